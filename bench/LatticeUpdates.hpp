@@ -0,0 +1,87 @@
+#ifndef BENCH_LATTICE_UPDATES_HPP
+#define BENCH_LATTICE_UPDATES_HPP
+
+/**
+ * @file LatticeUpdates.hpp
+ * @brief Common lattice setup and throughput counters for benchmarks of lattice kernels.
+ */
+
+#include "../src/lattice/Lattice.hpp"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+
+/**
+ * @brief Fills every population of a lattice with the weight of its lattice vector, which is the
+ * equilibrium of a fluid at rest with unit density.
+ *
+ * @param lattice A lattice with one span of node values per lattice vector, such as Lattice or
+ * SparseLattice, overwritten.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Populations The type of the lattice.
+ */
+template <const auto& Descriptor, typename Populations>
+auto fillRestState(Populations& lattice) -> void
+{
+    for (std::size_t i = 0; i < Descriptor.weights.size(); ++i)
+    {
+        const auto population{lattice.population(i)};
+        using Scalar = std::ranges::range_value_t<decltype(population)>;
+        std::ranges::fill(population, static_cast<Scalar>(Descriptor.weights[i]));
+    }
+}
+
+/**
+ * @brief Creates a lattice at rest with unit density, see fillRestState.
+ *
+ * @param extents The number of lattice nodes along each axis.
+ * @return A lattice whose populations are the weights of their lattice vectors.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto makeRestLattice(const std::array<std::size_t, Descriptor.velocities[0].size()>& extents)
+    -> Lattice<Descriptor.velocities[0].size(), Descriptor.velocities.size(), Scalar>
+{
+    Lattice<Descriptor.velocities[0].size(), Descriptor.velocities.size(), Scalar> lattice{
+        extents
+    };
+
+    fillRestState<Descriptor>(lattice);
+
+    return lattice;
+}
+
+/**
+ * @brief Reports the throughput of a benchmark that updates nodeCount lattice nodes per iteration.
+ *
+ * Besides items and bytes per second, the benchmark gets an MLUPS counter (million lattice updates
+ * per second) and a bytes/update counter with the memory traffic of a single node update, so
+ * JSON outputs of different commits can be compared with the tools shipped with Google Benchmark.
+ *
+ * @param state The state of the running benchmark.
+ * @param nodeCount The number of nodes updated per iteration.
+ * @param bytesPerUpdate The number of bytes read and written per node update.
+ */
+inline auto reportLatticeUpdates(
+    benchmark::State& state,
+    std::size_t nodeCount,
+    std::size_t bytesPerUpdate
+) -> void
+{
+    const auto updates{static_cast<std::int64_t>(state.iterations()) *
+                       static_cast<std::int64_t>(nodeCount)};
+
+    state.SetItemsProcessed(updates);
+    state.SetBytesProcessed(updates * static_cast<std::int64_t>(bytesPerUpdate));
+    state.counters["MLUPS"] =
+        benchmark::Counter(static_cast<double>(updates) * 1e-6, benchmark::Counter::kIsRate);
+    state.counters["bytes/update"] = benchmark::Counter(static_cast<double>(bytesPerUpdate));
+}
+
+#endif // BENCH_LATTICE_UPDATES_HPP
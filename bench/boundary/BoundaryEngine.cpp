@@ -0,0 +1,142 @@
+#include "../../src/boundary/BoundaryEngine.hpp"
+#include "../../src/collision/bgk.hpp"
+#include "../LatticeUpdates.hpp"
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t extent{512};
+
+/**
+ * Returns the mask of a channel with walls on its first and last rows and a square obstacle in
+ * its centre.
+ */
+auto makeMask() -> std::vector<bool>
+{
+    std::vector<bool> solid(extent * extent, false);
+
+    for (std::size_t y = 0; y < extent; ++y)
+    {
+        for (std::size_t x = 0; x < extent; ++x)
+        {
+            const bool wall{y == 0 || y == extent - 1};
+            const bool obstacle{x >= extent / 4 && x < extent / 4 + extent / 8 &&
+                                y >= 7 * extent / 16 && y < 9 * extent / 16};
+            solid[y * extent + x] = wall || obstacle;
+        }
+    }
+
+    return solid;
+}
+
+/**
+ * Reference boundary pass that scans the whole mask every time step and branches on the type of
+ * each neighbor, as a boundary condition without precomputed link lists would.
+ */
+template <std::floating_point Scalar>
+void BM_MaskScanBounceBackD2Q9(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    const std::vector<bool> solid{makeMask()};
+    const D2Q9<Scalar> model;
+    const auto velocities{latticeVelocities(model)};
+    const auto opposites{latticeOpposites(model)};
+    std::size_t completedSteps{0};
+
+    for (auto _ : state)
+    {
+        const bool odd{completedSteps++ % 2 == 1};
+        std::array<std::span<Scalar>, D2Q9_SIZE> populations;
+        for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+        {
+            populations[i] = lattice.population(i);
+        }
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            if (solid[node])
+            {
+                continue;
+            }
+            for (std::size_t i = 1; i < D2Q9_SIZE; ++i)
+            {
+                const std::size_t neighbor{
+                    periodicNeighbor(lattice.extents(), node, velocities[opposites[i]])
+                };
+                if (!solid[neighbor])
+                {
+                    continue;
+                }
+                if (odd)
+                {
+                    populations[opposites[i]][neighbor] = populations[i][node];
+                }
+                else
+                {
+                    populations[i][node] = populations[opposites[i]][neighbor];
+                }
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), sizeof(bool));
+}
+
+/**
+ * The same boundary pass through the precomputed link lists of a boundary engine.
+ */
+template <std::floating_point Scalar>
+void BM_BoundaryEngineBounceBackD2Q9(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    BoundaryEngine<D2Q9_DESCRIPTOR, Scalar> engine{lattice.extents(), makeMask()};
+    std::size_t completedSteps{0};
+
+    for (auto _ : state)
+    {
+        engine.apply(lattice, completedSteps++);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), sizeof(bool));
+}
+
+/**
+ * A complete channel time step: fused collision and streaming followed by bounce-back walls, a
+ * Zou/He velocity inlet and a Zou/He pressure outlet.
+ */
+template <std::floating_point Scalar>
+void BM_ChannelCollideStreamD2Q9(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    const std::vector<bool> solid{makeMask()};
+    BoundaryEngine<D2Q9_DESCRIPTOR, Scalar> engine{lattice.extents(), solid};
+    for (std::size_t y = 1; y + 1 < extent; ++y)
+    {
+        engine.addVelocityNode(y * extent, {0, 1}, {Scalar{0.05}, Scalar{0.0}});
+        engine.addPressureNode((y + 1) * extent - 1, {0, -1}, Scalar{1.0});
+    }
+    const Scalar relaxationFrequency{1.2};
+    std::size_t timeStep{0};
+
+    for (auto _ : state)
+    {
+        streamAA(lattice, timeStep, [&](std::array<Scalar, D2Q9_SIZE>& values) {
+            relaxBGK<D2Q9_DESCRIPTOR>(values, relaxationFrequency);
+        });
+        engine.apply(lattice, ++timeStep);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_MaskScanBounceBackD2Q9, float);
+BENCHMARK_TEMPLATE(BM_MaskScanBounceBackD2Q9, double);
+BENCHMARK_TEMPLATE(BM_BoundaryEngineBounceBackD2Q9, float);
+BENCHMARK_TEMPLATE(BM_BoundaryEngineBounceBackD2Q9, double);
+BENCHMARK_TEMPLATE(BM_ChannelCollideStreamD2Q9, float);
+BENCHMARK_TEMPLATE(BM_ChannelCollideStreamD2Q9, double);
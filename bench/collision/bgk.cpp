@@ -0,0 +1,76 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/densityDistribution/arithmetic.hpp"
+#include "../LatticeUpdates.hpp"
+
+namespace
+{
+
+constexpr std::size_t extent{256};
+
+/**
+ * Reference collision composed from the moment functions, latticeWeights and the arithmetic
+ * operators, with the equilibrium held in a temporary density distribution.
+ */
+template <std::floating_point Scalar>
+auto composedBGK(D2Q9<Scalar>& distribution, Scalar relaxationFrequency) -> void
+{
+    const Scalar density{computeDensity(distribution)};
+    const std::array<Scalar, 2> momentum{computeMomentum(distribution)};
+    const std::array<Scalar, 2> velocity{momentum[0] / density, momentum[1] / density};
+    const Scalar velocitySquared{velocity[0] * velocity[0] + velocity[1] * velocity[1]};
+    const auto weights{latticeWeights(distribution)};
+    const auto velocities{latticeVelocities(distribution)};
+
+    D2Q9<Scalar> equilibrium;
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        const Scalar projection{velocities[i][0] * velocity[0] + velocities[i][1] * velocity[1]};
+        equilibrium[i] = weights[i] * density *
+                         (1 + 3 * projection + Scalar{4.5} * projection * projection -
+                          Scalar{1.5} * velocitySquared);
+    }
+
+    distribution = distribution + (equilibrium - distribution) * relaxationFrequency;
+}
+
+template <std::floating_point Scalar>
+void BM_ComposedBGKD2Q9(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    const Scalar relaxationFrequency{1.2};
+
+    for (auto _ : state)
+    {
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            D2Q9<Scalar> distribution{lattice.node(node)};
+            composedBGK(distribution, relaxationFrequency);
+            lattice.setNode(node, distribution);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+template <std::floating_point Scalar>
+void BM_FusedBGKD2Q9(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    const Scalar relaxationFrequency{1.2};
+
+    for (auto _ : state)
+    {
+        collideBGK(lattice, relaxationFrequency);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_ComposedBGKD2Q9, float);
+BENCHMARK_TEMPLATE(BM_ComposedBGKD2Q9, double);
+BENCHMARK_TEMPLATE(BM_FusedBGKD2Q9, float);
+BENCHMARK_TEMPLATE(BM_FusedBGKD2Q9, double);
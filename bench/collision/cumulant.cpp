@@ -0,0 +1,27 @@
+#include "../../src/collision/cumulant.hpp"
+#include "../LatticeUpdates.hpp"
+
+namespace
+{
+
+constexpr std::size_t extent{256};
+
+template <std::floating_point Scalar>
+void BM_CumulantD2Q9(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    const RelaxationRates<Scalar> rates{1.2, 1.1, 1.0};
+
+    for (auto _ : state)
+    {
+        collideCumulant(lattice, rates);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_CumulantD2Q9, float);
+BENCHMARK_TEMPLATE(BM_CumulantD2Q9, double);
@@ -0,0 +1,62 @@
+#include "../../src/collision/mrt.hpp"
+#include "../LatticeUpdates.hpp"
+
+namespace
+{
+
+constexpr std::size_t extent{256};
+constexpr std::size_t depth{16};
+
+template <std::floating_point Scalar>
+void BM_MRTD2Q9(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    const RelaxationRates<Scalar> rates{1.2, 1.1, 1.0};
+
+    for (auto _ : state)
+    {
+        collideMRT(lattice, rates);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+template <std::floating_point Scalar>
+void BM_BGKD3Q19(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D3Q19_DESCRIPTOR, Scalar>({extent, extent, depth})};
+    const Scalar relaxationFrequency{1.2};
+
+    for (auto _ : state)
+    {
+        relaxBGK<D3Q19_DESCRIPTOR>(lattice, relaxationFrequency);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), 2 * D3Q19_SIZE * sizeof(Scalar));
+}
+
+template <std::floating_point Scalar>
+void BM_MRTD3Q19(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D3Q19_DESCRIPTOR, Scalar>({extent, extent, depth})};
+    const RelaxationRates<Scalar> rates{1.2, 1.1, 1.0};
+
+    for (auto _ : state)
+    {
+        collideMRT(lattice, rates);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), 2 * D3Q19_SIZE * sizeof(Scalar));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_MRTD2Q9, float);
+BENCHMARK_TEMPLATE(BM_MRTD2Q9, double);
+BENCHMARK_TEMPLATE(BM_BGKD3Q19, float);
+BENCHMARK_TEMPLATE(BM_BGKD3Q19, double);
+BENCHMARK_TEMPLATE(BM_MRTD3Q19, float);
+BENCHMARK_TEMPLATE(BM_MRTD3Q19, double);
@@ -0,0 +1,239 @@
+#include "../../src/densityDistribution/arithmetic.hpp"
+#include "../../src/densityDistribution/d2q5.hpp"
+#include "../../src/densityDistribution/d2q9.hpp"
+#include "../LatticeUpdates.hpp"
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t nodeCount{4096};
+
+/**
+ * Reference for the access cost before unchecked subscripts: every element goes through
+ * std::array::at, as DensityDistribution::operator[] did unconditionally.
+ */
+template <typename Scalar>
+void BM_CheckedSubscriptDensity(benchmark::State& state)
+{
+    std::vector<std::array<Scalar, D2Q9_SIZE>> nodes(nodeCount);
+    for (auto& node : nodes)
+    {
+        node.fill(Scalar{1.0});
+    }
+
+    for (auto _ : state)
+    {
+        Scalar density{0.0};
+        for (const auto& node : nodes)
+        {
+            for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+            {
+                density += node.at(i);
+            }
+        }
+        benchmark::DoNotOptimize(density);
+    }
+
+    reportLatticeUpdates(state, nodeCount, D2Q9_SIZE * sizeof(Scalar));
+}
+
+template <typename Scalar>
+void BM_SubscriptDensity(benchmark::State& state)
+{
+    std::vector<D2Q9<Scalar>> nodes(nodeCount, D2Q9<Scalar>{1, 1, 1, 1, 1, 1, 1, 1, 1});
+
+    for (auto _ : state)
+    {
+        Scalar density{0.0};
+        for (const auto& node : nodes)
+        {
+            for (std::size_t i = 0; i < node.size(); ++i)
+            {
+                density += node[i];
+            }
+        }
+        benchmark::DoNotOptimize(density);
+    }
+
+    reportLatticeUpdates(state, nodeCount, D2Q9_SIZE * sizeof(Scalar));
+}
+
+template <typename Scalar>
+void BM_GetDensity(benchmark::State& state)
+{
+    std::vector<D2Q9<Scalar>> nodes(nodeCount, D2Q9<Scalar>{1, 1, 1, 1, 1, 1, 1, 1, 1});
+
+    for (auto _ : state)
+    {
+        Scalar density{0.0};
+        for (const auto& node : nodes)
+        {
+            density += computeDensity(node);
+        }
+        benchmark::DoNotOptimize(density);
+    }
+
+    reportLatticeUpdates(state, nodeCount, D2Q9_SIZE * sizeof(Scalar));
+}
+
+/**
+ * The scalar type of the values in a density distribution.
+ */
+template <typename Distribution>
+using ScalarOf = std::remove_cvref_t<decltype(std::declval<Distribution&>()[0])>;
+
+/**
+ * Adds a single node and square grids of 64 x 64 and 512 x 512 nodes, so per-call overhead,
+ * cache-resident batches and memory-bound batches are measured separately.
+ */
+void nodeCounts(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->Arg(1)->Arg(64 * 64)->Arg(512 * 512);
+}
+
+template <typename Distribution>
+auto makeNodes(std::size_t count) -> std::vector<Distribution>
+{
+    std::vector<Distribution> nodes(count);
+    for (std::size_t node = 0; node < count; ++node)
+    {
+        for (std::size_t i = 0; i < nodes[node].size(); ++i)
+        {
+            nodes[node][i] = static_cast<ScalarOf<Distribution>>(1 + (node + i) % 7);
+        }
+    }
+    return nodes;
+}
+
+/**
+ * Constructs a density distribution per node and fills it through the subscript operator.
+ */
+template <typename Distribution>
+void BM_ConstructAndAccess(benchmark::State& state)
+{
+    const auto count{static_cast<std::size_t>(state.range(0))};
+    const auto nodes{makeNodes<Distribution>(count)};
+    std::vector<Distribution> copies(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t node = 0; node < count; ++node)
+        {
+            Distribution distribution;
+            for (std::size_t i = 0; i < distribution.size(); ++i)
+            {
+                distribution[i] = nodes[node][i];
+            }
+            copies[node] = distribution;
+        }
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, count, 2 * sizeof(Distribution));
+}
+
+template <typename Distribution>
+void BM_Sum(benchmark::State& state)
+{
+    const auto count{static_cast<std::size_t>(state.range(0))};
+    const auto lhs{makeNodes<Distribution>(count)};
+    const auto rhs{makeNodes<Distribution>(count)};
+    std::vector<Distribution> result(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t node = 0; node < count; ++node)
+        {
+            result[node] = lhs[node] + rhs[node];
+        }
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, count, 3 * sizeof(Distribution));
+}
+
+template <typename Distribution>
+void BM_Difference(benchmark::State& state)
+{
+    const auto count{static_cast<std::size_t>(state.range(0))};
+    const auto lhs{makeNodes<Distribution>(count)};
+    const auto rhs{makeNodes<Distribution>(count)};
+    std::vector<Distribution> result(count);
+
+    for (auto _ : state)
+    {
+        for (std::size_t node = 0; node < count; ++node)
+        {
+            result[node] = lhs[node] - rhs[node];
+        }
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, count, 3 * sizeof(Distribution));
+}
+
+template <typename Distribution>
+void BM_ComputeDensity(benchmark::State& state)
+{
+    const auto count{static_cast<std::size_t>(state.range(0))};
+    const auto nodes{makeNodes<Distribution>(count)};
+
+    for (auto _ : state)
+    {
+        for (const auto& node : nodes)
+        {
+            benchmark::DoNotOptimize(computeDensity(node));
+        }
+    }
+
+    reportLatticeUpdates(state, count, sizeof(Distribution));
+}
+
+template <typename Distribution>
+void BM_ComputeMomentum(benchmark::State& state)
+{
+    const auto count{static_cast<std::size_t>(state.range(0))};
+    const auto nodes{makeNodes<Distribution>(count)};
+
+    for (auto _ : state)
+    {
+        for (const auto& node : nodes)
+        {
+            benchmark::DoNotOptimize(computeMomentum(node));
+        }
+    }
+
+    reportLatticeUpdates(state, count, sizeof(Distribution));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_CheckedSubscriptDensity, float);
+BENCHMARK_TEMPLATE(BM_CheckedSubscriptDensity, double);
+BENCHMARK_TEMPLATE(BM_SubscriptDensity, float);
+BENCHMARK_TEMPLATE(BM_SubscriptDensity, double);
+BENCHMARK_TEMPLATE(BM_GetDensity, float);
+BENCHMARK_TEMPLATE(BM_GetDensity, double);
+BENCHMARK_TEMPLATE(BM_ConstructAndAccess, D2Q5<float>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_ConstructAndAccess, D2Q5<double>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_ConstructAndAccess, D2Q9<float>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_ConstructAndAccess, D2Q9<double>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_Sum, D2Q5<float>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_Sum, D2Q5<double>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_Sum, D2Q9<float>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_Sum, D2Q9<double>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_Difference, D2Q5<float>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_Difference, D2Q5<double>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_Difference, D2Q9<float>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_Difference, D2Q9<double>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_ComputeDensity, D2Q5<float>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_ComputeDensity, D2Q5<double>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_ComputeDensity, D2Q9<float>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_ComputeDensity, D2Q9<double>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_ComputeMomentum, D2Q5<float>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_ComputeMomentum, D2Q5<double>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_ComputeMomentum, D2Q9<float>)->Apply(nodeCounts);
+BENCHMARK_TEMPLATE(BM_ComputeMomentum, D2Q9<double>)->Apply(nodeCounts);
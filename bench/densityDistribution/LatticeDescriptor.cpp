@@ -0,0 +1,165 @@
+#include "../../src/densityDistribution/d2q5.hpp"
+#include "../../src/densityDistribution/d2q9.hpp"
+#include "../LatticeUpdates.hpp"
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t nodeCount{4096};
+
+/**
+ * Hand-unrolled D2Q5 moments as written before the lattice descriptor existed.
+ */
+template <typename Scalar>
+auto handWrittenMoments(const D2Q5<Scalar>& f) -> std::array<Scalar, 3>
+{
+    return {f.template get<0>() + f.template get<1>() + f.template get<2>() + f.template get<3>() +
+                f.template get<4>(),
+            f.template get<1>() - f.template get<2>(),
+            f.template get<3>() - f.template get<4>()};
+}
+
+/**
+ * Hand-unrolled D2Q9 moments as written before the lattice descriptor existed.
+ */
+template <typename Scalar>
+auto handWrittenMoments(const D2Q9<Scalar>& f) -> std::array<Scalar, 3>
+{
+    return {f.template get<0>() + f.template get<1>() + f.template get<2>() + f.template get<3>() +
+                f.template get<4>() + f.template get<5>() + f.template get<6>() +
+                f.template get<7>() + f.template get<8>(),
+            (f.template get<1>() + f.template get<5>() + f.template get<8>()) -
+                (f.template get<3>() + f.template get<6>() + f.template get<7>()),
+            (f.template get<2>() + f.template get<5>() + f.template get<6>()) -
+                (f.template get<4>() + f.template get<7>() + f.template get<8>())};
+}
+
+/**
+ * Moments generated from the lattice descriptor, returned in the same form as the reference.
+ */
+template <typename Distribution>
+auto descriptorMoments(const Distribution& f)
+{
+    const auto momentum{computeMomentum(f)};
+    return std::array{computeDensity(f), momentum[0], momentum[1]};
+}
+
+template <typename Distribution>
+auto makeNodes() -> std::vector<Distribution>
+{
+    std::vector<Distribution> nodes(nodeCount);
+    for (std::size_t node = 0; node < nodeCount; ++node)
+    {
+        for (std::size_t i = 0; i < nodes[node].size(); ++i)
+        {
+            nodes[node][i] = static_cast<std::remove_cvref_t<decltype(nodes[node][i])>>(
+                1 + (node + i) % 7
+            );
+        }
+    }
+    return nodes;
+}
+
+template <typename Distribution>
+void BM_HandWrittenMoments(benchmark::State& state)
+{
+    const auto nodes{makeNodes<Distribution>()};
+
+    for (auto _ : state)
+    {
+        for (const auto& node : nodes)
+        {
+            benchmark::DoNotOptimize(handWrittenMoments(node));
+        }
+    }
+
+    reportLatticeUpdates(state, nodeCount, sizeof(Distribution));
+}
+
+template <typename Distribution>
+void BM_DescriptorMoments(benchmark::State& state)
+{
+    const auto nodes{makeNodes<Distribution>()};
+
+    for (auto _ : state)
+    {
+        for (const auto& node : nodes)
+        {
+            benchmark::DoNotOptimize(descriptorMoments(node));
+        }
+    }
+
+    reportLatticeUpdates(state, nodeCount, sizeof(Distribution));
+}
+
+/**
+ * Equilibrium evaluated with run-time loops over the weight and velocity tables, as in the node
+ * kernel of the fused BGK collision.
+ */
+template <typename Scalar>
+void BM_LoopEquilibriumD2Q9(benchmark::State& state)
+{
+    const auto nodes{makeNodes<D2Q9<Scalar>>()};
+    const D2Q9<Scalar> model;
+    const auto velocities{latticeVelocities(model)};
+    const auto weights{latticeWeights(model)};
+
+    for (auto _ : state)
+    {
+        for (const auto& node : nodes)
+        {
+            const Scalar density{computeDensity(node)};
+            std::array<Scalar, D2Q9_DIMENSION> velocity{computeMomentum(node)};
+            velocity[0] /= density;
+            velocity[1] /= density;
+            const Scalar velocitySquared{velocity[0] * velocity[0] + velocity[1] * velocity[1]};
+
+            D2Q9<Scalar> equilibrium;
+            for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+            {
+                const Scalar projection{static_cast<Scalar>(velocities[i][0]) * velocity[0] +
+                                        static_cast<Scalar>(velocities[i][1]) * velocity[1]};
+                equilibrium[i] = weights[i] * density *
+                                 (Scalar{1.0} + Scalar{3.0} * projection +
+                                  Scalar{4.5} * projection * projection -
+                                  Scalar{1.5} * velocitySquared);
+            }
+            benchmark::DoNotOptimize(equilibrium);
+        }
+    }
+
+    reportLatticeUpdates(state, nodeCount, 2 * sizeof(D2Q9<Scalar>));
+}
+
+template <typename Scalar>
+void BM_DescriptorEquilibriumD2Q9(benchmark::State& state)
+{
+    const auto nodes{makeNodes<D2Q9<Scalar>>()};
+
+    for (auto _ : state)
+    {
+        for (const auto& node : nodes)
+        {
+            benchmark::DoNotOptimize(computeEquilibrium(node));
+        }
+    }
+
+    reportLatticeUpdates(state, nodeCount, 2 * sizeof(D2Q9<Scalar>));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_HandWrittenMoments, D2Q5<float>);
+BENCHMARK_TEMPLATE(BM_HandWrittenMoments, D2Q5<double>);
+BENCHMARK_TEMPLATE(BM_HandWrittenMoments, D2Q9<float>);
+BENCHMARK_TEMPLATE(BM_HandWrittenMoments, D2Q9<double>);
+BENCHMARK_TEMPLATE(BM_DescriptorMoments, D2Q5<float>);
+BENCHMARK_TEMPLATE(BM_DescriptorMoments, D2Q5<double>);
+BENCHMARK_TEMPLATE(BM_DescriptorMoments, D2Q9<float>);
+BENCHMARK_TEMPLATE(BM_DescriptorMoments, D2Q9<double>);
+BENCHMARK_TEMPLATE(BM_LoopEquilibriumD2Q9, float);
+BENCHMARK_TEMPLATE(BM_LoopEquilibriumD2Q9, double);
+BENCHMARK_TEMPLATE(BM_DescriptorEquilibriumD2Q9, float);
+BENCHMARK_TEMPLATE(BM_DescriptorEquilibriumD2Q9, double);
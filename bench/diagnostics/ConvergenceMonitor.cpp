@@ -0,0 +1,44 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/diagnostics/ConvergenceMonitor.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include "../LatticeUpdates.hpp"
+#include <algorithm>
+
+namespace
+{
+
+constexpr std::size_t extent{1024};
+
+/**
+ * AA time steps with a convergence check every state.range(0) steps, or none for a range of zero.
+ * Check intervals are even so that every check reads the natural layout.
+ */
+template <std::floating_point Scalar>
+void BM_MonitoredCollideStreamD2Q9(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    const auto checkInterval{static_cast<std::size_t>(state.range(0))};
+    ConvergenceMonitor<D2Q9_DESCRIPTOR, Scalar> monitor{
+        lattice.extents(), Scalar{0.0}, std::max<std::size_t>(checkInterval, 1)
+    };
+    std::size_t timeStep{0};
+
+    for (auto _ : state)
+    {
+        streamAA(lattice, timeStep++, [&](std::array<Scalar, D2Q9_SIZE>& values) {
+            relaxBGK<D2Q9_DESCRIPTOR>(values, Scalar{1.2});
+        });
+        if (checkInterval != 0)
+        {
+            benchmark::DoNotOptimize(monitor.update(lattice, timeStep));
+        }
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_MonitoredCollideStreamD2Q9, float)->Arg(0)->Arg(2)->Arg(10)->Arg(100);
+BENCHMARK_TEMPLATE(BM_MonitoredCollideStreamD2Q9, double)->Arg(0)->Arg(2)->Arg(10)->Arg(100);
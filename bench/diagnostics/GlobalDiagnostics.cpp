@@ -0,0 +1,114 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/diagnostics/GlobalDiagnostics.hpp"
+#include "../LatticeUpdates.hpp"
+#include <algorithm>
+
+namespace
+{
+
+constexpr std::size_t extent{1024};
+
+template <std::floating_point Scalar>
+struct Problem
+{
+    Problem()
+        : extents{extent, extent},
+          scheduler{
+              extents,
+              defaultTileExtents<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>(extents),
+              std::max<std::size_t>(std::thread::hardware_concurrency(), 1)
+          },
+          lattice{extents, [&](const auto& zero) { scheduler.firstTouch(zero); }}
+    {
+        fillRestState<D2Q9_DESCRIPTOR>(lattice);
+    }
+
+    auto collision() const
+    {
+        return [&](std::array<Scalar, D2Q9_SIZE>& values) {
+            relaxBGK<D2Q9_DESCRIPTOR>(values, Scalar{1.2});
+        };
+    }
+
+    std::array<std::size_t, D2Q9_DIMENSION> extents;
+    TiledScheduler<D2Q9_DIMENSION> scheduler;
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar> lattice;
+};
+
+/**
+ * Reference time step without diagnostics.
+ */
+template <std::floating_point Scalar>
+void BM_CollideStreamD2Q9(benchmark::State& state)
+{
+    Problem<Scalar> problem;
+    std::size_t timeStep{0};
+
+    for (auto _ : state)
+    {
+        streamAA(problem.lattice, timeStep++, problem.collision(), problem.scheduler);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, problem.lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+/**
+ * Time step pairs with the diagnostics reduced in a separate sweep before every pair.
+ */
+template <std::floating_point Scalar>
+void BM_CollideStreamThenReduceD2Q9(benchmark::State& state)
+{
+    Problem<Scalar> problem;
+    DiagnosticsReducer<D2Q9_DESCRIPTOR, Scalar> reducer{problem.scheduler};
+    std::size_t timeStep{0};
+
+    for (auto _ : state)
+    {
+        if (timeStep % 2 == 0)
+        {
+            benchmark::DoNotOptimize(reducer.reduce(problem.lattice, problem.scheduler));
+        }
+        streamAA(problem.lattice, timeStep++, problem.collision(), problem.scheduler);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, problem.lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+/**
+ * Time step pairs with the diagnostics reduced in the sweep of the first step of every pair.
+ */
+template <std::floating_point Scalar>
+void BM_FusedCollideStreamReduceD2Q9(benchmark::State& state)
+{
+    Problem<Scalar> problem;
+    DiagnosticsReducer<D2Q9_DESCRIPTOR, Scalar> reducer{problem.scheduler};
+    std::size_t timeStep{0};
+
+    for (auto _ : state)
+    {
+        if (timeStep % 2 == 0)
+        {
+            benchmark::DoNotOptimize(reducer.streamAA(
+                problem.lattice, timeStep++, problem.collision(), problem.scheduler
+            ));
+        }
+        else
+        {
+            streamAA(problem.lattice, timeStep++, problem.collision(), problem.scheduler);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, problem.lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_CollideStreamD2Q9, float)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CollideStreamD2Q9, double)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CollideStreamThenReduceD2Q9, float)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CollideStreamThenReduceD2Q9, double)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_FusedCollideStreamReduceD2Q9, float)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_FusedCollideStreamReduceD2Q9, double)->UseRealTime();
@@ -0,0 +1,76 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/io/AsyncFieldWriter.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include "../LatticeUpdates.hpp"
+
+namespace
+{
+
+constexpr std::size_t extent{512};
+constexpr std::size_t stepsPerIteration{100};
+
+/**
+ * Runs fused AA steps of a D2Q9 lattice and writes the fields every state.range(0) steps, or
+ * never if it is zero, reporting the mean time the solver waited per output.
+ */
+template <std::floating_point Scalar>
+void BM_AACollideStreamWithOutputD2Q9(benchmark::State& state)
+{
+    const auto outputInterval{static_cast<std::size_t>(state.range(0))};
+    const std::array<std::size_t, D2Q9_DIMENSION> extents{extent, extent};
+    const auto directory{std::filesystem::temp_directory_path() / "LatticeFlowBenchFields"};
+    std::filesystem::create_directories(directory);
+
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>(extents)};
+    const D2Q9<Scalar> model;
+    const auto velocities{latticeVelocities(model)};
+    const auto opposites{latticeOpposites(model)};
+    const Scalar relaxationFrequency{1.2};
+
+    std::size_t timeStep{0};
+    {
+        AsyncFieldWriter<D2Q9_DIMENSION, D2Q9_SIZE, Scalar> writer{extents, velocities, directory};
+
+        for (auto _ : state)
+        {
+            for (std::size_t step = 0; step < stepsPerIteration; ++step, ++timeStep)
+            {
+                if (outputInterval != 0 && timeStep % outputInterval == 0)
+                {
+                    writer.snapshot(lattice, timeStep);
+                }
+                streamAA(
+                    lattice,
+                    velocities,
+                    opposites,
+                    timeStep,
+                    [&](std::array<Scalar, D2Q9_SIZE>& values) {
+                        relaxBGK<D2Q9_DESCRIPTOR>(values, relaxationFrequency);
+                    }
+                );
+            }
+        }
+        writer.flush();
+
+        std::chrono::nanoseconds totalStall{0};
+        for (const std::chrono::nanoseconds stall : writer.stalls())
+        {
+            totalStall += stall;
+        }
+        const auto outputs{std::max(writer.stalls().size(), std::size_t{1})};
+        state.counters["stall/output"] = benchmark::Counter(
+            std::chrono::duration<double>(totalStall).count() / static_cast<double>(outputs)
+        );
+        state.counters["outputs"] = benchmark::Counter(static_cast<double>(writer.stalls().size()));
+    }
+
+    std::filesystem::remove_all(directory);
+    reportLatticeUpdates(
+        state, stepsPerIteration * lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar)
+    );
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_AACollideStreamWithOutputD2Q9, float)->Arg(0)->Arg(100);
+BENCHMARK_TEMPLATE(BM_AACollideStreamWithOutputD2Q9, double)->Arg(0)->Arg(100);
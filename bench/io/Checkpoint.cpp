@@ -0,0 +1,56 @@
+#include "../../src/densityDistribution/d2q9.hpp"
+#include "../../src/io/Checkpoint.hpp"
+#include "../LatticeUpdates.hpp"
+
+namespace
+{
+
+constexpr std::size_t extent{1024};
+
+/**
+ * Returns the path of the checkpoint file written by the benchmarks.
+ */
+auto benchmarkCheckpointPath() -> std::filesystem::path
+{
+    return std::filesystem::temp_directory_path() / "LatticeFlowBench.checkpoint";
+}
+
+template <std::floating_point Scalar>
+void BM_WriteCheckpointD2Q9(benchmark::State& state)
+{
+    const auto path{benchmarkCheckpointPath()};
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar> lattice{{extent, extent}};
+
+    for (auto _ : state)
+    {
+        writeCheckpoint(lattice, path, 0);
+    }
+
+    std::filesystem::remove(path);
+    reportLatticeUpdates(state, lattice.nodeCount(), D2Q9_SIZE * sizeof(Scalar));
+}
+
+template <std::floating_point Scalar>
+void BM_RestoreCheckpointD2Q9(benchmark::State& state)
+{
+    const auto path{benchmarkCheckpointPath()};
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar> lattice{{extent, extent}};
+    writeCheckpoint(lattice, path, 0);
+
+    for (auto _ : state)
+    {
+        const MappedCheckpoint<D2Q9_DIMENSION, D2Q9_SIZE, Scalar> checkpoint{path};
+        checkpoint.restore(lattice);
+        benchmark::ClobberMemory();
+    }
+
+    std::filesystem::remove(path);
+    reportLatticeUpdates(state, lattice.nodeCount(), D2Q9_SIZE * sizeof(Scalar));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_WriteCheckpointD2Q9, float);
+BENCHMARK_TEMPLATE(BM_WriteCheckpointD2Q9, double);
+BENCHMARK_TEMPLATE(BM_RestoreCheckpointD2Q9, float);
+BENCHMARK_TEMPLATE(BM_RestoreCheckpointD2Q9, double);
@@ -0,0 +1,96 @@
+#include "../../src/densityDistribution/d2q9.hpp"
+#include "../../src/lattice/Arena.hpp"
+#include "../../src/lattice/Lattice.hpp"
+#include "../LatticeUpdates.hpp"
+#include <fstream>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+constexpr std::size_t blockExtent{64};
+constexpr std::size_t blockCount{256};
+
+/**
+ * Returns the number of minor page faults of the process so far, or zero where unsupported.
+ */
+auto minorPageFaults() -> double
+{
+#ifdef __linux__
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_minflt);
+#else
+    return 0.0;
+#endif
+}
+
+/**
+ * Returns the resident set size of the process in bytes, or zero where unsupported.
+ */
+auto residentSetSize() -> double
+{
+#ifdef __linux__
+    std::ifstream statm{"/proc/self/statm"};
+    std::size_t pages{0};
+    std::size_t residentPages{0};
+    statm >> pages >> residentPages;
+    return static_cast<double>(residentPages) * static_cast<double>(sysconf(_SC_PAGESIZE));
+#else
+    return 0.0;
+#endif
+}
+
+/**
+ * Builds and tears down the blocks of a domain, as a refinement or restart does, with population
+ * storage from the heap or from an arena that is reset between rebuilds.
+ */
+template <std::floating_point Scalar, bool UseArena>
+void BM_RebuildLatticeBlocksD2Q9(benchmark::State& state)
+{
+    using Block = Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>;
+
+    Arena arena;
+    std::pmr::memory_resource* resource{UseArena ? &arena : nullptr};
+    std::vector<Block> blocks;
+    blocks.reserve(blockCount);
+    double residentBytes{0.0};
+
+    const double faultsBefore{minorPageFaults()};
+    for (auto _ : state)
+    {
+        blocks.clear();
+        if constexpr (UseArena)
+        {
+            arena.reset();
+        }
+        for (std::size_t block = 0; block < blockCount; ++block)
+        {
+            blocks.emplace_back(
+                std::array<std::size_t, D2Q9_DIMENSION>{blockExtent, blockExtent}, resource
+            );
+        }
+        benchmark::DoNotOptimize(blocks.back().population(0).data());
+        residentBytes = residentSetSize();
+    }
+    const double faults{minorPageFaults() - faultsBefore};
+
+    state.counters["pageFaults"] =
+        benchmark::Counter(faults / static_cast<double>(state.iterations()));
+    state.counters["RSS"] = benchmark::Counter(
+        residentBytes, benchmark::Counter::kDefaults, benchmark::Counter::kIs1024
+    );
+    reportLatticeUpdates(state, blockCount * blockExtent * blockExtent, D2Q9_SIZE * sizeof(Scalar));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_RebuildLatticeBlocksD2Q9, float, false);
+BENCHMARK_TEMPLATE(BM_RebuildLatticeBlocksD2Q9, float, true);
+BENCHMARK_TEMPLATE(BM_RebuildLatticeBlocksD2Q9, double, false);
+BENCHMARK_TEMPLATE(BM_RebuildLatticeBlocksD2Q9, double, true);
@@ -0,0 +1,121 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/lattice/MixedPrecisionLattice.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include "../LatticeUpdates.hpp"
+
+namespace
+{
+
+// Large enough that the populations of every storage format exceed the last-level cache.
+constexpr std::size_t extent{2048};
+
+/**
+ * Reference time step on a lattice that stores populations in the compute precision.
+ */
+template <std::floating_point Scalar>
+void BM_FullPrecisionAACollideStreamD2Q9(benchmark::State& state)
+{
+    const D2Q9<Scalar> model;
+    const auto velocities{latticeVelocities(model)};
+    const auto opposites{latticeOpposites(model)};
+    const Scalar relaxationFrequency{1.2};
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    std::size_t timeStep{0};
+
+    for (auto _ : state)
+    {
+        streamAA(
+            lattice,
+            velocities,
+            opposites,
+            timeStep++,
+            [&](std::array<Scalar, D2Q9_SIZE>& values) {
+                relaxBGK<D2Q9_DESCRIPTOR>(values, relaxationFrequency);
+            }
+        );
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+template <std::floating_point Scalar, StorageFormat Format>
+void BM_MixedPrecisionAACollideStreamD2Q9(benchmark::State& state)
+{
+    const D2Q9<Scalar> model;
+    const auto velocities{latticeVelocities(model)};
+    const auto opposites{latticeOpposites(model)};
+    const auto weights{latticeWeights(model)};
+    const Scalar relaxationFrequency{1.2};
+    MixedPrecisionLattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar, Format> lattice{
+        {extent, extent}, weights
+    };
+    std::size_t timeStep{0};
+
+    for (auto _ : state)
+    {
+        streamAA(
+            lattice,
+            velocities,
+            opposites,
+            timeStep++,
+            [&](std::array<Scalar, D2Q9_SIZE>& values) {
+                relaxBGK<D2Q9_DESCRIPTOR>(values, relaxationFrequency);
+            }
+        );
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(
+        state, lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(typename Format::Stored)
+    );
+}
+
+template <std::floating_point Scalar>
+void BM_FullPrecisionBGKD2Q9(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    const Scalar relaxationFrequency{1.2};
+
+    for (auto _ : state)
+    {
+        collideBGK(lattice, relaxationFrequency);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+template <std::floating_point Scalar, StorageFormat Format>
+void BM_MixedPrecisionBGKD2Q9(benchmark::State& state)
+{
+    MixedPrecisionLattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar, Format> lattice{
+        {extent, extent}, latticeWeights(D2Q9<Scalar>{})
+    };
+    const Scalar relaxationFrequency{1.2};
+
+    for (auto _ : state)
+    {
+        collideBGK(lattice, relaxationFrequency);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(
+        state, lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(typename Format::Stored)
+    );
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_FullPrecisionAACollideStreamD2Q9, float);
+BENCHMARK_TEMPLATE(BM_FullPrecisionAACollideStreamD2Q9, double);
+BENCHMARK_TEMPLATE(BM_MixedPrecisionAACollideStreamD2Q9, float, Float16Storage);
+BENCHMARK_TEMPLATE(BM_MixedPrecisionAACollideStreamD2Q9, float, ShiftedFloat16Storage);
+BENCHMARK_TEMPLATE(BM_MixedPrecisionAACollideStreamD2Q9, float, BFloat16Storage);
+BENCHMARK_TEMPLATE(BM_MixedPrecisionAACollideStreamD2Q9, double, ShiftedFloat32Storage);
+BENCHMARK_TEMPLATE(BM_FullPrecisionBGKD2Q9, float);
+BENCHMARK_TEMPLATE(BM_FullPrecisionBGKD2Q9, double);
+BENCHMARK_TEMPLATE(BM_MixedPrecisionBGKD2Q9, float, Float16Storage);
+BENCHMARK_TEMPLATE(BM_MixedPrecisionBGKD2Q9, float, ShiftedFloat16Storage);
+BENCHMARK_TEMPLATE(BM_MixedPrecisionBGKD2Q9, float, BFloat16Storage);
+BENCHMARK_TEMPLATE(BM_MixedPrecisionBGKD2Q9, double, ShiftedFloat32Storage);
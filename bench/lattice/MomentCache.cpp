@@ -0,0 +1,68 @@
+#include "../../src/lattice/MomentCache.hpp"
+#include "../LatticeUpdates.hpp"
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t extent{1024};
+
+/**
+ * Reference time step in which one reader needs densities, one needs momenta and the output needs
+ * both, each with its own batched pass over the populations.
+ */
+template <std::floating_point Scalar>
+void BM_RepeatedMomentsD2Q9(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    std::vector<Scalar> density(lattice.nodeCount());
+    std::vector<Scalar> momentumX(lattice.nodeCount());
+    std::vector<Scalar> momentumY(lattice.nodeCount());
+    const std::array<std::span<Scalar>, D2Q9_DIMENSION> momenta{momentumX, momentumY};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lattice.population(0).data());
+        computeDensity(lattice, std::span<Scalar>{density});
+        computeMomentum(lattice, momenta);
+        computeMoments(lattice, std::span<Scalar>{density}, momenta);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(
+        state, lattice.nodeCount(), (D2Q9_SIZE + 1 + D2Q9_DIMENSION) * sizeof(Scalar)
+    );
+}
+
+/**
+ * The same consumers reading from a moment cache, which makes one fused pass per time step.
+ */
+template <std::floating_point Scalar>
+void BM_CachedMomentsD2Q9(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    MomentCache<D2Q9_DIMENSION, D2Q9_SIZE, Scalar> cache{
+        lattice, latticeVelocities(D2Q9<Scalar>{})
+    };
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lattice.population(0).data());
+        benchmark::DoNotOptimize(cache.densities().data());
+        benchmark::DoNotOptimize(cache.momenta()[0].data());
+        benchmark::DoNotOptimize(cache.densities().data());
+        benchmark::DoNotOptimize(cache.momenta()[1].data());
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(
+        state, lattice.nodeCount(), (D2Q9_SIZE + 1 + D2Q9_DIMENSION) * sizeof(Scalar)
+    );
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_RepeatedMomentsD2Q9, float);
+BENCHMARK_TEMPLATE(BM_RepeatedMomentsD2Q9, double);
+BENCHMARK_TEMPLATE(BM_CachedMomentsD2Q9, float);
+BENCHMARK_TEMPLATE(BM_CachedMomentsD2Q9, double);
@@ -0,0 +1,56 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/lattice/SparseLattice.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include "../LatticeUpdates.hpp"
+#include <random>
+
+namespace
+{
+
+constexpr std::size_t extent{2048};
+
+/**
+ * Collides and streams the fluid nodes of a porous medium whose solid fraction in percent is the
+ * benchmark argument. Updates are counted per fluid node, and bytes include the stream-slot entries
+ * that odd time steps read.
+ */
+template <std::floating_point Scalar>
+void BM_SparseAACollideStreamD2Q9(benchmark::State& state)
+{
+    const D2Q9<Scalar> model;
+    const auto velocities{latticeVelocities(model)};
+    const Scalar relaxationFrequency{1.2};
+    std::mt19937 generator{42};
+    std::bernoulli_distribution solid{static_cast<double>(state.range(0)) / 100.0};
+    std::vector<bool> fluid(extent * extent);
+    for (std::size_t node = 0; node < fluid.size(); ++node)
+    {
+        fluid[node] = !solid(generator);
+    }
+    SparseLattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar> lattice{
+        {extent, extent}, velocities, latticeOpposites(model), fluid
+    };
+    std::size_t timeStep{0};
+
+    fillRestState<D2Q9_DESCRIPTOR>(lattice);
+
+    for (auto _ : state)
+    {
+        streamAA(lattice, timeStep++, [&](std::array<Scalar, D2Q9_SIZE>& values) {
+            relaxBGK<D2Q9_DESCRIPTOR>(values, relaxationFrequency);
+        });
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["fluidNodes"] = static_cast<double>(lattice.nodeCount());
+    reportLatticeUpdates(
+        state,
+        lattice.nodeCount(),
+        2 * D2Q9_SIZE * sizeof(Scalar) + D2Q9_SIZE * sizeof(std::uint32_t) / 2
+    );
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_SparseAACollideStreamD2Q9, float)->Arg(0)->Arg(50)->Arg(80);
+BENCHMARK_TEMPLATE(BM_SparseAACollideStreamD2Q9, double)->Arg(0)->Arg(50)->Arg(80);
@@ -0,0 +1,119 @@
+#include "../../src/lattice/equilibrium.hpp"
+#include "../LatticeUpdates.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t extent{1024};
+
+/**
+ * Density and velocity fields of a decaying shear wave on the benchmark lattice.
+ */
+template <std::floating_point Scalar>
+struct Fields
+{
+    Fields() : densities(extent * extent), velocityX(densities.size()), velocityY(densities.size())
+    {
+        for (std::size_t node = 0; node < densities.size(); ++node)
+        {
+            densities[node] = Scalar{1.0} + static_cast<Scalar>(node % extent) / (100 * extent);
+            velocityX[node] = static_cast<Scalar>(node / extent) / (20 * extent);
+            velocityY[node] = Scalar{0.01};
+        }
+    }
+
+    auto flowVelocities() const -> std::array<std::span<const Scalar>, D2Q9_DIMENSION>
+    {
+        return {std::span<const Scalar>{velocityX}, std::span<const Scalar>{velocityY}};
+    }
+
+    std::vector<Scalar> densities;
+    std::vector<Scalar> velocityX;
+    std::vector<Scalar> velocityY;
+};
+
+/**
+ * Reference initialization that computes the equilibrium of every node with the per-node
+ * computeEquilibrium and scatters it with setNode.
+ */
+template <std::floating_point Scalar>
+void BM_NodeEquilibriumD2Q9(benchmark::State& state)
+{
+    const Fields<Scalar> fields;
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar> lattice{{extent, extent}};
+
+    for (auto _ : state)
+    {
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            const std::array<Scalar, D2Q9_DIMENSION> velocity{
+                fields.velocityX[node], fields.velocityY[node]
+            };
+            lattice.setNode(
+                node, computeEquilibrium<D2Q9_DESCRIPTOR>(fields.densities[node], velocity)
+            );
+        }
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(
+        state, lattice.nodeCount(), (D2Q9_SIZE + 1 + D2Q9_DIMENSION) * sizeof(Scalar)
+    );
+}
+
+template <std::floating_point Scalar>
+void BM_BulkEquilibriumD2Q9(benchmark::State& state)
+{
+    const Fields<Scalar> fields;
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar> lattice{{extent, extent}};
+
+    for (auto _ : state)
+    {
+        initializeEquilibrium(
+            lattice, std::span<const Scalar>{fields.densities}, fields.flowVelocities()
+        );
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(
+        state, lattice.nodeCount(), (D2Q9_SIZE + 1 + D2Q9_DIMENSION) * sizeof(Scalar)
+    );
+}
+
+template <std::floating_point Scalar>
+void BM_ParallelBulkEquilibriumD2Q9(benchmark::State& state)
+{
+    const Fields<Scalar> fields;
+    const std::array<std::size_t, D2Q9_DIMENSION> extents{extent, extent};
+    TiledScheduler<D2Q9_DIMENSION> scheduler{
+        extents,
+        defaultTileExtents<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>(extents),
+        std::max<std::size_t>(std::thread::hardware_concurrency(), 1)
+    };
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar> lattice{
+        extents, [&](const auto& zero) { scheduler.firstTouch(zero); }
+    };
+
+    for (auto _ : state)
+    {
+        initializeEquilibrium(
+            lattice, std::span<const Scalar>{fields.densities}, fields.flowVelocities(), scheduler
+        );
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(
+        state, lattice.nodeCount(), (D2Q9_SIZE + 1 + D2Q9_DIMENSION) * sizeof(Scalar)
+    );
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_NodeEquilibriumD2Q9, float);
+BENCHMARK_TEMPLATE(BM_NodeEquilibriumD2Q9, double);
+BENCHMARK_TEMPLATE(BM_BulkEquilibriumD2Q9, float);
+BENCHMARK_TEMPLATE(BM_BulkEquilibriumD2Q9, double);
+BENCHMARK_TEMPLATE(BM_ParallelBulkEquilibriumD2Q9, float)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ParallelBulkEquilibriumD2Q9, double)->UseRealTime();
@@ -0,0 +1,105 @@
+#include "../../src/lattice/moments.hpp"
+#include "../LatticeUpdates.hpp"
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t extent{1024};
+
+// A cube with about as many nodes as the square D2Q9 lattice.
+constexpr std::size_t extent3D{102};
+
+/**
+ * Reference extraction that gathers every node into a DensityDistribution and calls the per-node
+ * computeDensity and computeMomentum functions.
+ */
+template <std::floating_point Scalar>
+void BM_NodeMomentsD2Q9(benchmark::State& state)
+{
+    const auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    std::vector<Scalar> density(lattice.nodeCount());
+    std::vector<Scalar> momentumX(lattice.nodeCount());
+    std::vector<Scalar> momentumY(lattice.nodeCount());
+
+    for (auto _ : state)
+    {
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            const D2Q9<Scalar> distribution{lattice.node(node)};
+            const std::array<Scalar, D2Q9_DIMENSION> momentum{computeMomentum(distribution)};
+            density[node] = computeDensity(distribution);
+            momentumX[node] = momentum[0];
+            momentumY[node] = momentum[1];
+        }
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(
+        state, lattice.nodeCount(), (D2Q9_SIZE + 1 + D2Q9_DIMENSION) * sizeof(Scalar)
+    );
+}
+
+template <std::floating_point Scalar>
+void BM_BatchedMomentsD2Q9(benchmark::State& state)
+{
+    const auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    std::vector<Scalar> density(lattice.nodeCount());
+    std::vector<Scalar> momentumX(lattice.nodeCount());
+    std::vector<Scalar> momentumY(lattice.nodeCount());
+    const std::array<std::span<Scalar>, D2Q9_DIMENSION> momenta{momentumX, momentumY};
+
+    for (auto _ : state)
+    {
+        computeMoments(lattice, std::span<Scalar>{density}, momenta);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(
+        state, lattice.nodeCount(), (D2Q9_SIZE + 1 + D2Q9_DIMENSION) * sizeof(Scalar)
+    );
+    state.SetLabel(std::string{SIMD_INSTRUCTION_SET});
+}
+
+/**
+ * Batched moments of a three-dimensional lattice model, comparable to BM_BatchedMomentsD2Q9 in
+ * node updates per second and in bytes per second.
+ */
+template <std::size_t Size, std::floating_point Scalar>
+void BM_BatchedMoments3D(benchmark::State& state)
+{
+    Lattice<3, Size, Scalar> lattice{{extent3D, extent3D, extent3D}};
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        for (Scalar& value : lattice.population(i))
+        {
+            value = Scalar{1.0} / Size;
+        }
+    }
+    std::vector<Scalar> density(lattice.nodeCount());
+    std::vector<Scalar> momentumX(lattice.nodeCount());
+    std::vector<Scalar> momentumY(lattice.nodeCount());
+    std::vector<Scalar> momentumZ(lattice.nodeCount());
+    const std::array<std::span<Scalar>, 3> momenta{momentumX, momentumY, momentumZ};
+
+    for (auto _ : state)
+    {
+        computeMoments(lattice, std::span<Scalar>{density}, momenta);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), (Size + 1 + 3) * sizeof(Scalar));
+    state.SetLabel(std::string{SIMD_INSTRUCTION_SET});
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_NodeMomentsD2Q9, float);
+BENCHMARK_TEMPLATE(BM_NodeMomentsD2Q9, double);
+BENCHMARK_TEMPLATE(BM_BatchedMomentsD2Q9, float);
+BENCHMARK_TEMPLATE(BM_BatchedMomentsD2Q9, double);
+BENCHMARK_TEMPLATE(BM_BatchedMoments3D, D3Q19_SIZE, float);
+BENCHMARK_TEMPLATE(BM_BatchedMoments3D, D3Q19_SIZE, double);
+BENCHMARK_TEMPLATE(BM_BatchedMoments3D, D3Q27_SIZE, float);
+BENCHMARK_TEMPLATE(BM_BatchedMoments3D, D3Q27_SIZE, double);
@@ -0,0 +1,74 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/parallel/Subdomain.hpp"
+#include "../LatticeUpdates.hpp"
+#include <memory>
+#include <thread>
+
+#include <unistd.h>
+
+namespace
+{
+
+constexpr std::size_t extent{1024};
+constexpr std::size_t stepsPerIteration{10};
+
+/**
+ * Advances a lattice decomposed into as many slabs as the benchmark argument, each run by its own
+ * thread that talks to its neighbors through shared memory rings only.
+ */
+template <std::floating_point Scalar>
+void BM_DecomposedAACollideStreamD2Q9(benchmark::State& state)
+{
+    using Slab = Subdomain<D2Q9_DIMENSION, D2Q9_SIZE, Scalar, SharedMemoryTransport>;
+
+    const D2Q9<Scalar> model;
+    const auto velocities{latticeVelocities(model)};
+    const Scalar relaxationFrequency{1.2};
+    const auto rankCount{static_cast<std::size_t>(state.range(0))};
+    const std::array<std::size_t, D2Q9_DIMENSION> extents{extent, extent};
+    const std::string prefix{"/latticeflow-bench-" + std::to_string(::getpid())};
+    const auto rings{
+        SharedMemoryTransport::createRings(prefix, rankCount, 4 * 3 * extent * sizeof(Scalar))
+    };
+    std::vector<std::unique_ptr<SharedMemoryTransport>> transports;
+    std::vector<std::unique_ptr<Slab>> slabs;
+    for (std::size_t rank = 0; rank < rankCount; ++rank)
+    {
+        transports.push_back(std::make_unique<SharedMemoryTransport>(prefix, rank, rankCount));
+        slabs.push_back(std::make_unique<Slab>(
+            extents, velocities, latticeOpposites(model), rank, rankCount, *transports.back()
+        ));
+        fillRestState<D2Q9_DESCRIPTOR>(slabs.back()->lattice());
+    }
+    std::size_t firstStep{0};
+
+    for (auto _ : state)
+    {
+        std::vector<std::thread> threads;
+        for (const auto& slab : slabs)
+        {
+            threads.emplace_back([&, firstStep] {
+                for (std::size_t step = firstStep; step < firstStep + stepsPerIteration; ++step)
+                {
+                    slab->step(step, [&](std::array<Scalar, D2Q9_SIZE>& values) {
+                        relaxBGK<D2Q9_DESCRIPTOR>(values, relaxationFrequency);
+                    });
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        firstStep += stepsPerIteration;
+    }
+
+    reportLatticeUpdates(
+        state, stepsPerIteration * extent * extent, 2 * D2Q9_SIZE * sizeof(Scalar)
+    );
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_DecomposedAACollideStreamD2Q9, float)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_DecomposedAACollideStreamD2Q9, double)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
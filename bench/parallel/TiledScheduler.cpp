@@ -0,0 +1,61 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include "../LatticeUpdates.hpp"
+#include <algorithm>
+
+namespace
+{
+
+constexpr std::size_t extent{1024};
+
+/**
+ * Adds thread counts from one to the number of hardware threads, doubling in between.
+ */
+void threadCounts(benchmark::internal::Benchmark* benchmark)
+{
+    const std::size_t maximum{std::max(std::thread::hardware_concurrency(), 1U)};
+
+    for (std::size_t threadCount = 1; threadCount < maximum; threadCount *= 2)
+    {
+        benchmark->Arg(static_cast<std::int64_t>(threadCount));
+    }
+    benchmark->Arg(static_cast<std::int64_t>(maximum));
+}
+
+template <std::floating_point Scalar>
+void BM_ParallelAACollideStreamD2Q9(benchmark::State& state)
+{
+    const std::array<std::size_t, D2Q9_DIMENSION> extents{extent, extent};
+    TiledScheduler<D2Q9_DIMENSION> scheduler{
+        extents,
+        defaultTileExtents<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>(extents),
+        static_cast<std::size_t>(state.range(0))
+    };
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar> lattice{
+        extents, [&](const auto& zero) { scheduler.firstTouch(zero); }
+    };
+    const Scalar relaxationFrequency{1.2};
+    std::size_t timeStep{0};
+
+    fillRestState<D2Q9_DESCRIPTOR>(lattice);
+
+    for (auto _ : state)
+    {
+        streamAA(
+            lattice,
+            timeStep++,
+            [&](std::array<Scalar, D2Q9_SIZE>& values) {
+                relaxBGK<D2Q9_DESCRIPTOR>(values, relaxationFrequency);
+            },
+            scheduler
+        );
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_ParallelAACollideStreamD2Q9, float)->Apply(threadCounts)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ParallelAACollideStreamD2Q9, double)->Apply(threadCounts)->UseRealTime();
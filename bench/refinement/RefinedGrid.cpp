@@ -0,0 +1,129 @@
+#include "../../src/boundary/BoundaryEngine.hpp"
+#include "../../src/refinement/RefinedGrid.hpp"
+#include "../LatticeUpdates.hpp"
+
+namespace
+{
+
+constexpr std::array<std::size_t, 2> rootBlocks{8, 4};
+constexpr std::size_t finestLevel{2};
+constexpr std::size_t substeps{std::size_t{1} << finestLevel};
+
+/**
+ * A cylinder in a periodic row of cylinders, in units of the node spacing of level zero.
+ */
+template <std::floating_point Scalar>
+auto cylinder(const std::array<Scalar, 2>& position) -> bool
+{
+    const Scalar x{position[0] - Scalar{32.0}};
+    const Scalar y{position[1] - Scalar{32.0}};
+
+    return x * x + y * y < Scalar{16.0};
+}
+
+template <std::floating_point Scalar>
+auto relaxationFrequency() -> Scalar
+{
+    return Scalar{1.6};
+}
+
+/**
+ * Reference time to solution: a uniform lattice with the spacing of the finest level takes four
+ * time steps per time step of level zero, with the cylinder as bounce-back links.
+ */
+template <std::floating_point Scalar>
+void BM_UniformCylinderWakeD2Q9(benchmark::State& state)
+{
+    const std::array<std::size_t, 2> extents{
+        rootBlocks[0] * REFINED_BLOCK_EXTENT * substeps,
+        rootBlocks[1] * REFINED_BLOCK_EXTENT * substeps
+    };
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar> lattice{extents};
+    std::vector<bool> solid(lattice.nodeCount());
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const std::array<Scalar, 2> position{
+            (static_cast<Scalar>(node % extents[0]) + Scalar{0.5}) / substeps,
+            (static_cast<Scalar>(node / extents[0]) + Scalar{0.5}) / substeps
+        };
+        solid[node] = cylinder(position);
+        lattice.setNode(
+            node,
+            computeEquilibrium<D2Q9_DESCRIPTOR>(
+                Scalar{1.0},
+                std::array<Scalar, 2>{solid[node] ? Scalar{0.0} : Scalar{0.05}, Scalar{0.0}}
+            )
+        );
+    }
+    BoundaryEngine<D2Q9_DESCRIPTOR, Scalar> engine{extents, solid};
+    const RefinedGrid<D2Q9_DESCRIPTOR, Scalar> levels{{1, 1}, relaxationFrequency<Scalar>()};
+    const Scalar finestFrequency{levels.relaxationFrequency(finestLevel)};
+    std::size_t timeStep{0};
+
+    for (auto _ : state)
+    {
+        for (std::size_t substep = 0; substep < substeps; ++substep)
+        {
+            streamAA(lattice, timeStep, [&](std::array<Scalar, D2Q9_SIZE>& values) {
+                relaxBGK<D2Q9_DESCRIPTOR>(values, finestFrequency);
+            });
+            engine.apply(lattice, ++timeStep);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["nodes"] = static_cast<double>(lattice.nodeCount());
+    reportLatticeUpdates(state, lattice.nodeCount() * substeps, 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+/**
+ * The same flow on a refined grid that is coarse far from the cylinder, refined once around its
+ * wake and twice around the cylinder itself. Lattice updates are counted as on the uniform lattice,
+ * so MLUPS compares the time to solution.
+ */
+template <std::floating_point Scalar>
+void BM_RefinedCylinderWakeD2Q9(benchmark::State& state)
+{
+    RefinedGrid<D2Q9_DESCRIPTOR, Scalar> grid{rootBlocks, relaxationFrequency<Scalar>()};
+    for (std::size_t x = 1; x <= 4; ++x)
+    {
+        for (std::size_t y = 1; y <= 2; ++y)
+        {
+            grid.refine({0, {x, y}});
+        }
+    }
+    for (std::size_t x = 3; x <= 5; ++x)
+    {
+        for (std::size_t y = 3; y <= 4; ++y)
+        {
+            grid.refine({1, {x, y}});
+        }
+    }
+    grid.setSolid(cylinder<Scalar>);
+    grid.initialize([](const std::array<Scalar, 2>& position) {
+        return computeEquilibrium<D2Q9_DESCRIPTOR>(
+            Scalar{1.0},
+            std::array<Scalar, 2>{cylinder(position) ? Scalar{0.0} : Scalar{0.05}, Scalar{0.0}}
+        );
+    });
+    const std::size_t uniformNodeCount{
+        rootBlocks[0] * rootBlocks[1] * REFINED_BLOCK_EXTENT * REFINED_BLOCK_EXTENT * substeps *
+        substeps
+    };
+
+    for (auto _ : state)
+    {
+        grid.advance();
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["nodes"] = static_cast<double>(grid.nodeCount());
+    reportLatticeUpdates(state, uniformNodeCount * substeps, 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_UniformCylinderWakeD2Q9, float);
+BENCHMARK_TEMPLATE(BM_UniformCylinderWakeD2Q9, double);
+BENCHMARK_TEMPLATE(BM_RefinedCylinderWakeD2Q9, float);
+BENCHMARK_TEMPLATE(BM_RefinedCylinderWakeD2Q9, double);
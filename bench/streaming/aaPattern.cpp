@@ -0,0 +1,102 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/densityDistribution/d3q19.hpp"
+#include "../../src/densityDistribution/d3q27.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include "../LatticeUpdates.hpp"
+#include <utility>
+
+namespace
+{
+
+constexpr std::size_t extent{256};
+
+/**
+ * Reference time step: collision followed by a separate streaming pass into a second lattice, so
+ * every population is read and written twice and twice the memory is allocated.
+ */
+template <std::floating_point Scalar>
+void BM_TwoBufferCollideStreamD2Q9(benchmark::State& state)
+{
+    auto source{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    auto destination{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    const auto velocities{latticeVelocities(D2Q9<Scalar>{})};
+    const Scalar relaxationFrequency{1.2};
+
+    for (auto _ : state)
+    {
+        collideBGK(source, relaxationFrequency);
+        for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+        {
+            const auto from{source.population(i)};
+            const auto to{destination.population(i)};
+            for (std::size_t node = 0; node < source.nodeCount(); ++node)
+            {
+                to[periodicNeighbor(source.extents(), node, velocities[i])] = from[node];
+            }
+        }
+        std::swap(source, destination);
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, source.nodeCount(), 4 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+template <std::floating_point Scalar>
+void BM_FusedAACollideStreamD2Q9(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    const Scalar relaxationFrequency{1.2};
+    std::size_t timeStep{0};
+
+    for (auto _ : state)
+    {
+        streamAA(lattice, timeStep++, [&](std::array<Scalar, D2Q9_SIZE>& values) {
+            relaxBGK<D2Q9_DESCRIPTOR>(values, relaxationFrequency);
+        });
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), 2 * D2Q9_SIZE * sizeof(Scalar));
+}
+
+/**
+ * Fused AA time step with BGK collision of blocks of row nodes for a three-dimensional lattice
+ * model, for comparison with the D2Q9 time step in node updates per second.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+void BM_FusedAACollideStream3D(benchmark::State& state)
+{
+    constexpr std::size_t size{Descriptor.velocities.size()};
+    constexpr std::size_t extent3D{40};
+
+    auto lattice{makeRestLattice<Descriptor, Scalar>({extent3D, extent3D, extent3D})};
+    const Scalar relaxationFrequency{1.2};
+    std::size_t timeStep{0};
+
+    for (auto _ : state)
+    {
+        streamAA(
+            lattice,
+            Descriptor.velocities,
+            Descriptor.opposites,
+            timeStep++,
+            [&](auto& block, std::size_t count) {
+                relaxBGK<Descriptor>(block, count, relaxationFrequency);
+            }
+        );
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(state, lattice.nodeCount(), 2 * size * sizeof(Scalar));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_TwoBufferCollideStreamD2Q9, float);
+BENCHMARK_TEMPLATE(BM_TwoBufferCollideStreamD2Q9, double);
+BENCHMARK_TEMPLATE(BM_FusedAACollideStreamD2Q9, float);
+BENCHMARK_TEMPLATE(BM_FusedAACollideStreamD2Q9, double);
+BENCHMARK_TEMPLATE(BM_FusedAACollideStream3D, D3Q19_DESCRIPTOR, float);
+BENCHMARK_TEMPLATE(BM_FusedAACollideStream3D, D3Q19_DESCRIPTOR, double);
+BENCHMARK_TEMPLATE(BM_FusedAACollideStream3D, D3Q27_DESCRIPTOR, float);
+BENCHMARK_TEMPLATE(BM_FusedAACollideStream3D, D3Q27_DESCRIPTOR, double);
@@ -0,0 +1,51 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/streaming/wavefront.hpp"
+#include "../LatticeUpdates.hpp"
+
+namespace
+{
+
+constexpr std::size_t extent{1024};
+
+/**
+ * Temporally blocked time steps on a lattice that does not fit into cache, with the band extent in
+ * rows as the first argument and the number of time steps per block as the second. A depth of one
+ * is plain stepping, and the bytes/update counter is the DRAM traffic a block saves per update.
+ */
+template <std::floating_point Scalar>
+void BM_WavefrontAACollideStreamD2Q9(benchmark::State& state)
+{
+    auto lattice{makeRestLattice<D2Q9_DESCRIPTOR, Scalar>({extent, extent})};
+    const Scalar relaxationFrequency{1.2};
+    const auto bandExtent{static_cast<std::size_t>(state.range(0))};
+    const auto depth{static_cast<std::size_t>(state.range(1))};
+    std::size_t timeStep{0};
+
+    for (auto _ : state)
+    {
+        streamWavefrontAA(
+            lattice,
+            timeStep,
+            depth,
+            bandExtent,
+            [&](std::array<Scalar, D2Q9_SIZE>& values) {
+                relaxBGK<D2Q9_DESCRIPTOR>(values, relaxationFrequency);
+            }
+        );
+        timeStep += depth;
+        benchmark::ClobberMemory();
+    }
+
+    reportLatticeUpdates(
+        state, lattice.nodeCount() * depth, 2 * D2Q9_SIZE * sizeof(Scalar) / depth
+    );
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_WavefrontAACollideStreamD2Q9, float)
+    ->ArgNames({"band", "depth"})
+    ->ArgsProduct({{4, 16, 64}, {1, 2, 4, 8}});
+BENCHMARK_TEMPLATE(BM_WavefrontAACollideStreamD2Q9, double)
+    ->ArgNames({"band", "depth"})
+    ->ArgsProduct({{4, 16, 64}, {1, 2, 4, 8}});
@@ -0,0 +1,139 @@
+#ifndef BOUNDARY_BOUNDARY_ENGINE_HPP
+#define BOUNDARY_BOUNDARY_ENGINE_HPP
+
+/**
+ * @file BoundaryEngine.hpp
+ * @brief Declaration of the BoundaryEngine class template that applies boundary conditions to
+ * groups of lattice nodes with batched kernels, leaving the bulk kernels free of boundary
+ * branches.
+ */
+
+#include "../instrumentation/PhaseRecorder.hpp"
+#include "../lattice/Lattice.hpp"
+#include "../lattice/MomentCache.hpp"
+#include "../streaming/aaPattern.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The number of boundary nodes that a Zou/He kernel gathers into local buffers at once.
+ */
+constexpr std::size_t BOUNDARY_BLOCK_SIZE{64};
+
+/**
+ * @enum BoundaryType
+ * @brief The kind of boundary condition that applies to a lattice node.
+ */
+enum class BoundaryType : std::uint8_t
+{
+    Periodic,
+    BounceBack,
+    ZouHeVelocity,
+    ZouHePressure
+};
+
+/**
+ * @struct BoundaryNormal
+ * @brief The unit normal of a boundary face that points into the fluid, given by its axis and
+ * sign.
+ */
+struct BoundaryNormal
+{
+    std::size_t axis;
+    int sign;
+};
+
+/**
+ * @class BoundaryEngine
+ * @brief A class template that groups the boundary nodes of a lattice by the kind of their
+ * boundary condition and applies each group with one batched kernel between time steps of the AA
+ * pattern.
+ *
+ * Solid nodes realize halfway bounce-back. Every link from a fluid node to a solid neighbor is
+ * stored once per lattice vector as a pair of population slots, and applying the links is a
+ * branch-free gather and scatter per lattice vector. Zou/He velocity and pressure nodes are grouped
+ * by the kind of condition and the normal of their face, and each group is updated in blocks by a
+ * kernel whose loops over lattice vectors follow from the normal alone. Nodes without a condition
+ * are periodic through the streaming of the AA pattern, so the fused bulk kernel runs unchanged on
+ * all nodes. Solid nodes are collided by the bulk kernel like fluid nodes and must therefore hold
+ * finite populations, such as the equilibrium at rest.
+ *
+ * The populations that stream into a node in the next time step lie in the slots of the same
+ * lattice vector at the node after an even number of time steps, and in the slots of the opposite
+ * lattice vector at the upstream neighbor after an odd number. Both slot lists are built once, so
+ * the kernels only select a list by parity. After an even number of time steps every write lands
+ * in the slots of a boundary node itself, so a current MomentCache is kept current by recomputing
+ * the moments of the boundary nodes alone.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+class BoundaryEngine
+{
+public:
+    static constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    static constexpr std::size_t size{Descriptor.velocities.size()};
+
+    BoundaryEngine(
+        const std::array<std::size_t, dimension>& extents,
+        const std::vector<bool>& solid
+    );
+
+    auto addVelocityNode(
+        std::size_t index,
+        const BoundaryNormal& normal,
+        const std::array<Scalar, dimension>& velocity
+    ) -> void;
+    auto addPressureNode(std::size_t index, const BoundaryNormal& normal, Scalar density) -> void;
+
+    auto apply(Lattice<dimension, size, Scalar>& lattice, std::size_t completedSteps) -> void;
+    auto apply(
+        Lattice<dimension, size, Scalar>& lattice,
+        std::size_t completedSteps,
+        MomentCache<dimension, size, Scalar>& cache
+    ) -> void;
+
+    auto nodeType(std::size_t index) const -> BoundaryType;
+    auto linkCount() const -> std::size_t;
+    auto boundaryNodeCount() const -> std::size_t;
+
+private:
+    using Indices = std::vector<std::uint32_t>;
+
+    /**
+     * @brief The Zou/He nodes of one kind of condition on faces with the same normal.
+     */
+    struct ZouHeGroup
+    {
+        BoundaryType type;
+        BoundaryNormal normal;
+        std::array<std::array<Indices, size>, 2> slots;
+        std::array<std::vector<Scalar>, dimension> velocities;
+        std::vector<Scalar> densities;
+    };
+
+    auto addZouHeNode(std::size_t index, const BoundaryNormal& normal, BoundaryType type)
+        -> ZouHeGroup&;
+    auto applyBounceBack(Lattice<dimension, size, Scalar>& lattice, std::size_t parity) const
+        -> void;
+    auto applyZouHe(
+        Lattice<dimension, size, Scalar>& lattice,
+        const ZouHeGroup& group,
+        std::size_t parity
+    ) const -> void;
+
+    std::array<std::size_t, dimension> extents_;
+    std::vector<BoundaryType> types_;
+    std::array<Indices, size> fluidNodes_;
+    std::array<Indices, size> solidNodes_;
+    std::size_t linkedNodeCount_{0};
+    Indices boundaryNodes_;
+    std::vector<ZouHeGroup> groups_;
+};
+
+#include "BoundaryEngine.tpp"
+
+#endif // BOUNDARY_BOUNDARY_ENGINE_HPP
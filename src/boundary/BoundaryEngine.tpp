@@ -0,0 +1,553 @@
+#ifndef BOUNDARY_BOUNDARY_ENGINE_TPP
+#define BOUNDARY_BOUNDARY_ENGINE_TPP
+
+/**
+ * @file BoundaryEngine.tpp
+ * @brief Implementation of the BoundaryEngine class template that applies boundary conditions to
+ * groups of lattice nodes with batched kernels, leaving the bulk kernels free of boundary
+ * branches.
+ */
+
+;
+#include "BoundaryEngine.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+/**
+ * @brief Constructor for BoundaryEngine with the extents of the lattice and a solid mask.
+ *
+ * Builds the bounce-back links of every fluid node to its solid upstream neighbors and the sorted
+ * list of linked fluid nodes. The bounding
+ * box is periodic, so solid nodes on one face also reflect populations of fluid nodes on the
+ * opposite face.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param solid Whether each node, by linear index, is a solid node.
+ * @throws std::invalid_argument If the size of the mask differs from the number of nodes.
+ * @throws std::length_error If the nodes cannot be indexed with 32 bits.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+BoundaryEngine<Descriptor, Scalar>::BoundaryEngine(
+    const std::array<std::size_t, dimension>& extents,
+    const std::vector<bool>& solid
+)
+    : extents_{extents},
+      types_(solid.size(), BoundaryType::Periodic)
+{
+    const std::size_t nodeCount{std::accumulate(
+        extents.begin(), extents.end(), std::size_t{1}, std::multiplies<std::size_t>{}
+    )};
+
+    if (solid.size() != nodeCount)
+    {
+        throw std::invalid_argument{"solid mask must cover the lattice"};
+    }
+    if (nodeCount > std::numeric_limits<std::uint32_t>::max())
+    {
+        throw std::length_error{"too many nodes for 32-bit boundary indices"};
+    }
+
+    for (std::size_t node = 0; node < nodeCount; ++node)
+    {
+        if (solid[node])
+        {
+            types_[node] = BoundaryType::BounceBack;
+            continue;
+        }
+
+        bool linked{false};
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            const std::size_t upstream{
+                periodicNeighbor(extents, node, Descriptor.velocities[Descriptor.opposites[i]])
+            };
+            if (solid[upstream])
+            {
+                fluidNodes_[i].push_back(static_cast<std::uint32_t>(node));
+                solidNodes_[i].push_back(static_cast<std::uint32_t>(upstream));
+                linked = true;
+            }
+        }
+        linkedNodeCount_ += linked ? 1 : 0;
+        if (linked)
+        {
+            boundaryNodes_.push_back(static_cast<std::uint32_t>(node));
+        }
+    }
+}
+
+/**
+ * @brief Adds a fluid node with a prescribed velocity imposed with the Zou/He scheme.
+ *
+ * @param index Linear index of the lattice node.
+ * @param normal The normal of the boundary face at the node that points into the fluid.
+ * @param velocity The prescribed flow velocity.
+ * @throws std::out_of_range If the index lies outside the lattice.
+ * @throws std::invalid_argument If the normal is not a signed unit vector along an axis, or if the
+ * node is solid or already has a boundary condition.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto BoundaryEngine<Descriptor, Scalar>::addVelocityNode(
+    std::size_t index,
+    const BoundaryNormal& normal,
+    const std::array<Scalar, dimension>& velocity
+) -> void
+{
+    ZouHeGroup& group{addZouHeNode(index, normal, BoundaryType::ZouHeVelocity)};
+
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        group.velocities[axis].push_back(velocity[axis]);
+    }
+}
+
+/**
+ * @brief Adds a fluid node with a prescribed density, and thus pressure, imposed with the Zou/He
+ * scheme.
+ *
+ * The velocity at the node is normal to the face.
+ *
+ * @param index Linear index of the lattice node.
+ * @param normal The normal of the boundary face at the node that points into the fluid.
+ * @param density The prescribed mass density.
+ * @throws std::out_of_range If the index lies outside the lattice.
+ * @throws std::invalid_argument If the normal is not a signed unit vector along an axis, or if the
+ * node is solid or already has a boundary condition.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto BoundaryEngine<Descriptor, Scalar>::addPressureNode(
+    std::size_t index,
+    const BoundaryNormal& normal,
+    Scalar density
+) -> void
+{
+    addZouHeNode(index, normal, BoundaryType::ZouHePressure).densities.push_back(density);
+}
+
+/**
+ * @brief Applies all boundary conditions to the populations that stream into the boundary nodes
+ * in the next time step.
+ *
+ * Must be called after every time step of the AA pattern, before the next one. Bounce-back links
+ * are applied first, so that Zou/He nodes next to a wall see reflected populations.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param completedSteps The number of AA time steps performed on the lattice so far.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto BoundaryEngine<Descriptor, Scalar>::apply(
+    Lattice<dimension, size, Scalar>& lattice,
+    std::size_t completedSteps
+) -> void
+{
+    const ScopedPhase phase{Phase::Boundary, boundaryNodeCount()};
+
+    const std::size_t parity{completedSteps % 2};
+
+    applyBounceBack(lattice, parity);
+    for (const ZouHeGroup& group : groups_)
+    {
+        applyZouHe(lattice, group, parity);
+    }
+}
+
+/**
+ * @brief Applies all boundary conditions and keeps a current moment cache of the lattice current.
+ *
+ * After an even number of time steps, the conditions change the populations of the boundary nodes
+ * only, so if the cache was current before, the moments of these nodes are recomputed and the rest
+ * of the cache is kept. Zou/He nodes need the moments of their known populations alone, so the
+ * kernels do not read the cache. After an odd number of time steps the populations are not in
+ * their natural layout and the cache is left stale.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param completedSteps The number of AA time steps performed on the lattice so far.
+ * @param cache The moment cache of the lattice.
+ * @throws std::invalid_argument If the cache belongs to another lattice.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto BoundaryEngine<Descriptor, Scalar>::apply(
+    Lattice<dimension, size, Scalar>& lattice,
+    std::size_t completedSteps,
+    MomentCache<dimension, size, Scalar>& cache
+) -> void
+{
+    if (&cache.lattice() != &lattice)
+    {
+        throw std::invalid_argument{"moment cache belongs to another lattice"};
+    }
+
+    const bool current{completedSteps % 2 == 0 && cache.isCurrent()};
+
+    apply(lattice, completedSteps);
+
+    if (current)
+    {
+        cache.refreshNodes(boundaryNodes_);
+    }
+}
+
+/**
+ * @brief Returns the kind of boundary condition of a node.
+ *
+ * @param index Linear index of the lattice node.
+ * @return BounceBack for solid nodes, the kind of Zou/He condition for velocity and pressure nodes
+ * and Periodic for all other nodes.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto BoundaryEngine<Descriptor, Scalar>::nodeType(std::size_t index) const -> BoundaryType
+{
+    return types_[index];
+}
+
+/**
+ * @brief Returns the number of bounce-back links.
+ *
+ * @return The number of pairs of a fluid node and a lattice vector whose upstream neighbor is
+ * solid.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto BoundaryEngine<Descriptor, Scalar>::linkCount() const -> std::size_t
+{
+    std::size_t count{0};
+    for (const Indices& nodes : fluidNodes_)
+    {
+        count += nodes.size();
+    }
+
+    return count;
+}
+
+/**
+ * @brief Returns the number of node updates that apply performs.
+ *
+ * @return The number of fluid nodes with a bounce-back link plus the number of Zou/He nodes.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto BoundaryEngine<Descriptor, Scalar>::boundaryNodeCount() const -> std::size_t
+{
+    std::size_t count{linkedNodeCount_};
+    for (const ZouHeGroup& group : groups_)
+    {
+        count += group.slots[0][0].size();
+    }
+
+    return count;
+}
+
+/**
+ * @brief Registers a Zou/He node in the group of its kind and normal.
+ *
+ * Records the slots of the incoming populations of the node for both parities of the number of
+ * completed time steps and adds the node to the sorted list of boundary nodes.
+ *
+ * @param index Linear index of the lattice node.
+ * @param normal The normal of the boundary face at the node that points into the fluid.
+ * @param type The kind of Zou/He condition.
+ * @return Reference to the group, whose prescribed values the caller appends.
+ * @throws std::out_of_range If the index lies outside the lattice.
+ * @throws std::invalid_argument If the normal is not a signed unit vector along an axis, or if the
+ * node is solid or already has a boundary condition.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto BoundaryEngine<Descriptor, Scalar>::addZouHeNode(
+    std::size_t index,
+    const BoundaryNormal& normal,
+    BoundaryType type
+) -> ZouHeGroup&
+{
+    if (index >= types_.size())
+    {
+        throw std::out_of_range{"boundary node lies outside the lattice"};
+    }
+    if (normal.axis >= dimension || (normal.sign != 1 && normal.sign != -1))
+    {
+        throw std::invalid_argument{"boundary normal must be a signed unit vector along an axis"};
+    }
+    if (types_[index] != BoundaryType::Periodic)
+    {
+        throw std::invalid_argument{"boundary node is solid or already has a condition"};
+    }
+
+    types_[index] = type;
+    boundaryNodes_.insert(
+        std::ranges::lower_bound(boundaryNodes_, static_cast<std::uint32_t>(index)),
+        static_cast<std::uint32_t>(index)
+    );
+
+    auto group{std::ranges::find_if(groups_, [&](const ZouHeGroup& candidate) {
+        return candidate.type == type && candidate.normal.axis == normal.axis &&
+               candidate.normal.sign == normal.sign;
+    })};
+    if (group == groups_.end())
+    {
+        groups_.push_back(ZouHeGroup{type, normal, {}, {}, {}});
+        group = std::prev(groups_.end());
+    }
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const std::size_t upstream{
+            periodicNeighbor(extents_, index, Descriptor.velocities[Descriptor.opposites[i]])
+        };
+        group->slots[0][i].push_back(static_cast<std::uint32_t>(index));
+        group->slots[1][i].push_back(static_cast<std::uint32_t>(upstream));
+    }
+
+    return *group;
+}
+
+/**
+ * @brief Reflects the populations of all bounce-back links.
+ *
+ * After an even number of time steps, the population that streams into a fluid node from a solid
+ * neighbor is replaced by the one that the fluid node sent towards the neighbor, which the AA
+ * pattern stored at the neighbor. After an odd number, the copy goes the other way, since the
+ * fluid node reads its incoming population from the neighbor.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param parity The parity of the number of completed time steps.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto BoundaryEngine<Descriptor, Scalar>::applyBounceBack(
+    Lattice<dimension, size, Scalar>& lattice,
+    std::size_t parity
+) const -> void
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const Indices& fluidNodes{fluidNodes_[i]};
+        const Indices& solidNodes{solidNodes_[i]};
+        if (fluidNodes.empty())
+        {
+            continue;
+        }
+
+        const std::span<Scalar> fluid{lattice.population(i)};
+        const std::span<Scalar> solid{lattice.population(Descriptor.opposites[i])};
+
+        if (parity == 0)
+        {
+            for (std::size_t link = 0; link < fluidNodes.size(); ++link)
+            {
+                fluid[fluidNodes[link]] = solid[solidNodes[link]];
+            }
+        }
+        else
+        {
+            for (std::size_t link = 0; link < fluidNodes.size(); ++link)
+            {
+                solid[solidNodes[link]] = fluid[fluidNodes[link]];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Sets the unknown incoming populations of a group of Zou/He nodes.
+ *
+ * Incoming populations that point into the fluid are unknown. The missing one of density and
+ * normal velocity follows from the known populations as in \cite Zou1997. Unknown populations are
+ * set by bounce-back of their non-equilibrium part, and the tangential momentum is then corrected
+ * over the unknown populations with a tangential component as in \cite Hecht2010, which reproduces
+ * the original scheme on D2Q9 and extends it to three dimensions. The loops over lattice vectors
+ * depend only on the normal of the group, and the nodes of a block are processed in the innermost
+ * loops without branches.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param group The group of Zou/He nodes.
+ * @param parity The parity of the number of completed time steps.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto BoundaryEngine<Descriptor, Scalar>::applyZouHe(
+    Lattice<dimension, size, Scalar>& lattice,
+    const ZouHeGroup& group,
+    std::size_t parity
+) const -> void
+{
+    const std::size_t normalAxis{group.normal.axis};
+    const auto sign{static_cast<Scalar>(group.normal.sign)};
+    const auto inverseSpeedOfSoundSquared{
+        static_cast<Scalar>(1.0 / Descriptor.speedOfSoundSquared)
+    };
+
+    std::array<Scalar, size> knownWeights;
+    std::array<std::size_t, size> unknowns;
+    std::size_t unknownCount{0};
+    std::array<int, dimension> tangentialNorms{};
+    std::array<std::span<Scalar>, size> populations;
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const int normalComponent{Descriptor.velocities[i][normalAxis] * group.normal.sign};
+        knownWeights[i] = static_cast<Scalar>(normalComponent < 0 ? 2 : normalComponent == 0);
+        if (normalComponent > 0)
+        {
+            unknowns[unknownCount++] = i;
+            for (std::size_t axis = 0; axis < dimension; ++axis)
+            {
+                if (axis != normalAxis)
+                {
+                    tangentialNorms[axis] +=
+                        Descriptor.velocities[i][axis] * Descriptor.velocities[i][axis];
+                }
+            }
+        }
+        populations[i] = lattice.population(parity == 0 ? i : Descriptor.opposites[i]);
+    }
+
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, BOUNDARY_BLOCK_SIZE>, size> block;
+    alignas(CACHE_LINE_SIZE)
+        std::array<std::array<Scalar, BOUNDARY_BLOCK_SIZE>, dimension> velocity;
+    alignas(CACHE_LINE_SIZE) std::array<Scalar, BOUNDARY_BLOCK_SIZE> density;
+    alignas(CACHE_LINE_SIZE) std::array<Scalar, BOUNDARY_BLOCK_SIZE> sum;
+
+    const std::size_t nodeCount{group.slots[0][0].size()};
+    for (std::size_t first = 0; first < nodeCount; first += BOUNDARY_BLOCK_SIZE)
+    {
+        const std::size_t count{std::min(BOUNDARY_BLOCK_SIZE, nodeCount - first)};
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            const std::uint32_t* slots{group.slots[parity][i].data() + first};
+            for (std::size_t node = 0; node < count; ++node)
+            {
+                block[i][node] = populations[i][slots[node]];
+            }
+        }
+
+        sum.fill(Scalar{0.0});
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            for (std::size_t node = 0; node < count; ++node)
+            {
+                sum[node] += knownWeights[i] * block[i][node];
+            }
+        }
+
+        if (group.type == BoundaryType::ZouHeVelocity)
+        {
+            for (std::size_t axis = 0; axis < dimension; ++axis)
+            {
+                std::copy_n(group.velocities[axis].begin() + first, count, velocity[axis].begin());
+            }
+            for (std::size_t node = 0; node < count; ++node)
+            {
+                density[node] = sum[node] / (Scalar{1.0} - sign * velocity[normalAxis][node]);
+            }
+        }
+        else
+        {
+            std::copy_n(group.densities.begin() + first, count, density.begin());
+            for (std::size_t axis = 0; axis < dimension; ++axis)
+            {
+                velocity[axis].fill(Scalar{0.0});
+            }
+            for (std::size_t node = 0; node < count; ++node)
+            {
+                velocity[normalAxis][node] = sign * (Scalar{1.0} - sum[node] / density[node]);
+            }
+        }
+
+        for (std::size_t u = 0; u < unknownCount; ++u)
+        {
+            const std::size_t i{unknowns[u]};
+            const auto coefficient{
+                static_cast<Scalar>(2.0 * Descriptor.weights[i]) * inverseSpeedOfSoundSquared
+            };
+            for (std::size_t node = 0; node < count; ++node)
+            {
+                Scalar projection{0.0};
+                for (std::size_t axis = 0; axis < dimension; ++axis)
+                {
+                    projection += static_cast<Scalar>(Descriptor.velocities[i][axis]) *
+                                  velocity[axis][node];
+                }
+                block[i][node] = block[Descriptor.opposites[i]][node] +
+                                 coefficient * density[node] * projection;
+            }
+        }
+
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            if (tangentialNorms[axis] == 0)
+            {
+                continue;
+            }
+
+            for (std::size_t node = 0; node < count; ++node)
+            {
+                sum[node] = density[node] * velocity[axis][node];
+            }
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                const auto component{static_cast<Scalar>(Descriptor.velocities[i][axis])};
+                for (std::size_t node = 0; node < count; ++node)
+                {
+                    sum[node] -= component * block[i][node];
+                }
+            }
+            for (std::size_t u = 0; u < unknownCount; ++u)
+            {
+                const std::size_t i{unknowns[u]};
+                const Scalar share{
+                    static_cast<Scalar>(Descriptor.velocities[i][axis]) /
+                    static_cast<Scalar>(tangentialNorms[axis])
+                };
+                for (std::size_t node = 0; node < count; ++node)
+                {
+                    block[i][node] += share * sum[node];
+                }
+            }
+        }
+
+        for (std::size_t u = 0; u < unknownCount; ++u)
+        {
+            const std::size_t i{unknowns[u]};
+            const std::uint32_t* slots{group.slots[parity][i].data() + first};
+            for (std::size_t node = 0; node < count; ++node)
+            {
+                populations[i][slots[node]] = block[i][node];
+            }
+        }
+    }
+}
+
+#endif // BOUNDARY_BOUNDARY_ENGINE_TPP
@@ -0,0 +1,175 @@
+#ifndef COLLISION_MOMENT_TRANSFORM_HPP
+#define COLLISION_MOMENT_TRANSFORM_HPP
+
+/**
+ * @file MomentTransform.hpp
+ * @brief Declaration of raw-moment transforms of lattice models that are derived from a lattice
+ * descriptor at compile time and evaluated as sparse, fully unrolled code.
+ */
+
+#include "../densityDistribution/LatticeDescriptor.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @enum MomentKind
+ * @brief The role of a raw moment in a moment-space collision.
+ */
+enum class MomentKind
+{
+    Conserved,
+    NormalStress,
+    ShearStress,
+    Higher
+};
+
+/**
+ * @struct RelaxationRates
+ * @brief The relaxation frequencies of a moment-space collision.
+ *
+ * The shear rate sets the kinematic viscosity like the relaxation frequency of BGK does, the bulk
+ * rate the bulk viscosity, and the higher rate those moments of third and higher order that do not
+ * affect the hydrodynamic limit. Setting all three to the same value recovers BGK.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+struct RelaxationRates
+{
+    Scalar shear;
+    Scalar bulk;
+    Scalar higher;
+};
+
+/**
+ * @struct EquilibriumMoments
+ * @brief The coefficients of the raw moments of the second-order equilibrium as polynomials in
+ * the flow velocity, per unit density.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ */
+template <std::size_t Dimension, std::size_t Size>
+struct EquilibriumMoments
+{
+    std::array<double, Size> constant;
+    std::array<std::array<double, Dimension>, Size> linear;
+    std::array<std::array<std::array<double, Dimension>, Dimension>, Size> quadratic;
+};
+
+/**
+ * @struct BlockColumn
+ * @brief A read-only view of the values of one lattice node in a block of nodes, which the sparse
+ * sums read like the values of a single node.
+ *
+ * @tparam Size The number of values at each lattice node.
+ * @tparam BlockSize The capacity of the block in lattice nodes.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Size, std::size_t BlockSize, std::floating_point Scalar>
+struct BlockColumn
+{
+    const std::array<std::array<Scalar, BlockSize>, Size>& block;
+    std::size_t node;
+
+    constexpr auto operator[](std::size_t index) const -> Scalar
+    {
+        return block[index][node];
+    }
+};
+
+consteval auto momentPower(int component, int exponent) -> int;
+
+consteval auto snapCoefficient(double coefficient) -> double;
+
+template <auto Coefficient, std::floating_point Scalar>
+constexpr auto accumulateScaled(Scalar sum, Scalar value) -> Scalar;
+
+template <const auto& Descriptor>
+consteval auto momentExponents();
+
+template <const auto& Descriptor>
+consteval auto momentMatrix();
+
+template <const auto& Descriptor>
+consteval auto inverseMomentMatrix();
+
+template <const auto& Descriptor>
+consteval auto momentKinds();
+
+template <const auto& Descriptor>
+consteval auto equilibriumMoments();
+
+template <const auto& Descriptor>
+consteval auto equilibriumTermCoefficient(std::size_t moment, std::size_t term) -> double;
+
+template <
+    const auto& Descriptor,
+    std::size_t Moment,
+    std::floating_point Scalar,
+    typename Populations,
+    std::size_t... I>
+constexpr auto sumMoment(const Populations& populations, std::index_sequence<I...>) -> Scalar;
+
+template <
+    const auto& Descriptor,
+    std::size_t Direction,
+    std::floating_point Scalar,
+    typename Moments,
+    std::size_t... K>
+constexpr auto sumPopulation(const Moments& moments, std::index_sequence<K...>) -> Scalar;
+
+template <
+    const auto& Descriptor,
+    std::size_t Moment,
+    std::floating_point Scalar,
+    typename Terms,
+    std::size_t... P>
+constexpr auto sumEquilibriumMoment(const Terms& terms, std::index_sequence<P...>) -> Scalar;
+
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto transformToMoments(
+    const Populations& populations,
+    std::array<Scalar, Descriptor.velocities.size()>& moments
+) -> void;
+
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto transformFromMoments(
+    const std::array<Scalar, Descriptor.velocities.size()>& moments,
+    Populations& populations
+) -> void;
+
+template <const auto& Descriptor, std::size_t Dimension, std::floating_point Scalar>
+constexpr auto computeEquilibriumMoments(
+    Scalar density,
+    const std::array<Scalar, Dimension>& velocity
+) -> std::array<Scalar, Descriptor.velocities.size()>;
+
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto transformBlockToMoments(
+    const std::array<std::array<Scalar, BlockSize>, Size>& block,
+    std::size_t count,
+    std::array<std::array<Scalar, BlockSize>, Size>& moments
+) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto transformBlockFromMoments(
+    const std::array<std::array<Scalar, BlockSize>, Size>& moments,
+    std::size_t count,
+    std::array<std::array<Scalar, BlockSize>, Size>& block
+) -> void;
+
+#include "MomentTransform.tpp"
+
+#endif // COLLISION_MOMENT_TRANSFORM_HPP
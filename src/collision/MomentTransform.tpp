@@ -0,0 +1,702 @@
+#ifndef COLLISION_MOMENT_TRANSFORM_TPP
+#define COLLISION_MOMENT_TRANSFORM_TPP
+
+/**
+ * @file MomentTransform.tpp
+ * @brief Implementation of raw-moment transforms of lattice models that are derived from a lattice
+ * descriptor at compile time and evaluated as sparse, fully unrolled code.
+ */
+
+;
+#include "MomentTransform.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Raises a lattice velocity component to the power of a moment exponent.
+ *
+ * @param component The velocity component, in {-1, 0, 1}.
+ * @param exponent The exponent, in {0, 1, 2}.
+ * @return The power, with a zeroth power of one also for a zero component.
+ */
+consteval auto momentPower(int component, int exponent) -> int
+{
+    return exponent == 0 ? 1 : (exponent == 1 ? component : component * component);
+}
+
+/**
+ * @brief Rounds coefficients that differ from 0, 1 or -1 only by rounding errors of their
+ * compile-time derivation, so that the generated code skips or adds them without multiplication.
+ *
+ * @param coefficient The coefficient.
+ * @return The snapped coefficient.
+ */
+consteval auto snapCoefficient(double coefficient) -> double
+{
+    constexpr double tolerance{1e-12};
+
+    for (const double exact : {0.0, 1.0, -1.0})
+    {
+        if (coefficient - exact < tolerance && exact - coefficient < tolerance)
+        {
+            return exact;
+        }
+    }
+
+    return coefficient;
+}
+
+/**
+ * @brief Adds a value scaled by a compile-time coefficient to a sum.
+ *
+ * Zero coefficients add nothing, and coefficients of one and minus one need no multiplication.
+ *
+ * @param sum The sum so far.
+ * @param value The value to add.
+ * @return The new sum.
+ *
+ * @tparam Coefficient The coefficient of the value.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <auto Coefficient, std::floating_point Scalar>
+constexpr auto accumulateScaled(Scalar sum, Scalar value) -> Scalar
+{
+    if constexpr (Coefficient == 0)
+    {
+        static_cast<void>(value);
+        return sum;
+    }
+    else if constexpr (Coefficient == 1)
+    {
+        return sum + value;
+    }
+    else if constexpr (Coefficient == -1)
+    {
+        return sum - value;
+    }
+    else
+    {
+        return sum + static_cast<Scalar>(Coefficient) * value;
+    }
+}
+
+/**
+ * @brief Selects the monomial raw moments that form a basis for a lattice model.
+ *
+ * Candidates are the monomials with exponents in {0, 1, 2} per axis, ordered by total degree and
+ * then with the first axis varying fastest. A candidate is kept if its values on the lattice
+ * vectors are linearly independent of those of the moments kept before. The first moment is
+ * therefore the density and the next Dimension moments are the momentum components.
+ *
+ * @return The exponents of the basis moments, one array per moment.
+ * @throws std::invalid_argument If the lattice velocities do not span Size independent moments.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ */
+template <const auto& Descriptor>
+consteval auto momentExponents()
+{
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    constexpr std::size_t size{Descriptor.velocities.size()};
+    constexpr std::size_t candidateCount{[] {
+        std::size_t count{1};
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            count *= 3;
+        }
+        return count;
+    }()};
+
+    std::array<std::array<int, dimension>, size> exponents{};
+    std::array<std::array<double, size>, size> echelon{};
+    std::array<std::size_t, size> pivots{};
+    std::size_t rank{0};
+
+    for (int degree = 0; degree <= static_cast<int>(2 * dimension); ++degree)
+    {
+        for (std::size_t code = 0; code < candidateCount && rank < size; ++code)
+        {
+            std::array<int, dimension> candidate{};
+            int candidateDegree{0};
+            std::size_t digits{code};
+            for (std::size_t axis = 0; axis < dimension; ++axis)
+            {
+                candidate[axis] = static_cast<int>(digits % 3);
+                candidateDegree += candidate[axis];
+                digits /= 3;
+            }
+            if (candidateDegree != degree)
+            {
+                continue;
+            }
+
+            std::array<double, size> row{};
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                int value{1};
+                for (std::size_t axis = 0; axis < dimension; ++axis)
+                {
+                    value *= momentPower(Descriptor.velocities[i][axis], candidate[axis]);
+                }
+                row[i] = value;
+            }
+
+            for (std::size_t r = 0; r < rank; ++r)
+            {
+                const double factor{row[pivots[r]]};
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    row[i] -= factor * echelon[r][i];
+                }
+            }
+
+            std::size_t pivot{0};
+            for (std::size_t i = 1; i < size; ++i)
+            {
+                if ((row[i] < 0 ? -row[i] : row[i]) > (row[pivot] < 0 ? -row[pivot] : row[pivot]))
+                {
+                    pivot = i;
+                }
+            }
+            if (snapCoefficient(row[pivot]) == 0.0)
+            {
+                continue;
+            }
+
+            const double scale{row[pivot]};
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                echelon[rank][i] = row[i] / scale;
+            }
+            pivots[rank] = pivot;
+            exponents[rank++] = candidate;
+        }
+    }
+
+    if (rank < size)
+    {
+        throw std::invalid_argument{"lattice velocities do not span a monomial moment basis"};
+    }
+
+    return exponents;
+}
+
+/**
+ * @brief Computes the matrix that maps populations to the basis moments of a lattice model.
+ *
+ * @return The matrix with one row per moment and one column per lattice vector, whose entries are
+ * the values of the monomials on the lattice vectors and lie in {-1, 0, 1}.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ */
+template <const auto& Descriptor>
+consteval auto momentMatrix()
+{
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    constexpr std::size_t size{Descriptor.velocities.size()};
+    constexpr auto exponents{momentExponents<Descriptor>()};
+
+    std::array<std::array<int, size>, size> matrix{};
+    for (std::size_t k = 0; k < size; ++k)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            matrix[k][i] = 1;
+            for (std::size_t axis = 0; axis < dimension; ++axis)
+            {
+                matrix[k][i] *= momentPower(Descriptor.velocities[i][axis], exponents[k][axis]);
+            }
+        }
+    }
+
+    return matrix;
+}
+
+/**
+ * @brief Computes the matrix that maps the basis moments of a lattice model back to populations.
+ *
+ * @return The inverse of the moment matrix, computed by Gauss-Jordan elimination with partial
+ * pivoting, with coefficients near 0, 1 and -1 snapped to these values.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ */
+template <const auto& Descriptor>
+consteval auto inverseMomentMatrix()
+{
+    constexpr std::size_t size{Descriptor.velocities.size()};
+    constexpr auto matrix{momentMatrix<Descriptor>()};
+
+    std::array<std::array<double, size>, size> left{};
+    std::array<std::array<double, size>, size> inverse{};
+    for (std::size_t k = 0; k < size; ++k)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            left[k][i] = matrix[k][i];
+        }
+        inverse[k][k] = 1.0;
+    }
+
+    for (std::size_t column = 0; column < size; ++column)
+    {
+        std::size_t pivot{column};
+        for (std::size_t row = column + 1; row < size; ++row)
+        {
+            const double candidate{left[row][column] < 0 ? -left[row][column] : left[row][column]};
+            const double best{left[pivot][column] < 0 ? -left[pivot][column] : left[pivot][column]};
+            if (candidate > best)
+            {
+                pivot = row;
+            }
+        }
+        std::swap(left[column], left[pivot]);
+        std::swap(inverse[column], inverse[pivot]);
+
+        const double scale{left[column][column]};
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            left[column][i] /= scale;
+            inverse[column][i] /= scale;
+        }
+
+        for (std::size_t row = 0; row < size; ++row)
+        {
+            const double factor{left[row][column]};
+            if (row == column || factor == 0.0)
+            {
+                continue;
+            }
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                left[row][i] -= factor * left[column][i];
+                inverse[row][i] -= factor * inverse[column][i];
+            }
+        }
+    }
+
+    for (auto& row : inverse)
+    {
+        for (double& coefficient : row)
+        {
+            coefficient = snapCoefficient(coefficient);
+        }
+    }
+
+    return inverse;
+}
+
+/**
+ * @brief Classifies the basis moments of a lattice model by their role in a collision.
+ *
+ * @return Conserved for density and momentum, NormalStress for the second-order moments along a
+ * single axis, ShearStress for the other second-order moments and Higher for all others.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ */
+template <const auto& Descriptor>
+consteval auto momentKinds()
+{
+    constexpr std::size_t size{Descriptor.velocities.size()};
+    constexpr auto exponents{momentExponents<Descriptor>()};
+
+    std::array<MomentKind, size> kinds{};
+    for (std::size_t k = 0; k < size; ++k)
+    {
+        int degree{0};
+        int largest{0};
+        for (const int exponent : exponents[k])
+        {
+            degree += exponent;
+            largest = exponent > largest ? exponent : largest;
+        }
+
+        if (degree <= 1)
+        {
+            kinds[k] = MomentKind::Conserved;
+        }
+        else if (degree == 2)
+        {
+            kinds[k] = largest == 2 ? MomentKind::NormalStress : MomentKind::ShearStress;
+        }
+        else
+        {
+            kinds[k] = MomentKind::Higher;
+        }
+    }
+
+    return kinds;
+}
+
+/**
+ * @brief Derives the raw moments of the second-order equilibrium of a lattice model as
+ * polynomials in the flow velocity.
+ *
+ * The equilibrium of \cite Kruger2017 is a quadratic polynomial in the velocity per lattice
+ * vector, so each of its moments is one as well. Only the upper triangle of the quadratic
+ * coefficients is used, with the mixed terms doubled.
+ *
+ * @return The polynomial coefficients per unit density.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ */
+template <const auto& Descriptor>
+consteval auto equilibriumMoments()
+{
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    constexpr std::size_t size{Descriptor.velocities.size()};
+    constexpr auto matrix{momentMatrix<Descriptor>()};
+    const double soundSpeedSquared{Descriptor.speedOfSoundSquared};
+
+    EquilibriumMoments<dimension, size> moments{};
+    for (std::size_t k = 0; k < size; ++k)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            const double weight{matrix[k][i] * Descriptor.weights[i]};
+            const auto& velocity{Descriptor.velocities[i]};
+
+            moments.constant[k] += weight;
+            for (std::size_t a = 0; a < dimension; ++a)
+            {
+                moments.linear[k][a] += weight * velocity[a] / soundSpeedSquared;
+                for (std::size_t b = a; b < dimension; ++b)
+                {
+                    moments.quadratic[k][a][b] += (a == b ? 1.0 : 2.0) * weight * velocity[a] *
+                                                  velocity[b] /
+                                                  (2.0 * soundSpeedSquared * soundSpeedSquared);
+                }
+            }
+        }
+
+        for (std::size_t a = 0; a < dimension; ++a)
+        {
+            moments.quadratic[k][a][a] -= moments.constant[k] / (2.0 * soundSpeedSquared);
+        }
+    }
+
+    for (std::size_t k = 0; k < size; ++k)
+    {
+        moments.constant[k] = snapCoefficient(moments.constant[k]);
+        for (std::size_t a = 0; a < dimension; ++a)
+        {
+            moments.linear[k][a] = snapCoefficient(moments.linear[k][a]);
+            for (std::size_t b = 0; b < dimension; ++b)
+            {
+                moments.quadratic[k][a][b] = snapCoefficient(moments.quadratic[k][a][b]);
+            }
+        }
+    }
+
+    return moments;
+}
+
+/**
+ * @brief Returns the coefficient of a velocity term in the equilibrium value of a basis moment.
+ *
+ * The terms are the Dimension velocity components followed by the Dimension * Dimension products
+ * of two components in row-major order, of which only the upper triangle is used.
+ *
+ * @param moment The index of the basis moment.
+ * @param term The index of the velocity term.
+ * @return The coefficient per unit density.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ */
+template <const auto& Descriptor>
+consteval auto equilibriumTermCoefficient(std::size_t moment, std::size_t term) -> double
+{
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    constexpr auto coefficients{equilibriumMoments<Descriptor>()};
+
+    if (term < dimension)
+    {
+        return coefficients.linear[moment][term];
+    }
+
+    const std::size_t a{(term - dimension) / dimension};
+    const std::size_t b{(term - dimension) % dimension};
+    return a <= b ? coefficients.quadratic[moment][a][b] : 0.0;
+}
+
+/**
+ * @brief Computes one basis moment of the populations of a node as an unrolled sparse sum.
+ *
+ * Starting from negative zero lets the compiler drop the addition to the first term.
+ *
+ * @param populations The populations of the node in lattice vector order.
+ * @return The basis moment.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Moment The index of the basis moment.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Populations A container of Size scalar values that supports the subscript operator.
+ * @tparam I The indices of all lattice vectors.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Moment,
+    std::floating_point Scalar,
+    typename Populations,
+    std::size_t... I>
+constexpr auto sumMoment(const Populations& populations, std::index_sequence<I...>) -> Scalar
+{
+    Scalar sum{-0.0};
+    ((sum = accumulateScaled<momentMatrix<Descriptor>()[Moment][I]>(
+          sum, static_cast<Scalar>(populations[I])
+      )),
+     ...);
+
+    return sum;
+}
+
+/**
+ * @brief Computes one population of a node from the basis moments as an unrolled sparse sum.
+ *
+ * @param moments The basis moments.
+ * @return The population.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Direction The index of the lattice vector.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Moments A container of the basis moments that supports the subscript operator.
+ * @tparam K The indices of all basis moments.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Direction,
+    std::floating_point Scalar,
+    typename Moments,
+    std::size_t... K>
+constexpr auto sumPopulation(const Moments& moments, std::index_sequence<K...>) -> Scalar
+{
+    Scalar sum{-0.0};
+    ((sum = accumulateScaled<inverseMomentMatrix<Descriptor>()[Direction][K]>(
+          sum, static_cast<Scalar>(moments[K])
+      )),
+     ...);
+
+    return sum;
+}
+
+/**
+ * @brief Computes the equilibrium value of one basis moment per unit density as an unrolled
+ * sparse sum.
+ *
+ * @param terms The velocity components followed by the products of two components.
+ * @return The equilibrium basis moment per unit density.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Moment The index of the basis moment.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Terms A container of the velocity terms that supports the subscript operator.
+ * @tparam P The indices of all velocity terms.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Moment,
+    std::floating_point Scalar,
+    typename Terms,
+    std::size_t... P>
+constexpr auto sumEquilibriumMoment(const Terms& terms, std::index_sequence<P...>) -> Scalar
+{
+    Scalar sum{static_cast<Scalar>(equilibriumMoments<Descriptor>().constant[Moment])};
+    ((sum = accumulateScaled<equilibriumTermCoefficient<Descriptor>(Moment, P)>(
+          sum, static_cast<Scalar>(terms[P])
+      )),
+     ...);
+
+    return sum;
+}
+
+/**
+ * @brief Transforms the populations of a node to the basis moments of a lattice model.
+ *
+ * Every moment is a fully unrolled sum over the lattice vectors with a non-zero value of its
+ * monomial, added or subtracted without multiplication.
+ *
+ * @param populations The populations of the node in lattice vector order.
+ * @param moments The basis moments, overwritten on output.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Populations A container of Size scalar values that supports the subscript operator.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto transformToMoments(
+    const Populations& populations,
+    std::array<Scalar, Descriptor.velocities.size()>& moments
+) -> void
+{
+    constexpr std::size_t size{Descriptor.velocities.size()};
+
+    [&]<std::size_t... K>(std::index_sequence<K...>) {
+        ((moments[K] = sumMoment<Descriptor, K, Scalar>(
+              populations, std::make_index_sequence<size>{}
+          )),
+         ...);
+    }(std::make_index_sequence<size>{});
+}
+
+/**
+ * @brief Transforms the basis moments of a lattice model back to the populations of a node.
+ *
+ * Every population is a fully unrolled sum over the moments with a non-zero coefficient in the
+ * inverse moment matrix.
+ *
+ * @param moments The basis moments.
+ * @param populations The populations of the node in lattice vector order, overwritten on output.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Populations A container of Size scalar values that supports the subscript operator.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto transformFromMoments(
+    const std::array<Scalar, Descriptor.velocities.size()>& moments,
+    Populations& populations
+) -> void
+{
+    constexpr std::size_t size{Descriptor.velocities.size()};
+
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        ((populations[I] = sumPopulation<Descriptor, I, Scalar>(
+              moments, std::make_index_sequence<size>{}
+          )),
+         ...);
+    }(std::make_index_sequence<size>{});
+}
+
+/**
+ * @brief Computes the basis moments of the second-order equilibrium of a lattice model.
+ *
+ * @param density The mass density.
+ * @param velocity The flow velocity.
+ * @return The equilibrium basis moments, evaluated from the compile-time polynomial coefficients
+ * with all zero terms omitted.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::size_t Dimension, std::floating_point Scalar>
+constexpr auto computeEquilibriumMoments(
+    Scalar density,
+    const std::array<Scalar, Dimension>& velocity
+) -> std::array<Scalar, Descriptor.velocities.size()>
+{
+    constexpr std::size_t size{Descriptor.velocities.size()};
+    constexpr std::size_t termCount{Dimension + Dimension * Dimension};
+
+    std::array<Scalar, termCount> terms{};
+    for (std::size_t a = 0; a < Dimension; ++a)
+    {
+        terms[a] = velocity[a];
+        for (std::size_t b = a; b < Dimension; ++b)
+        {
+            terms[Dimension + a * Dimension + b] = velocity[a] * velocity[b];
+        }
+    }
+
+    std::array<Scalar, size> moments;
+    [&]<std::size_t... K>(std::index_sequence<K...>) {
+        ((moments[K] = density * sumEquilibriumMoment<Descriptor, K, Scalar>(
+                                     terms, std::make_index_sequence<termCount>{}
+                                 )),
+         ...);
+    }(std::make_index_sequence<size>{});
+
+    return moments;
+}
+
+/**
+ * @brief Transforms the populations of a block of lattice nodes to the basis moments of a lattice
+ * model.
+ *
+ * Every moment array is written in one unit-stride pass over the nodes that the compiler
+ * vectorizes, with the same unrolled sparse sum as transformToMoments, so the result is the same.
+ * The populations of a node that the sum of a moment does not use are never loaded.
+ *
+ * @param block The populations of the block, one array of nodes per lattice vector.
+ * @param count The number of nodes in the block.
+ * @param moments The basis moments of the block, one array of nodes per moment, overwritten on
+ * output.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam BlockSize The capacity of the block in lattice nodes.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto transformBlockToMoments(
+    const std::array<std::array<Scalar, BlockSize>, Size>& block,
+    std::size_t count,
+    std::array<std::array<Scalar, BlockSize>, Size>& moments
+) -> void
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match block");
+
+    [&]<std::size_t... K>(std::index_sequence<K...>) {
+        const auto transformMoment{[&]<std::size_t Moment>() {
+            for (std::size_t node = 0; node < count; ++node)
+            {
+                moments[Moment][node] = sumMoment<Descriptor, Moment, Scalar>(
+                    BlockColumn<Size, BlockSize, Scalar>{block, node},
+                    std::make_index_sequence<Size>{}
+                );
+            }
+        }};
+
+        (transformMoment.template operator()<K>(), ...);
+    }(std::make_index_sequence<Size>{});
+}
+
+/**
+ * @brief Transforms the basis moments of a block of lattice nodes back to their populations.
+ *
+ * Every population array is written in one unit-stride pass over the nodes that the compiler
+ * vectorizes, with the same unrolled sparse sum as transformFromMoments.
+ *
+ * @param moments The basis moments of the block, one array of nodes per moment.
+ * @param count The number of nodes in the block.
+ * @param block The populations of the block, one array of nodes per lattice vector, overwritten on
+ * output.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam BlockSize The capacity of the block in lattice nodes.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto transformBlockFromMoments(
+    const std::array<std::array<Scalar, BlockSize>, Size>& moments,
+    std::size_t count,
+    std::array<std::array<Scalar, BlockSize>, Size>& block
+) -> void
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match block");
+
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        const auto transformPopulation{[&]<std::size_t Direction>() {
+            for (std::size_t node = 0; node < count; ++node)
+            {
+                block[Direction][node] = sumPopulation<Descriptor, Direction, Scalar>(
+                    BlockColumn<Size, BlockSize, Scalar>{moments, node},
+                    std::make_index_sequence<Size>{}
+                );
+            }
+        }};
+
+        (transformPopulation.template operator()<I>(), ...);
+    }(std::make_index_sequence<Size>{});
+}
+
+#endif // COLLISION_MOMENT_TRANSFORM_TPP
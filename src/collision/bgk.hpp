@@ -0,0 +1,149 @@
+#ifndef COLLISION_BGK_HPP
+#define COLLISION_BGK_HPP
+
+/**
+ * @file bgk.hpp
+ * @brief Declaration of fused single-relaxation-time (BGK) collision kernels that are generated
+ * from a lattice descriptor, and of their D2Q5 and D2Q9 wrappers.
+ */
+
+#include "../densityDistribution/d2q5.hpp"
+#include "../densityDistribution/d2q9.hpp"
+#include "../instrumentation/PhaseRecorder.hpp"
+#include "../lattice/Lattice.hpp"
+#include "../lattice/MixedPrecisionLattice.hpp"
+#include "../lattice/MomentCache.hpp"
+#include "MomentTransform.hpp"
+
+/**
+ * @brief The number of lattice nodes that the batched collision kernels process at once.
+ */
+constexpr std::size_t COLLISION_BLOCK_SIZE{64};
+
+template <
+    const auto& Descriptor,
+    std::size_t Direction,
+    std::size_t Dimension,
+    std::floating_point Scalar>
+constexpr auto accumulateMomentum(std::array<Scalar, Dimension>& momentum, Scalar population)
+    -> void;
+
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto relaxBGK(Populations& populations, Scalar relaxationFrequency) -> void;
+
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto relaxBGK(
+    Populations& populations,
+    Scalar density,
+    const std::array<Scalar, Descriptor.velocities[0].size()>& momentum,
+    Scalar relaxationFrequency
+) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto computeBlockMoments(
+    const std::array<std::array<Scalar, BlockSize>, Size>& block,
+    std::size_t count,
+    std::array<Scalar, BlockSize>& density,
+    std::array<std::array<Scalar, BlockSize>, Descriptor.velocities[0].size()>& momentum
+) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto relaxBlockBGK(
+    std::array<std::array<Scalar, BlockSize>, Size>& block,
+    std::size_t count,
+    const std::array<Scalar, BlockSize>& density,
+    const std::array<std::array<Scalar, BlockSize>, Descriptor.velocities[0].size()>& momentum,
+    Scalar relaxationFrequency
+) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto relaxBGK(
+    std::array<std::array<Scalar, BlockSize>, Size>& block,
+    std::size_t count,
+    Scalar relaxationFrequency
+) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto relaxBGK(Lattice<Dimension, Size, Scalar>& lattice, Scalar relaxationFrequency) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto relaxBGK(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    MomentCache<Dimension, Size, Scalar>& cache,
+    Scalar relaxationFrequency
+) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    StorageFormat Format>
+auto relaxBGK(
+    MixedPrecisionLattice<Dimension, Size, Scalar, Format>& lattice,
+    Scalar relaxationFrequency
+) -> void;
+
+template <std::floating_point Scalar>
+constexpr auto collideBGK(D2Q5<Scalar>& distribution, Scalar relaxationFrequency) -> void;
+
+template <std::floating_point Scalar>
+constexpr auto collideBGK(D2Q9<Scalar>& distribution, Scalar relaxationFrequency) -> void;
+
+template <std::floating_point Scalar>
+auto collideBGK(Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice, Scalar relaxationFrequency)
+    -> void;
+
+template <std::floating_point Scalar>
+auto collideBGK(Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice, Scalar relaxationFrequency)
+    -> void;
+
+template <std::floating_point Scalar>
+auto collideBGK(
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    MomentCache<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& cache,
+    Scalar relaxationFrequency
+) -> void;
+
+template <std::floating_point Scalar>
+auto collideBGK(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    MomentCache<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& cache,
+    Scalar relaxationFrequency
+) -> void;
+
+template <std::floating_point Scalar, StorageFormat Format>
+auto collideBGK(
+    MixedPrecisionLattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar, Format>& lattice,
+    Scalar relaxationFrequency
+) -> void;
+
+template <std::floating_point Scalar, StorageFormat Format>
+auto collideBGK(
+    MixedPrecisionLattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar, Format>& lattice,
+    Scalar relaxationFrequency
+) -> void;
+
+#include "bgk.tpp"
+
+#endif // COLLISION_BGK_HPP
@@ -0,0 +1,597 @@
+#ifndef COLLISION_BGK_TPP
+#define COLLISION_BGK_TPP
+
+/**
+ * @file bgk.tpp
+ * @brief Implementation of fused single-relaxation-time (BGK) collision kernels that are generated
+ * from a lattice descriptor, and of their D2Q5 and D2Q9 wrappers.
+ */
+
+;
+#include "bgk.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Adds the momentum of one population to a momentum density.
+ *
+ * Every component adds or subtracts the population according to the sign of the constant velocity
+ * component of the lattice vector, and is left unchanged where that component is zero.
+ *
+ * @param momentum The momentum density, updated in place.
+ * @param population The population of the lattice vector.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Direction The index of the lattice vector.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Direction,
+    std::size_t Dimension,
+    std::floating_point Scalar>
+constexpr auto accumulateMomentum(std::array<Scalar, Dimension>& momentum, Scalar population)
+    -> void
+{
+    [&]<std::size_t... Axis>(std::index_sequence<Axis...>) {
+        ((momentum[Axis] = accumulateScaled<Descriptor.velocities[Direction][Axis]>(
+              momentum[Axis], population
+          )),
+         ...);
+    }(std::make_index_sequence<Dimension>{});
+}
+
+/**
+ * @brief Relaxes the populations of a single lattice node towards equilibrium in one pass.
+ *
+ * Computes the density and momentum with all loops over lattice vectors unrolled and relaxes the
+ * node with them, without creating any intermediate density distribution.
+ *
+ * @param populations The populations of the lattice node, updated in place.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Populations A container of Size scalar values that supports the subscript operator.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto relaxBGK(Populations& populations, Scalar relaxationFrequency) -> void
+{
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    constexpr std::size_t size{Descriptor.velocities.size()};
+
+    Scalar density{0.0};
+    std::array<Scalar, dimension> momentum{};
+
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        ((density += populations[I]), ...);
+        (accumulateMomentum<Descriptor, I>(momentum, static_cast<Scalar>(populations[I])), ...);
+    }(std::make_index_sequence<size>{});
+
+    relaxBGK<Descriptor>(populations, density, momentum, relaxationFrequency);
+}
+
+/**
+ * @brief Relaxes the populations of a single lattice node with known moments towards equilibrium.
+ *
+ * Evaluates computeEquilibriumPopulation of the descriptor for every lattice vector from the given
+ * density and momentum and applies the BGK relaxation, so the equilibrium follows the squared
+ * speed of sound of the descriptor.
+ *
+ * @param populations The populations of the lattice node, updated in place.
+ * @param density The mass density of the node.
+ * @param momentum The momentum density of the node.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Populations A container of Size scalar values that supports the subscript operator.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto relaxBGK(
+    Populations& populations,
+    Scalar density,
+    const std::array<Scalar, Descriptor.velocities[0].size()>& momentum,
+    Scalar relaxationFrequency
+) -> void
+{
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    constexpr std::size_t size{Descriptor.velocities.size()};
+
+    const Scalar inverseDensity{Scalar{1.0} / density};
+    std::array<Scalar, dimension> velocity;
+    Scalar velocitySquared{0.0};
+
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        velocity[axis] = momentum[axis] * inverseDensity;
+        velocitySquared += velocity[axis] * velocity[axis];
+    }
+
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        ((populations[I] += relaxationFrequency *
+                            (computeEquilibriumPopulation<Descriptor, I>(
+                                 density, projectVelocity<Descriptor, I>(velocity), velocitySquared
+                             ) -
+                             populations[I])),
+         ...);
+    }(std::make_index_sequence<size>{});
+}
+
+/**
+ * @brief Computes the density and momentum of the nodes of a collision block.
+ *
+ * The nodes are visited in one unit-stride loop that the compiler vectorizes, and the sums over
+ * lattice vectors inside it are unrolled and follow the lattice vector order of the node kernel.
+ * Every momentum component skips the lattice vectors without a velocity along its axis.
+ *
+ * @param block The populations of the block, one array of nodes per lattice vector.
+ * @param count The number of nodes in the block.
+ * @param density The mass density of every node, overwritten on output.
+ * @param momentum The momentum density of every node, one array per axis, overwritten on output.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam BlockSize The capacity of the block in lattice nodes.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto computeBlockMoments(
+    const std::array<std::array<Scalar, BlockSize>, Size>& block,
+    std::size_t count,
+    std::array<Scalar, BlockSize>& density,
+    std::array<std::array<Scalar, BlockSize>, Descriptor.velocities[0].size()>& momentum
+) -> void
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match block");
+
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+
+    for (std::size_t node = 0; node < count; ++node)
+    {
+        Scalar nodeDensity{0.0};
+        std::array<Scalar, dimension> nodeMomentum{};
+
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((nodeDensity += block[I][node]), ...);
+            (accumulateMomentum<Descriptor, I>(nodeMomentum, block[I][node]), ...);
+        }(std::make_index_sequence<Size>{});
+
+        density[node] = nodeDensity;
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            momentum[axis][node] = nodeMomentum[axis];
+        }
+    }
+}
+
+/**
+ * @brief Relaxes the populations of the nodes of a collision block with known moments towards
+ * equilibrium.
+ *
+ * The flow velocity of all nodes is computed first, and each population array is then relaxed in
+ * one unit-stride pass over the block that the compiler vectorizes, like initializeEquilibrium
+ * fills it. Every equilibrium population is computed by computeEquilibriumPopulation, so the
+ * result equals that of the node kernel up to rounding.
+ *
+ * @param block The populations of the block, one array of nodes per lattice vector, updated in
+ * place.
+ * @param count The number of nodes in the block.
+ * @param density The mass density of every node.
+ * @param momentum The momentum density of every node, one array per axis.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam BlockSize The capacity of the block in lattice nodes.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto relaxBlockBGK(
+    std::array<std::array<Scalar, BlockSize>, Size>& block,
+    std::size_t count,
+    const std::array<Scalar, BlockSize>& density,
+    const std::array<std::array<Scalar, BlockSize>, Descriptor.velocities[0].size()>& momentum,
+    Scalar relaxationFrequency
+) -> void
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match block");
+
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+
+    alignas(CACHE_LINE_SIZE) std::array<Scalar, BlockSize> velocitySquared;
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, BlockSize>, dimension> velocity;
+
+    for (std::size_t node = 0; node < count; ++node)
+    {
+        const Scalar inverseDensity{Scalar{1.0} / density[node]};
+        Scalar nodeVelocitySquared{0.0};
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            velocity[axis][node] = momentum[axis][node] * inverseDensity;
+            nodeVelocitySquared += velocity[axis][node] * velocity[axis][node];
+        }
+        velocitySquared[node] = nodeVelocitySquared;
+    }
+
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        const auto relaxDirection{[&]<std::size_t Direction>() {
+            std::array<Scalar, BlockSize>& population{block[Direction]};
+
+            for (std::size_t node = 0; node < count; ++node)
+            {
+                const Scalar projection{[&]<std::size_t... Axis>(std::index_sequence<Axis...>) {
+                    Scalar sum{0.0};
+                    ((sum = accumulateScaled<Descriptor.velocities[Direction][Axis]>(
+                          sum, velocity[Axis][node]
+                      )),
+                     ...);
+                    return sum;
+                }(std::make_index_sequence<dimension>{})};
+                const Scalar equilibrium{computeEquilibriumPopulation<Descriptor, Direction>(
+                    density[node], projection, velocitySquared[node]
+                )};
+                population[node] += relaxationFrequency * (equilibrium - population[node]);
+            }
+        }};
+
+        (relaxDirection.template operator()<I>(), ...);
+    }(std::make_index_sequence<Size>{});
+}
+
+/**
+ * @brief Relaxes the populations of a block of lattice nodes towards equilibrium.
+ *
+ * Computes the moments with computeBlockMoments and relaxes the block with relaxBlockBGK, so every
+ * loop runs over the nodes of the block with unit stride. A fused sweep such as sweepAA passes its
+ * blocks to a collision callable that calls this overload.
+ *
+ * @param block The populations of the block, one array of nodes per lattice vector, updated in
+ * place.
+ * @param count The number of nodes in the block, which must not exceed BlockSize.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam BlockSize The capacity of the block in lattice nodes.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto relaxBGK(
+    std::array<std::array<Scalar, BlockSize>, Size>& block,
+    std::size_t count,
+    Scalar relaxationFrequency
+) -> void
+{
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+
+    alignas(CACHE_LINE_SIZE) std::array<Scalar, BlockSize> density;
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, BlockSize>, dimension> momentum;
+
+    computeBlockMoments<Descriptor>(block, count, density, momentum);
+    relaxBlockBGK<Descriptor>(block, count, density, momentum, relaxationFrequency);
+}
+
+/**
+ * @brief Relaxes the populations of all nodes of a lattice towards equilibrium.
+ *
+ * Nodes are processed in blocks of COLLISION_BLOCK_SIZE. Each block is copied from the population
+ * arrays into a local buffer that cannot alias them and collided by the block overload, whose
+ * loops all run over the nodes of the block with unit stride, so that the compiler vectorizes
+ * them.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto relaxBGK(Lattice<Dimension, Size, Scalar>& lattice, Scalar relaxationFrequency) -> void
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match lattice");
+
+    const ScopedPhase phase{Phase::Collide, lattice.nodeCount()};
+
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, COLLISION_BLOCK_SIZE>, Size> block;
+
+    for (std::size_t first = 0; first < lattice.nodeCount(); first += COLLISION_BLOCK_SIZE)
+    {
+        const std::size_t count{std::min(COLLISION_BLOCK_SIZE, lattice.nodeCount() - first)};
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const auto population{lattice.population(i).subspan(first, count)};
+            std::copy(population.begin(), population.end(), block[i].begin());
+        }
+
+        relaxBGK<Descriptor>(block, count, relaxationFrequency);
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const auto population{lattice.population(i).subspan(first, count)};
+            std::copy(block[i].begin(), block[i].begin() + count, population.begin());
+        }
+    }
+}
+
+/**
+ * @brief Relaxes the populations of all nodes of a lattice towards equilibrium with the moments of
+ * a moment cache.
+ *
+ * Reads the density and momentum of every node from the cache, which makes at most one fused pass
+ * over the populations and none if another reader of the same time step already refreshed it, and
+ * processes the nodes in blocks of COLLISION_BLOCK_SIZE like the kernel that computes the moments
+ * itself. The collision changes the populations, so the cache is stale afterwards.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param cache The moment cache of the lattice.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ * @throws std::invalid_argument If the cache belongs to another lattice.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto relaxBGK(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    MomentCache<Dimension, Size, Scalar>& cache,
+    Scalar relaxationFrequency
+) -> void
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match lattice");
+
+    if (&cache.lattice() != &lattice)
+    {
+        throw std::invalid_argument{"moment cache belongs to another lattice"};
+    }
+
+    const std::span<const Scalar> densities{cache.densities()};
+    const std::array<std::span<const Scalar>, Dimension> momenta{cache.momenta()};
+
+    const ScopedPhase phase{Phase::Collide, lattice.nodeCount()};
+
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, COLLISION_BLOCK_SIZE>, Size> block;
+    alignas(CACHE_LINE_SIZE) std::array<Scalar, COLLISION_BLOCK_SIZE> density;
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, COLLISION_BLOCK_SIZE>, Dimension>
+        momentum;
+
+    for (std::size_t first = 0; first < lattice.nodeCount(); first += COLLISION_BLOCK_SIZE)
+    {
+        const std::size_t count{std::min(COLLISION_BLOCK_SIZE, lattice.nodeCount() - first)};
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const auto population{lattice.population(i).subspan(first, count)};
+            std::copy(population.begin(), population.end(), block[i].begin());
+        }
+
+        std::copy_n(densities.begin() + first, count, density.begin());
+        for (std::size_t axis = 0; axis < Dimension; ++axis)
+        {
+            std::copy_n(momenta[axis].begin() + first, count, momentum[axis].begin());
+        }
+
+        relaxBlockBGK<Descriptor>(block, count, density, momentum, relaxationFrequency);
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const auto population{lattice.population(i).subspan(first, count)};
+            std::copy(block[i].begin(), block[i].begin() + count, population.begin());
+        }
+    }
+}
+
+/**
+ * @brief Relaxes the populations of all nodes of a mixed-precision lattice towards equilibrium.
+ *
+ * Each block of COLLISION_BLOCK_SIZE nodes is widened from the storage format into a local buffer
+ * of Scalar values, collided there and narrowed back, so the collision itself is the same as for
+ * a Lattice of Scalar values.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    StorageFormat Format>
+auto relaxBGK(
+    MixedPrecisionLattice<Dimension, Size, Scalar, Format>& lattice,
+    Scalar relaxationFrequency
+) -> void
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match lattice");
+
+    const ScopedPhase phase{Phase::Collide, lattice.nodeCount()};
+
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, COLLISION_BLOCK_SIZE>, Size> block;
+
+    for (std::size_t first = 0; first < lattice.nodeCount(); first += COLLISION_BLOCK_SIZE)
+    {
+        const std::size_t count{std::min(COLLISION_BLOCK_SIZE, lattice.nodeCount() - first)};
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            lattice.load(i, first, std::span<Scalar>{block[i]}.first(count));
+        }
+
+        relaxBGK<Descriptor>(block, count, relaxationFrequency);
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            lattice.store(i, first, std::span<const Scalar>{block[i]}.first(count));
+        }
+    }
+}
+
+/**
+ * @brief Applies a fused BGK collision to a D2Q5 density distribution.
+ *
+ * @param distribution A D2Q5 density distribution, updated in place.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto collideBGK(D2Q5<Scalar>& distribution, Scalar relaxationFrequency) -> void
+{
+    relaxBGK<D2Q5_DESCRIPTOR>(distribution, relaxationFrequency);
+}
+
+/**
+ * @brief Applies a fused BGK collision to a D2Q9 density distribution.
+ *
+ * @param distribution A D2Q9 density distribution, updated in place.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto collideBGK(D2Q9<Scalar>& distribution, Scalar relaxationFrequency) -> void
+{
+    relaxBGK<D2Q9_DESCRIPTOR>(distribution, relaxationFrequency);
+}
+
+/**
+ * @brief Applies a fused BGK collision to every node of a D2Q5 lattice.
+ *
+ * @param lattice A D2Q5 lattice, updated in place.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto collideBGK(Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice, Scalar relaxationFrequency)
+    -> void
+{
+    relaxBGK<D2Q5_DESCRIPTOR>(lattice, relaxationFrequency);
+}
+
+/**
+ * @brief Applies a fused BGK collision to every node of a D2Q9 lattice.
+ *
+ * @param lattice A D2Q9 lattice, updated in place.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto collideBGK(Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice, Scalar relaxationFrequency)
+    -> void
+{
+    relaxBGK<D2Q9_DESCRIPTOR>(lattice, relaxationFrequency);
+}
+
+/**
+ * @brief Applies a fused BGK collision to every node of a D2Q5 lattice with cached moments.
+ *
+ * @param lattice A D2Q5 lattice, updated in place.
+ * @param cache The moment cache of the lattice.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ * @throws std::invalid_argument If the cache belongs to another lattice.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto collideBGK(
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    MomentCache<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& cache,
+    Scalar relaxationFrequency
+) -> void
+{
+    relaxBGK<D2Q5_DESCRIPTOR>(lattice, cache, relaxationFrequency);
+}
+
+/**
+ * @brief Applies a fused BGK collision to every node of a D2Q9 lattice with cached moments.
+ *
+ * @param lattice A D2Q9 lattice, updated in place.
+ * @param cache The moment cache of the lattice.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ * @throws std::invalid_argument If the cache belongs to another lattice.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto collideBGK(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    MomentCache<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& cache,
+    Scalar relaxationFrequency
+) -> void
+{
+    relaxBGK<D2Q9_DESCRIPTOR>(lattice, cache, relaxationFrequency);
+}
+
+/**
+ * @brief Applies a fused BGK collision to every node of a mixed-precision D2Q5 lattice.
+ *
+ * @param lattice A mixed-precision D2Q5 lattice, updated in place.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ *
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::floating_point Scalar, StorageFormat Format>
+auto collideBGK(
+    MixedPrecisionLattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar, Format>& lattice,
+    Scalar relaxationFrequency
+) -> void
+{
+    relaxBGK<D2Q5_DESCRIPTOR>(lattice, relaxationFrequency);
+}
+
+/**
+ * @brief Applies a fused BGK collision to every node of a mixed-precision D2Q9 lattice.
+ *
+ * @param lattice A mixed-precision D2Q9 lattice, updated in place.
+ * @param relaxationFrequency The inverse of the relaxation time.
+ *
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::floating_point Scalar, StorageFormat Format>
+auto collideBGK(
+    MixedPrecisionLattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar, Format>& lattice,
+    Scalar relaxationFrequency
+) -> void
+{
+    relaxBGK<D2Q9_DESCRIPTOR>(lattice, relaxationFrequency);
+}
+
+#endif // COLLISION_BGK_TPP
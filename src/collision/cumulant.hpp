@@ -0,0 +1,76 @@
+#ifndef COLLISION_CUMULANT_HPP
+#define COLLISION_CUMULANT_HPP
+
+/**
+ * @file cumulant.hpp
+ * @brief Declaration of cumulant collision kernels for the D2Q9 lattice model.
+ */
+
+#include "../densityDistribution/d2q9.hpp"
+#include "../lattice/Lattice.hpp"
+#include "../lattice/MomentCache.hpp"
+#include "MomentTransform.hpp"
+#include "bgk.hpp"
+
+template <const auto& Descriptor>
+consteval auto tensorProductIndices();
+
+template <std::floating_point Scalar>
+constexpr auto forwardChimera(Scalar& lower, Scalar& center, Scalar& upper, Scalar velocity)
+    -> void;
+
+template <std::floating_point Scalar>
+constexpr auto backwardChimera(Scalar& lower, Scalar& center, Scalar& upper, Scalar velocity)
+    -> void;
+
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto relaxCumulant(Populations& populations, const RelaxationRates<Scalar>& rates)
+    -> void;
+
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto relaxCumulant(
+    Populations& populations,
+    Scalar density,
+    const std::array<Scalar, 2>& momentum,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto relaxCumulant(Lattice<Dimension, Size, Scalar>& lattice, const RelaxationRates<Scalar>& rates)
+    -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto relaxCumulant(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    MomentCache<Dimension, Size, Scalar>& cache,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+template <std::floating_point Scalar>
+constexpr auto collideCumulant(D2Q9<Scalar>& distribution, const RelaxationRates<Scalar>& rates)
+    -> void;
+
+template <std::floating_point Scalar>
+auto collideCumulant(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+template <std::floating_point Scalar>
+auto collideCumulant(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    MomentCache<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& cache,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+#include "cumulant.tpp"
+
+#endif // COLLISION_CUMULANT_HPP
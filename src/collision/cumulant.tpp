@@ -0,0 +1,436 @@
+#ifndef COLLISION_CUMULANT_TPP
+#define COLLISION_CUMULANT_TPP
+
+/**
+ * @file cumulant.tpp
+ * @brief Implementation of cumulant collision kernels for the D2Q9 lattice model.
+ */
+
+;
+#include "cumulant.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Arranges the lattice vectors of a two-dimensional tensor-product velocity set on a
+ * 3 x 3 grid.
+ *
+ * @return The index of the lattice vector with velocity (x, y) at position [x + 1][y + 1].
+ * @throws std::invalid_argument If the velocity set is not the tensor product of {-1, 0, 1}.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ */
+template <const auto& Descriptor>
+consteval auto tensorProductIndices()
+{
+    constexpr std::size_t size{Descriptor.velocities.size()};
+
+    std::array<std::array<std::size_t, 3>, 3> indices{};
+    std::array<std::array<bool, 3>, 3> found{};
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto& velocity{Descriptor.velocities[i]};
+        const auto x{static_cast<std::size_t>(velocity[0] + 1)};
+        const auto y{static_cast<std::size_t>(velocity[1] + 1)};
+        if (found[x][y])
+        {
+            throw std::invalid_argument{"velocity set repeats a lattice vector"};
+        }
+        indices[x][y] = i;
+        found[x][y] = true;
+    }
+
+    for (const auto& column : found)
+    {
+        for (const bool present : column)
+        {
+            if (!present)
+            {
+                throw std::invalid_argument{"velocity set is not a tensor product"};
+            }
+        }
+    }
+
+    return indices;
+}
+
+/**
+ * @brief Replaces three values along one axis of a tensor-product velocity set by their central
+ * moments of order zero, one and two along that axis.
+ *
+ * This is one pass of the central-moment transform of \cite Geier2015, which needs no matrix.
+ *
+ * @param lower The value at velocity component -1, replaced by the zeroth moment.
+ * @param center The value at velocity component 0, replaced by the first central moment.
+ * @param upper The value at velocity component 1, replaced by the second central moment.
+ * @param velocity The flow velocity component along the axis.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto forwardChimera(Scalar& lower, Scalar& center, Scalar& upper, Scalar velocity)
+    -> void
+{
+    const Scalar sum{lower + center + upper};
+    const Scalar difference{upper - lower};
+
+    center = difference - velocity * sum;
+    upper = upper + lower - Scalar{2.0} * velocity * difference + velocity * velocity * sum;
+    lower = sum;
+}
+
+/**
+ * @brief Inverts forwardChimera, replacing central moments of order zero, one and two along one
+ * axis by the values at velocity components -1, 0 and 1.
+ *
+ * @param lower The zeroth moment, replaced by the value at velocity component -1.
+ * @param center The first central moment, replaced by the value at velocity component 0.
+ * @param upper The second central moment, replaced by the value at velocity component 1.
+ * @param velocity The flow velocity component along the axis.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto backwardChimera(Scalar& lower, Scalar& center, Scalar& upper, Scalar velocity)
+    -> void
+{
+    const Scalar first{center + velocity * lower};
+    const Scalar second{upper + Scalar{2.0} * velocity * center + velocity * velocity * lower};
+
+    center = lower - second;
+    lower = Scalar{0.5} * (second - first);
+    upper = Scalar{0.5} * (second + first);
+}
+
+/**
+ * @brief Relaxes the cumulants of a single lattice node towards equilibrium.
+ *
+ * Transforms the populations to central moments with two chimera passes, relaxes the shear
+ * stresses with the shear rate, the trace of the normal stresses with the bulk rate and the
+ * third-order central moments and the fourth-order cumulant with the higher rate, and transforms
+ * back. The cumulants of order four and higher relax towards zero, and those of order three and
+ * below coincide with central moments on this velocity set. Density and momentum are summed from
+ * the populations.
+ *
+ * @param populations The populations of the lattice node, updated in place.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Descriptor The lattice descriptor of a two-dimensional tensor-product velocity set.
+ * @tparam Populations A container of Size scalar values that supports the subscript operator.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto relaxCumulant(Populations& populations, const RelaxationRates<Scalar>& rates)
+    -> void
+{
+    constexpr auto indices{tensorProductIndices<Descriptor>()};
+
+    Scalar density{-0.0};
+    std::array<Scalar, 2> momentum{-0.0, -0.0};
+    for (std::size_t x = 0; x < 3; ++x)
+    {
+        for (std::size_t y = 0; y < 3; ++y)
+        {
+            density += populations[indices[x][y]];
+        }
+    }
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        momentum[0] += populations[indices[2][i]] - populations[indices[0][i]];
+        momentum[1] += populations[indices[i][2]] - populations[indices[i][0]];
+    }
+
+    relaxCumulant<Descriptor>(populations, density, momentum, rates);
+}
+
+/**
+ * @brief Relaxes the cumulants of a single lattice node with known density and momentum towards
+ * equilibrium.
+ *
+ * Like the overload that takes the populations alone, but the central moments are taken about the
+ * flow velocity of the given moments, such as those of a MomentCache.
+ *
+ * @param populations The populations of the lattice node, updated in place.
+ * @param density The mass density of the node.
+ * @param momentum The momentum density of the node.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Descriptor The lattice descriptor of a two-dimensional tensor-product velocity set.
+ * @tparam Populations A container of Size scalar values that supports the subscript operator.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto relaxCumulant(
+    Populations& populations,
+    Scalar density,
+    const std::array<Scalar, 2>& momentum,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    static_assert(
+        Descriptor.velocities.size() == 9 && Descriptor.velocities[0].size() == 2,
+        "cumulant collision needs a two-dimensional tensor-product velocity set"
+    );
+
+    constexpr auto indices{tensorProductIndices<Descriptor>()};
+    constexpr auto soundSpeedSquared{static_cast<Scalar>(Descriptor.speedOfSoundSquared)};
+
+    std::array<std::array<Scalar, 3>, 3> moments;
+    for (std::size_t x = 0; x < 3; ++x)
+    {
+        for (std::size_t y = 0; y < 3; ++y)
+        {
+            moments[x][y] = populations[indices[x][y]];
+        }
+    }
+
+    const Scalar inverseDensity{Scalar{1.0} / density};
+    const Scalar velocityX{momentum[0] * inverseDensity};
+    const Scalar velocityY{momentum[1] * inverseDensity};
+
+    for (auto& column : moments)
+    {
+        forwardChimera(column[0], column[1], column[2], velocityY);
+    }
+    for (std::size_t y = 0; y < 3; ++y)
+    {
+        forwardChimera(moments[0][y], moments[1][y], moments[2][y], velocityX);
+    }
+
+    Scalar& xx{moments[2][0]};
+    Scalar& yy{moments[0][2]};
+    Scalar& xy{moments[1][1]};
+    Scalar& xxy{moments[2][1]};
+    Scalar& xyy{moments[1][2]};
+    Scalar& xxyy{moments[2][2]};
+
+    Scalar fourthCumulant{xxyy - (xx * yy + Scalar{2.0} * xy * xy) * inverseDensity};
+    Scalar deviator{xx - yy};
+    Scalar trace{xx + yy};
+
+    deviator -= rates.shear * deviator;
+    trace += rates.bulk * (Scalar{2.0} * soundSpeedSquared * density - trace);
+    xy -= rates.shear * xy;
+    xxy -= rates.higher * xxy;
+    xyy -= rates.higher * xyy;
+    fourthCumulant -= rates.higher * fourthCumulant;
+
+    xx = Scalar{0.5} * (trace + deviator);
+    yy = Scalar{0.5} * (trace - deviator);
+    xxyy = fourthCumulant + (xx * yy + Scalar{2.0} * xy * xy) * inverseDensity;
+
+    for (std::size_t y = 0; y < 3; ++y)
+    {
+        backwardChimera(moments[0][y], moments[1][y], moments[2][y], velocityX);
+    }
+    for (auto& column : moments)
+    {
+        backwardChimera(column[0], column[1], column[2], velocityY);
+    }
+
+    for (std::size_t x = 0; x < 3; ++x)
+    {
+        for (std::size_t y = 0; y < 3; ++y)
+        {
+            populations[indices[x][y]] = moments[x][y];
+        }
+    }
+}
+
+/**
+ * @brief Relaxes the cumulants of all nodes of a lattice towards equilibrium.
+ *
+ * Nodes are processed in blocks of COLLISION_BLOCK_SIZE through a local buffer, like the BGK
+ * kernel of a lattice.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Descriptor The lattice descriptor of a two-dimensional tensor-product velocity set.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto relaxCumulant(Lattice<Dimension, Size, Scalar>& lattice, const RelaxationRates<Scalar>& rates)
+    -> void
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match lattice");
+
+    const ScopedPhase phase{Phase::Collide, lattice.nodeCount()};
+
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, COLLISION_BLOCK_SIZE>, Size> block;
+
+    for (std::size_t first = 0; first < lattice.nodeCount(); first += COLLISION_BLOCK_SIZE)
+    {
+        const std::size_t count{std::min(COLLISION_BLOCK_SIZE, lattice.nodeCount() - first)};
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const auto population{lattice.population(i).subspan(first, count)};
+            std::copy(population.begin(), population.end(), block[i].begin());
+        }
+
+        for (std::size_t node = 0; node < count; ++node)
+        {
+            std::array<Scalar, Size> populations;
+            for (std::size_t i = 0; i < Size; ++i)
+            {
+                populations[i] = block[i][node];
+            }
+
+            relaxCumulant<Descriptor>(populations, rates);
+
+            for (std::size_t i = 0; i < Size; ++i)
+            {
+                block[i][node] = populations[i];
+            }
+        }
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const auto population{lattice.population(i).subspan(first, count)};
+            std::copy(block[i].begin(), block[i].begin() + count, population.begin());
+        }
+    }
+}
+
+/**
+ * @brief Relaxes the cumulants of all nodes of a lattice towards equilibrium with the density and
+ * momentum of a moment cache.
+ *
+ * Nodes are processed in blocks of COLLISION_BLOCK_SIZE like the kernel that sums the moments of
+ * each node itself. The collision changes the populations, so the cache is stale afterwards.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param cache The moment cache of the lattice.
+ * @param rates The relaxation frequencies.
+ * @throws std::invalid_argument If the cache belongs to another lattice.
+ *
+ * @tparam Descriptor The lattice descriptor of a two-dimensional tensor-product velocity set.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto relaxCumulant(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    MomentCache<Dimension, Size, Scalar>& cache,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match lattice");
+
+    if (&cache.lattice() != &lattice)
+    {
+        throw std::invalid_argument{"moment cache belongs to another lattice"};
+    }
+
+    const std::span<const Scalar> densities{cache.densities()};
+    const std::array<std::span<const Scalar>, Dimension> momenta{cache.momenta()};
+
+    const ScopedPhase phase{Phase::Collide, lattice.nodeCount()};
+
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, COLLISION_BLOCK_SIZE>, Size> block;
+
+    for (std::size_t first = 0; first < lattice.nodeCount(); first += COLLISION_BLOCK_SIZE)
+    {
+        const std::size_t count{std::min(COLLISION_BLOCK_SIZE, lattice.nodeCount() - first)};
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const auto population{lattice.population(i).subspan(first, count)};
+            std::copy(population.begin(), population.end(), block[i].begin());
+        }
+
+        for (std::size_t node = 0; node < count; ++node)
+        {
+            std::array<Scalar, Size> populations;
+            for (std::size_t i = 0; i < Size; ++i)
+            {
+                populations[i] = block[i][node];
+            }
+            std::array<Scalar, Dimension> momentum;
+            for (std::size_t axis = 0; axis < Dimension; ++axis)
+            {
+                momentum[axis] = momenta[axis][first + node];
+            }
+
+            relaxCumulant<Descriptor>(populations, densities[first + node], momentum, rates);
+
+            for (std::size_t i = 0; i < Size; ++i)
+            {
+                block[i][node] = populations[i];
+            }
+        }
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const auto population{lattice.population(i).subspan(first, count)};
+            std::copy(block[i].begin(), block[i].begin() + count, population.begin());
+        }
+    }
+}
+
+/**
+ * @brief Applies a cumulant collision to a D2Q9 density distribution.
+ *
+ * @param distribution A D2Q9 density distribution, updated in place.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto collideCumulant(D2Q9<Scalar>& distribution, const RelaxationRates<Scalar>& rates)
+    -> void
+{
+    relaxCumulant<D2Q9_DESCRIPTOR>(distribution, rates);
+}
+
+/**
+ * @brief Applies a cumulant collision to every node of a D2Q9 lattice.
+ *
+ * @param lattice A D2Q9 lattice, updated in place.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto collideCumulant(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    relaxCumulant<D2Q9_DESCRIPTOR>(lattice, rates);
+}
+
+/**
+ * @brief Applies a cumulant collision to every node of a D2Q9 lattice with cached moments.
+ *
+ * @param lattice A D2Q9 lattice, updated in place.
+ * @param cache The moment cache of the lattice.
+ * @param rates The relaxation frequencies.
+ * @throws std::invalid_argument If the cache belongs to another lattice.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto collideCumulant(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    MomentCache<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& cache,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    relaxCumulant<D2Q9_DESCRIPTOR>(lattice, cache, rates);
+}
+
+#endif // COLLISION_CUMULANT_TPP
@@ -0,0 +1,128 @@
+#ifndef COLLISION_MRT_HPP
+#define COLLISION_MRT_HPP
+
+/**
+ * @file mrt.hpp
+ * @brief Declaration of multiple-relaxation-time (MRT) collision kernels in raw-moment space for
+ * the D2Q9 and D3Q19 lattice models.
+ */
+
+#include "../densityDistribution/d2q9.hpp"
+#include "../densityDistribution/d3q19.hpp"
+#include "../lattice/Lattice.hpp"
+#include "../lattice/MomentCache.hpp"
+#include "MomentTransform.hpp"
+#include "bgk.hpp"
+
+template <const auto& Descriptor, std::floating_point Scalar>
+constexpr auto relaxRawMoments(
+    std::array<Scalar, Descriptor.velocities.size()>& moments,
+    Scalar density,
+    const std::array<Scalar, Descriptor.velocities[0].size()>& momentum,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto relaxMRT(Populations& populations, const RelaxationRates<Scalar>& rates) -> void;
+
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto relaxMRT(
+    Populations& populations,
+    Scalar density,
+    const std::array<Scalar, Descriptor.velocities[0].size()>& momentum,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto relaxBlockRawMoments(
+    std::array<std::array<Scalar, BlockSize>, Size>& moments,
+    std::size_t count,
+    const std::array<Scalar, BlockSize>& density,
+    const std::array<std::array<Scalar, BlockSize>, Descriptor.velocities[0].size()>& momentum,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto relaxMRT(
+    std::array<std::array<Scalar, BlockSize>, Size>& block,
+    std::size_t count,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto relaxMRT(
+    std::array<std::array<Scalar, BlockSize>, Size>& block,
+    std::size_t count,
+    const std::array<Scalar, BlockSize>& density,
+    const std::array<std::array<Scalar, BlockSize>, Descriptor.velocities[0].size()>& momentum,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto relaxMRT(Lattice<Dimension, Size, Scalar>& lattice, const RelaxationRates<Scalar>& rates)
+    -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto relaxMRT(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    MomentCache<Dimension, Size, Scalar>& cache,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+template <std::floating_point Scalar>
+constexpr auto collideMRT(D2Q9<Scalar>& distribution, const RelaxationRates<Scalar>& rates)
+    -> void;
+
+template <std::floating_point Scalar>
+constexpr auto collideMRT(D3Q19<Scalar>& distribution, const RelaxationRates<Scalar>& rates)
+    -> void;
+
+template <std::floating_point Scalar>
+auto collideMRT(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+template <std::floating_point Scalar>
+auto collideMRT(
+    Lattice<D3Q19_DIMENSION, D3Q19_SIZE, Scalar>& lattice,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+template <std::floating_point Scalar>
+auto collideMRT(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    MomentCache<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& cache,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+template <std::floating_point Scalar>
+auto collideMRT(
+    Lattice<D3Q19_DIMENSION, D3Q19_SIZE, Scalar>& lattice,
+    MomentCache<D3Q19_DIMENSION, D3Q19_SIZE, Scalar>& cache,
+    const RelaxationRates<Scalar>& rates
+) -> void;
+
+#include "mrt.tpp"
+
+#endif // COLLISION_MRT_HPP
@@ -0,0 +1,587 @@
+#ifndef COLLISION_MRT_TPP
+#define COLLISION_MRT_TPP
+
+/**
+ * @file mrt.tpp
+ * @brief Implementation of multiple-relaxation-time (MRT) collision kernels in raw-moment space
+ * for the D2Q9 and D3Q19 lattice models.
+ */
+
+;
+#include "mrt.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Relaxes the raw moments of a single lattice node towards equilibrium with one rate per
+ * kind of moment.
+ *
+ * Relaxes the deviatoric part of the normal stresses and the shear stresses with the shear rate,
+ * the trace of the normal stresses with the bulk rate and all higher moments with the higher rate
+ * towards the equilibrium moments of the given density and momentum. Density and momentum are not
+ * relaxed.
+ *
+ * @param moments The raw moments of the node in the moment basis of the descriptor, updated in
+ * place.
+ * @param density The mass density of the node.
+ * @param momentum The momentum density of the node.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+constexpr auto relaxRawMoments(
+    std::array<Scalar, Descriptor.velocities.size()>& moments,
+    Scalar density,
+    const std::array<Scalar, Descriptor.velocities[0].size()>& momentum,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    constexpr std::size_t size{Descriptor.velocities.size()};
+    constexpr auto kinds{momentKinds<Descriptor>()};
+
+    const Scalar inverseDensity{Scalar{1.0} / density};
+    std::array<Scalar, dimension> velocity;
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        velocity[axis] = momentum[axis] * inverseDensity;
+    }
+
+    const std::array<Scalar, size> equilibrium{
+        computeEquilibriumMoments<Descriptor>(density, velocity)
+    };
+
+    const Scalar trace{[&]<std::size_t... K>(std::index_sequence<K...>) {
+        Scalar sum{0.0};
+        ((sum += kinds[K] == MomentKind::NormalStress ? moments[K] - equilibrium[K] : Scalar{0.0}),
+         ...);
+        return sum / static_cast<Scalar>(dimension);
+    }(std::make_index_sequence<size>{})};
+
+    [&]<std::size_t... K>(std::index_sequence<K...>) {
+        (
+            [&] {
+                if constexpr (kinds[K] == MomentKind::NormalStress)
+                {
+                    moments[K] -= rates.shear * (moments[K] - equilibrium[K] - trace) +
+                                  rates.bulk * trace;
+                }
+                else if constexpr (kinds[K] == MomentKind::ShearStress)
+                {
+                    moments[K] -= rates.shear * (moments[K] - equilibrium[K]);
+                }
+                else if constexpr (kinds[K] == MomentKind::Higher)
+                {
+                    moments[K] -= rates.higher * (moments[K] - equilibrium[K]);
+                }
+            }(),
+            ...
+        );
+    }(std::make_index_sequence<size>{});
+}
+
+/**
+ * @brief Relaxes the raw moments of a single lattice node towards equilibrium with one rate per
+ * kind of moment.
+ *
+ * Transforms the populations to the moment basis of the descriptor, takes density and momentum
+ * from the transformed moments, relaxes the moments with relaxRawMoments and transforms back. Both
+ * transforms are generated from the descriptor at compile time.
+ *
+ * @param populations The populations of the lattice node, updated in place.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Populations A container of Size scalar values that supports the subscript operator.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto relaxMRT(Populations& populations, const RelaxationRates<Scalar>& rates) -> void
+{
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    constexpr std::size_t size{Descriptor.velocities.size()};
+
+    std::array<Scalar, size> moments;
+    transformToMoments<Descriptor>(populations, moments);
+
+    std::array<Scalar, dimension> momentum;
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        momentum[axis] = moments[1 + axis];
+    }
+
+    relaxRawMoments<Descriptor>(moments, moments[0], momentum, rates);
+
+    transformFromMoments<Descriptor>(moments, populations);
+}
+
+/**
+ * @brief Relaxes the raw moments of a single lattice node with known density and momentum towards
+ * equilibrium with one rate per kind of moment.
+ *
+ * Like the overload that takes the populations alone, but the equilibrium follows from the given
+ * moments, such as those of a MomentCache, instead of the transformed populations.
+ *
+ * @param populations The populations of the lattice node, updated in place.
+ * @param density The mass density of the node.
+ * @param momentum The momentum density of the node.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Populations A container of Size scalar values that supports the subscript operator.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, typename Populations, std::floating_point Scalar>
+constexpr auto relaxMRT(
+    Populations& populations,
+    Scalar density,
+    const std::array<Scalar, Descriptor.velocities[0].size()>& momentum,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    std::array<Scalar, Descriptor.velocities.size()> moments;
+    transformToMoments<Descriptor>(populations, moments);
+
+    relaxRawMoments<Descriptor>(moments, density, momentum, rates);
+
+    transformFromMoments<Descriptor>(moments, populations);
+}
+
+/**
+ * @brief Relaxes the raw moments of a block of lattice nodes towards equilibrium with one rate per
+ * kind of moment.
+ *
+ * The velocity terms of all nodes are computed first, and every later pass runs over the nodes of
+ * the block with unit stride for one moment at a time, so the compiler vectorizes it. Shear and
+ * higher moments are relaxed in the pass that computes their equilibrium, and the normal stresses
+ * in a second pass once their trace is known. The sums and their order are those of
+ * relaxRawMoments, so the result is the same for every node.
+ *
+ * @param moments The raw moments of the block in the moment basis of the descriptor, one array of
+ * nodes per moment, updated in place.
+ * @param count The number of nodes in the block.
+ * @param density The mass density of every node.
+ * @param momentum The momentum density of every node, one array per axis.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam BlockSize The capacity of the block in lattice nodes.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto relaxBlockRawMoments(
+    std::array<std::array<Scalar, BlockSize>, Size>& moments,
+    std::size_t count,
+    const std::array<Scalar, BlockSize>& density,
+    const std::array<std::array<Scalar, BlockSize>, Descriptor.velocities[0].size()>& momentum,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match block");
+
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    constexpr std::size_t termCount{dimension + dimension * dimension};
+    constexpr auto kinds{momentKinds<Descriptor>()};
+
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, BlockSize>, termCount> terms;
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, BlockSize>, Size> nonEquilibrium;
+    alignas(CACHE_LINE_SIZE) std::array<Scalar, BlockSize> trace;
+
+    for (std::size_t node = 0; node < count; ++node)
+    {
+        const Scalar inverseDensity{Scalar{1.0} / density[node]};
+        std::array<Scalar, dimension> velocity;
+        for (std::size_t a = 0; a < dimension; ++a)
+        {
+            velocity[a] = momentum[a][node] * inverseDensity;
+            terms[a][node] = velocity[a];
+        }
+        for (std::size_t a = 0; a < dimension; ++a)
+        {
+            for (std::size_t b = 0; b < dimension; ++b)
+            {
+                terms[dimension + a * dimension + b][node] =
+                    a <= b ? velocity[a] * velocity[b] : Scalar{0.0};
+            }
+        }
+    }
+
+    std::fill_n(trace.begin(), count, Scalar{0.0});
+
+    [&]<std::size_t... K>(std::index_sequence<K...>) {
+        const auto relaxOrDefer{[&]<std::size_t Moment>() {
+            if constexpr (kinds[Moment] != MomentKind::Conserved)
+            {
+                for (std::size_t node = 0; node < count; ++node)
+                {
+                    const Scalar deviation{
+                        moments[Moment][node] -
+                        density[node] * sumEquilibriumMoment<Descriptor, Moment, Scalar>(
+                                            BlockColumn<termCount, BlockSize, Scalar>{terms, node},
+                                            std::make_index_sequence<termCount>{}
+                                        )
+                    };
+
+                    if constexpr (kinds[Moment] == MomentKind::NormalStress)
+                    {
+                        nonEquilibrium[Moment][node] = deviation;
+                        trace[node] += deviation;
+                    }
+                    else if constexpr (kinds[Moment] == MomentKind::ShearStress)
+                    {
+                        moments[Moment][node] -= rates.shear * deviation;
+                    }
+                    else
+                    {
+                        moments[Moment][node] -= rates.higher * deviation;
+                    }
+                }
+            }
+        }};
+
+        (relaxOrDefer.template operator()<K>(), ...);
+    }(std::make_index_sequence<Size>{});
+
+    for (std::size_t node = 0; node < count; ++node)
+    {
+        trace[node] /= static_cast<Scalar>(dimension);
+    }
+
+    [&]<std::size_t... K>(std::index_sequence<K...>) {
+        const auto relaxNormalStress{[&]<std::size_t Moment>() {
+            if constexpr (kinds[Moment] == MomentKind::NormalStress)
+            {
+                for (std::size_t node = 0; node < count; ++node)
+                {
+                    moments[Moment][node] -=
+                        rates.shear * (nonEquilibrium[Moment][node] - trace[node]) +
+                        rates.bulk * trace[node];
+                }
+            }
+        }};
+
+        (relaxNormalStress.template operator()<K>(), ...);
+    }(std::make_index_sequence<Size>{});
+}
+
+/**
+ * @brief Relaxes the raw moments of a block of lattice nodes towards equilibrium.
+ *
+ * Transforms the block to moments with transformBlockToMoments, takes density and momentum from
+ * the transformed moments, relaxes them with relaxBlockRawMoments and transforms back, so every
+ * loop runs over the nodes of the block with unit stride.
+ *
+ * @param block The populations of the block, one array of nodes per lattice vector, updated in
+ * place.
+ * @param count The number of nodes in the block, which must not exceed BlockSize.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam BlockSize The capacity of the block in lattice nodes.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto relaxMRT(
+    std::array<std::array<Scalar, BlockSize>, Size>& block,
+    std::size_t count,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, BlockSize>, Size> moments;
+    alignas(CACHE_LINE_SIZE) std::array<Scalar, BlockSize> density;
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, BlockSize>, dimension> momentum;
+
+    transformBlockToMoments<Descriptor>(block, count, moments);
+
+    std::copy_n(moments[0].begin(), count, density.begin());
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        std::copy_n(moments[1 + axis].begin(), count, momentum[axis].begin());
+    }
+
+    relaxBlockRawMoments<Descriptor>(moments, count, density, momentum, rates);
+
+    transformBlockFromMoments<Descriptor>(moments, count, block);
+}
+
+/**
+ * @brief Relaxes the raw moments of a block of lattice nodes with known density and momentum
+ * towards equilibrium.
+ *
+ * Like the overload that takes the block alone, but the equilibrium follows from the given
+ * moments, such as those of a MomentCache, instead of the transformed populations.
+ *
+ * @param block The populations of the block, one array of nodes per lattice vector, updated in
+ * place.
+ * @param count The number of nodes in the block, which must not exceed BlockSize.
+ * @param density The mass density of every node.
+ * @param momentum The momentum density of every node, one array per axis.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam BlockSize The capacity of the block in lattice nodes.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Size,
+    std::size_t BlockSize,
+    std::floating_point Scalar>
+auto relaxMRT(
+    std::array<std::array<Scalar, BlockSize>, Size>& block,
+    std::size_t count,
+    const std::array<Scalar, BlockSize>& density,
+    const std::array<std::array<Scalar, BlockSize>, Descriptor.velocities[0].size()>& momentum,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, BlockSize>, Size> moments;
+
+    transformBlockToMoments<Descriptor>(block, count, moments);
+    relaxBlockRawMoments<Descriptor>(moments, count, density, momentum, rates);
+    transformBlockFromMoments<Descriptor>(moments, count, block);
+}
+
+/**
+ * @brief Relaxes the raw moments of all nodes of a lattice towards equilibrium.
+ *
+ * Nodes are processed in blocks of COLLISION_BLOCK_SIZE through a local buffer and collided by
+ * the block overload, whose loops all run over the nodes of the block with unit stride, like the
+ * BGK kernel of a lattice.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto relaxMRT(Lattice<Dimension, Size, Scalar>& lattice, const RelaxationRates<Scalar>& rates)
+    -> void
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match lattice");
+
+    const ScopedPhase phase{Phase::Collide, lattice.nodeCount()};
+
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, COLLISION_BLOCK_SIZE>, Size> block;
+
+    for (std::size_t first = 0; first < lattice.nodeCount(); first += COLLISION_BLOCK_SIZE)
+    {
+        const std::size_t count{std::min(COLLISION_BLOCK_SIZE, lattice.nodeCount() - first)};
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const auto population{lattice.population(i).subspan(first, count)};
+            std::copy(population.begin(), population.end(), block[i].begin());
+        }
+
+        relaxMRT<Descriptor>(block, count, rates);
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const auto population{lattice.population(i).subspan(first, count)};
+            std::copy(block[i].begin(), block[i].begin() + count, population.begin());
+        }
+    }
+}
+
+/**
+ * @brief Relaxes the raw moments of all nodes of a lattice towards equilibrium with the density and
+ * momentum of a moment cache.
+ *
+ * Nodes are processed in blocks of COLLISION_BLOCK_SIZE like the kernel that takes the moments
+ * from the transformed populations. The collision changes the populations, so the cache is stale
+ * afterwards.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param cache The moment cache of the lattice.
+ * @param rates The relaxation frequencies.
+ * @throws std::invalid_argument If the cache belongs to another lattice.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto relaxMRT(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    MomentCache<Dimension, Size, Scalar>& cache,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match lattice");
+
+    if (&cache.lattice() != &lattice)
+    {
+        throw std::invalid_argument{"moment cache belongs to another lattice"};
+    }
+
+    const std::span<const Scalar> densities{cache.densities()};
+    const std::array<std::span<const Scalar>, Dimension> momenta{cache.momenta()};
+
+    const ScopedPhase phase{Phase::Collide, lattice.nodeCount()};
+
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, COLLISION_BLOCK_SIZE>, Size> block;
+    alignas(CACHE_LINE_SIZE) std::array<Scalar, COLLISION_BLOCK_SIZE> density;
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, COLLISION_BLOCK_SIZE>, Dimension>
+        momentum;
+
+    for (std::size_t first = 0; first < lattice.nodeCount(); first += COLLISION_BLOCK_SIZE)
+    {
+        const std::size_t count{std::min(COLLISION_BLOCK_SIZE, lattice.nodeCount() - first)};
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const auto population{lattice.population(i).subspan(first, count)};
+            std::copy(population.begin(), population.end(), block[i].begin());
+        }
+
+        std::copy_n(densities.begin() + first, count, density.begin());
+        for (std::size_t axis = 0; axis < Dimension; ++axis)
+        {
+            std::copy_n(momenta[axis].begin() + first, count, momentum[axis].begin());
+        }
+
+        relaxMRT<Descriptor>(block, count, density, momentum, rates);
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const auto population{lattice.population(i).subspan(first, count)};
+            std::copy(block[i].begin(), block[i].begin() + count, population.begin());
+        }
+    }
+}
+
+/**
+ * @brief Applies an MRT collision to a D2Q9 density distribution.
+ *
+ * @param distribution A D2Q9 density distribution, updated in place.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto collideMRT(D2Q9<Scalar>& distribution, const RelaxationRates<Scalar>& rates)
+    -> void
+{
+    relaxMRT<D2Q9_DESCRIPTOR>(distribution, rates);
+}
+
+/**
+ * @brief Applies an MRT collision to a D3Q19 density distribution.
+ *
+ * @param distribution A D3Q19 density distribution, updated in place.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto collideMRT(D3Q19<Scalar>& distribution, const RelaxationRates<Scalar>& rates)
+    -> void
+{
+    relaxMRT<D3Q19_DESCRIPTOR>(distribution, rates);
+}
+
+/**
+ * @brief Applies an MRT collision to every node of a D2Q9 lattice.
+ *
+ * @param lattice A D2Q9 lattice, updated in place.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto collideMRT(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    relaxMRT<D2Q9_DESCRIPTOR>(lattice, rates);
+}
+
+/**
+ * @brief Applies an MRT collision to every node of a D3Q19 lattice.
+ *
+ * @param lattice A D3Q19 lattice, updated in place.
+ * @param rates The relaxation frequencies.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto collideMRT(
+    Lattice<D3Q19_DIMENSION, D3Q19_SIZE, Scalar>& lattice,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    relaxMRT<D3Q19_DESCRIPTOR>(lattice, rates);
+}
+
+/**
+ * @brief Applies an MRT collision to every node of a D2Q9 lattice with cached moments.
+ *
+ * @param lattice A D2Q9 lattice, updated in place.
+ * @param cache The moment cache of the lattice.
+ * @param rates The relaxation frequencies.
+ * @throws std::invalid_argument If the cache belongs to another lattice.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto collideMRT(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    MomentCache<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& cache,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    relaxMRT<D2Q9_DESCRIPTOR>(lattice, cache, rates);
+}
+
+/**
+ * @brief Applies an MRT collision to every node of a D3Q19 lattice with cached moments.
+ *
+ * @param lattice A D3Q19 lattice, updated in place.
+ * @param cache The moment cache of the lattice.
+ * @param rates The relaxation frequencies.
+ * @throws std::invalid_argument If the cache belongs to another lattice.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto collideMRT(
+    Lattice<D3Q19_DIMENSION, D3Q19_SIZE, Scalar>& lattice,
+    MomentCache<D3Q19_DIMENSION, D3Q19_SIZE, Scalar>& cache,
+    const RelaxationRates<Scalar>& rates
+) -> void
+{
+    relaxMRT<D3Q19_DESCRIPTOR>(lattice, cache, rates);
+}
+
+#endif // COLLISION_MRT_TPP
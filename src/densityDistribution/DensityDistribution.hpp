@@ -7,34 +7,72 @@
  * distribution at a lattice node.
  */
 
+#include "DensityDistributionExpression.hpp"
+
 #include <array>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+
+/**
+ * @brief Enables bounds checking in the run-time subscript operators of DensityDistribution.
+ *
+ * Defaults to enabled in debug builds and disabled when NDEBUG is defined, so that release builds
+ * take the unchecked hot path. It can be overridden by defining it to 0 or 1 before inclusion.
+ */
+#ifndef LATTICEFLOW_BOUNDS_CHECKING
+#ifdef NDEBUG
+#define LATTICEFLOW_BOUNDS_CHECKING 0
+#else
+#define LATTICEFLOW_BOUNDS_CHECKING 1
+#endif
+#endif
 
 /**
  * @class DensityDistribution
  * @brief A class template representing a generic density distribution at a lattice node.
  *
  * This class template provides functionalities to manage and access a density distribution
- * represented as an one-dimensional array of scalar values.
+ * represented as an one-dimensional array of scalar values. All member functions are usable in
+ * constant expressions. Arithmetic expressions with matching template parameters can be assigned
+ * to it, which evaluates them element-wise in a single loop.
  *
  * @tparam Dimension The number of spatial dimensions.
  * @tparam Size The number of lattice vectors at each lattice node.
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-class DensityDistribution
+class DensityDistribution : public DensityDistributionExpression<
+                                Dimension,
+                                Size,
+                                Scalar,
+                                DensityDistribution<Dimension, Size, Scalar>>
 {
 public:
-    DensityDistribution();
-    DensityDistribution(std::initializer_list<Scalar> distribution);
-
-    auto operator[](std::size_t index) -> Scalar&;
-    auto operator[](std::size_t index) const -> const Scalar&;
-    auto begin() -> std::array<Scalar, Size>::iterator;
-    auto begin() const -> std::array<Scalar, Size>::const_iterator;
-    auto end() -> std::array<Scalar, Size>::iterator;
-    auto end() const -> std::array<Scalar, Size>::const_iterator;
-    auto cbegin() const -> std::array<Scalar, Size>::const_iterator;
-    auto cend() const -> std::array<Scalar, Size>::const_iterator;
+    constexpr DensityDistribution();
+    constexpr DensityDistribution(std::initializer_list<Scalar> distribution);
+    template <typename Expression>
+    constexpr DensityDistribution(
+        const DensityDistributionExpression<Dimension, Size, Scalar, Expression>& expression
+    );
+
+    template <typename Expression>
+    constexpr auto operator=(
+        const DensityDistributionExpression<Dimension, Size, Scalar, Expression>& expression
+    ) -> DensityDistribution&;
+
+    constexpr auto operator[](std::size_t index) -> Scalar&;
+    constexpr auto operator[](std::size_t index) const -> const Scalar&;
+    template <std::size_t Index>
+    constexpr auto get() -> Scalar&;
+    template <std::size_t Index>
+    constexpr auto get() const -> const Scalar&;
+    constexpr auto begin() -> std::array<Scalar, Size>::iterator;
+    constexpr auto begin() const -> std::array<Scalar, Size>::const_iterator;
+    constexpr auto end() -> std::array<Scalar, Size>::iterator;
+    constexpr auto end() const -> std::array<Scalar, Size>::const_iterator;
+    constexpr auto cbegin() const -> std::array<Scalar, Size>::const_iterator;
+    constexpr auto cend() const -> std::array<Scalar, Size>::const_iterator;
 
     constexpr auto dimension() const -> std::size_t;
     constexpr auto size() const -> std::size_t;
@@ -10,6 +10,8 @@
 ;
 #include "DensityDistribution.hpp"
 
+#include <algorithm>
+
 /**
  * @brief Default constructor for DensityDistribution.
  *
@@ -20,7 +22,7 @@
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-DensityDistribution<Dimension, Size, Scalar>::DensityDistribution() : distribution_{0.0}
+constexpr DensityDistribution<Dimension, Size, Scalar>::DensityDistribution() : distribution_{}
 {
 }
 
@@ -36,16 +38,73 @@ DensityDistribution<Dimension, Size, Scalar>::DensityDistribution() : distributi
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-DensityDistribution<Dimension, Size, Scalar>::DensityDistribution(
+constexpr DensityDistribution<Dimension, Size, Scalar>::DensityDistribution(
     std::initializer_list<Scalar> distribution
 )
+    : distribution_{}
 {
     std::copy(distribution.begin(), distribution.end(), distribution_.begin());
 }
 
+/**
+ * @brief Constructor for DensityDistribution from an arithmetic expression.
+ *
+ * Evaluates the expression element-wise in a single loop.
+ *
+ * @param expression The expression to evaluate.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Expression The type of the expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+template <typename Expression>
+constexpr DensityDistribution<Dimension, Size, Scalar>::DensityDistribution(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Expression>& expression
+)
+    : distribution_{}
+{
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        distribution_[i] = expression.derived()[i];
+    }
+}
+
+/**
+ * @brief Assigns an arithmetic expression to a DensityDistribution.
+ *
+ * Evaluates the expression element-wise in a single loop. Since every element of an expression
+ * only depends on the elements of its operands at the same index, the expression may refer to the
+ * assigned density distribution itself.
+ *
+ * @param expression The expression to evaluate.
+ * @return Reference to the assigned density distribution.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Expression The type of the expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+template <typename Expression>
+constexpr auto DensityDistribution<Dimension, Size, Scalar>::operator=(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Expression>& expression
+) -> DensityDistribution&
+{
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        distribution_[i] = expression.derived()[i];
+    }
+
+    return *this;
+}
+
 /**
  * @brief Subscript operator for non-const DensityDistribution objects.
  *
+ * The index is bounds-checked only if LATTICEFLOW_BOUNDS_CHECKING is enabled.
+ *
  * @param index Index of the element to access.
  * @return Non-const reference to the element at the specified index.
  *
@@ -54,14 +113,24 @@ DensityDistribution<Dimension, Size, Scalar>::DensityDistribution(
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-auto DensityDistribution<Dimension, Size, Scalar>::operator[](std::size_t index) -> Scalar&
+constexpr auto DensityDistribution<Dimension, Size, Scalar>::operator[](std::size_t index)
+    -> Scalar&
 {
-    return distribution_.at(index);
+    if constexpr (LATTICEFLOW_BOUNDS_CHECKING)
+    {
+        return distribution_.at(index);
+    }
+    else
+    {
+        return distribution_[index];
+    }
 }
 
 /**
  * @brief Subscript operator for const DensityDistribution objects.
  *
+ * The index is bounds-checked only if LATTICEFLOW_BOUNDS_CHECKING is enabled.
+ *
  * @param index Index of the element to access.
  * @return Const reference to the element at the specified index.
  *
@@ -70,10 +139,59 @@ auto DensityDistribution<Dimension, Size, Scalar>::operator[](std::size_t index)
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-auto DensityDistribution<Dimension, Size, Scalar>::operator[](std::size_t index
+constexpr auto DensityDistribution<Dimension, Size, Scalar>::operator[](std::size_t index
 ) const -> const Scalar&
 {
-    return distribution_.at(index);
+    if constexpr (LATTICEFLOW_BOUNDS_CHECKING)
+    {
+        return distribution_.at(index);
+    }
+    else
+    {
+        return distribution_[index];
+    }
+}
+
+/**
+ * @brief Compile-time indexed element access for non-const DensityDistribution objects.
+ *
+ * The index is checked at compile time, so no run-time bounds check is ever performed.
+ *
+ * @return Non-const reference to the element at the specified index.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Index Index of the element to access.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+template <std::size_t Index>
+constexpr auto DensityDistribution<Dimension, Size, Scalar>::get() -> Scalar&
+{
+    static_assert(Index < Size, "Index must be smaller than the number of lattice vectors");
+
+    return std::get<Index>(distribution_);
+}
+
+/**
+ * @brief Compile-time indexed element access for const DensityDistribution objects.
+ *
+ * The index is checked at compile time, so no run-time bounds check is ever performed.
+ *
+ * @return Const reference to the element at the specified index.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Index Index of the element to access.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+template <std::size_t Index>
+constexpr auto DensityDistribution<Dimension, Size, Scalar>::get() const -> const Scalar&
+{
+    static_assert(Index < Size, "Index must be smaller than the number of lattice vectors");
+
+    return std::get<Index>(distribution_);
 }
 
 /**
@@ -86,7 +204,8 @@ auto DensityDistribution<Dimension, Size, Scalar>::operator[](std::size_t index
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-auto DensityDistribution<Dimension, Size, Scalar>::begin() -> std::array<Scalar, Size>::iterator
+constexpr auto DensityDistribution<Dimension, Size, Scalar>::begin()
+    -> std::array<Scalar, Size>::iterator
 {
     return distribution_.begin();
 }
@@ -101,7 +220,7 @@ auto DensityDistribution<Dimension, Size, Scalar>::begin() -> std::array<Scalar,
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-auto DensityDistribution<Dimension, Size, Scalar>::begin() const
+constexpr auto DensityDistribution<Dimension, Size, Scalar>::begin() const
     -> std::array<Scalar, Size>::const_iterator
 {
     return distribution_.begin();
@@ -117,7 +236,8 @@ auto DensityDistribution<Dimension, Size, Scalar>::begin() const
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-auto DensityDistribution<Dimension, Size, Scalar>::end() -> std::array<Scalar, Size>::iterator
+constexpr auto DensityDistribution<Dimension, Size, Scalar>::end()
+    -> std::array<Scalar, Size>::iterator
 {
     return distribution_.end();
 }
@@ -132,7 +252,7 @@ auto DensityDistribution<Dimension, Size, Scalar>::end() -> std::array<Scalar, S
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-auto DensityDistribution<Dimension, Size, Scalar>::end() const
+constexpr auto DensityDistribution<Dimension, Size, Scalar>::end() const
     -> std::array<Scalar, Size>::const_iterator
 {
     return distribution_.end();
@@ -148,7 +268,7 @@ auto DensityDistribution<Dimension, Size, Scalar>::end() const
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-auto DensityDistribution<Dimension, Size, Scalar>::cbegin() const
+constexpr auto DensityDistribution<Dimension, Size, Scalar>::cbegin() const
     -> std::array<Scalar, Size>::const_iterator
 {
     return distribution_.cbegin();
@@ -164,7 +284,7 @@ auto DensityDistribution<Dimension, Size, Scalar>::cbegin() const
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-auto DensityDistribution<Dimension, Size, Scalar>::cend() const
+constexpr auto DensityDistribution<Dimension, Size, Scalar>::cend() const
     -> std::array<Scalar, Size>::const_iterator
 {
     return distribution_.cend();
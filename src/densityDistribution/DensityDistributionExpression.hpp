@@ -0,0 +1,198 @@
+#ifndef DENSITY_DISTRIBUTION_EXPRESSION_HPP
+#define DENSITY_DISTRIBUTION_EXPRESSION_HPP
+
+/**
+ * @file DensityDistributionExpression.hpp
+ * @brief Declaration of the expression templates that represent lazily evaluated element-wise
+ * arithmetic on density distributions.
+ */
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+class DensityDistribution;
+
+/**
+ * @class DensityDistributionExpression
+ * @brief A CRTP base class template for everything that evaluates element-wise to a density
+ * distribution.
+ *
+ * Density distributions and arithmetic expressions on them derive from this class template, so
+ * operators can require operands with matching template parameters. Elements are only computed
+ * when an expression is assigned to a DensityDistribution, which evaluates the whole expression in
+ * a single loop without temporaries.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Derived The type of the derived expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Derived>
+class DensityDistributionExpression
+{
+public:
+    constexpr auto operator[](std::size_t index) const -> Scalar;
+    constexpr auto derived() const -> const Derived&;
+};
+
+/**
+ * @brief Type trait that selects how an expression stores one of its operands.
+ *
+ * Density distributions are stored by reference to avoid copies, while nested expressions are
+ * small and stored by value so that they outlive the full-expression that created them. A
+ * temporary density distribution is marked by a const-qualified operand type and stored by value
+ * as well, so an expression built from it never refers to a destroyed object.
+ *
+ * @tparam Operand The type of the operand.
+ */
+template <typename Operand>
+struct ExpressionOperand
+{
+    using type = Operand;
+};
+
+/**
+ * @brief Specialization of ExpressionOperand that stores density distributions by reference.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+struct ExpressionOperand<DensityDistribution<Dimension, Size, Scalar>>
+{
+    using type = const DensityDistribution<Dimension, Size, Scalar>&;
+};
+
+/**
+ * @brief Alias template for the operand type that marks a temporary density distribution, which an
+ * expression stores by value.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+using OwnedDensityDistribution = const DensityDistribution<Dimension, Size, Scalar>;
+
+/**
+ * @brief Specialization of ExpressionOperand that stores temporary density distributions by value.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+struct ExpressionOperand<const DensityDistribution<Dimension, Size, Scalar>>
+{
+    using type = DensityDistribution<Dimension, Size, Scalar>;
+};
+
+/**
+ * @class DensityDistributionBinaryExpression
+ * @brief An expression that combines two density distribution expressions element-wise.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Lhs The type of the left-hand side expression.
+ * @tparam Rhs The type of the right-hand side expression.
+ * @tparam Operation The binary function object applied to each pair of elements.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Lhs,
+    typename Rhs,
+    typename Operation>
+class DensityDistributionBinaryExpression
+    : public DensityDistributionExpression<
+          Dimension,
+          Size,
+          Scalar,
+          DensityDistributionBinaryExpression<Dimension, Size, Scalar, Lhs, Rhs, Operation>>
+{
+public:
+    constexpr DensityDistributionBinaryExpression(const Lhs& lhs, const Rhs& rhs);
+
+    constexpr auto operator[](std::size_t index) const -> Scalar;
+
+private:
+    typename ExpressionOperand<Lhs>::type lhs_;
+    typename ExpressionOperand<Rhs>::type rhs_;
+};
+
+/**
+ * @class DensityDistributionScalarExpression
+ * @brief An expression that combines every element of a density distribution expression with a
+ * scalar value.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Operand The type of the density distribution expression.
+ * @tparam Operation The binary function object applied to each element and the scalar value.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Operand,
+    typename Operation>
+class DensityDistributionScalarExpression
+    : public DensityDistributionExpression<
+          Dimension,
+          Size,
+          Scalar,
+          DensityDistributionScalarExpression<Dimension, Size, Scalar, Operand, Operation>>
+{
+public:
+    constexpr DensityDistributionScalarExpression(const Operand& operand, Scalar scalar);
+
+    constexpr auto operator[](std::size_t index) const -> Scalar;
+
+private:
+    typename ExpressionOperand<Operand>::type operand_;
+    Scalar scalar_;
+};
+
+/**
+ * @brief Alias template for the element-wise sum of two density distribution expressions.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Lhs,
+    typename Rhs>
+using DensityDistributionSum =
+    DensityDistributionBinaryExpression<Dimension, Size, Scalar, Lhs, Rhs, std::plus<Scalar>>;
+
+/**
+ * @brief Alias template for the element-wise difference of two density distribution expressions.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Lhs,
+    typename Rhs>
+using DensityDistributionDifference =
+    DensityDistributionBinaryExpression<Dimension, Size, Scalar, Lhs, Rhs, std::minus<Scalar>>;
+
+/**
+ * @brief Alias template for a density distribution expression multiplied by a scalar value.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Operand>
+using DensityDistributionProduct =
+    DensityDistributionScalarExpression<Dimension, Size, Scalar, Operand, std::multiplies<Scalar>>;
+
+/**
+ * @brief Alias template for a density distribution expression divided by a scalar value.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Operand>
+using DensityDistributionQuotient =
+    DensityDistributionScalarExpression<Dimension, Size, Scalar, Operand, std::divides<Scalar>>;
+
+#include "DensityDistributionExpression.tpp"
+
+#endif // DENSITY_DISTRIBUTION_EXPRESSION_HPP
@@ -0,0 +1,149 @@
+#ifndef DENSITY_DISTRIBUTION_EXPRESSION_TPP
+#define DENSITY_DISTRIBUTION_EXPRESSION_TPP
+
+/**
+ * @file DensityDistributionExpression.tpp
+ * @brief Implementation of the expression templates that represent lazily evaluated element-wise
+ * arithmetic on density distributions.
+ */
+
+;
+#include "DensityDistributionExpression.hpp"
+
+/**
+ * @brief Evaluates the expression at a single index.
+ *
+ * @param index Index of the element to evaluate.
+ * @return The value of the expression at the specified index.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Derived The type of the derived expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Derived>
+constexpr auto DensityDistributionExpression<Dimension, Size, Scalar, Derived>::operator[](
+    std::size_t index
+) const -> Scalar
+{
+    return derived()[index];
+}
+
+/**
+ * @brief Returns the expression as its derived type.
+ *
+ * @return Const reference to the derived expression.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Derived The type of the derived expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Derived>
+constexpr auto DensityDistributionExpression<Dimension, Size, Scalar, Derived>::derived() const
+    -> const Derived&
+{
+    return static_cast<const Derived&>(*this);
+}
+
+/**
+ * @brief Constructor for DensityDistributionBinaryExpression.
+ *
+ * @param lhs The left-hand side expression.
+ * @param rhs The right-hand side expression.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Lhs The type of the left-hand side expression.
+ * @tparam Rhs The type of the right-hand side expression.
+ * @tparam Operation The binary function object applied to each pair of elements.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Lhs,
+    typename Rhs,
+    typename Operation>
+constexpr DensityDistributionBinaryExpression<Dimension, Size, Scalar, Lhs, Rhs, Operation>::
+    DensityDistributionBinaryExpression(const Lhs& lhs, const Rhs& rhs)
+    : lhs_{lhs}, rhs_{rhs}
+{
+}
+
+/**
+ * @brief Evaluates the binary expression at a single index.
+ *
+ * @param index Index of the element to evaluate.
+ * @return The operation applied to the elements of both operands at the specified index.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Lhs The type of the left-hand side expression.
+ * @tparam Rhs The type of the right-hand side expression.
+ * @tparam Operation The binary function object applied to each pair of elements.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Lhs,
+    typename Rhs,
+    typename Operation>
+constexpr auto DensityDistributionBinaryExpression<Dimension, Size, Scalar, Lhs, Rhs, Operation>::
+operator[](std::size_t index) const -> Scalar
+{
+    return Operation{}(lhs_[index], rhs_[index]);
+}
+
+/**
+ * @brief Constructor for DensityDistributionScalarExpression.
+ *
+ * @param operand The density distribution expression.
+ * @param scalar The scalar value.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Operand The type of the density distribution expression.
+ * @tparam Operation The binary function object applied to each element and the scalar value.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Operand,
+    typename Operation>
+constexpr DensityDistributionScalarExpression<Dimension, Size, Scalar, Operand, Operation>::
+    DensityDistributionScalarExpression(const Operand& operand, Scalar scalar)
+    : operand_{operand}, scalar_{scalar}
+{
+}
+
+/**
+ * @brief Evaluates the scalar expression at a single index.
+ *
+ * @param index Index of the element to evaluate.
+ * @return The operation applied to the element of the operand and the scalar value.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Operand The type of the density distribution expression.
+ * @tparam Operation The binary function object applied to each element and the scalar value.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Operand,
+    typename Operation>
+constexpr auto DensityDistributionScalarExpression<Dimension, Size, Scalar, Operand, Operation>::
+operator[](std::size_t index) const -> Scalar
+{
+    return Operation{}(operand_[index], scalar_);
+}
+
+#endif // DENSITY_DISTRIBUTION_EXPRESSION_TPP
@@ -0,0 +1,94 @@
+#ifndef DENSITY_DISTRIBUTION_LATTICE_DESCRIPTOR_HPP
+#define DENSITY_DISTRIBUTION_LATTICE_DESCRIPTOR_HPP
+
+/**
+ * @file LatticeDescriptor.hpp
+ * @brief Declaration of the LatticeDescriptor class template that describes a lattice model at
+ * compile time, and of moment and equilibrium functions generated from it.
+ */
+
+#include "DensityDistribution.hpp"
+
+#include <array>
+#include <cstddef>
+
+/**
+ * @struct LatticeDescriptor
+ * @brief A literal type holding the velocity set, weights, opposite-direction table and squared
+ * speed of sound of a lattice model.
+ *
+ * Descriptors are meant to be constexpr objects with static storage duration that are passed to
+ * the generic functions below as template arguments, so that every loop over lattice vectors is
+ * unrolled at compile time and every velocity component becomes a constant. Weights and speed of
+ * sound are stored in double precision and rounded to the scalar type of the computation.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ */
+template <std::size_t Dimension, std::size_t Size>
+struct LatticeDescriptor
+{
+    std::array<std::array<int, Dimension>, Size> velocities;
+    std::array<double, Size> weights;
+    std::array<std::size_t, Size> opposites;
+    double speedOfSoundSquared;
+};
+
+template <std::size_t Dimension, std::size_t Size>
+consteval auto makeLatticeDescriptor(
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<double, Size>& weights,
+    double speedOfSoundSquared
+) -> LatticeDescriptor<Dimension, Size>;
+
+template <const auto& Descriptor, std::size_t Axis, int Sign>
+consteval auto directionsAlong();
+
+template <
+    const auto& Descriptor,
+    std::size_t Axis,
+    int Sign,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+constexpr auto sumPopulationsAlong(
+    const DensityDistribution<Dimension, Size, Scalar>& distribution
+) -> Scalar;
+
+template <
+    const auto& Descriptor,
+    std::size_t Direction,
+    std::size_t Dimension,
+    std::floating_point Scalar>
+constexpr auto projectVelocity(const std::array<Scalar, Dimension>& velocity) -> Scalar;
+
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+constexpr auto computeDensity(const DensityDistribution<Dimension, Size, Scalar>& distribution)
+    -> Scalar;
+
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+constexpr auto computeMomentum(const DensityDistribution<Dimension, Size, Scalar>& distribution)
+    -> std::array<Scalar, Dimension>;
+
+template <const auto& Descriptor, std::size_t Direction, std::floating_point Scalar>
+constexpr auto computeEquilibriumPopulation(
+    Scalar density,
+    Scalar projection,
+    Scalar velocitySquared
+) -> Scalar;
+
+template <const auto& Descriptor, std::size_t Dimension, std::floating_point Scalar>
+constexpr auto computeEquilibrium(Scalar density, const std::array<Scalar, Dimension>& velocity)
+    -> DensityDistribution<Dimension, Descriptor.velocities.size(), Scalar>;
+
+#include "LatticeDescriptor.tpp"
+
+#endif // DENSITY_DISTRIBUTION_LATTICE_DESCRIPTOR_HPP
@@ -0,0 +1,309 @@
+#ifndef DENSITY_DISTRIBUTION_LATTICE_DESCRIPTOR_TPP
+#define DENSITY_DISTRIBUTION_LATTICE_DESCRIPTOR_TPP
+
+/**
+ * @file LatticeDescriptor.tpp
+ * @brief Implementation of the LatticeDescriptor class template that describes a lattice model at
+ * compile time, and of moment and equilibrium functions generated from it.
+ */
+
+;
+#include "LatticeDescriptor.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Returns the lattice vectors whose component along an axis has a given sign.
+ *
+ * @return The indices of the lattice vectors in increasing order.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Axis The index of the spatial axis.
+ * @tparam Sign The sign of the velocity component, either 1 or -1.
+ */
+template <const auto& Descriptor, std::size_t Axis, int Sign>
+consteval auto directionsAlong()
+{
+    constexpr std::size_t count{[] {
+        std::size_t directions{0};
+        for (const auto& velocity : Descriptor.velocities)
+        {
+            directions += velocity[Axis] == Sign ? 1 : 0;
+        }
+        return directions;
+    }()};
+
+    std::array<std::size_t, count> directions{};
+    std::size_t next{0};
+    for (std::size_t i = 0; i < Descriptor.velocities.size(); ++i)
+    {
+        if (Descriptor.velocities[i][Axis] == Sign)
+        {
+            directions[next++] = i;
+        }
+    }
+
+    return directions;
+}
+
+/**
+ * @brief Sums the populations of the lattice vectors whose component along an axis has a sign.
+ *
+ * The sum is a left fold in the order of the lattice vectors, without an initial zero.
+ *
+ * @param distribution The density distribution.
+ * @return The sum of the selected populations, or zero if there are none.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Axis The index of the spatial axis.
+ * @tparam Sign The sign of the velocity component, either 1 or -1.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Axis,
+    int Sign,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+constexpr auto sumPopulationsAlong(
+    const DensityDistribution<Dimension, Size, Scalar>& distribution
+) -> Scalar
+{
+    constexpr std::size_t count{directionsAlong<Descriptor, Axis, Sign>().size()};
+
+    if constexpr (count == 0)
+    {
+        static_cast<void>(distribution);
+        return Scalar{0.0};
+    }
+    else
+    {
+        return [&]<std::size_t... J>(std::index_sequence<J...>) {
+            return (... + distribution.template get<directionsAlong<Descriptor, Axis, Sign>()[J]>()
+            );
+        }(std::make_index_sequence<count>{});
+    }
+}
+
+/**
+ * @brief Projects a velocity onto a lattice vector.
+ *
+ * The products with the constant velocity components are kept, including those with zero
+ * components, so that the projections onto all lattice vectors form isomorphic expressions that
+ * the compiler can evaluate in SIMD registers.
+ *
+ * @param velocity The velocity.
+ * @return The scalar product of the lattice vector and the velocity.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Direction The index of the lattice vector.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Direction,
+    std::size_t Dimension,
+    std::floating_point Scalar>
+constexpr auto projectVelocity(const std::array<Scalar, Dimension>& velocity) -> Scalar
+{
+    return [&]<std::size_t... Axis>(std::index_sequence<Axis...>) {
+        return (
+            ... + (static_cast<Scalar>(Descriptor.velocities[Direction][Axis]) * velocity[Axis])
+        );
+    }(std::make_index_sequence<Dimension>{});
+}
+
+/**
+ * @brief Creates a lattice descriptor and derives its opposite-direction table.
+ *
+ * Fails to compile if a velocity component lies outside {-1, 0, 1} or if a lattice vector has no
+ * opposite in the velocity set.
+ *
+ * @param velocities The lattice velocities.
+ * @param weights The lattice weights, in the same order as the lattice velocities.
+ * @param speedOfSoundSquared The squared speed of sound in lattice units.
+ * @return The lattice descriptor.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ */
+template <std::size_t Dimension, std::size_t Size>
+consteval auto makeLatticeDescriptor(
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<double, Size>& weights,
+    double speedOfSoundSquared
+) -> LatticeDescriptor<Dimension, Size>
+{
+    std::array<std::size_t, Size> opposites{};
+
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        bool found{false};
+
+        for (std::size_t j = 0; j < Size; ++j)
+        {
+            bool opposite{true};
+            for (std::size_t axis = 0; axis < Dimension; ++axis)
+            {
+                if (velocities[i][axis] < -1 || velocities[i][axis] > 1)
+                {
+                    throw std::invalid_argument{"velocity components must lie in {-1, 0, 1}"};
+                }
+                opposite = opposite && velocities[j][axis] == -velocities[i][axis];
+            }
+
+            if (opposite)
+            {
+                opposites[i] = j;
+                found = true;
+            }
+        }
+
+        if (!found)
+        {
+            throw std::invalid_argument{"every lattice vector needs an opposite"};
+        }
+    }
+
+    return {velocities, weights, opposites, speedOfSoundSquared};
+}
+
+/**
+ * @brief Computes the mass density of a density distribution from a lattice descriptor.
+ *
+ * The sum is fully unrolled and adds the populations in lattice vector order.
+ *
+ * @param distribution A density distribution of the described lattice model.
+ * @return The mass density of the density distribution.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+constexpr auto computeDensity(const DensityDistribution<Dimension, Size, Scalar>& distribution)
+    -> Scalar
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match distribution");
+
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+        return (... + distribution.template get<I>());
+    }(std::make_index_sequence<Size>{});
+}
+
+/**
+ * @brief Computes the momentum density of a density distribution from a lattice descriptor.
+ *
+ * Each component is the sum of the populations with a positive velocity component minus the sum of
+ * those with a negative one, so no population is multiplied by a velocity component.
+ *
+ * @param distribution A density distribution of the described lattice model.
+ * @return The momentum density of the density distribution.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+constexpr auto computeMomentum(const DensityDistribution<Dimension, Size, Scalar>& distribution)
+    -> std::array<Scalar, Dimension>
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match distribution");
+
+    return [&]<std::size_t... Axis>(std::index_sequence<Axis...>) {
+        return std::array<Scalar, Dimension>{
+            (sumPopulationsAlong<Descriptor, Axis, 1>(distribution) -
+             sumPopulationsAlong<Descriptor, Axis, -1>(distribution))...
+        };
+    }(std::make_index_sequence<Dimension>{});
+}
+
+/**
+ * @brief Computes the second-order equilibrium of a lattice model for one lattice vector.
+ *
+ * Evaluates the equilibrium of \cite Kruger2017 with all factors derived from the squared speed of
+ * sound at compile time and the projection terms in Horner form. This is the single definition of
+ * the equilibrium that the node and bulk equilibrium functions share.
+ *
+ * @param density The mass density.
+ * @param projection The scalar product of the lattice vector and the flow velocity.
+ * @param velocitySquared The squared magnitude of the flow velocity.
+ * @return The equilibrium population of the lattice vector.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Direction The index of the lattice vector.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::size_t Direction, std::floating_point Scalar>
+constexpr auto computeEquilibriumPopulation(
+    Scalar density,
+    Scalar projection,
+    Scalar velocitySquared
+) -> Scalar
+{
+    constexpr Scalar weight{static_cast<Scalar>(Descriptor.weights[Direction])};
+    constexpr Scalar inverseSoundSpeedSquared{1.0 / Descriptor.speedOfSoundSquared};
+    constexpr Scalar halfInverseSoundSpeedFourth{
+        1.0 / (2.0 * Descriptor.speedOfSoundSquared * Descriptor.speedOfSoundSquared)
+    };
+    constexpr Scalar halfInverseSoundSpeedSquared{1.0 / (2.0 * Descriptor.speedOfSoundSquared)};
+
+    const Scalar isotropicTerm{Scalar{1.0} - halfInverseSoundSpeedSquared * velocitySquared};
+
+    return weight * density *
+           (isotropicTerm +
+            projection * (inverseSoundSpeedSquared + halfInverseSoundSpeedFourth * projection));
+}
+
+/**
+ * @brief Computes the second-order equilibrium of a lattice model from a lattice descriptor.
+ *
+ * Evaluates computeEquilibriumPopulation for every lattice vector with all loops unrolled. The
+ * velocity-independent term is the same for all lattice vectors, so the compiler computes it once.
+ *
+ * @param density The mass density.
+ * @param velocity The flow velocity.
+ * @return The equilibrium density distribution.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::size_t Dimension, std::floating_point Scalar>
+constexpr auto computeEquilibrium(Scalar density, const std::array<Scalar, Dimension>& velocity)
+    -> DensityDistribution<Dimension, Descriptor.velocities.size(), Scalar>
+{
+    constexpr std::size_t size{Descriptor.velocities.size()};
+
+    const Scalar velocitySquared{[&]<std::size_t... Axis>(std::index_sequence<Axis...>) {
+        return (... + (velocity[Axis] * velocity[Axis]));
+    }(std::make_index_sequence<Dimension>{})};
+
+    DensityDistribution<Dimension, size, Scalar> equilibrium;
+
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        ((equilibrium.template get<I>() = computeEquilibriumPopulation<Descriptor, I>(
+              density, projectVelocity<Descriptor, I>(velocity), velocitySquared
+          )),
+         ...);
+    }(std::make_index_sequence<size>{});
+
+    return equilibrium;
+}
+
+#endif // DENSITY_DISTRIBUTION_LATTICE_DESCRIPTOR_TPP
@@ -5,21 +5,176 @@
  * @file arithmetic.hpp
  * @brief Declaration of non-member arithmetic functions that operate on DensityDistribution
  * objects.
+ *
+ * The binary operators return lazily evaluated expressions instead of new density distributions,
+ * so an expression such as f + (feq - f) * omega is computed in one loop when it is assigned.
+ * Temporary density distributions passed to them are copied into the expression, so an expression
+ * can be kept beyond the full-expression that created it.
  */
 
 #include "DensityDistribution.hpp"
 
+#include <type_traits>
+
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Lhs,
+    typename Rhs>
+constexpr auto operator+(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Lhs>& lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Rhs>& rhs
+) -> DensityDistributionSum<Dimension, Size, Scalar, Lhs, Rhs>;
+
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Lhs,
+    typename Rhs>
+constexpr auto operator-(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Lhs>& lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Rhs>& rhs
+) -> DensityDistributionDifference<Dimension, Size, Scalar, Lhs, Rhs>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Operand>
+constexpr auto operator*(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Operand>& lhs,
+    std::type_identity_t<Scalar> rhs
+) -> DensityDistributionProduct<Dimension, Size, Scalar, Operand>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Operand>
+constexpr auto operator*(
+    std::type_identity_t<Scalar> lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Operand>& rhs
+) -> DensityDistributionProduct<Dimension, Size, Scalar, Operand>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Operand>
+constexpr auto operator/(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Operand>& lhs,
+    std::type_identity_t<Scalar> rhs
+) -> DensityDistributionQuotient<Dimension, Size, Scalar, Operand>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Rhs>
+constexpr auto operator+(
+    DensityDistribution<Dimension, Size, Scalar>&& lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Rhs>& rhs
+) -> DensityDistributionSum<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>,
+    Rhs>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Lhs>
+constexpr auto operator+(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Lhs>& lhs,
+    DensityDistribution<Dimension, Size, Scalar>&& rhs
+) -> DensityDistributionSum<
+    Dimension,
+    Size,
+    Scalar,
+    Lhs,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto operator+(
+    DensityDistribution<Dimension, Size, Scalar>&& lhs,
+    DensityDistribution<Dimension, Size, Scalar>&& rhs
+) -> DensityDistributionSum<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Rhs>
+constexpr auto operator-(
+    DensityDistribution<Dimension, Size, Scalar>&& lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Rhs>& rhs
+) -> DensityDistributionDifference<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>,
+    Rhs>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Lhs>
+constexpr auto operator-(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Lhs>& lhs,
+    DensityDistribution<Dimension, Size, Scalar>&& rhs
+) -> DensityDistributionDifference<
+    Dimension,
+    Size,
+    Scalar,
+    Lhs,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto operator-(
+    DensityDistribution<Dimension, Size, Scalar>&& lhs,
+    DensityDistribution<Dimension, Size, Scalar>&& rhs
+) -> DensityDistributionDifference<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto operator*(
+    DensityDistribution<Dimension, Size, Scalar>&& lhs,
+    std::type_identity_t<Scalar> rhs
+) -> DensityDistributionProduct<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto operator*(
+    std::type_identity_t<Scalar> lhs,
+    DensityDistribution<Dimension, Size, Scalar>&& rhs
+) -> DensityDistributionProduct<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto operator/(
+    DensityDistribution<Dimension, Size, Scalar>&& lhs,
+    std::type_identity_t<Scalar> rhs
+) -> DensityDistributionQuotient<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Expression>
+constexpr auto operator+=(
+    DensityDistribution<Dimension, Size, Scalar>& lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Expression>& rhs
+) -> DensityDistribution<Dimension, Size, Scalar>&;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Expression>
+constexpr auto operator-=(
+    DensityDistribution<Dimension, Size, Scalar>& lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Expression>& rhs
+) -> DensityDistribution<Dimension, Size, Scalar>&;
+
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-auto operator+(
-    const DensityDistribution<Dimension, Size, Scalar>& lhs,
-    const DensityDistribution<Dimension, Size, Scalar>& rhs
-) -> DensityDistribution<Dimension, Size, Scalar>;
+constexpr auto operator*=(
+    DensityDistribution<Dimension, Size, Scalar>& lhs,
+    std::type_identity_t<Scalar> rhs
+) -> DensityDistribution<Dimension, Size, Scalar>&;
 
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-auto operator-(
-    const DensityDistribution<Dimension, Size, Scalar>& lhs,
-    const DensityDistribution<Dimension, Size, Scalar>& rhs
-) -> DensityDistribution<Dimension, Size, Scalar>;
+constexpr auto operator/=(
+    DensityDistribution<Dimension, Size, Scalar>& lhs,
+    std::type_identity_t<Scalar> rhs
+) -> DensityDistribution<Dimension, Size, Scalar>&;
 
 #include "arithmetic.tpp"
 
@@ -11,57 +11,430 @@
 #include "arithmetic.hpp"
 
 /**
- * @brief Adds two density distributions element-wise.
+ * @brief Adds two density distribution expressions element-wise.
  *
- * @param lhs The left-hand side density distribution.
- * @param rhs The right-hand side density distribution.
- * @return A new density distribution containing the element-wise sum of lhs and rhs.
+ * @param lhs The left-hand side expression.
+ * @param rhs The right-hand side expression.
+ * @return A lazily evaluated expression of the element-wise sum of lhs and rhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Lhs The type of the left-hand side expression.
+ * @tparam Rhs The type of the right-hand side expression.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Lhs,
+    typename Rhs>
+constexpr auto operator+(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Lhs>& lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Rhs>& rhs
+) -> DensityDistributionSum<Dimension, Size, Scalar, Lhs, Rhs>
+{
+    return {lhs.derived(), rhs.derived()};
+}
+
+/**
+ * @brief Subtracts two density distribution expressions element-wise.
+ *
+ * @param lhs The left-hand side expression.
+ * @param rhs The right-hand side expression.
+ * @return A lazily evaluated expression of the element-wise difference between lhs and rhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Lhs The type of the left-hand side expression.
+ * @tparam Rhs The type of the right-hand side expression.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Lhs,
+    typename Rhs>
+constexpr auto operator-(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Lhs>& lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Rhs>& rhs
+) -> DensityDistributionDifference<Dimension, Size, Scalar, Lhs, Rhs>
+{
+    return {lhs.derived(), rhs.derived()};
+}
+
+/**
+ * @brief Multiplies a density distribution expression by a scalar value.
+ *
+ * @param lhs The density distribution expression.
+ * @param rhs The scalar value.
+ * @return A lazily evaluated expression of every element of lhs multiplied by rhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Operand The type of the density distribution expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Operand>
+constexpr auto operator*(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Operand>& lhs,
+    std::type_identity_t<Scalar> rhs
+) -> DensityDistributionProduct<Dimension, Size, Scalar, Operand>
+{
+    return {lhs.derived(), rhs};
+}
+
+/**
+ * @brief Multiplies a scalar value by a density distribution expression.
+ *
+ * @param lhs The scalar value.
+ * @param rhs The density distribution expression.
+ * @return A lazily evaluated expression of every element of rhs multiplied by lhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Operand The type of the density distribution expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Operand>
+constexpr auto operator*(
+    std::type_identity_t<Scalar> lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Operand>& rhs
+) -> DensityDistributionProduct<Dimension, Size, Scalar, Operand>
+{
+    return {rhs.derived(), lhs};
+}
+
+/**
+ * @brief Divides a density distribution expression by a scalar value.
+ *
+ * @param lhs The density distribution expression.
+ * @param rhs The scalar value.
+ * @return A lazily evaluated expression of every element of lhs divided by rhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Operand The type of the density distribution expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Operand>
+constexpr auto operator/(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Operand>& lhs,
+    std::type_identity_t<Scalar> rhs
+) -> DensityDistributionQuotient<Dimension, Size, Scalar, Operand>
+{
+    return {lhs.derived(), rhs};
+}
+
+/**
+ * @brief Adds a density distribution expression element-wise to a temporary density distribution.
+ *
+ * @param lhs The temporary density distribution, which is copied into the expression.
+ * @param rhs The right-hand side expression.
+ * @return A lazily evaluated expression of the element-wise sum of lhs and rhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Rhs The type of the right-hand side expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Rhs>
+constexpr auto operator+(
+    DensityDistribution<Dimension, Size, Scalar>&& lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Rhs>& rhs
+) -> DensityDistributionSum<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>,
+    Rhs>
+{
+    return {lhs, rhs.derived()};
+}
+
+/**
+ * @brief Adds a temporary density distribution element-wise to a density distribution expression.
+ *
+ * @param lhs The left-hand side expression.
+ * @param rhs The temporary density distribution, which is copied into the expression.
+ * @return A lazily evaluated expression of the element-wise sum of lhs and rhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Lhs The type of the left-hand side expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Lhs>
+constexpr auto operator+(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Lhs>& lhs,
+    DensityDistribution<Dimension, Size, Scalar>&& rhs
+) -> DensityDistributionSum<
+    Dimension,
+    Size,
+    Scalar,
+    Lhs,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>
+{
+    return {lhs.derived(), rhs};
+}
+
+/**
+ * @brief Adds two temporary density distributions element-wise.
+ *
+ * @param lhs The left-hand side temporary, which is copied into the expression.
+ * @param rhs The right-hand side temporary, which is copied into the expression.
+ * @return A lazily evaluated expression of the element-wise sum of lhs and rhs.
  *
  * @tparam Dimension The number of spatial dimensions.
  * @tparam Size The number of lattice vectors at each lattice node.
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-auto operator+(
-    const DensityDistribution<Dimension, Size, Scalar>& lhs,
-    const DensityDistribution<Dimension, Size, Scalar>& rhs
-) -> DensityDistribution<Dimension, Size, Scalar>
+constexpr auto operator+(
+    DensityDistribution<Dimension, Size, Scalar>&& lhs,
+    DensityDistribution<Dimension, Size, Scalar>&& rhs
+) -> DensityDistributionSum<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>
 {
-    DensityDistribution<Dimension, Size, Scalar> result;
+    return {lhs, rhs};
+}
 
-    for (std::size_t i = 0; i < result.size(); ++i)
-    {
-        result[i] = lhs[i] + rhs[i];
-    }
+/**
+ * @brief Subtracts a density distribution expression element-wise from a temporary density
+ * distribution.
+ *
+ * @param lhs The temporary density distribution, which is copied into the expression.
+ * @param rhs The right-hand side expression.
+ * @return A lazily evaluated expression of the element-wise difference between lhs and rhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Rhs The type of the right-hand side expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Rhs>
+constexpr auto operator-(
+    DensityDistribution<Dimension, Size, Scalar>&& lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Rhs>& rhs
+) -> DensityDistributionDifference<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>,
+    Rhs>
+{
+    return {lhs, rhs.derived()};
+}
 
-    return result;
+/**
+ * @brief Subtracts a temporary density distribution element-wise from a density distribution
+ * expression.
+ *
+ * @param lhs The left-hand side expression.
+ * @param rhs The temporary density distribution, which is copied into the expression.
+ * @return A lazily evaluated expression of the element-wise difference between lhs and rhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Lhs The type of the left-hand side expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Lhs>
+constexpr auto operator-(
+    const DensityDistributionExpression<Dimension, Size, Scalar, Lhs>& lhs,
+    DensityDistribution<Dimension, Size, Scalar>&& rhs
+) -> DensityDistributionDifference<
+    Dimension,
+    Size,
+    Scalar,
+    Lhs,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>
+{
+    return {lhs.derived(), rhs};
+}
+
+/**
+ * @brief Subtracts two temporary density distributions element-wise.
+ *
+ * @param lhs The left-hand side temporary, which is copied into the expression.
+ * @param rhs The right-hand side temporary, which is copied into the expression.
+ * @return A lazily evaluated expression of the element-wise difference between lhs and rhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto operator-(
+    DensityDistribution<Dimension, Size, Scalar>&& lhs,
+    DensityDistribution<Dimension, Size, Scalar>&& rhs
+) -> DensityDistributionDifference<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>
+{
+    return {lhs, rhs};
+}
+
+/**
+ * @brief Multiplies a temporary density distribution by a scalar value.
+ *
+ * @param lhs The temporary density distribution, which is copied into the expression.
+ * @param rhs The scalar value.
+ * @return A lazily evaluated expression of every element of lhs multiplied by rhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto operator*(
+    DensityDistribution<Dimension, Size, Scalar>&& lhs,
+    std::type_identity_t<Scalar> rhs
+) -> DensityDistributionProduct<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>
+{
+    return {lhs, rhs};
+}
+
+/**
+ * @brief Multiplies a scalar value by a temporary density distribution.
+ *
+ * @param lhs The scalar value.
+ * @param rhs The temporary density distribution, which is copied into the expression.
+ * @return A lazily evaluated expression of every element of rhs multiplied by lhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto operator*(
+    std::type_identity_t<Scalar> lhs,
+    DensityDistribution<Dimension, Size, Scalar>&& rhs
+) -> DensityDistributionProduct<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>
+{
+    return {rhs, lhs};
 }
 
 /**
- * @brief Subtracts two density distributions element-wise.
+ * @brief Divides a temporary density distribution by a scalar value.
  *
- * @param lhs The left-hand side density distribution.
- * @param rhs The right-hand side density distribution.
- * @return A new density distribution containing the element-wise difference between lhs and rhs.
+ * @param lhs The temporary density distribution, which is copied into the expression.
+ * @param rhs The scalar value.
+ * @return A lazily evaluated expression of every element of lhs divided by rhs.
  *
  * @tparam Dimension The number of spatial dimensions.
  * @tparam Size The number of lattice vectors at each lattice node.
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
-auto operator-(
-    const DensityDistribution<Dimension, Size, Scalar>& lhs,
-    const DensityDistribution<Dimension, Size, Scalar>& rhs
-) -> DensityDistribution<Dimension, Size, Scalar>
+constexpr auto operator/(
+    DensityDistribution<Dimension, Size, Scalar>&& lhs,
+    std::type_identity_t<Scalar> rhs
+) -> DensityDistributionQuotient<
+    Dimension,
+    Size,
+    Scalar,
+    OwnedDensityDistribution<Dimension, Size, Scalar>>
 {
-    DensityDistribution<Dimension, Size, Scalar> result;
+    return {lhs, rhs};
+}
+
+/**
+ * @brief Adds a density distribution expression element-wise to a density distribution.
+ *
+ * @param lhs The density distribution to add to.
+ * @param rhs The expression to add.
+ * @return Reference to lhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Expression The type of the expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Expression>
+constexpr auto operator+=(
+    DensityDistribution<Dimension, Size, Scalar>& lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Expression>& rhs
+) -> DensityDistribution<Dimension, Size, Scalar>&
+{
+    return lhs = lhs + rhs;
+}
+
+/**
+ * @brief Subtracts a density distribution expression element-wise from a density distribution.
+ *
+ * @param lhs The density distribution to subtract from.
+ * @param rhs The expression to subtract.
+ * @return Reference to lhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Expression The type of the expression.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Expression>
+constexpr auto operator-=(
+    DensityDistribution<Dimension, Size, Scalar>& lhs,
+    const DensityDistributionExpression<Dimension, Size, Scalar, Expression>& rhs
+) -> DensityDistribution<Dimension, Size, Scalar>&
+{
+    return lhs = lhs - rhs;
+}
 
-    for (std::size_t i = 0; i < result.size(); ++i)
-    {
-        result[i] = lhs[i] - rhs[i];
-    }
+/**
+ * @brief Multiplies every element of a density distribution by a scalar value.
+ *
+ * @param lhs The density distribution to scale.
+ * @param rhs The scalar value.
+ * @return Reference to lhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto operator*=(
+    DensityDistribution<Dimension, Size, Scalar>& lhs,
+    std::type_identity_t<Scalar> rhs
+) -> DensityDistribution<Dimension, Size, Scalar>&
+{
+    return lhs = lhs * rhs;
+}
 
-    return result;
+/**
+ * @brief Divides every element of a density distribution by a scalar value.
+ *
+ * @param lhs The density distribution to scale.
+ * @param rhs The scalar value.
+ * @return Reference to lhs.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto operator/=(
+    DensityDistribution<Dimension, Size, Scalar>& lhs,
+    std::type_identity_t<Scalar> rhs
+) -> DensityDistribution<Dimension, Size, Scalar>&
+{
+    return lhs = lhs / rhs;
 }
 
 #endif // ARITHMETIC_TPP
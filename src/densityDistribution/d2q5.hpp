@@ -8,6 +8,7 @@
  */
 
 #include "DensityDistribution.hpp"
+#include "LatticeDescriptor.hpp"
 
 /**
  * @brief The number of spatial dimensions in the D2Q5 lattice model.
@@ -27,14 +28,39 @@ constexpr std::size_t D2Q5_SIZE{5};
 template <std::floating_point Scalar>
 using D2Q5 = DensityDistribution<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>;
 
+/**
+ * @brief The compile-time descriptor of the D2Q5 lattice model as defined in \cite Yoshida2010.
+ *
+ * Lattice vectors are ordered center, right, left, top and bottom.
+ */
+constexpr LatticeDescriptor<D2Q5_DIMENSION, D2Q5_SIZE> D2Q5_DESCRIPTOR{
+    makeLatticeDescriptor<D2Q5_DIMENSION, D2Q5_SIZE>(
+        {{{0, 0}, {1, 0}, {-1, 0}, {0, 1}, {0, -1}}},
+        {1.0 / 3.0, 1.0 / 6.0, 1.0 / 6.0, 1.0 / 6.0, 1.0 / 6.0},
+        1.0 / 3.0
+    )
+};
+
 template <std::floating_point Scalar>
 constexpr auto latticeWeights(const D2Q5<Scalar>& distribution) -> std::array<Scalar, D2Q5_SIZE>;
 
 template <std::floating_point Scalar>
-auto computeDensity(const D2Q5<Scalar>& distribution) -> Scalar;
+constexpr auto latticeVelocities(const D2Q5<Scalar>& distribution)
+    -> std::array<std::array<int, D2Q5_DIMENSION>, D2Q5_SIZE>;
+
+template <std::floating_point Scalar>
+constexpr auto latticeOpposites(const D2Q5<Scalar>& distribution)
+    -> std::array<std::size_t, D2Q5_SIZE>;
+
+template <std::floating_point Scalar>
+constexpr auto computeDensity(const D2Q5<Scalar>& distribution) -> Scalar;
+
+template <std::floating_point Scalar>
+constexpr auto computeMomentum(const D2Q5<Scalar>& distribution)
+    -> std::array<Scalar, D2Q5_DIMENSION>;
 
 template <std::floating_point Scalar>
-auto computeMomentum(const D2Q5<Scalar>& distribution) -> std::array<Scalar, D2Q5_DIMENSION>;
+constexpr auto computeEquilibrium(const D2Q5<Scalar>& distribution) -> D2Q5<Scalar>;
 
 #include "d2q5.tpp"
 
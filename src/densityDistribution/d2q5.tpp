@@ -10,8 +10,6 @@
 ;
 #include "d2q5.hpp"
 
-#include <numeric>
-
 /**
  * @brief Returns the lattice weights for the D2Q5 lattice model.
  *
@@ -27,19 +25,55 @@ constexpr auto latticeWeights(const D2Q5<Scalar>& distribution) -> std::array<Sc
 {
     static_cast<void>(distribution);
 
-    constexpr Scalar weightCenter{1.0 / 3.0};
-    constexpr Scalar weightRight{1.0 / 6.0};
-    constexpr Scalar weightLeft{1.0 / 6.0};
-    constexpr Scalar weightTop{1.0 / 6.0};
-    constexpr Scalar weightBottom{1.0 / 6.0};
-
-    constexpr std::array<Scalar, D2Q5_SIZE> weights{
-        weightCenter, weightRight, weightLeft, weightTop, weightBottom
-    };
+    std::array<Scalar, D2Q5_SIZE> weights;
+    for (std::size_t i = 0; i < D2Q5_SIZE; ++i)
+    {
+        weights[i] = static_cast<Scalar>(D2Q5_DESCRIPTOR.weights[i]);
+    }
 
     return weights;
 }
 
+/**
+ * @brief Returns the lattice velocities for the D2Q5 lattice model.
+ *
+ * Returns the lattice velocities for the D2Q5 lattice model in the same order as the lattice
+ * weights, as defined in \cite Yoshida2010.
+ *
+ * @param distribution A D2Q5 density distribution.
+ * @return The D2Q5 lattice velocities.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto latticeVelocities(const D2Q5<Scalar>& distribution)
+    -> std::array<std::array<int, D2Q5_DIMENSION>, D2Q5_SIZE>
+{
+    static_cast<void>(distribution);
+
+    return D2Q5_DESCRIPTOR.velocities;
+}
+
+/**
+ * @brief Returns the opposite-direction table for the D2Q5 lattice model.
+ *
+ * The entry at index i is the index of the lattice vector that points in the direction opposite to
+ * lattice vector i, following the ordering of latticeVelocities.
+ *
+ * @param distribution A D2Q5 density distribution.
+ * @return The D2Q5 opposite-direction table.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto latticeOpposites(const D2Q5<Scalar>& distribution)
+    -> std::array<std::size_t, D2Q5_SIZE>
+{
+    static_cast<void>(distribution);
+
+    return D2Q5_DESCRIPTOR.opposites;
+}
+
 /**
  * @brief Computes the mass density of a D2Q5 density distribution.
  *
@@ -49,12 +83,9 @@ constexpr auto latticeWeights(const D2Q5<Scalar>& distribution) -> std::array<Sc
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::floating_point Scalar>
-auto computeDensity(const D2Q5<Scalar>& distribution) -> Scalar
+constexpr auto computeDensity(const D2Q5<Scalar>& distribution) -> Scalar
 {
-    const Scalar density{
-        distribution[0] + distribution[1] + distribution[2] + distribution[3] + distribution[4]
-    };
-    return density;
+    return computeDensity<D2Q5_DESCRIPTOR>(distribution);
 }
 
 /**
@@ -66,13 +97,31 @@ auto computeDensity(const D2Q5<Scalar>& distribution) -> Scalar
  * @tparam Scalar The floating-point type of scalar values.
  */
 template <std::floating_point Scalar>
-auto computeMomentum(const D2Q5<Scalar>& distribution) -> std::array<Scalar, D2Q5_DIMENSION>
+constexpr auto computeMomentum(const D2Q5<Scalar>& distribution)
+    -> std::array<Scalar, D2Q5_DIMENSION>
+{
+    return computeMomentum<D2Q5_DESCRIPTOR>(distribution);
+}
+
+/**
+ * @brief Computes the equilibrium of a D2Q5 density distribution.
+ *
+ * @param distribution A D2Q5 density distribution.
+ * @return The D2Q5 equilibrium density distribution with the same mass and momentum density.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto computeEquilibrium(const D2Q5<Scalar>& distribution) -> D2Q5<Scalar>
 {
-    const Scalar momentumX = distribution[1] - distribution[2];
-    const Scalar momentumY = distribution[3] - distribution[4];
-    const std::array<Scalar, D2Q5_DIMENSION> momentum{momentumX, momentumY};
+    const Scalar density{computeDensity(distribution)};
+    std::array<Scalar, D2Q5_DIMENSION> velocity{computeMomentum(distribution)};
+    for (Scalar& component : velocity)
+    {
+        component /= density;
+    }
 
-    return momentum;
+    return computeEquilibrium<D2Q5_DESCRIPTOR>(density, velocity);
 }
 
 #endif // DENSITY_DISTRIBUTION_D2Q5_TPP
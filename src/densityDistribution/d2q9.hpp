@@ -8,6 +8,7 @@
  */
 
 #include "DensityDistribution.hpp"
+#include "LatticeDescriptor.hpp"
 
 /**
  * @brief The number of spatial dimensions in the D2Q9 lattice model.
@@ -27,14 +28,41 @@ constexpr std::size_t D2Q9_SIZE{9};
 template <std::floating_point Scalar>
 using D2Q9 = DensityDistribution<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>;
 
+/**
+ * @brief The compile-time descriptor of the D2Q9 lattice model as defined in \cite Kruger2017.
+ *
+ * Lattice vectors are ordered center, right, top, left, bottom, top right, top left, bottom left
+ * and bottom right.
+ */
+constexpr LatticeDescriptor<D2Q9_DIMENSION, D2Q9_SIZE> D2Q9_DESCRIPTOR{
+    makeLatticeDescriptor<D2Q9_DIMENSION, D2Q9_SIZE>(
+        {{{0, 0}, {1, 0}, {0, 1}, {-1, 0}, {0, -1}, {1, 1}, {-1, 1}, {-1, -1}, {1, -1}}},
+        {4.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0, 1.0 / 9.0, 1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0,
+         1.0 / 36.0},
+        1.0 / 3.0
+    )
+};
+
 template <std::floating_point Scalar>
 constexpr auto latticeWeights(const D2Q9<Scalar>& distribution) -> std::array<Scalar, D2Q9_SIZE>;
 
 template <std::floating_point Scalar>
-auto computeDensity(const D2Q9<Scalar>& distribution) -> Scalar;
+constexpr auto latticeVelocities(const D2Q9<Scalar>& distribution)
+    -> std::array<std::array<int, D2Q9_DIMENSION>, D2Q9_SIZE>;
+
+template <std::floating_point Scalar>
+constexpr auto latticeOpposites(const D2Q9<Scalar>& distribution)
+    -> std::array<std::size_t, D2Q9_SIZE>;
+
+template <std::floating_point Scalar>
+constexpr auto computeDensity(const D2Q9<Scalar>& distribution) -> Scalar;
+
+template <std::floating_point Scalar>
+constexpr auto computeMomentum(const D2Q9<Scalar>& distribution)
+    -> std::array<Scalar, D2Q9_DIMENSION>;
 
 template <std::floating_point Scalar>
-auto computeMomentum(const D2Q9<Scalar>& distribution) -> std::array<Scalar, D2Q9_DIMENSION>;
+constexpr auto computeEquilibrium(const D2Q9<Scalar>& distribution) -> D2Q9<Scalar>;
 
 #include "d2q9.tpp"
 
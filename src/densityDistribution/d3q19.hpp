@@ -0,0 +1,88 @@
+#ifndef DENSITY_DISTRIBUTION_D3Q19_HPP
+#define DENSITY_DISTRIBUTION_D3Q19_HPP
+
+/**
+ * @file d3q19.hpp
+ * @brief Declaration of non-member functions that operate on DensityDistribution<3, 19, *>
+ * objects.
+ */
+
+#include "DensityDistribution.hpp"
+#include "LatticeDescriptor.hpp"
+
+/**
+ * @brief The number of spatial dimensions in the D3Q19 lattice model.
+ */
+constexpr std::size_t D3Q19_DIMENSION{3};
+
+/**
+ * @brief The number of lattice vectors in the D3Q19 lattice model.
+ */
+constexpr std::size_t D3Q19_SIZE{19};
+
+/**
+ * @brief Alias template for DensityDistribution with 3 dimensions and 19 lattice vectors.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+using D3Q19 = DensityDistribution<D3Q19_DIMENSION, D3Q19_SIZE, Scalar>;
+
+/**
+ * @brief The compile-time descriptor of the D3Q19 lattice model as defined in \cite Kruger2017.
+ *
+ * Lattice vectors are ordered as the rest vector, the six face neighbors and the twelve edge
+ * neighbors, with every vector directly followed by its opposite.
+ */
+constexpr LatticeDescriptor<D3Q19_DIMENSION, D3Q19_SIZE> D3Q19_DESCRIPTOR{
+    makeLatticeDescriptor<D3Q19_DIMENSION, D3Q19_SIZE>(
+        {{{0, 0, 0},
+          {1, 0, 0},
+          {-1, 0, 0},
+          {0, 1, 0},
+          {0, -1, 0},
+          {0, 0, 1},
+          {0, 0, -1},
+          {1, 1, 0},
+          {-1, -1, 0},
+          {1, 0, 1},
+          {-1, 0, -1},
+          {0, 1, 1},
+          {0, -1, -1},
+          {1, -1, 0},
+          {-1, 1, 0},
+          {1, 0, -1},
+          {-1, 0, 1},
+          {0, 1, -1},
+          {0, -1, 1}}},
+        {1.0 / 3.0,  1.0 / 18.0, 1.0 / 18.0, 1.0 / 18.0, 1.0 / 18.0, 1.0 / 18.0, 1.0 / 18.0,
+         1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0,
+         1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0, 1.0 / 36.0},
+        1.0 / 3.0
+    )
+};
+
+template <std::floating_point Scalar>
+constexpr auto latticeWeights(const D3Q19<Scalar>& distribution) -> std::array<Scalar, D3Q19_SIZE>;
+
+template <std::floating_point Scalar>
+constexpr auto latticeVelocities(const D3Q19<Scalar>& distribution)
+    -> std::array<std::array<int, D3Q19_DIMENSION>, D3Q19_SIZE>;
+
+template <std::floating_point Scalar>
+constexpr auto latticeOpposites(const D3Q19<Scalar>& distribution)
+    -> std::array<std::size_t, D3Q19_SIZE>;
+
+template <std::floating_point Scalar>
+constexpr auto computeDensity(const D3Q19<Scalar>& distribution) -> Scalar;
+
+template <std::floating_point Scalar>
+constexpr auto computeMomentum(const D3Q19<Scalar>& distribution)
+    -> std::array<Scalar, D3Q19_DIMENSION>;
+
+template <std::floating_point Scalar>
+constexpr auto computeEquilibrium(const D3Q19<Scalar>& distribution) -> D3Q19<Scalar>;
+
+#include "d3q19.tpp"
+
+#endif // DENSITY_DISTRIBUTION_D3Q19_HPP
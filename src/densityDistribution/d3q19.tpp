@@ -0,0 +1,127 @@
+#ifndef DENSITY_DISTRIBUTION_D3Q19_TPP
+#define DENSITY_DISTRIBUTION_D3Q19_TPP
+
+/**
+ * @file d3q19.tpp
+ * @brief Implementation of non-member functions that operate on DensityDistribution<3, 19, *>
+ * objects.
+ */
+
+;
+#include "d3q19.hpp"
+
+/**
+ * @brief Returns the lattice weights for the D3Q19 lattice model.
+ *
+ * Returns the lattice weights for the D3Q19 lattice model as defined in \cite Kruger2017.
+ *
+ * @param distribution A D3Q19 density distribution.
+ * @return The D3Q19 lattice weights.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto latticeWeights(const D3Q19<Scalar>& distribution) -> std::array<Scalar, D3Q19_SIZE>
+{
+    static_cast<void>(distribution);
+
+    std::array<Scalar, D3Q19_SIZE> weights;
+    for (std::size_t i = 0; i < D3Q19_SIZE; ++i)
+    {
+        weights[i] = static_cast<Scalar>(D3Q19_DESCRIPTOR.weights[i]);
+    }
+
+    return weights;
+}
+
+/**
+ * @brief Returns the lattice velocities for the D3Q19 lattice model.
+ *
+ * Returns the lattice velocities for the D3Q19 lattice model in the same order as the lattice
+ * weights, as defined in \cite Kruger2017.
+ *
+ * @param distribution A D3Q19 density distribution.
+ * @return The D3Q19 lattice velocities.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto latticeVelocities(const D3Q19<Scalar>& distribution)
+    -> std::array<std::array<int, D3Q19_DIMENSION>, D3Q19_SIZE>
+{
+    static_cast<void>(distribution);
+
+    return D3Q19_DESCRIPTOR.velocities;
+}
+
+/**
+ * @brief Returns the opposite-direction table for the D3Q19 lattice model.
+ *
+ * The entry at index i is the index of the lattice vector that points in the direction opposite to
+ * lattice vector i, following the ordering of latticeVelocities.
+ *
+ * @param distribution A D3Q19 density distribution.
+ * @return The D3Q19 opposite-direction table.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto latticeOpposites(const D3Q19<Scalar>& distribution)
+    -> std::array<std::size_t, D3Q19_SIZE>
+{
+    static_cast<void>(distribution);
+
+    return D3Q19_DESCRIPTOR.opposites;
+}
+
+/**
+ * @brief Computes the mass density of a D3Q19 density distribution.
+ *
+ * @param distribution A D3Q19 density distribution.
+ * @return The mass density of the D3Q19 density distribution.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto computeDensity(const D3Q19<Scalar>& distribution) -> Scalar
+{
+    return computeDensity<D3Q19_DESCRIPTOR>(distribution);
+}
+
+/**
+ * @brief Computes the momentum density of a D3Q19 density distribution.
+ *
+ * @param distribution A D3Q19 density distribution.
+ * @return The momentum density of the D3Q19 density distribution.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto computeMomentum(const D3Q19<Scalar>& distribution)
+    -> std::array<Scalar, D3Q19_DIMENSION>
+{
+    return computeMomentum<D3Q19_DESCRIPTOR>(distribution);
+}
+
+/**
+ * @brief Computes the equilibrium of a D3Q19 density distribution.
+ *
+ * @param distribution A D3Q19 density distribution.
+ * @return The D3Q19 equilibrium density distribution with the same mass and momentum density.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+constexpr auto computeEquilibrium(const D3Q19<Scalar>& distribution) -> D3Q19<Scalar>
+{
+    const Scalar density{computeDensity(distribution)};
+    std::array<Scalar, D3Q19_DIMENSION> velocity{computeMomentum(distribution)};
+    for (Scalar& component : velocity)
+    {
+        component /= density;
+    }
+
+    return computeEquilibrium<D3Q19_DESCRIPTOR>(density, velocity);
+}
+
+#endif // DENSITY_DISTRIBUTION_D3Q19_TPP
@@ -0,0 +1,98 @@
+#ifndef DENSITY_DISTRIBUTION_D3Q27_HPP
+#define DENSITY_DISTRIBUTION_D3Q27_HPP
+
+/**
+ * @file d3q27.hpp
+ * @brief Declaration of non-member functions that operate on DensityDistribution<3, 27, *>
+ * objects.
+ */
+
+#include "DensityDistribution.hpp"
+#include "LatticeDescriptor.hpp"
+
+/**
+ * @brief The number of spatial dimensions in the D3Q27 lattice model.
+ */
+constexpr std::size_t D3Q27_DIMENSION{3};
+
+/**
+ * @brief The number of lattice vectors in the D3Q27 lattice model.
+ */
+constexpr std::size_t D3Q27_SIZE{27};
+
+/**
+ * @brief Alias template for DensityDistribution with 3 dimensions and 27 lattice vectors.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+using D3Q27 = DensityDistribution<D3Q27_DIMENSION, D3Q27_SIZE, Scalar>;
+
+/**
+ * @brief The compile-time descriptor of the D3Q27 lattice model as defined in \cite Kruger2017.
+ *
+ * Lattice vectors are ordered as the rest vector, the six face neighbors, the twelve edge
+ * neighbors and the eight corner neighbors, with every vector directly followed by its opposite.
+ */
+constexpr LatticeDescriptor<D3Q27_DIMENSION, D3Q27_SIZE> D3Q27_DESCRIPTOR{
+    makeLatticeDescriptor<D3Q27_DIMENSION, D3Q27_SIZE>(
+        {{{0, 0, 0},
+          {1, 0, 0},
+          {-1, 0, 0},
+          {0, 1, 0},
+          {0, -1, 0},
+          {0, 0, 1},
+          {0, 0, -1},
+          {1, 1, 0},
+          {-1, -1, 0},
+          {1, 0, 1},
+          {-1, 0, -1},
+          {0, 1, 1},
+          {0, -1, -1},
+          {1, -1, 0},
+          {-1, 1, 0},
+          {1, 0, -1},
+          {-1, 0, 1},
+          {0, 1, -1},
+          {0, -1, 1},
+          {1, 1, 1},
+          {-1, -1, -1},
+          {1, 1, -1},
+          {-1, -1, 1},
+          {1, -1, 1},
+          {-1, 1, -1},
+          {-1, 1, 1},
+          {1, -1, -1}}},
+        {8.0 / 27.0,  2.0 / 27.0,  2.0 / 27.0,  2.0 / 27.0,  2.0 / 27.0,  2.0 / 27.0,
+         2.0 / 27.0,  1.0 / 54.0,  1.0 / 54.0,  1.0 / 54.0,  1.0 / 54.0,  1.0 / 54.0,
+         1.0 / 54.0,  1.0 / 54.0,  1.0 / 54.0,  1.0 / 54.0,  1.0 / 54.0,  1.0 / 54.0,
+         1.0 / 54.0,  1.0 / 216.0, 1.0 / 216.0, 1.0 / 216.0, 1.0 / 216.0, 1.0 / 216.0,
+         1.0 / 216.0, 1.0 / 216.0, 1.0 / 216.0},
+        1.0 / 3.0
+    )
+};
+
+template <std::floating_point Scalar>
+constexpr auto latticeWeights(const D3Q27<Scalar>& distribution) -> std::array<Scalar, D3Q27_SIZE>;
+
+template <std::floating_point Scalar>
+constexpr auto latticeVelocities(const D3Q27<Scalar>& distribution)
+    -> std::array<std::array<int, D3Q27_DIMENSION>, D3Q27_SIZE>;
+
+template <std::floating_point Scalar>
+constexpr auto latticeOpposites(const D3Q27<Scalar>& distribution)
+    -> std::array<std::size_t, D3Q27_SIZE>;
+
+template <std::floating_point Scalar>
+constexpr auto computeDensity(const D3Q27<Scalar>& distribution) -> Scalar;
+
+template <std::floating_point Scalar>
+constexpr auto computeMomentum(const D3Q27<Scalar>& distribution)
+    -> std::array<Scalar, D3Q27_DIMENSION>;
+
+template <std::floating_point Scalar>
+constexpr auto computeEquilibrium(const D3Q27<Scalar>& distribution) -> D3Q27<Scalar>;
+
+#include "d3q27.tpp"
+
+#endif // DENSITY_DISTRIBUTION_D3Q27_HPP
@@ -0,0 +1,38 @@
+#ifndef DIAGNOSTICS_COMPENSATED_SUM_HPP
+#define DIAGNOSTICS_COMPENSATED_SUM_HPP
+
+/**
+ * @file CompensatedSum.hpp
+ * @brief Declaration of the CompensatedSum class template that accumulates a sum of floating-point
+ * values with a running compensation of its rounding error.
+ */
+
+#include <concepts>
+
+/**
+ * @class CompensatedSum
+ * @brief A class template for a sum that carries the rounding error of its additions along.
+ *
+ * Additions follow Kahan summation with the branch of the Neumaier variant, which also compensates
+ * terms larger in magnitude than the running sum, so the error stays of the order of one rounding
+ * of the result instead of growing with the number of terms. Merging two sums adds both parts of
+ * the other sum, which keeps a pairwise combination of partial sums compensated as well.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+class CompensatedSum
+{
+public:
+    auto add(Scalar value) -> void;
+    auto merge(const CompensatedSum& other) -> void;
+    auto value() const -> Scalar;
+
+private:
+    Scalar sum_{0.0};
+    Scalar compensation_{0.0};
+};
+
+#include "CompensatedSum.tpp"
+
+#endif // DIAGNOSTICS_COMPENSATED_SUM_HPP
@@ -0,0 +1,62 @@
+#ifndef DIAGNOSTICS_COMPENSATED_SUM_TPP
+#define DIAGNOSTICS_COMPENSATED_SUM_TPP
+
+/**
+ * @file CompensatedSum.tpp
+ * @brief Implementation of the CompensatedSum class template that accumulates a sum of
+ * floating-point values with a running compensation of its rounding error.
+ */
+
+;
+#include "CompensatedSum.hpp"
+
+#include <cmath>
+
+/**
+ * @brief Adds a value to the sum and keeps the rounding error of the addition as the compensation.
+ *
+ * The compensation of the previous addition is added to the value first, so it stays below one
+ * rounding of the sum instead of growing with the number of terms.
+ *
+ * @param value The value to add.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto CompensatedSum<Scalar>::add(Scalar value) -> void
+{
+    const Scalar term{value + compensation_};
+    const Scalar sum{sum_ + term};
+
+    compensation_ = std::abs(sum_) >= std::abs(term) ? (sum_ - sum) + term : (term - sum) + sum_;
+    sum_ = sum;
+}
+
+/**
+ * @brief Adds another compensated sum to this one.
+ *
+ * @param other The sum to add.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto CompensatedSum<Scalar>::merge(const CompensatedSum& other) -> void
+{
+    add(other.sum_);
+    add(other.compensation_);
+}
+
+/**
+ * @brief Returns the compensated value of the sum.
+ *
+ * @return The sum plus its accumulated rounding error.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto CompensatedSum<Scalar>::value() const -> Scalar
+{
+    return sum_ + compensation_;
+}
+
+#endif // DIAGNOSTICS_COMPENSATED_SUM_TPP
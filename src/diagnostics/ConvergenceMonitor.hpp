@@ -0,0 +1,96 @@
+#ifndef DIAGNOSTICS_CONVERGENCE_MONITOR_HPP
+#define DIAGNOSTICS_CONVERGENCE_MONITOR_HPP
+
+/**
+ * @file ConvergenceMonitor.hpp
+ * @brief Declaration of the ConvergenceMonitor class template that detects a steady state from the
+ * velocity field at a sample of lattice nodes, and of a time loop that stops at the steady state.
+ */
+
+#include "../lattice/Lattice.hpp"
+#include "CompensatedSum.hpp"
+#include "VelocityResidual.hpp"
+
+#include <array>
+#include <vector>
+
+/**
+ * @brief The default number of lattice nodes whose velocity a ConvergenceMonitor samples.
+ */
+constexpr std::size_t CONVERGENCE_SAMPLE_COUNT{4096};
+
+/**
+ * @enum PopulationLayout
+ * @brief The layout in which the time steps of a time loop leave the populations of a lattice.
+ *
+ * Natural time steps leave the populations in their natural layout after every time step, AA
+ * pattern time steps only after an even number of time steps.
+ */
+enum class PopulationLayout
+{
+    Natural,
+    AAPattern
+};
+
+/**
+ * @class ConvergenceMonitor
+ * @brief A class template that decides whether the flow on a lattice has reached a steady state.
+ *
+ * Every check interval, the monitor computes the velocity at sample nodes on an evenly spaced grid
+ * and compares it with the velocity of the previous check. The residual is the L2 norm of the
+ * change relative to the L2 norm of the velocity, divided by the number of time steps between the
+ * checks, so a threshold does not depend on the check interval. The flow is converged once the
+ * residual falls below the threshold. A check reads populations in their natural layout, which an
+ * AA-pattern lattice holds after an even number of time steps, so AA time loops need an even check
+ * interval.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+class ConvergenceMonitor
+{
+public:
+    static constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    static constexpr std::size_t size{Descriptor.velocities.size()};
+
+    ConvergenceMonitor(
+        const std::array<std::size_t, dimension>& extents,
+        Scalar threshold,
+        std::size_t checkInterval,
+        std::size_t sampleCount = CONVERGENCE_SAMPLE_COUNT
+    );
+
+    auto update(
+        const Lattice<dimension, size, Scalar>& lattice,
+        std::size_t completedSteps
+    ) -> bool;
+
+    auto converged() const -> bool;
+    auto residual() const -> Scalar;
+    auto threshold() const -> Scalar;
+    auto checkInterval() const -> std::size_t;
+    auto samples() const -> const std::vector<std::size_t>&;
+
+private:
+    std::array<std::size_t, dimension> extents_;
+    Scalar threshold_;
+    std::size_t checkInterval_;
+    std::vector<std::size_t> samples_;
+    VelocityResidual<dimension, Scalar> velocityResidual_;
+    std::size_t previousCheck_{0};
+    Scalar residual_;
+};
+
+template <const auto& Descriptor, std::floating_point Scalar, typename Advance>
+auto advanceUntilConverged(
+    Lattice<Descriptor.velocities[0].size(), Descriptor.velocities.size(), Scalar>& lattice,
+    ConvergenceMonitor<Descriptor, Scalar>& monitor,
+    std::size_t maxSteps,
+    PopulationLayout layout,
+    Advance advance
+) -> std::size_t;
+
+#include "ConvergenceMonitor.tpp"
+
+#endif // DIAGNOSTICS_CONVERGENCE_MONITOR_HPP
@@ -0,0 +1,300 @@
+#ifndef DIAGNOSTICS_CONVERGENCE_MONITOR_TPP
+#define DIAGNOSTICS_CONVERGENCE_MONITOR_TPP
+
+/**
+ * @file ConvergenceMonitor.tpp
+ * @brief Implementation of the ConvergenceMonitor class template that detects a steady state from
+ * the velocity field at a sample of lattice nodes, and of a time loop that stops at the steady
+ * state.
+ */
+
+;
+#include "ConvergenceMonitor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+/**
+ * @brief Constructor for ConvergenceMonitor that chooses the sample nodes of a lattice.
+ *
+ * The samples form a grid with about the same number of evenly spaced coordinates along every
+ * axis, so that they cover every axis regardless of how the extents divide the sample count. Each
+ * sample sits in the middle of its grid cell. The number of samples is the product of the
+ * coordinates per axis, which is close to the requested sample count.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param threshold The residual below which the flow counts as converged.
+ * @param checkInterval The number of time steps between checks.
+ * @param sampleCount The approximate number of sample nodes, capped at the number of lattice nodes.
+ * @throws std::invalid_argument If the check interval or the sample count is zero.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+ConvergenceMonitor<Descriptor, Scalar>::ConvergenceMonitor(
+    const std::array<std::size_t, dimension>& extents,
+    Scalar threshold,
+    std::size_t checkInterval,
+    std::size_t sampleCount
+)
+    : extents_{extents},
+      threshold_{threshold},
+      checkInterval_{checkInterval},
+      velocityResidual_{0},
+      residual_{std::numeric_limits<Scalar>::infinity()}
+{
+    if (checkInterval == 0)
+    {
+        throw std::invalid_argument{"check interval must be positive"};
+    }
+    if (sampleCount == 0)
+    {
+        throw std::invalid_argument{"sample count must be positive"};
+    }
+
+    const std::size_t nodeCount{
+        std::accumulate(extents.begin(), extents.end(), std::size_t{1}, std::multiplies<>{})
+    };
+    const std::size_t count{std::min(sampleCount, nodeCount)};
+    if (count == 0)
+    {
+        return;
+    }
+
+    std::array<std::size_t, dimension> counts;
+    std::size_t remaining{count};
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        const double exponent{1.0 / static_cast<double>(dimension - axis)};
+        const double root{std::pow(static_cast<double>(remaining), exponent)};
+        const auto rounded{static_cast<std::size_t>(std::lround(root))};
+        counts[axis] = std::clamp(rounded, std::size_t{1}, extents[axis]);
+        remaining = (remaining + counts[axis] - 1) / counts[axis];
+    }
+
+    const std::size_t total{
+        std::accumulate(counts.begin(), counts.end(), std::size_t{1}, std::multiplies<>{})
+    };
+    samples_.reserve(total);
+    for (std::size_t sample = 0; sample < total; ++sample)
+    {
+        std::size_t node{0};
+        std::size_t stride{1};
+        std::size_t rest{sample};
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            const std::size_t index{rest % counts[axis]};
+            const std::size_t coordinate{
+                index * extents[axis] / counts[axis] + extents[axis] / (2 * counts[axis])
+            };
+            rest /= counts[axis];
+            node += coordinate * stride;
+            stride *= extents[axis];
+        }
+        samples_.push_back(node);
+    }
+    velocityResidual_ = VelocityResidual<dimension, Scalar>{total};
+}
+
+/**
+ * @brief Checks the flow for convergence if a check is due after a number of time steps.
+ *
+ * A check is due whenever the number of completed time steps is a multiple of the check interval.
+ * Between checks nothing is read and the previous decision is returned. The first check only
+ * records the velocity at the sample nodes.
+ *
+ * @param lattice The lattice after the completed time steps.
+ * @param completedSteps The number of time steps completed on the lattice.
+ * @return Whether the flow has converged as of the latest check.
+ * @throws std::invalid_argument If the extents of the lattice differ from those of the monitor.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto ConvergenceMonitor<Descriptor, Scalar>::update(
+    const Lattice<dimension, size, Scalar>& lattice,
+    std::size_t completedSteps
+) -> bool
+{
+    if (lattice.extents() != extents_)
+    {
+        throw std::invalid_argument{"lattice extents differ from the extents of the monitor"};
+    }
+    if (completedSteps % checkInterval_ != 0 ||
+        (velocityResidual_.hasPrevious() && completedSteps == previousCheck_))
+    {
+        return converged();
+    }
+
+    std::array<std::span<const Scalar>, size> populations;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        populations[i] = lattice.population(i);
+    }
+
+    CompensatedSum<Scalar> velocitySquared;
+    CompensatedSum<Scalar> velocityChangeSquared;
+    std::array<Scalar, size> values;
+    for (std::size_t sample = 0; sample < samples_.size(); ++sample)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            values[i] = populations[i][samples_[sample]];
+        }
+        const NodeMoments<dimension, Scalar> moments{computeNodeMoments<Descriptor>(values)};
+        if (moments.density == 0)
+        {
+            continue;
+        }
+
+        std::array<Scalar, dimension> velocity;
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            velocity[axis] = moments.momentum[axis] / moments.density;
+            velocitySquared.add(velocity[axis] * velocity[axis]);
+        }
+        velocityChangeSquared.add(velocityResidual_.track(sample, velocity));
+    }
+
+    residual_ = velocityResidual_.finish(velocitySquared.value(), velocityChangeSquared.value());
+    if (completedSteps > previousCheck_)
+    {
+        residual_ /= static_cast<Scalar>(completedSteps - previousCheck_);
+    }
+    else
+    {
+        residual_ = std::numeric_limits<Scalar>::infinity();
+    }
+    previousCheck_ = completedSteps;
+
+    return converged();
+}
+
+/**
+ * @brief Returns whether the flow has converged as of the latest check.
+ *
+ * @return Whether the residual of the latest check is below the threshold.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto ConvergenceMonitor<Descriptor, Scalar>::converged() const -> bool
+{
+    return residual_ < threshold_;
+}
+
+/**
+ * @brief Returns the residual of the latest check.
+ *
+ * @return The relative change of the sampled velocity per time step, or infinity before the
+ * second check.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto ConvergenceMonitor<Descriptor, Scalar>::residual() const -> Scalar
+{
+    return residual_;
+}
+
+/**
+ * @brief Returns the residual below which the flow counts as converged.
+ *
+ * @return The convergence threshold.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto ConvergenceMonitor<Descriptor, Scalar>::threshold() const -> Scalar
+{
+    return threshold_;
+}
+
+/**
+ * @brief Returns the number of time steps between checks.
+ *
+ * @return The check interval.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto ConvergenceMonitor<Descriptor, Scalar>::checkInterval() const -> std::size_t
+{
+    return checkInterval_;
+}
+
+/**
+ * @brief Returns the linear indices of the sample nodes.
+ *
+ * @return Const reference to the sample nodes in ascending order.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto ConvergenceMonitor<Descriptor, Scalar>::samples() const
+    -> const std::vector<std::size_t>&
+{
+    return samples_;
+}
+
+/**
+ * @brief Advances a lattice time step by time step until the flow converges or a step limit is
+ * reached.
+ *
+ * The monitor is checked before the first time step and after every time step. Checks read the
+ * populations in their natural layout, so a time loop of AA-pattern time steps needs an even check
+ * interval.
+ *
+ * @param lattice The lattice that is advanced.
+ * @param monitor The convergence monitor of the lattice.
+ * @param maxSteps The largest number of time steps to perform.
+ * @param layout The layout in which the time steps leave the populations.
+ * @param advance A callable invoked as advance(timeStep) that performs one time step.
+ * @return The number of time steps performed.
+ * @throws std::invalid_argument If the time steps follow the AA pattern and the check interval of
+ * the monitor is odd, or if the extents of the lattice differ from those of the monitor.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Advance The type of the time step callable.
+ */
+template <const auto& Descriptor, std::floating_point Scalar, typename Advance>
+auto advanceUntilConverged(
+    Lattice<Descriptor.velocities[0].size(), Descriptor.velocities.size(), Scalar>& lattice,
+    ConvergenceMonitor<Descriptor, Scalar>& monitor,
+    std::size_t maxSteps,
+    PopulationLayout layout,
+    Advance advance
+) -> std::size_t
+{
+    if (layout == PopulationLayout::AAPattern && monitor.checkInterval() % 2 != 0)
+    {
+        throw std::invalid_argument{"AA-pattern time loops need an even check interval"};
+    }
+
+    monitor.update(lattice, 0);
+
+    for (std::size_t timeStep = 0; timeStep < maxSteps; ++timeStep)
+    {
+        advance(timeStep);
+        if (monitor.update(lattice, timeStep + 1))
+        {
+            return timeStep + 1;
+        }
+    }
+
+    return maxSteps;
+}
+
+#endif // DIAGNOSTICS_CONVERGENCE_MONITOR_TPP
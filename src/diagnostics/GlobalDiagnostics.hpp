@@ -0,0 +1,134 @@
+#ifndef DIAGNOSTICS_GLOBAL_DIAGNOSTICS_HPP
+#define DIAGNOSTICS_GLOBAL_DIAGNOSTICS_HPP
+
+/**
+ * @file GlobalDiagnostics.hpp
+ * @brief Declaration of the DiagnosticsReducer class template that reduces the populations of a
+ * lattice to global diagnostics in one sweep, on its own or fused with a time step.
+ */
+
+#include "../lattice/AlignedAllocator.hpp"
+#include "../lattice/Lattice.hpp"
+#include "../lattice/Tiling.hpp"
+#include "../parallel/TiledScheduler.hpp"
+#include "../streaming/aaPattern.hpp"
+#include "CompensatedSum.hpp"
+#include "VelocityResidual.hpp"
+
+#include <array>
+#include <vector>
+
+/**
+ * @struct GlobalDiagnostics
+ * @brief The global diagnostics of a lattice at one time step.
+ *
+ * The residual is the change of the velocity field since the previous reduction in the L2 norm,
+ * relative to the norm of the velocity field. It is infinite for the first reduction and whenever
+ * the residual is not tracked.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+struct GlobalDiagnostics
+{
+    Scalar mass;
+    std::array<Scalar, Dimension> momentum;
+    Scalar kineticEnergy;
+    Scalar maxVelocity;
+    Scalar residual;
+};
+
+/**
+ * @class DiagnosticsReducer
+ * @brief A class template that reduces the populations of a lattice to global diagnostics.
+ *
+ * Every tile is reduced into its own compensated partial sums in the fixed row order of the tile,
+ * and the partial sums are combined pairwise in tile order. The result therefore depends only on
+ * the tiles, never on which thread reduced a tile, and is bit-identical for every thread count of a
+ * scheduler with the same tiles. The velocity field of the previous reduction is kept in the visit
+ * order of the tiles for the residual.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+class DiagnosticsReducer
+{
+public:
+    static constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    static constexpr std::size_t size{Descriptor.velocities.size()};
+
+    explicit DiagnosticsReducer(
+        const std::array<std::size_t, dimension>& extents,
+        bool trackResidual = true
+    );
+    explicit DiagnosticsReducer(
+        const TiledScheduler<dimension>& scheduler,
+        bool trackResidual = true
+    );
+
+    auto reduce(
+        const Lattice<dimension, size, Scalar>& lattice
+    ) -> GlobalDiagnostics<dimension, Scalar>;
+    auto reduce(
+        const Lattice<dimension, size, Scalar>& lattice,
+        TiledScheduler<dimension>& scheduler
+    ) -> GlobalDiagnostics<dimension, Scalar>;
+
+    template <typename Collision>
+    auto streamAA(
+        Lattice<dimension, size, Scalar>& lattice,
+        std::size_t timeStep,
+        Collision collision
+    ) -> GlobalDiagnostics<dimension, Scalar>;
+    template <typename Collision>
+    auto streamAA(
+        Lattice<dimension, size, Scalar>& lattice,
+        std::size_t timeStep,
+        Collision collision,
+        TiledScheduler<dimension>& scheduler
+    ) -> GlobalDiagnostics<dimension, Scalar>;
+
+    auto tiles() const -> const std::vector<LatticeTile<dimension>>&;
+
+private:
+    /**
+     * @brief The partial sums of one tile, padded to a cache line so that concurrently reduced
+     * tiles do not share one.
+     */
+    struct alignas(CACHE_LINE_SIZE) TileSums
+    {
+        CompensatedSum<Scalar> mass;
+        std::array<CompensatedSum<Scalar>, dimension> momentum;
+        CompensatedSum<Scalar> kineticEnergy;
+        CompensatedSum<Scalar> velocitySquared;
+        CompensatedSum<Scalar> velocityChangeSquared;
+        Scalar maxVelocitySquared{0.0};
+    };
+
+    auto checkLattice(const Lattice<dimension, size, Scalar>& lattice) const -> void;
+    auto checkScheduler(const TiledScheduler<dimension>& scheduler) const -> void;
+    auto accumulate(
+        const std::array<Scalar, size>& values,
+        TileSums& sums,
+        std::size_t visit
+    ) -> void;
+    auto reduceTile(
+        const Lattice<dimension, size, Scalar>& lattice,
+        std::size_t index
+    ) -> void;
+    auto combine(std::size_t first, std::size_t last) const -> TileSums;
+    auto finish() -> GlobalDiagnostics<dimension, Scalar>;
+
+    std::array<std::size_t, dimension> extents_;
+    std::vector<LatticeTile<dimension>> tiles_;
+    std::vector<std::size_t> tileOffsets_;
+    std::vector<TileSums> sums_;
+    VelocityResidual<dimension, Scalar> residual_;
+    bool trackResidual_;
+};
+
+#include "GlobalDiagnostics.tpp"
+
+#endif // DIAGNOSTICS_GLOBAL_DIAGNOSTICS_HPP
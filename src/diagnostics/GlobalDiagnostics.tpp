@@ -0,0 +1,456 @@
+#ifndef DIAGNOSTICS_GLOBAL_DIAGNOSTICS_TPP
+#define DIAGNOSTICS_GLOBAL_DIAGNOSTICS_TPP
+
+/**
+ * @file GlobalDiagnostics.tpp
+ * @brief Implementation of the DiagnosticsReducer class template that reduces the populations of
+ * a lattice to global diagnostics in one sweep, on its own or fused with a time step.
+ */
+
+;
+#include "GlobalDiagnostics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+/**
+ * @brief Constructor for DiagnosticsReducer that reduces a lattice as a single tile.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param trackResidual Whether to keep the velocity field between reductions for the residual.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+DiagnosticsReducer<Descriptor, Scalar>::DiagnosticsReducer(
+    const std::array<std::size_t, dimension>& extents,
+    bool trackResidual
+)
+    : extents_{extents},
+      residual_{0},
+      trackResidual_{trackResidual}
+{
+    LatticeTile<dimension> tile;
+    tile.begin.fill(0);
+    tile.end = extents;
+    tiles_.push_back(tile);
+    tileOffsets_.push_back(0);
+    sums_.resize(1);
+
+    if (trackResidual_)
+    {
+        residual_ = VelocityResidual<dimension, Scalar>{tileNodeCount(tile)};
+    }
+}
+
+/**
+ * @brief Constructor for DiagnosticsReducer that reduces a lattice in the tiles of a scheduler.
+ *
+ * @param scheduler The scheduler whose tiles are reduced separately.
+ * @param trackResidual Whether to keep the velocity field between reductions for the residual.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+DiagnosticsReducer<Descriptor, Scalar>::DiagnosticsReducer(
+    const TiledScheduler<dimension>& scheduler,
+    bool trackResidual
+)
+    : extents_{scheduler.extents()},
+      tiles_{scheduler.tiles()},
+      sums_(scheduler.tiles().size()),
+      residual_{0},
+      trackResidual_{trackResidual}
+{
+    std::size_t nodeCount{0};
+    for (const LatticeTile<dimension>& tile : tiles_)
+    {
+        tileOffsets_.push_back(nodeCount);
+        nodeCount += tileNodeCount(tile);
+    }
+
+    if (trackResidual_)
+    {
+        residual_ = VelocityResidual<dimension, Scalar>{nodeCount};
+    }
+}
+
+/**
+ * @brief Reduces the populations of a lattice to global diagnostics, one tile after the other.
+ *
+ * The populations are read in their natural layout, which an AA-pattern lattice holds before every
+ * even time step.
+ *
+ * @param lattice The lattice to reduce.
+ * @return The global diagnostics of the lattice.
+ * @throws std::invalid_argument If the extents of the lattice differ from those of the reducer.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto DiagnosticsReducer<Descriptor, Scalar>::reduce(
+    const Lattice<dimension, size, Scalar>& lattice
+) -> GlobalDiagnostics<dimension, Scalar>
+{
+    checkLattice(lattice);
+
+    for (std::size_t index = 0; index < tiles_.size(); ++index)
+    {
+        reduceTile(lattice, index);
+    }
+
+    return finish();
+}
+
+/**
+ * @brief Reduces the populations of a lattice to global diagnostics on all tiles of a scheduler in
+ * parallel.
+ *
+ * The result is bit-identical to the sequential reduction.
+ *
+ * @param lattice The lattice to reduce.
+ * @param scheduler A scheduler with the tiles of the reducer.
+ * @return The global diagnostics of the lattice.
+ * @throws std::invalid_argument If the extents of the lattice or the tiles of the scheduler differ
+ * from those of the reducer.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto DiagnosticsReducer<Descriptor, Scalar>::reduce(
+    const Lattice<dimension, size, Scalar>& lattice,
+    TiledScheduler<dimension>& scheduler
+) -> GlobalDiagnostics<dimension, Scalar>
+{
+    checkLattice(lattice);
+    checkScheduler(scheduler);
+
+    scheduler.forEachOwnedTile([&](const LatticeTile<dimension>& tile) {
+        reduceTile(lattice, static_cast<std::size_t>(&tile - scheduler.tiles().data()));
+    });
+
+    return finish();
+}
+
+/**
+ * @brief Performs one fused collide-and-stream time step of the AA pattern and reduces the
+ * populations of every node as the time step gathers them, before they are collided.
+ *
+ * The diagnostics describe the lattice at the start of the time step, and on even time steps they
+ * are bit-identical to a reduction of the lattice before the time step.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param timeStep The index of the time step, whose parity selects the kind of access.
+ * @param collision A callable that updates the populations of one node, passed as an array of
+ * scalar values in lattice vector order.
+ * @return The global diagnostics of the lattice at the start of the time step.
+ * @throws std::invalid_argument If the extents of the lattice differ from those of the reducer.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Collision The type of the collision callable.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+template <typename Collision>
+auto DiagnosticsReducer<Descriptor, Scalar>::streamAA(
+    Lattice<dimension, size, Scalar>& lattice,
+    std::size_t timeStep,
+    Collision collision
+) -> GlobalDiagnostics<dimension, Scalar>
+{
+    checkLattice(lattice);
+
+    for (std::size_t index = 0; index < tiles_.size(); ++index)
+    {
+        TileSums& sums{sums_[index]};
+        std::size_t visit{tileOffsets_[index]};
+
+        sums = TileSums{};
+        ::streamAA(
+            lattice,
+            Descriptor.velocities,
+            Descriptor.opposites,
+            timeStep,
+            [&](std::array<Scalar, size>& values) {
+                accumulate(values, sums, visit++);
+                collision(values);
+            },
+            tiles_[index]
+        );
+    }
+
+    return finish();
+}
+
+/**
+ * @brief Performs one fused collide-and-stream time step of the AA pattern on all tiles of a
+ * scheduler in parallel and reduces the populations of every node before they are collided.
+ *
+ * The diagnostics are bit-identical to those of the sequential fused time step.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param timeStep The index of the time step, whose parity selects the kind of access.
+ * @param collision A callable that updates the populations of one node, which must be safe to call
+ * concurrently from several threads.
+ * @param scheduler A scheduler with the tiles of the reducer.
+ * @return The global diagnostics of the lattice at the start of the time step.
+ * @throws std::invalid_argument If the extents of the lattice or the tiles of the scheduler differ
+ * from those of the reducer.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Collision The type of the collision callable.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+template <typename Collision>
+auto DiagnosticsReducer<Descriptor, Scalar>::streamAA(
+    Lattice<dimension, size, Scalar>& lattice,
+    std::size_t timeStep,
+    Collision collision,
+    TiledScheduler<dimension>& scheduler
+) -> GlobalDiagnostics<dimension, Scalar>
+{
+    checkLattice(lattice);
+    checkScheduler(scheduler);
+
+    scheduler.forEachOwnedTile([&](const LatticeTile<dimension>& tile) {
+        const auto index{static_cast<std::size_t>(&tile - scheduler.tiles().data())};
+        TileSums& sums{sums_[index]};
+        std::size_t visit{tileOffsets_[index]};
+
+        sums = TileSums{};
+        ::streamAA(
+            lattice,
+            Descriptor.velocities,
+            Descriptor.opposites,
+            timeStep,
+            [&](std::array<Scalar, size>& values) {
+                accumulate(values, sums, visit++);
+                collision(values);
+            },
+            tile
+        );
+    });
+
+    return finish();
+}
+
+/**
+ * @brief Returns the tiles that are reduced into separate partial sums.
+ *
+ * @return Const reference to the tiles in the order in which their partial sums are combined.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto DiagnosticsReducer<Descriptor, Scalar>::tiles() const
+    -> const std::vector<LatticeTile<dimension>>&
+{
+    return tiles_;
+}
+
+/**
+ * @brief Checks that a lattice has the extents of the reducer.
+ *
+ * @param lattice The lattice to check.
+ * @throws std::invalid_argument If the extents of the lattice differ from those of the reducer.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto DiagnosticsReducer<Descriptor, Scalar>::checkLattice(
+    const Lattice<dimension, size, Scalar>& lattice
+) const -> void
+{
+    if (lattice.extents() != extents_)
+    {
+        throw std::invalid_argument{"lattice extents differ from the extents of the reducer"};
+    }
+}
+
+/**
+ * @brief Checks that a scheduler has the tiles of the reducer.
+ *
+ * @param scheduler The scheduler to check.
+ * @throws std::invalid_argument If the tiles of the scheduler differ from those of the reducer.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto DiagnosticsReducer<Descriptor, Scalar>::checkScheduler(
+    const TiledScheduler<dimension>& scheduler
+) const -> void
+{
+    const std::vector<LatticeTile<dimension>>& tiles{scheduler.tiles()};
+
+    if (!std::ranges::equal(tiles, tiles_, [](const auto& first, const auto& second) {
+            return first.begin == second.begin && first.end == second.end;
+        }))
+    {
+        throw std::invalid_argument{"scheduler tiles differ from the tiles of the reducer"};
+    }
+}
+
+/**
+ * @brief Adds the moments of one node to the partial sums of its tile.
+ *
+ * Nodes with zero density, such as untouched solid nodes, add nothing but their zero mass.
+ *
+ * @param values The populations of the node in lattice vector order.
+ * @param sums The partial sums of the tile of the node.
+ * @param visit The position of the node in the visit order of all tiles.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto DiagnosticsReducer<Descriptor, Scalar>::accumulate(
+    const std::array<Scalar, size>& values,
+    TileSums& sums,
+    std::size_t visit
+) -> void
+{
+    const NodeMoments<dimension, Scalar> moments{computeNodeMoments<Descriptor>(values)};
+
+    sums.mass.add(moments.density);
+    if (moments.density == 0)
+    {
+        return;
+    }
+
+    const Scalar inverseDensity{Scalar{1.0} / moments.density};
+    std::array<Scalar, dimension> velocity;
+    Scalar velocitySquared{0.0};
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        sums.momentum[axis].add(moments.momentum[axis]);
+
+        velocity[axis] = moments.momentum[axis] * inverseDensity;
+        velocitySquared += velocity[axis] * velocity[axis];
+    }
+    const Scalar velocityChangeSquared{
+        trackResidual_ ? residual_.track(visit, velocity) : Scalar{0.0}
+    };
+
+    sums.kineticEnergy.add(Scalar{0.5} * moments.density * velocitySquared);
+    sums.velocitySquared.add(velocitySquared);
+    sums.velocityChangeSquared.add(velocityChangeSquared);
+    sums.maxVelocitySquared = std::max(sums.maxVelocitySquared, velocitySquared);
+}
+
+/**
+ * @brief Reduces the populations of the nodes of one tile into its partial sums.
+ *
+ * @param lattice The lattice to reduce.
+ * @param index The index of the tile.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto DiagnosticsReducer<Descriptor, Scalar>::reduceTile(
+    const Lattice<dimension, size, Scalar>& lattice,
+    std::size_t index
+) -> void
+{
+    std::array<std::span<const Scalar>, size> populations;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        populations[i] = lattice.population(i);
+    }
+
+    TileSums& sums{sums_[index]};
+    std::size_t visit{tileOffsets_[index]};
+    std::array<Scalar, size> values;
+
+    sums = TileSums{};
+    forEachRow(tiles_[index], extents_, [&](std::size_t firstNode, std::size_t lastNode) {
+        for (std::size_t node = firstNode; node < lastNode; ++node)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                values[i] = populations[i][node];
+            }
+            accumulate(values, sums, visit++);
+        }
+    });
+}
+
+/**
+ * @brief Combines the partial sums of a range of tiles pairwise.
+ *
+ * @param first The index of the first tile of the range.
+ * @param last One past the index of the last tile of the range.
+ * @return The combined partial sums of the range.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto DiagnosticsReducer<Descriptor, Scalar>::combine(std::size_t first, std::size_t last) const
+    -> TileSums
+{
+    if (last - first == 1)
+    {
+        return sums_[first];
+    }
+
+    const std::size_t middle{first + (last - first) / 2};
+    TileSums sums{combine(first, middle)};
+    const TileSums other{combine(middle, last)};
+
+    sums.mass.merge(other.mass);
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        sums.momentum[axis].merge(other.momentum[axis]);
+    }
+    sums.kineticEnergy.merge(other.kineticEnergy);
+    sums.velocitySquared.merge(other.velocitySquared);
+    sums.velocityChangeSquared.merge(other.velocityChangeSquared);
+    sums.maxVelocitySquared = std::max(sums.maxVelocitySquared, other.maxVelocitySquared);
+
+    return sums;
+}
+
+/**
+ * @brief Combines the partial sums of all tiles into the global diagnostics.
+ *
+ * @return The global diagnostics of the reduced lattice.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto DiagnosticsReducer<Descriptor, Scalar>::finish() -> GlobalDiagnostics<dimension, Scalar>
+{
+    const TileSums sums{tiles_.empty() ? TileSums{} : combine(0, tiles_.size())};
+
+    GlobalDiagnostics<dimension, Scalar> diagnostics{};
+    diagnostics.mass = sums.mass.value();
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        diagnostics.momentum[axis] = sums.momentum[axis].value();
+    }
+    diagnostics.kineticEnergy = sums.kineticEnergy.value();
+    diagnostics.maxVelocity = std::sqrt(sums.maxVelocitySquared);
+    diagnostics.residual = std::numeric_limits<Scalar>::infinity();
+
+    if (trackResidual_)
+    {
+        diagnostics.residual =
+            residual_.finish(sums.velocitySquared.value(), sums.velocityChangeSquared.value());
+    }
+
+    return diagnostics;
+}
+
+#endif // DIAGNOSTICS_GLOBAL_DIAGNOSTICS_TPP
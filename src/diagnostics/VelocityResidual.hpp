@@ -0,0 +1,64 @@
+#ifndef DIAGNOSTICS_VELOCITY_RESIDUAL_HPP
+#define DIAGNOSTICS_VELOCITY_RESIDUAL_HPP
+
+/**
+ * @file VelocityResidual.hpp
+ * @brief Declaration of the per-node moments and the VelocityResidual class template that the
+ * global diagnostics and the convergence monitor share.
+ */
+
+#include "../densityDistribution/LatticeDescriptor.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct NodeMoments
+ * @brief The mass and momentum density of one lattice node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+struct NodeMoments
+{
+    Scalar density;
+    std::array<Scalar, Dimension> momentum;
+};
+
+template <const auto& Descriptor, std::floating_point Scalar>
+auto computeNodeMoments(const std::array<Scalar, Descriptor.velocities.size()>& values)
+    -> NodeMoments<Descriptor.velocities[0].size(), Scalar>;
+
+/**
+ * @class VelocityResidual
+ * @brief A class template that measures how much the velocity at a fixed set of nodes changed
+ * since the previous evaluation.
+ *
+ * The velocity of every tracked node is kept from one evaluation to the next. The residual is the
+ * L2 norm of the change relative to the L2 norm of the velocity, or the absolute change if the
+ * velocity vanishes. It is infinite for the first evaluation.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+class VelocityResidual
+{
+public:
+    explicit VelocityResidual(std::size_t nodeCount);
+
+    auto track(std::size_t node, const std::array<Scalar, Dimension>& velocity) -> Scalar;
+    auto finish(Scalar velocitySquared, Scalar velocityChangeSquared) -> Scalar;
+    auto hasPrevious() const -> bool;
+
+private:
+    std::vector<Scalar> previousVelocities_;
+    bool hasPrevious_{false};
+};
+
+#include "VelocityResidual.tpp"
+
+#endif // DIAGNOSTICS_VELOCITY_RESIDUAL_HPP
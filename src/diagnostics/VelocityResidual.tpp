@@ -0,0 +1,127 @@
+#ifndef DIAGNOSTICS_VELOCITY_RESIDUAL_TPP
+#define DIAGNOSTICS_VELOCITY_RESIDUAL_TPP
+
+/**
+ * @file VelocityResidual.tpp
+ * @brief Implementation of the per-node moments and the VelocityResidual class template that the
+ * global diagnostics and the convergence monitor share.
+ */
+
+;
+#include "VelocityResidual.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/**
+ * @brief Computes the mass and momentum density of one lattice node.
+ *
+ * Uses the descriptor-generated computeDensity and computeMomentum, so the diagnostics sum the
+ * populations exactly as the collision kernels do.
+ *
+ * @param values The populations of the node in lattice vector order.
+ * @return The mass and momentum density of the node.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto computeNodeMoments(const std::array<Scalar, Descriptor.velocities.size()>& values)
+    -> NodeMoments<Descriptor.velocities[0].size(), Scalar>
+{
+    constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    constexpr std::size_t size{Descriptor.velocities.size()};
+
+    DensityDistribution<dimension, size, Scalar> distribution;
+    std::ranges::copy(values, distribution.begin());
+
+    return {computeDensity<Descriptor>(distribution), computeMomentum<Descriptor>(distribution)};
+}
+
+/**
+ * @brief Constructor for VelocityResidual with the number of tracked nodes.
+ *
+ * @param nodeCount The number of nodes whose velocity is tracked.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+VelocityResidual<Dimension, Scalar>::VelocityResidual(std::size_t nodeCount)
+    : previousVelocities_(Dimension * nodeCount)
+{
+}
+
+/**
+ * @brief Replaces the kept velocity of a node and returns how much it changed.
+ *
+ * @param node The index of the node among the tracked nodes.
+ * @param velocity The current velocity of the node.
+ * @return The squared L2 norm of the change of the velocity since the previous evaluation.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+auto VelocityResidual<Dimension, Scalar>::track(
+    std::size_t node,
+    const std::array<Scalar, Dimension>& velocity
+) -> Scalar
+{
+    Scalar velocityChangeSquared{0.0};
+
+    for (std::size_t axis = 0; axis < Dimension; ++axis)
+    {
+        Scalar& previous{previousVelocities_[node * Dimension + axis]};
+        velocityChangeSquared += (velocity[axis] - previous) * (velocity[axis] - previous);
+        previous = velocity[axis];
+    }
+
+    return velocityChangeSquared;
+}
+
+/**
+ * @brief Completes an evaluation in which every tracked node was passed to track.
+ *
+ * @param velocitySquared The sum of the squared velocities of the tracked nodes.
+ * @param velocityChangeSquared The sum of the results of track.
+ * @return The relative change of the velocity, or infinity for the first evaluation.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+auto VelocityResidual<Dimension, Scalar>::finish(
+    Scalar velocitySquared,
+    Scalar velocityChangeSquared
+) -> Scalar
+{
+    Scalar residual{std::numeric_limits<Scalar>::infinity()};
+
+    if (hasPrevious_)
+    {
+        const Scalar change{std::sqrt(velocityChangeSquared)};
+        const Scalar norm{std::sqrt(velocitySquared)};
+        residual = norm > 0 ? change / norm : change;
+    }
+    hasPrevious_ = true;
+
+    return residual;
+}
+
+/**
+ * @brief Returns whether an evaluation was completed before.
+ *
+ * @return Whether velocities of an earlier evaluation are kept.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+auto VelocityResidual<Dimension, Scalar>::hasPrevious() const -> bool
+{
+    return hasPrevious_;
+}
+
+#endif // DIAGNOSTICS_VELOCITY_RESIDUAL_TPP
@@ -0,0 +1,204 @@
+#ifndef INSTRUMENTATION_PHASE_RECORDER_HPP
+#define INSTRUMENTATION_PHASE_RECORDER_HPP
+
+/**
+ * @file PhaseRecorder.hpp
+ * @brief Declaration of scoped timers and counters for the phases of a time step, recorded into
+ * per-thread buffers that are merged when a report is written.
+ */
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Enables the scoped phase timers in the kernels of the library.
+ *
+ * Defaults to disabled, in which case ScopedPhase has an empty inline constructor and destructor
+ * and the kernels compile to the same code as without instrumentation. It must be defined to the
+ * same value in all translation units of a program, for example on the compiler command line.
+ */
+#ifndef LATTICEFLOW_INSTRUMENTATION
+#define LATTICEFLOW_INSTRUMENTATION 0
+#endif
+
+/**
+ * @enum Phase
+ * @brief The phases of a time step that are timed separately.
+ */
+enum class Phase : std::uint8_t
+{
+    Collide,
+    Stream,
+    Boundary,
+    Communication,
+    Moments,
+    Io
+};
+
+/**
+ * @brief The number of enumerators of Phase.
+ */
+constexpr std::size_t PHASE_COUNT{6};
+
+/**
+ * @brief The number of events that the buffer of one thread holds before it drops further events.
+ */
+constexpr std::size_t PHASE_BUFFER_CAPACITY{std::size_t{1} << 14U};
+
+/**
+ * @struct PhaseEvent
+ * @brief A single timed execution of a phase by one thread.
+ */
+struct PhaseEvent
+{
+    std::uint64_t start;
+    std::uint64_t duration;
+    std::uint64_t nodes;
+    std::uint32_t thread;
+    Phase phase;
+};
+
+/**
+ * @struct PhaseSummary
+ * @brief The accumulated counters of one phase over all threads.
+ */
+struct PhaseSummary
+{
+    std::uint64_t calls;
+    std::uint64_t nanoseconds;
+    std::uint64_t nodes;
+};
+
+/**
+ * @class PhaseBuffer
+ * @brief A fixed-capacity event buffer and set of phase counters that is written by a single
+ * thread without locks and can be read by any thread.
+ *
+ * Events become visible to readers with a release store of the event count. Once the buffer is
+ * full, further events are dropped while the counters keep accumulating. Clearing is not
+ * synchronized with recording, which keeps record lock-free, so clear may only be called while no
+ * phases are being recorded.
+ */
+class PhaseBuffer
+{
+public:
+    explicit PhaseBuffer(std::uint32_t thread);
+
+    auto record(Phase phase, std::uint64_t start, std::uint64_t duration, std::uint64_t nodes)
+        -> void;
+    auto enter(Phase phase) -> bool;
+    auto leave(Phase phase) -> void;
+    auto events() const -> std::span<const PhaseEvent>;
+    auto summary(Phase phase) const -> PhaseSummary;
+    auto dropped() const -> std::uint64_t;
+    auto clear() -> void;
+
+private:
+    /**
+     * @brief The relaxed atomic counters of one phase.
+     */
+    struct Counters
+    {
+        std::atomic<std::uint64_t> calls;
+        std::atomic<std::uint64_t> nanoseconds;
+        std::atomic<std::uint64_t> nodes;
+    };
+
+    std::unique_ptr<PhaseEvent[]> events_;
+    std::atomic<std::size_t> size_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::array<Counters, PHASE_COUNT> counters_{};
+    std::array<std::uint32_t, PHASE_COUNT> depths_{};
+    std::uint32_t thread_;
+};
+
+/**
+ * @class PhaseRecorder
+ * @brief The process-wide registry of the phase buffers of all threads.
+ *
+ * Buffers are created on the first recorded event of a thread and outlive the thread, so that
+ * events of finished worker threads are still reported. When a thread exits, its buffer is handed
+ * to the next thread that records its first event, which appends to it under the same trace
+ * thread number, so short-lived threads do not grow the registry beyond the largest number of
+ * threads that recorded at the same time. Reports may be collected at any time, but clear may only
+ * be called while no thread is inside a ScopedPhase.
+ */
+class PhaseRecorder
+{
+public:
+    static auto now() -> std::uint64_t;
+    static auto local() -> PhaseBuffer&;
+    static auto events() -> std::vector<PhaseEvent>;
+    static auto summary() -> std::array<PhaseSummary, PHASE_COUNT>;
+    static auto dropped() -> std::uint64_t;
+    static auto clear() -> void;
+
+private:
+    /**
+     * @brief The buffers of all threads that have recorded an event and the buffers of exited
+     * threads that are free for reuse, guarded by a mutex that is only taken when a thread records
+     * its first event or exits and when reports are collected.
+     */
+    struct Registry
+    {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<PhaseBuffer>> buffers;
+        std::vector<PhaseBuffer*> freeBuffers;
+    };
+
+    /**
+     * @brief The thread-local owner of the buffer of a thread, which returns the buffer to the
+     * free list of the registry when the thread exits.
+     */
+    struct BufferOwner
+    {
+        BufferOwner() = default;
+        BufferOwner(const BufferOwner& other) = delete;
+        BufferOwner(BufferOwner&& other) = delete;
+        ~BufferOwner();
+
+        auto operator=(const BufferOwner& other) -> BufferOwner& = delete;
+        auto operator=(BufferOwner&& other) -> BufferOwner& = delete;
+
+        PhaseBuffer* buffer{nullptr};
+    };
+
+    static auto registry() -> Registry&;
+};
+
+/**
+ * @class ScopedPhase
+ * @brief A timer that records the execution of a phase from its construction to its destruction.
+ *
+ * A scope nested in a scope of the same phase on the same thread is not recorded, so that kernels
+ * composed of other instrumented kernels are counted once.
+ */
+class ScopedPhase
+{
+public:
+    explicit ScopedPhase(Phase phase, std::size_t nodes = 0);
+    ScopedPhase(const ScopedPhase& other) = delete;
+    ScopedPhase(ScopedPhase&& other) = delete;
+    ~ScopedPhase();
+
+    auto operator=(const ScopedPhase& other) -> ScopedPhase& = delete;
+    auto operator=(ScopedPhase&& other) -> ScopedPhase& = delete;
+
+private:
+    PhaseBuffer* buffer_{nullptr};
+    std::uint64_t start_{0};
+    std::uint64_t nodes_{0};
+    Phase phase_;
+};
+
+constexpr auto phaseName(Phase phase) -> const char*;
+
+#include "PhaseRecorder.tpp"
+
+#endif // INSTRUMENTATION_PHASE_RECORDER_HPP
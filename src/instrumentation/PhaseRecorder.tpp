@@ -0,0 +1,373 @@
+#ifndef INSTRUMENTATION_PHASE_RECORDER_TPP
+#define INSTRUMENTATION_PHASE_RECORDER_TPP
+
+/**
+ * @file PhaseRecorder.tpp
+ * @brief Implementation of scoped timers and counters for the phases of a time step, recorded into
+ * per-thread buffers that are merged when a report is written.
+ */
+
+;
+#include "PhaseRecorder.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+/**
+ * @brief Constructor for PhaseBuffer that allocates the event storage.
+ *
+ * @param thread The sequential number of the owning thread in the trace.
+ */
+inline PhaseBuffer::PhaseBuffer(std::uint32_t thread)
+    : events_{std::make_unique<PhaseEvent[]>(PHASE_BUFFER_CAPACITY)},
+      thread_{thread}
+{
+}
+
+/**
+ * @brief Appends an event and adds it to the counters of its phase.
+ *
+ * Must only be called by the owning thread.
+ *
+ * @param phase The phase.
+ * @param start The start time in nanoseconds since the first call of PhaseRecorder::now.
+ * @param duration The duration in nanoseconds.
+ * @param nodes The number of lattice nodes processed.
+ */
+inline auto PhaseBuffer::record(
+    Phase phase,
+    std::uint64_t start,
+    std::uint64_t duration,
+    std::uint64_t nodes
+) -> void
+{
+    Counters& counters{counters_[static_cast<std::size_t>(phase)]};
+    counters.calls.fetch_add(1, std::memory_order_relaxed);
+    counters.nanoseconds.fetch_add(duration, std::memory_order_relaxed);
+    counters.nodes.fetch_add(nodes, std::memory_order_relaxed);
+
+    const std::size_t size{size_.load(std::memory_order_relaxed)};
+    if (size == PHASE_BUFFER_CAPACITY)
+    {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    events_[size] = PhaseEvent{start, duration, nodes, thread_, phase};
+    size_.store(size + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Marks the entry into a scope of a phase.
+ *
+ * Must only be called by the owning thread.
+ *
+ * @param phase The phase.
+ * @return Whether the scope is the outermost open scope of the phase.
+ */
+inline auto PhaseBuffer::enter(Phase phase) -> bool
+{
+    return depths_[static_cast<std::size_t>(phase)]++ == 0;
+}
+
+/**
+ * @brief Marks the exit from a scope of a phase.
+ *
+ * Must only be called by the owning thread.
+ *
+ * @param phase The phase.
+ */
+inline auto PhaseBuffer::leave(Phase phase) -> void
+{
+    --depths_[static_cast<std::size_t>(phase)];
+}
+
+/**
+ * @brief Returns the events recorded so far.
+ *
+ * @return A view of the published events in the order they were recorded.
+ */
+inline auto PhaseBuffer::events() const -> std::span<const PhaseEvent>
+{
+    return {events_.get(), size_.load(std::memory_order_acquire)};
+}
+
+/**
+ * @brief Returns the counters of a phase, including those of dropped events.
+ *
+ * @param phase The phase.
+ * @return The number of calls, nanoseconds and nodes recorded by this buffer.
+ */
+inline auto PhaseBuffer::summary(Phase phase) const -> PhaseSummary
+{
+    const Counters& counters{counters_[static_cast<std::size_t>(phase)]};
+
+    return {
+        counters.calls.load(std::memory_order_relaxed),
+        counters.nanoseconds.load(std::memory_order_relaxed),
+        counters.nodes.load(std::memory_order_relaxed)
+    };
+}
+
+/**
+ * @brief Returns the number of events that did not fit into the buffer.
+ *
+ * @return The number of dropped events.
+ */
+inline auto PhaseBuffer::dropped() const -> std::uint64_t
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Discards all events and resets all counters.
+ *
+ * May only be called while no phases are being recorded into this buffer. The stores are not
+ * synchronized with record, so a concurrent record could publish a stale event count after the
+ * reset or lose its counts to it. Call it between time steps, once all batches of the thread pool
+ * have finished.
+ */
+inline auto PhaseBuffer::clear() -> void
+{
+    size_.store(0, std::memory_order_release);
+    dropped_.store(0, std::memory_order_relaxed);
+    for (Counters& counters : counters_)
+    {
+        counters.calls.store(0, std::memory_order_relaxed);
+        counters.nanoseconds.store(0, std::memory_order_relaxed);
+        counters.nodes.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Returns the current time of the trace clock.
+ *
+ * @return The nanoseconds elapsed on the steady clock since the first call of this function.
+ */
+inline auto PhaseRecorder::now() -> std::uint64_t
+{
+    static const std::chrono::steady_clock::time_point epoch{std::chrono::steady_clock::now()};
+
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - epoch
+        )
+            .count()
+    );
+}
+
+/**
+ * @brief Returns the buffer of the calling thread, taking one on first use.
+ *
+ * The buffer of an exited thread is reused if there is one, otherwise a new buffer is registered.
+ *
+ * @return Reference to the buffer of the calling thread.
+ */
+inline auto PhaseRecorder::local() -> PhaseBuffer&
+{
+    thread_local BufferOwner owner;
+
+    if (owner.buffer == nullptr)
+    {
+        Registry& buffers{registry()};
+        const std::lock_guard lock{buffers.mutex};
+        if (buffers.freeBuffers.empty())
+        {
+            buffers.buffers.push_back(
+                std::make_unique<PhaseBuffer>(static_cast<std::uint32_t>(buffers.buffers.size()))
+            );
+            owner.buffer = buffers.buffers.back().get();
+        }
+        else
+        {
+            owner.buffer = buffers.freeBuffers.back();
+            buffers.freeBuffers.pop_back();
+        }
+    }
+
+    return *owner.buffer;
+}
+
+/**
+ * @brief Merges the events of all threads.
+ *
+ * @return The events of all threads, ordered by their start time.
+ */
+inline auto PhaseRecorder::events() -> std::vector<PhaseEvent>
+{
+    std::vector<PhaseEvent> merged;
+
+    {
+        Registry& buffers{registry()};
+        const std::lock_guard lock{buffers.mutex};
+        for (const auto& buffer : buffers.buffers)
+        {
+            const std::span<const PhaseEvent> events{buffer->events()};
+            merged.insert(merged.end(), events.begin(), events.end());
+        }
+    }
+
+    std::ranges::stable_sort(merged, {}, &PhaseEvent::start);
+
+    return merged;
+}
+
+/**
+ * @brief Sums the counters of all threads per phase.
+ *
+ * @return The summary of each phase, indexed by the value of the Phase enumerator.
+ */
+inline auto PhaseRecorder::summary() -> std::array<PhaseSummary, PHASE_COUNT>
+{
+    std::array<PhaseSummary, PHASE_COUNT> summaries{};
+
+    Registry& buffers{registry()};
+    const std::lock_guard lock{buffers.mutex};
+    for (const auto& buffer : buffers.buffers)
+    {
+        for (std::size_t phase = 0; phase < PHASE_COUNT; ++phase)
+        {
+            const PhaseSummary summary{buffer->summary(static_cast<Phase>(phase))};
+            summaries[phase].calls += summary.calls;
+            summaries[phase].nanoseconds += summary.nanoseconds;
+            summaries[phase].nodes += summary.nodes;
+        }
+    }
+
+    return summaries;
+}
+
+/**
+ * @brief Returns the number of events that did not fit into the buffers of all threads.
+ *
+ * @return The number of dropped events.
+ */
+inline auto PhaseRecorder::dropped() -> std::uint64_t
+{
+    std::uint64_t dropped{0};
+
+    Registry& buffers{registry()};
+    const std::lock_guard lock{buffers.mutex};
+    for (const auto& buffer : buffers.buffers)
+    {
+        dropped += buffer->dropped();
+    }
+
+    return dropped;
+}
+
+/**
+ * @brief Discards the events and counters of all threads.
+ *
+ * May only be called while no phases are being recorded on any thread, for example between time
+ * steps once all batches of the thread pool have finished. See PhaseBuffer::clear.
+ */
+inline auto PhaseRecorder::clear() -> void
+{
+    Registry& buffers{registry()};
+    const std::lock_guard lock{buffers.mutex};
+    for (const auto& buffer : buffers.buffers)
+    {
+        buffer->clear();
+    }
+}
+
+/**
+ * @brief Destructor for BufferOwner that returns the buffer of the exiting thread to the free list,
+ * keeping its events and counters for reports.
+ */
+inline PhaseRecorder::BufferOwner::~BufferOwner()
+{
+    if (buffer != nullptr)
+    {
+        Registry& buffers{registry()};
+        const std::lock_guard lock{buffers.mutex};
+        buffers.freeBuffers.push_back(buffer);
+    }
+}
+
+/**
+ * @brief Returns the process-wide registry of buffers.
+ *
+ * @return Reference to the registry.
+ */
+inline auto PhaseRecorder::registry() -> Registry&
+{
+    static Registry registry;
+
+    return registry;
+}
+
+/**
+ * @brief Constructor for ScopedPhase that starts the timer if instrumentation is enabled.
+ *
+ * @param phase The phase that the scope belongs to.
+ * @param nodes The number of lattice nodes that the scope processes.
+ */
+inline ScopedPhase::ScopedPhase(Phase phase, std::size_t nodes) : phase_{phase}
+{
+    if constexpr (LATTICEFLOW_INSTRUMENTATION)
+    {
+        PhaseBuffer& buffer{PhaseRecorder::local()};
+        if (buffer.enter(phase))
+        {
+            buffer_ = &buffer;
+            nodes_ = nodes;
+            start_ = PhaseRecorder::now();
+        }
+        else
+        {
+            buffer.leave(phase);
+        }
+    }
+    else
+    {
+        static_cast<void>(nodes);
+    }
+}
+
+/**
+ * @brief Destructor for ScopedPhase that records the elapsed time if the scope is the outermost
+ * one of its phase.
+ */
+inline ScopedPhase::~ScopedPhase()
+{
+    if constexpr (LATTICEFLOW_INSTRUMENTATION)
+    {
+        if (buffer_ != nullptr)
+        {
+            const std::uint64_t end{PhaseRecorder::now()};
+            buffer_->leave(phase_);
+            buffer_->record(phase_, start_, end - start_, nodes_);
+        }
+    }
+}
+
+/**
+ * @brief Returns the name of a phase as it appears in reports.
+ *
+ * @param phase The phase.
+ * @return The lower-case name of the phase.
+ */
+constexpr auto phaseName(Phase phase) -> const char*
+{
+    switch (phase)
+    {
+    case Phase::Collide:
+        return "collide";
+    case Phase::Stream:
+        return "stream";
+    case Phase::Boundary:
+        return "boundary";
+    case Phase::Communication:
+        return "communication";
+    case Phase::Moments:
+        return "moments";
+    case Phase::Io:
+        return "io";
+    }
+
+    return "unknown";
+}
+
+#endif // INSTRUMENTATION_PHASE_RECORDER_TPP
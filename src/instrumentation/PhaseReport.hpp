@@ -0,0 +1,24 @@
+#ifndef INSTRUMENTATION_PHASE_REPORT_HPP
+#define INSTRUMENTATION_PHASE_REPORT_HPP
+
+/**
+ * @file PhaseReport.hpp
+ * @brief Declaration of functions that export recorded phase events as a Chrome trace and phase
+ * counters as a summary table.
+ */
+
+#include "PhaseRecorder.hpp"
+
+#include <ostream>
+
+auto writeChromeTrace(std::ostream& stream, std::span<const PhaseEvent> events) -> void;
+
+auto writePhaseSummary(
+    std::ostream& stream,
+    const std::array<PhaseSummary, PHASE_COUNT>& summaries,
+    std::span<const PhaseEvent> events
+) -> void;
+
+#include "PhaseReport.tpp"
+
+#endif // INSTRUMENTATION_PHASE_REPORT_HPP
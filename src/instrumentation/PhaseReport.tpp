@@ -0,0 +1,157 @@
+#ifndef INSTRUMENTATION_PHASE_REPORT_TPP
+#define INSTRUMENTATION_PHASE_REPORT_TPP
+
+/**
+ * @file PhaseReport.tpp
+ * @brief Implementation of functions that export recorded phase events as a Chrome trace and
+ * phase counters as a summary table.
+ */
+
+;
+#include "PhaseReport.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <ios>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Writes phase events in the Chrome trace event format.
+ *
+ * Every event becomes a complete event with microsecond timestamps on the track of its thread and
+ * carries its node count as an argument, so the file can be opened in chrome://tracing or
+ * Perfetto.
+ *
+ * @param stream The stream to write the JSON document to.
+ * @param events The events, typically from PhaseRecorder::events.
+ */
+inline auto writeChromeTrace(std::ostream& stream, std::span<const PhaseEvent> events) -> void
+{
+    constexpr double nanosecondsPerMicrosecond{1e3};
+
+    const std::ios_base::fmtflags flags{stream.flags()};
+    const std::streamsize precision{stream.precision()};
+    stream << std::fixed << std::setprecision(3);
+
+    stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (std::size_t e = 0; e < events.size(); ++e)
+    {
+        const PhaseEvent& event{events[e]};
+        stream << (e == 0 ? "\n" : ",\n") << "{\"name\":\"" << phaseName(event.phase)
+               << "\",\"cat\":\"latticeflow\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread
+               << ",\"ts\":" << static_cast<double>(event.start) / nanosecondsPerMicrosecond
+               << ",\"dur\":" << static_cast<double>(event.duration) / nanosecondsPerMicrosecond
+               << ",\"args\":{\"nodes\":" << event.nodes << "}}";
+    }
+    stream << "\n]}\n";
+
+    stream.flags(flags);
+    stream.precision(precision);
+}
+
+/**
+ * @brief Returns the time covered by the union of a set of intervals.
+ *
+ * @param intervals The start and end times of the intervals in nanoseconds, in any order.
+ * @return The length of the union in nanoseconds, so that overlapping intervals count once.
+ */
+inline auto coveredNanoseconds(std::vector<std::pair<std::uint64_t, std::uint64_t>> intervals)
+    -> std::uint64_t
+{
+    std::ranges::sort(intervals);
+
+    std::uint64_t covered{0};
+    std::uint64_t end{0};
+    for (const auto& [first, last] : intervals)
+    {
+        if (last > end)
+        {
+            covered += last - std::max(first, end);
+            end = last;
+        }
+    }
+
+    return covered;
+}
+
+/**
+ * @brief Writes a table with the calls, CPU time, wall time, share of the wall time, nodes and
+ * million lattice updates per second (MLUPS) of each phase.
+ *
+ * Phases without calls are omitted. The CPU time and the nodes are summed over all threads. The
+ * wall time of a phase is the union of the intervals of its events, so the tiles that workers
+ * process concurrently are counted once, and its share is taken of the union of the intervals of
+ * all events. Phases that run concurrently with each other may therefore add up to more than 100
+ * percent. The MLUPS column is the throughput of the phase alone, that is, the nodes of its events
+ * divided by its wall time. Wall time and throughput cover only recorded events, so they omit the
+ * events that full buffers dropped.
+ *
+ * @param stream The stream to write the table to.
+ * @param summaries The counters of each phase, typically from PhaseRecorder::summary.
+ * @param events The events of all threads, typically from PhaseRecorder::events.
+ */
+inline auto writePhaseSummary(
+    std::ostream& stream,
+    const std::array<PhaseSummary, PHASE_COUNT>& summaries,
+    std::span<const PhaseEvent> events
+) -> void
+{
+    constexpr double nanosecondsPerMillisecond{1e6};
+    constexpr double percent{100.0};
+    constexpr int nameWidth{14};
+    constexpr int countWidth{10};
+    constexpr int valueWidth{12};
+
+    std::array<std::vector<std::pair<std::uint64_t, std::uint64_t>>, PHASE_COUNT> intervals;
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> allIntervals;
+    std::array<std::uint64_t, PHASE_COUNT> eventNodes{};
+    allIntervals.reserve(events.size());
+    for (const PhaseEvent& event : events)
+    {
+        const auto phase{static_cast<std::size_t>(event.phase)};
+        intervals[phase].emplace_back(event.start, event.start + event.duration);
+        allIntervals.emplace_back(event.start, event.start + event.duration);
+        eventNodes[phase] += event.nodes;
+    }
+    const std::uint64_t totalNanoseconds{coveredNanoseconds(std::move(allIntervals))};
+
+    const std::ios_base::fmtflags flags{stream.flags()};
+    const std::streamsize precision{stream.precision()};
+
+    stream << std::left << std::setw(nameWidth) << "phase" << std::right << std::setw(countWidth)
+           << "calls" << std::setw(valueWidth) << "CPU [ms]" << std::setw(valueWidth)
+           << "wall [ms]" << std::setw(valueWidth) << "share [%]" << std::setw(valueWidth)
+           << "nodes" << std::setw(valueWidth) << "MLUPS" << '\n';
+
+    stream << std::fixed << std::setprecision(3);
+    for (std::size_t phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        const PhaseSummary& summary{summaries[phase]};
+        if (summary.calls == 0)
+        {
+            continue;
+        }
+
+        const std::uint64_t wallNanoseconds{coveredNanoseconds(std::move(intervals[phase]))};
+        const auto wall{static_cast<double>(wallNanoseconds)};
+        const double share{
+            totalNanoseconds == 0 ? 0.0 : percent * wall / static_cast<double>(totalNanoseconds)
+        };
+        const double mlups{
+            wallNanoseconds == 0 ? 0.0 : static_cast<double>(eventNodes[phase]) * 1e3 / wall
+        };
+
+        stream << std::left << std::setw(nameWidth) << phaseName(static_cast<Phase>(phase))
+               << std::right << std::setw(countWidth) << summary.calls << std::setw(valueWidth)
+               << static_cast<double>(summary.nanoseconds) / nanosecondsPerMillisecond
+               << std::setw(valueWidth) << wall / nanosecondsPerMillisecond
+               << std::setw(valueWidth) << share << std::setw(valueWidth) << summary.nodes
+               << std::setw(valueWidth) << mlups << '\n';
+    }
+
+    stream.flags(flags);
+    stream.precision(precision);
+}
+
+#endif // INSTRUMENTATION_PHASE_REPORT_TPP
@@ -0,0 +1,99 @@
+#ifndef IO_ASYNC_FIELD_WRITER_HPP
+#define IO_ASYNC_FIELD_WRITER_HPP
+
+/**
+ * @file AsyncFieldWriter.hpp
+ * @brief Declaration of the AsyncFieldWriter class template that writes macroscopic fields of a
+ * lattice on a background thread while the solver keeps stepping.
+ */
+
+#include "../lattice/MomentCache.hpp"
+#include "../lattice/moments.hpp"
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @class AsyncFieldWriter
+ * @brief A class template that snapshots the density and momentum of a lattice into a
+ * double-buffered staging area and writes them as VTK image data on a background thread.
+ *
+ * The solver only pays for the batched moment kernel that fills a staging frame, plus a wait if
+ * both frames are still being written. Velocities are derived and the file is written by the I/O
+ * thread, which is the only other thread that touches a frame while it is queued. Each frame is
+ * written to directory/prefix_<timeStep>.vti as a VTK XML ImageData file with raw appended binary
+ * data, which ParaView and VisIt read without conversion. Errors of the I/O thread are rethrown by
+ * the next call to snapshot or flush.
+ *
+ * @tparam Dimension The number of spatial dimensions, at most three.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+class AsyncFieldWriter
+{
+public:
+    AsyncFieldWriter(
+        const std::array<std::size_t, Dimension>& extents,
+        const std::array<std::array<int, Dimension>, Size>& velocities,
+        std::filesystem::path directory,
+        std::string prefix = "fields"
+    );
+    AsyncFieldWriter(const AsyncFieldWriter& other) = delete;
+    AsyncFieldWriter(AsyncFieldWriter&& other) = delete;
+    ~AsyncFieldWriter();
+
+    auto operator=(const AsyncFieldWriter& other) -> AsyncFieldWriter& = delete;
+    auto operator=(AsyncFieldWriter&& other) -> AsyncFieldWriter& = delete;
+
+    auto snapshot(const Lattice<Dimension, Size, Scalar>& lattice, std::size_t timeStep)
+        -> std::chrono::nanoseconds;
+    auto snapshot(MomentCache<Dimension, Size, Scalar>& moments, std::size_t timeStep)
+        -> std::chrono::nanoseconds;
+    auto flush() -> void;
+
+    auto stalls() const -> const std::vector<std::chrono::nanoseconds>&;
+    auto framePath(std::size_t timeStep) const -> std::filesystem::path;
+
+private:
+    struct Frame
+    {
+        std::size_t timeStep{0};
+        std::vector<Scalar> densities;
+        std::array<std::vector<Scalar>, Dimension> momenta;
+    };
+
+    template <typename Fill>
+    auto stage(std::size_t timeStep, Fill fill) -> std::chrono::nanoseconds;
+    auto ioLoop() -> void;
+    auto writeFrame(const Frame& frame) const -> void;
+    auto rethrowPendingException() -> void;
+
+    std::array<std::size_t, Dimension> extents_;
+    std::array<std::array<int, Dimension>, Size> velocities_;
+    std::filesystem::path directory_;
+    std::string prefix_;
+    std::array<Frame, 2> frames_;
+    std::array<bool, 2> queued_{false, false};
+    std::size_t nextFrame_{0};
+    std::deque<std::size_t> queue_;
+    std::vector<std::chrono::nanoseconds> stalls_;
+    std::mutex mutex_;
+    std::condition_variable frameQueued_;
+    std::condition_variable frameWritten_;
+    std::exception_ptr exception_;
+    bool stopping_{false};
+    std::thread thread_;
+};
+
+#include "AsyncFieldWriter.tpp"
+
+#endif // IO_ASYNC_FIELD_WRITER_HPP
@@ -0,0 +1,433 @@
+#ifndef IO_ASYNC_FIELD_WRITER_TPP
+#define IO_ASYNC_FIELD_WRITER_TPP
+
+/**
+ * @file AsyncFieldWriter.tpp
+ * @brief Implementation of the AsyncFieldWriter class template that writes macroscopic fields of
+ * a lattice on a background thread while the solver keeps stepping.
+ */
+
+;
+#include "AsyncFieldWriter.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Constructor for AsyncFieldWriter that allocates both staging frames and starts the I/O
+ * thread.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param directory The existing directory that receives the files.
+ * @param prefix The start of every file name.
+ *
+ * @tparam Dimension The number of spatial dimensions, at most three.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+AsyncFieldWriter<Dimension, Size, Scalar>::AsyncFieldWriter(
+    const std::array<std::size_t, Dimension>& extents,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    std::filesystem::path directory,
+    std::string prefix
+)
+    : extents_{extents},
+      velocities_{velocities},
+      directory_{std::move(directory)},
+      prefix_{std::move(prefix)}
+{
+    static_assert(Dimension <= 3, "VTK image data has at most three dimensions");
+    static_assert(
+        std::same_as<Scalar, float> || std::same_as<Scalar, double>,
+        "VTK data arrays hold single or double precision values"
+    );
+
+    std::size_t nodeCount{1};
+    for (const std::size_t extent : extents_)
+    {
+        nodeCount *= extent;
+    }
+
+    for (Frame& frame : frames_)
+    {
+        frame.densities.resize(nodeCount);
+        for (std::vector<Scalar>& momentum : frame.momenta)
+        {
+            momentum.resize(nodeCount);
+        }
+    }
+
+    thread_ = std::thread{[this] { ioLoop(); }};
+}
+
+/**
+ * @brief Destructor for AsyncFieldWriter.
+ *
+ * Waits until all queued frames are written and joins the I/O thread. Errors of frames that were
+ * not flushed before are dropped.
+ *
+ * @tparam Dimension The number of spatial dimensions, at most three.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+AsyncFieldWriter<Dimension, Size, Scalar>::~AsyncFieldWriter()
+{
+    {
+        const std::scoped_lock lock{mutex_};
+        stopping_ = true;
+    }
+    frameQueued_.notify_one();
+
+    thread_.join();
+}
+
+/**
+ * @brief Copies the macroscopic fields of a lattice into a staging frame and queues it for
+ * writing.
+ *
+ * Only the batched moment kernel runs on the calling thread. If both staging frames are still
+ * queued, the call first waits for the older one to be written. The populations are read in
+ * natural layout, so lattices updated with streamAA must be snapshot after an even number of time
+ * steps. The lattice may be modified as soon as the call returns.
+ *
+ * @param lattice The lattice whose fields are written.
+ * @param timeStep The time step that names the file.
+ * @return The time the calling thread spent in this call, which is also appended to stalls.
+ * @throws std::invalid_argument If the extents of the lattice differ from those of the writer.
+ * @throws std::exception The first error that the I/O thread met since the last snapshot or flush.
+ *
+ * @tparam Dimension The number of spatial dimensions, at most three.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto AsyncFieldWriter<Dimension, Size, Scalar>::snapshot(
+    const Lattice<Dimension, Size, Scalar>& lattice,
+    std::size_t timeStep
+) -> std::chrono::nanoseconds
+{
+    if (lattice.extents() != extents_)
+    {
+        throw std::invalid_argument{"lattice extents differ from the writer extents"};
+    }
+
+    return stage(timeStep, [&](Frame& frame) {
+        std::array<std::span<Scalar>, Dimension> momenta;
+        for (std::size_t axis = 0; axis < Dimension; ++axis)
+        {
+            momenta[axis] = frame.momenta[axis];
+        }
+        computeMoments(
+            populationSpans(lattice), velocities_, std::span<Scalar>{frame.densities}, momenta
+        );
+    });
+}
+
+/**
+ * @brief Copies the cached macroscopic fields of a lattice into a staging frame and queues it for
+ * writing.
+ *
+ * The cache is refreshed if its lattice changed, otherwise the frame is filled from the moments
+ * that the time step already computed without another pass over the populations.
+ *
+ * @param moments The moment cache of the lattice whose fields are written.
+ * @param timeStep The time step that names the file.
+ * @return The time the calling thread spent in this call, which is also appended to stalls.
+ * @throws std::invalid_argument If the cached lattice holds a different number of nodes than the
+ * writer.
+ * @throws std::exception The first error that the I/O thread met since the last snapshot or flush.
+ *
+ * @tparam Dimension The number of spatial dimensions, at most three.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto AsyncFieldWriter<Dimension, Size, Scalar>::snapshot(
+    MomentCache<Dimension, Size, Scalar>& moments,
+    std::size_t timeStep
+) -> std::chrono::nanoseconds
+{
+    const std::span<const Scalar> densities{moments.densities()};
+    if (densities.size() != frames_[0].densities.size())
+    {
+        throw std::invalid_argument{"cached lattice differs in size from the writer extents"};
+    }
+
+    return stage(timeStep, [&](Frame& frame) {
+        const std::array<std::span<const Scalar>, Dimension> momenta{moments.momenta()};
+        std::ranges::copy(densities, frame.densities.begin());
+        for (std::size_t axis = 0; axis < Dimension; ++axis)
+        {
+            std::ranges::copy(momenta[axis], frame.momenta[axis].begin());
+        }
+    });
+}
+
+/**
+ * @brief Fills the next staging frame and queues it for writing.
+ *
+ * Waits for the frame to be written first if it is still queued.
+ *
+ * @param timeStep The time step that names the file.
+ * @param fill A callable invoked as fill(frame) that overwrites the fields of the frame.
+ * @return The time the calling thread spent in this call, which is also appended to stalls.
+ * @throws std::exception The first error that the I/O thread met since the last snapshot or flush.
+ *
+ * @tparam Dimension The number of spatial dimensions, at most three.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Fill The type of the fill callable.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+template <typename Fill>
+auto AsyncFieldWriter<Dimension, Size, Scalar>::stage(std::size_t timeStep, Fill fill)
+    -> std::chrono::nanoseconds
+{
+    const auto start{std::chrono::steady_clock::now()};
+
+    {
+        std::unique_lock lock{mutex_};
+        frameWritten_.wait(lock, [this] { return !queued_[nextFrame_]; });
+        rethrowPendingException();
+    }
+
+    Frame& frame{frames_[nextFrame_]};
+    frame.timeStep = timeStep;
+    fill(frame);
+
+    {
+        const std::scoped_lock lock{mutex_};
+        queued_[nextFrame_] = true;
+        queue_.push_back(nextFrame_);
+    }
+    frameQueued_.notify_one();
+    nextFrame_ = 1 - nextFrame_;
+
+    const auto stall{std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start
+    )};
+    stalls_.push_back(stall);
+
+    return stall;
+}
+
+/**
+ * @brief Waits until all queued frames are written.
+ *
+ * @throws std::exception The first error that the I/O thread met since the last snapshot or flush.
+ *
+ * @tparam Dimension The number of spatial dimensions, at most three.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto AsyncFieldWriter<Dimension, Size, Scalar>::flush() -> void
+{
+    std::unique_lock lock{mutex_};
+    frameWritten_.wait(lock, [this] { return queue_.empty(); });
+    rethrowPendingException();
+}
+
+/**
+ * @brief Returns the time the solver spent in each call to snapshot.
+ *
+ * @return Const reference to the stalls in the order of the snapshots.
+ *
+ * @tparam Dimension The number of spatial dimensions, at most three.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto AsyncFieldWriter<Dimension, Size, Scalar>::stalls() const
+    -> const std::vector<std::chrono::nanoseconds>&
+{
+    return stalls_;
+}
+
+/**
+ * @brief Returns the path of the file that holds the fields of a time step.
+ *
+ * @param timeStep The time step of the snapshot.
+ * @return The path directory/prefix_<timeStep>.vti, with the time step padded to eight digits.
+ *
+ * @tparam Dimension The number of spatial dimensions, at most three.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto AsyncFieldWriter<Dimension, Size, Scalar>::framePath(std::size_t timeStep) const
+    -> std::filesystem::path
+{
+    std::ostringstream name;
+    name << prefix_ << '_' << std::setw(8) << std::setfill('0') << timeStep << ".vti";
+
+    return directory_ / name.str();
+}
+
+/**
+ * @brief Writes queued frames in order until the writer is destroyed.
+ *
+ * A frame stays queued while it is written, so snapshot cannot refill it. The first exception of
+ * a write is kept for the solver thread, and later frames are still attempted.
+ *
+ * @tparam Dimension The number of spatial dimensions, at most three.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto AsyncFieldWriter<Dimension, Size, Scalar>::ioLoop() -> void
+{
+    while (true)
+    {
+        std::size_t index{0};
+        {
+            std::unique_lock lock{mutex_};
+            frameQueued_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (queue_.empty())
+            {
+                return;
+            }
+            index = queue_.front();
+        }
+
+        std::exception_ptr exception;
+        try
+        {
+            writeFrame(frames_[index]);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        {
+            const std::scoped_lock lock{mutex_};
+            if (exception && !exception_)
+            {
+                exception_ = exception;
+            }
+            queue_.pop_front();
+            queued_[index] = false;
+        }
+        frameWritten_.notify_all();
+    }
+}
+
+/**
+ * @brief Derives the velocities of a frame and writes it as a VTK XML ImageData file.
+ *
+ * The file holds the point arrays density and velocity, the latter with three components for all
+ * dimensions, as raw appended binary data with 64-bit block headers. It is written to a temporary
+ * file and renamed, so readers never see a partial frame.
+ *
+ * @param frame The frame to write.
+ * @throws std::runtime_error If the file cannot be written.
+ *
+ * @tparam Dimension The number of spatial dimensions, at most three.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto AsyncFieldWriter<Dimension, Size, Scalar>::writeFrame(const Frame& frame) const -> void
+{
+    constexpr std::size_t components{3};
+
+    const std::size_t nodeCount{frame.densities.size()};
+    const ScopedPhase phase{Phase::Io, nodeCount};
+
+    std::vector<Scalar> velocity(components * nodeCount, Scalar{0.0});
+    for (std::size_t node = 0; node < nodeCount; ++node)
+    {
+        const Scalar inverseDensity{Scalar{1.0} / frame.densities[node]};
+        for (std::size_t axis = 0; axis < Dimension; ++axis)
+        {
+            velocity[components * node + axis] = frame.momenta[axis][node] * inverseDensity;
+        }
+    }
+
+    const std::uint64_t densityBytes{nodeCount * sizeof(Scalar)};
+    const std::uint64_t velocityBytes{velocity.size() * sizeof(Scalar)};
+    const char* type{sizeof(Scalar) == 4 ? "Float32" : "Float64"};
+
+    std::ostringstream extent;
+    for (std::size_t axis = 0; axis < components; ++axis)
+    {
+        extent << (axis == 0 ? "" : " ") << "0 " << (axis < Dimension ? extents_[axis] - 1 : 0);
+    }
+
+    std::ostringstream header;
+    header << "<?xml version=\"1.0\"?>\n"
+           << "<VTKFile type=\"ImageData\" version=\"1.0\" byte_order=\""
+           << (std::endian::native == std::endian::little ? "LittleEndian" : "BigEndian")
+           << "\" header_type=\"UInt64\">\n"
+           << "  <ImageData WholeExtent=\"" << extent.str()
+           << "\" Origin=\"0 0 0\" Spacing=\"1 1 1\">\n"
+           << "    <Piece Extent=\"" << extent.str() << "\">\n"
+           << "      <PointData Scalars=\"density\" Vectors=\"velocity\">\n"
+           << "        <DataArray type=\"" << type
+           << "\" Name=\"density\" format=\"appended\" offset=\"0\"/>\n"
+           << "        <DataArray type=\"" << type
+           << "\" Name=\"velocity\" NumberOfComponents=\"3\" format=\"appended\" offset=\""
+           << sizeof(std::uint64_t) + densityBytes << "\"/>\n"
+           << "      </PointData>\n"
+           << "    </Piece>\n"
+           << "  </ImageData>\n"
+           << "  <AppendedData encoding=\"raw\">\n"
+           << "_";
+
+    const std::filesystem::path path{framePath(frame.timeStep)};
+    std::filesystem::path temporary{path};
+    temporary += ".tmp";
+
+    {
+        std::ofstream file{temporary, std::ios::binary};
+        file << header.str();
+        file.write(reinterpret_cast<const char*>(&densityBytes), sizeof(densityBytes));
+        file.write(
+            reinterpret_cast<const char*>(frame.densities.data()),
+            static_cast<std::streamsize>(densityBytes)
+        );
+        file.write(reinterpret_cast<const char*>(&velocityBytes), sizeof(velocityBytes));
+        file.write(
+            reinterpret_cast<const char*>(velocity.data()),
+            static_cast<std::streamsize>(velocityBytes)
+        );
+        file << "\n  </AppendedData>\n</VTKFile>\n";
+
+        if (!file.flush())
+        {
+            throw std::runtime_error{"cannot write fields to " + temporary.string()};
+        }
+    }
+
+    std::filesystem::rename(temporary, path);
+}
+
+/**
+ * @brief Rethrows and clears the stored error of the I/O thread, if there is one.
+ *
+ * Must be called with the mutex held.
+ *
+ * @tparam Dimension The number of spatial dimensions, at most three.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto AsyncFieldWriter<Dimension, Size, Scalar>::rethrowPendingException() -> void
+{
+    if (exception_)
+    {
+        std::rethrow_exception(std::exchange(exception_, nullptr));
+    }
+}
+
+#endif // IO_ASYNC_FIELD_WRITER_TPP
@@ -0,0 +1,138 @@
+#ifndef IO_CHECKPOINT_HPP
+#define IO_CHECKPOINT_HPP
+
+/**
+ * @file Checkpoint.hpp
+ * @brief Declaration of a binary checkpoint format that saves the populations of a lattice and
+ * restores them by memory-mapping the file.
+ *
+ * A checkpoint starts with a fixed header that names the lattice model, the scalar type, the
+ * extents, the byte order, the number of completed time steps and a checksum of the populations.
+ * The header is padded to a page, and every population array follows with the cache-line padded
+ * stride of Lattice, so a mapped checkpoint offers the population arrays in place and with the
+ * alignment kernels expect.
+ *
+ * The populations are saved as they are stored. A lattice advanced by the AA pattern holds the
+ * swapped layout after an odd number of time steps, so a restart must resume streaming with the
+ * number of completed time steps read back from the checkpoint rather than with zero.
+ */
+
+#include "../instrumentation/PhaseRecorder.hpp"
+#include "../lattice/Lattice.hpp"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+/**
+ * @brief The eight characters at the start of every checkpoint file.
+ */
+constexpr std::array<char, 8> CHECKPOINT_MAGIC{'L', 'F', 'L', 'O', 'W', 'C', 'K', 'P'};
+
+/**
+ * @brief The byte order marker, which reads back unchanged only on a machine of the same byte
+ * order as the writer.
+ */
+constexpr std::uint32_t CHECKPOINT_BYTE_ORDER{0x01020304U};
+
+/**
+ * @brief The largest number of spatial dimensions a checkpoint header can describe.
+ */
+constexpr std::size_t CHECKPOINT_MAX_DIMENSION{4};
+
+/**
+ * @brief The alignment in bytes of the first population array in a checkpoint file.
+ */
+constexpr std::size_t CHECKPOINT_DATA_ALIGNMENT{4096};
+
+/**
+ * @brief The version of the checkpoint format written by writeCheckpoint.
+ */
+constexpr std::uint32_t CHECKPOINT_VERSION{2};
+
+/**
+ * @brief The header at the start of every checkpoint file.
+ *
+ * All fields are stored in the byte order of the writing machine, which is recorded in byteOrder
+ * so that a reader with the other byte order rejects the file instead of misreading it.
+ */
+struct CheckpointHeader
+{
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint32_t dimension;
+    std::uint32_t size;
+    std::uint32_t scalarSize;
+    std::uint32_t scalarDigits;
+    std::array<std::uint64_t, CHECKPOINT_MAX_DIMENSION> extents;
+    std::uint64_t nodeCount;
+    std::uint64_t stride;
+    std::uint64_t dataOffset;
+    std::uint64_t completedSteps;
+    std::uint64_t checksum;
+};
+
+auto checkpointChecksum(std::uint64_t state, std::span<const std::byte> bytes) -> std::uint64_t;
+
+auto readCheckpointHeader(const std::filesystem::path& path) -> CheckpointHeader;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto writeCheckpoint(
+    const Lattice<Dimension, Size, Scalar>& lattice,
+    const std::filesystem::path& path,
+    std::size_t completedSteps
+) -> void;
+
+/**
+ * @class MappedCheckpoint
+ * @brief A class template representing a checkpoint file that is memory-mapped for reading.
+ *
+ * Opening a checkpoint validates its header against the template parameters but reads none of the
+ * populations; the operating system pages them in on first access. The population arrays are
+ * views into the mapping and stay valid for the lifetime of the object.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+class MappedCheckpoint
+{
+public:
+    explicit MappedCheckpoint(const std::filesystem::path& path);
+    MappedCheckpoint(const MappedCheckpoint&) = delete;
+    MappedCheckpoint(MappedCheckpoint&& other) noexcept;
+    auto operator=(const MappedCheckpoint&) -> MappedCheckpoint& = delete;
+    auto operator=(MappedCheckpoint&& other) noexcept -> MappedCheckpoint&;
+    ~MappedCheckpoint();
+
+    auto population(std::size_t direction) const -> std::span<const Scalar>;
+    auto header() const -> const CheckpointHeader&;
+    auto extents() const -> const std::array<std::size_t, Dimension>&;
+    auto nodeCount() const -> std::size_t;
+    auto completedSteps() const -> std::size_t;
+    auto verify() const -> bool;
+    auto restore(Lattice<Dimension, Size, Scalar>& lattice) const -> void;
+
+    constexpr auto dimension() const -> std::size_t;
+    constexpr auto size() const -> std::size_t;
+
+private:
+    CheckpointHeader header_;
+    std::array<std::size_t, Dimension> extents_;
+    void* mapping_;
+    std::size_t mappingSize_;
+};
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto readCheckpoint(
+    const std::filesystem::path& path,
+    std::size_t& completedSteps,
+    std::pmr::memory_resource* resource = nullptr
+) -> Lattice<Dimension, Size, Scalar>;
+
+#include "Checkpoint.tpp"
+
+#endif // IO_CHECKPOINT_HPP
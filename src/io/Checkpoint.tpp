@@ -0,0 +1,612 @@
+#ifndef IO_CHECKPOINT_TPP
+#define IO_CHECKPOINT_TPP
+
+/**
+ * @file Checkpoint.tpp
+ * @brief Implementation of a binary checkpoint format that saves the populations of a lattice and
+ * restores them by memory-mapping the file.
+ */
+
+;
+#include "Checkpoint.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief The number of population bytes that are checksummed and written or copied at a time.
+ *
+ * A chunk is small enough to stay in the cache between the checksum and the transfer, and large
+ * enough that every write is a long sequential one.
+ */
+constexpr std::size_t CHECKPOINT_CHUNK_SIZE{std::size_t{1} << 20U};
+
+/**
+ * @brief Folds a run of bytes into a running checksum of checkpoint populations.
+ *
+ * Bytes are consumed as 64-bit words, each of which is mixed into the state by bijective steps,
+ * so that changing any single word always changes the result. A trailing partial word is padded
+ * with zeros, so a run may be split into several calls only at multiples of eight bytes. The
+ * checksum detects truncated and corrupted files and is not meant to resist deliberate tampering.
+ *
+ * @param state The checksum of all previous runs, or 0 for the first one.
+ * @param bytes The run of bytes.
+ * @return The checksum including the run.
+ */
+inline auto checkpointChecksum(std::uint64_t state, std::span<const std::byte> bytes)
+    -> std::uint64_t
+{
+    constexpr std::uint64_t multiplier{0x9E3779B97F4A7C15U};
+    constexpr std::size_t wordSize{sizeof(std::uint64_t)};
+
+    const auto mix{[](std::uint64_t current, std::uint64_t word) {
+        current = (current ^ word) * multiplier;
+        return current ^ (current >> 32U);
+    }};
+
+    std::size_t offset{0};
+    for (; offset + wordSize <= bytes.size(); offset += wordSize)
+    {
+        std::uint64_t word{};
+        std::memcpy(&word, &bytes[offset], wordSize);
+        state = mix(state, word);
+    }
+    if (offset < bytes.size())
+    {
+        std::uint64_t word{0};
+        std::memcpy(&word, &bytes[offset], bytes.size() - offset);
+        state = mix(state, word);
+    }
+
+    return state;
+}
+
+/**
+ * @brief Writes a run of bytes to a file descriptor, resuming after partial writes.
+ *
+ * @param descriptor The file descriptor.
+ * @param bytes The run of bytes.
+ * @param offset The file offset of the first byte.
+ */
+inline auto writeCheckpointBytes(int descriptor, std::span<const std::byte> bytes, off_t offset)
+    -> void
+{
+    while (!bytes.empty())
+    {
+        const ssize_t written{::pwrite(descriptor, bytes.data(), bytes.size(), offset)};
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::system_error{errno, std::generic_category(), "cannot write checkpoint"};
+        }
+        bytes = bytes.subspan(static_cast<std::size_t>(written));
+        offset += written;
+    }
+}
+
+/**
+ * @brief Reads and validates the header of a checkpoint file.
+ *
+ * Only the parts of the header that do not depend on the lattice model are checked, so the result
+ * can be used to choose the template arguments of MappedCheckpoint.
+ *
+ * @param path The path of the checkpoint file.
+ * @return The header of the checkpoint.
+ * @throws std::runtime_error If the file cannot be read, is no checkpoint, has an unknown version
+ * or was written on a machine of the other byte order.
+ */
+inline auto readCheckpointHeader(const std::filesystem::path& path) -> CheckpointHeader
+{
+    std::ifstream file{path, std::ios::binary};
+    std::array<char, sizeof(CheckpointHeader)> bytes{};
+
+    if (!file.read(bytes.data(), bytes.size()))
+    {
+        throw std::runtime_error{"cannot read checkpoint header from " + path.string()};
+    }
+
+    const auto header{std::bit_cast<CheckpointHeader>(bytes)};
+
+    if (header.magic != CHECKPOINT_MAGIC)
+    {
+        throw std::runtime_error{path.string() + " is not a checkpoint"};
+    }
+    if (header.version != CHECKPOINT_VERSION)
+    {
+        throw std::runtime_error{"unsupported checkpoint version in " + path.string()};
+    }
+    if (header.byteOrder != CHECKPOINT_BYTE_ORDER)
+    {
+        throw std::runtime_error{path.string() + " was written with a different byte order"};
+    }
+
+    return header;
+}
+
+/**
+ * @brief Saves the populations of a lattice to a checkpoint file.
+ *
+ * The checkpoint is written to a temporary file next to path with one long sequential write per
+ * chunk of each population array, flushed to the storage device, and then renamed to path, so an
+ * interrupted write never replaces an existing checkpoint with a partial one. The checksum is
+ * accumulated chunk by chunk while the chunk is still in the cache.
+ *
+ * @param lattice The lattice to save.
+ * @param path The path of the checkpoint file.
+ * @param completedSteps The number of time steps the lattice has completed, which tells an
+ * AA-pattern restart the layout of the saved populations.
+ * @throws std::system_error If the file cannot be created, written or renamed.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto writeCheckpoint(
+    const Lattice<Dimension, Size, Scalar>& lattice,
+    const std::filesystem::path& path,
+    std::size_t completedSteps
+) -> void
+{
+    static_assert(Dimension <= CHECKPOINT_MAX_DIMENSION, "too many dimensions for a checkpoint");
+
+    const ScopedPhase phase{Phase::Io, lattice.nodeCount()};
+
+    constexpr std::size_t scalarsPerCacheLine{CACHE_LINE_SIZE / sizeof(Scalar)};
+    constexpr std::array<std::byte, CACHE_LINE_SIZE> padding{};
+
+    const std::size_t nodeCount{lattice.nodeCount()};
+    const std::size_t stride{
+        (nodeCount + scalarsPerCacheLine - 1) / scalarsPerCacheLine * scalarsPerCacheLine
+    };
+    const std::size_t paddingSize{(stride - nodeCount) * sizeof(Scalar)};
+
+    CheckpointHeader header{};
+    header.magic = CHECKPOINT_MAGIC;
+    header.version = CHECKPOINT_VERSION;
+    header.byteOrder = CHECKPOINT_BYTE_ORDER;
+    header.dimension = static_cast<std::uint32_t>(Dimension);
+    header.size = static_cast<std::uint32_t>(Size);
+    header.scalarSize = static_cast<std::uint32_t>(sizeof(Scalar));
+    header.scalarDigits = static_cast<std::uint32_t>(std::numeric_limits<Scalar>::digits);
+    header.extents.fill(1);
+    std::ranges::copy(lattice.extents(), header.extents.begin());
+    header.nodeCount = nodeCount;
+    header.stride = stride;
+    header.dataOffset = CHECKPOINT_DATA_ALIGNMENT;
+    header.completedSteps = completedSteps;
+    header.checksum = 0;
+
+    std::filesystem::path temporary{path};
+    temporary += ".tmp";
+
+    const int descriptor{::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)};
+    if (descriptor < 0)
+    {
+        throw std::system_error{
+            errno, std::generic_category(), "cannot create checkpoint " + temporary.string()
+        };
+    }
+
+    try
+    {
+        auto offset{static_cast<off_t>(header.dataOffset)};
+
+        for (std::size_t direction = 0; direction < Size; ++direction)
+        {
+            auto bytes{std::as_bytes(lattice.population(direction))};
+            while (!bytes.empty())
+            {
+                const auto chunk{bytes.first(std::min(bytes.size(), CHECKPOINT_CHUNK_SIZE))};
+                header.checksum = checkpointChecksum(header.checksum, chunk);
+                writeCheckpointBytes(descriptor, chunk, offset);
+                offset += static_cast<off_t>(chunk.size());
+                bytes = bytes.subspan(chunk.size());
+            }
+            writeCheckpointBytes(
+                descriptor, std::span<const std::byte>{padding}.first(paddingSize), offset
+            );
+            offset += static_cast<off_t>(paddingSize);
+        }
+
+        std::vector<std::byte> headerPage(header.dataOffset);
+        std::memcpy(headerPage.data(), &header, sizeof(header));
+        writeCheckpointBytes(descriptor, headerPage, 0);
+
+        if (::fsync(descriptor) != 0)
+        {
+            throw std::system_error{errno, std::generic_category(), "cannot flush checkpoint"};
+        }
+    }
+    catch (...)
+    {
+        ::close(descriptor);
+        std::filesystem::remove(temporary);
+        throw;
+    }
+
+    if (::close(descriptor) != 0)
+    {
+        std::filesystem::remove(temporary);
+        throw std::system_error{errno, std::generic_category(), "cannot close checkpoint"};
+    }
+
+    std::filesystem::rename(temporary, path);
+}
+
+/**
+ * @brief Constructor for MappedCheckpoint that maps a checkpoint file for reading.
+ *
+ * The file is mapped privately and read-only, with a hint that it will be read sequentially.
+ *
+ * @param path The path of the checkpoint file.
+ * @throws std::runtime_error If the header does not describe a lattice with the template
+ * parameters, or the file is shorter than the header claims.
+ * @throws std::system_error If the file cannot be opened or mapped.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+MappedCheckpoint<Dimension, Size, Scalar>::MappedCheckpoint(const std::filesystem::path& path)
+    : header_{readCheckpointHeader(path)},
+      extents_{},
+      mapping_{nullptr},
+      mappingSize_{0}
+{
+    static_assert(Dimension <= CHECKPOINT_MAX_DIMENSION, "too many dimensions for a checkpoint");
+
+    if (header_.dimension != Dimension || header_.size != Size ||
+        header_.scalarSize != sizeof(Scalar) ||
+        header_.scalarDigits != static_cast<std::uint32_t>(std::numeric_limits<Scalar>::digits))
+    {
+        throw std::runtime_error{path.string() + " holds a different lattice model or scalar type"};
+    }
+
+    std::size_t nodeCount{1};
+    for (std::size_t axis = 0; axis < Dimension; ++axis)
+    {
+        extents_[axis] = header_.extents[axis];
+        nodeCount *= extents_[axis];
+    }
+    if (nodeCount != header_.nodeCount || header_.stride < header_.nodeCount ||
+        header_.dataOffset % CHECKPOINT_DATA_ALIGNMENT != 0)
+    {
+        throw std::runtime_error{path.string() + " has an inconsistent checkpoint header"};
+    }
+
+    const int descriptor{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (descriptor < 0)
+    {
+        throw std::system_error{
+            errno, std::generic_category(), "cannot open checkpoint " + path.string()
+        };
+    }
+
+    struct stat status{};
+    if (::fstat(descriptor, &status) != 0)
+    {
+        const int error{errno};
+        ::close(descriptor);
+        throw std::system_error{error, std::generic_category(), "cannot inspect checkpoint"};
+    }
+
+    mappingSize_ = header_.dataOffset + Size * header_.stride * sizeof(Scalar);
+    if (static_cast<std::size_t>(status.st_size) < mappingSize_)
+    {
+        ::close(descriptor);
+        throw std::runtime_error{path.string() + " is truncated"};
+    }
+
+    mapping_ = ::mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    const int error{errno};
+    ::close(descriptor);
+    if (mapping_ == MAP_FAILED)
+    {
+        mapping_ = nullptr;
+        throw std::system_error{error, std::generic_category(), "cannot map checkpoint"};
+    }
+
+    ::posix_madvise(mapping_, mappingSize_, POSIX_MADV_SEQUENTIAL);
+}
+
+/**
+ * @brief Move constructor for MappedCheckpoint that takes over the mapping of another object.
+ *
+ * @param other The checkpoint to move from, which no longer owns a mapping afterwards.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+MappedCheckpoint<Dimension, Size, Scalar>::MappedCheckpoint(MappedCheckpoint&& other) noexcept
+    : header_{other.header_},
+      extents_{other.extents_},
+      mapping_{std::exchange(other.mapping_, nullptr)},
+      mappingSize_{std::exchange(other.mappingSize_, 0)}
+{
+}
+
+/**
+ * @brief Move assignment for MappedCheckpoint that releases the own mapping and takes over the
+ * mapping of another object.
+ *
+ * @param other The checkpoint to move from, which no longer owns a mapping afterwards.
+ * @return A reference to this checkpoint.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MappedCheckpoint<Dimension, Size, Scalar>::operator=(MappedCheckpoint&& other) noexcept
+    -> MappedCheckpoint&
+{
+    if (this != &other)
+    {
+        if (mapping_ != nullptr)
+        {
+            ::munmap(mapping_, mappingSize_);
+        }
+        header_ = other.header_;
+        extents_ = other.extents_;
+        mapping_ = std::exchange(other.mapping_, nullptr);
+        mappingSize_ = std::exchange(other.mappingSize_, 0);
+    }
+
+    return *this;
+}
+
+/**
+ * @brief Destructor for MappedCheckpoint that unmaps the checkpoint file.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+MappedCheckpoint<Dimension, Size, Scalar>::~MappedCheckpoint()
+{
+    if (mapping_ != nullptr)
+    {
+        ::munmap(mapping_, mappingSize_);
+    }
+}
+
+/**
+ * @brief Returns the population array of a lattice vector in place in the mapping.
+ *
+ * @param direction Index of the lattice vector.
+ * @return Const view of the values of the lattice vector at all lattice nodes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MappedCheckpoint<Dimension, Size, Scalar>::population(std::size_t direction) const
+    -> std::span<const Scalar>
+{
+    const auto* first{reinterpret_cast<const Scalar*>(
+        static_cast<const std::byte*>(mapping_) + header_.dataOffset
+    )};
+
+    return {first + direction * header_.stride, header_.nodeCount};
+}
+
+/**
+ * @brief Returns the header of the checkpoint.
+ *
+ * @return Const reference to the header.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MappedCheckpoint<Dimension, Size, Scalar>::header() const -> const CheckpointHeader&
+{
+    return header_;
+}
+
+/**
+ * @brief Returns the number of lattice nodes along each spatial dimension.
+ *
+ * @return Const reference to the extents of the saved lattice.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MappedCheckpoint<Dimension, Size, Scalar>::extents() const
+    -> const std::array<std::size_t, Dimension>&
+{
+    return extents_;
+}
+
+/**
+ * @brief Returns the total number of lattice nodes.
+ *
+ * @return The product of the extents.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MappedCheckpoint<Dimension, Size, Scalar>::nodeCount() const -> std::size_t
+{
+    return header_.nodeCount;
+}
+
+/**
+ * @brief Returns the number of time steps the saved lattice had completed.
+ *
+ * An odd number means that an AA-pattern lattice was saved in the swapped layout.
+ *
+ * @return The number of completed time steps.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MappedCheckpoint<Dimension, Size, Scalar>::completedSteps() const -> std::size_t
+{
+    return header_.completedSteps;
+}
+
+/**
+ * @brief Checks the populations against the checksum in the header.
+ *
+ * This reads every population from the file, so it costs as much as a full restore.
+ *
+ * @return Whether the checksum of the populations matches the header.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MappedCheckpoint<Dimension, Size, Scalar>::verify() const -> bool
+{
+    std::uint64_t checksum{0};
+
+    for (std::size_t direction = 0; direction < Size; ++direction)
+    {
+        checksum = checkpointChecksum(checksum, std::as_bytes(population(direction)));
+    }
+
+    return checksum == header_.checksum;
+}
+
+/**
+ * @brief Copies the populations into a lattice and verifies them on the way.
+ *
+ * Each chunk is checksummed right after it is copied, while it is still in the cache, so the
+ * file is read only once.
+ *
+ * @param lattice The lattice to restore, whose contents are unspecified if an exception is thrown.
+ * @throws std::invalid_argument If the extents of the lattice differ from the checkpoint.
+ * @throws std::runtime_error If the populations do not match the checksum in the header.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MappedCheckpoint<Dimension, Size, Scalar>::restore(Lattice<Dimension, Size, Scalar>& lattice
+) const -> void
+{
+    const ScopedPhase phase{Phase::Io, lattice.nodeCount()};
+
+    constexpr std::size_t chunkScalars{CHECKPOINT_CHUNK_SIZE / sizeof(Scalar)};
+
+    if (lattice.extents() != extents_)
+    {
+        throw std::invalid_argument{"lattice extents differ from the checkpoint"};
+    }
+
+    std::uint64_t checksum{0};
+
+    for (std::size_t direction = 0; direction < Size; ++direction)
+    {
+        const auto source{population(direction)};
+        const auto destination{lattice.population(direction)};
+
+        for (std::size_t first = 0; first < source.size(); first += chunkScalars)
+        {
+            const std::size_t count{std::min(chunkScalars, source.size() - first)};
+            std::ranges::copy(source.subspan(first, count), destination.begin() + first);
+            checksum = checkpointChecksum(
+                checksum, std::as_bytes(std::span<const Scalar>{destination.subspan(first, count)})
+            );
+        }
+    }
+
+    if (checksum != header_.checksum)
+    {
+        throw std::runtime_error{"checkpoint populations do not match their checksum"};
+    }
+}
+
+/**
+ * @brief Returns the number of spatial dimensions.
+ *
+ * @return The number of spatial dimensions.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto MappedCheckpoint<Dimension, Size, Scalar>::dimension() const -> std::size_t
+{
+    return Dimension;
+}
+
+/**
+ * @brief Returns the number of lattice vectors at each lattice node.
+ *
+ * @return The number of lattice vectors.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto MappedCheckpoint<Dimension, Size, Scalar>::size() const -> std::size_t
+{
+    return Size;
+}
+
+/**
+ * @brief Restores a lattice from a checkpoint file.
+ *
+ * @param path The path of the checkpoint file.
+ * @param completedSteps Set to the number of time steps the saved lattice had completed, with
+ * which an AA-pattern time loop resumes.
+ * @param resource The memory resource of the population storage, or nullptr for the heap.
+ * @return A lattice with the extents and populations of the checkpoint.
+ * @throws std::runtime_error If the file is no valid checkpoint of this lattice model.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto readCheckpoint(
+    const std::filesystem::path& path,
+    std::size_t& completedSteps,
+    std::pmr::memory_resource* resource
+) -> Lattice<Dimension, Size, Scalar>
+{
+    const MappedCheckpoint<Dimension, Size, Scalar> checkpoint{path};
+    Lattice<Dimension, Size, Scalar> lattice{checkpoint.extents(), resource};
+
+    checkpoint.restore(lattice);
+    completedSteps = checkpoint.completedSteps();
+
+    return lattice;
+}
+
+#endif // IO_CHECKPOINT_TPP
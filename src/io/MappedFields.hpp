@@ -0,0 +1,66 @@
+#ifndef IO_MAPPED_FIELDS_HPP
+#define IO_MAPPED_FIELDS_HPP
+
+/**
+ * @file MappedFields.hpp
+ * @brief Declaration of a raw binary format for density and velocity fields that is read by
+ * memory-mapping the file.
+ *
+ * A field file holds no header: the density at every lattice node is followed by each component of
+ * the velocity at every lattice node, all as native-endian scalars in the node order of Lattice.
+ * The extents and scalar type are therefore known to the reader beforehand, and the file size is
+ * the only check of that knowledge.
+ */
+
+#include "../lattice/Lattice.hpp"
+
+#include <array>
+#include <filesystem>
+#include <span>
+
+template <std::size_t Dimension, std::floating_point Scalar>
+auto writeFields(
+    const std::filesystem::path& path,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, Dimension>& flowVelocities
+) -> void;
+
+/**
+ * @class MappedFields
+ * @brief A class template representing a field file that is memory-mapped for reading.
+ *
+ * The fields are views into the mapping and stay valid for the lifetime of the object, so they can
+ * be passed to initializeEquilibrium without an intermediate copy.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+class MappedFields
+{
+public:
+    MappedFields(
+        const std::filesystem::path& path,
+        const std::array<std::size_t, Dimension>& extents
+    );
+    MappedFields(const MappedFields&) = delete;
+    MappedFields(MappedFields&& other) noexcept;
+    auto operator=(const MappedFields&) -> MappedFields& = delete;
+    auto operator=(MappedFields&& other) noexcept -> MappedFields&;
+    ~MappedFields();
+
+    auto densities() const -> std::span<const Scalar>;
+    auto velocities() const -> std::array<std::span<const Scalar>, Dimension>;
+    auto extents() const -> const std::array<std::size_t, Dimension>&;
+    auto nodeCount() const -> std::size_t;
+
+private:
+    std::array<std::size_t, Dimension> extents_;
+    std::size_t nodeCount_;
+    void* mapping_;
+    std::size_t mappingSize_;
+};
+
+#include "MappedFields.tpp"
+
+#endif // IO_MAPPED_FIELDS_HPP
@@ -0,0 +1,265 @@
+#ifndef IO_MAPPED_FIELDS_TPP
+#define IO_MAPPED_FIELDS_TPP
+
+/**
+ * @file MappedFields.tpp
+ * @brief Implementation of a raw binary format for density and velocity fields that is read by
+ * memory-mapping the file.
+ */
+
+;
+#include "MappedFields.hpp"
+
+#include <cerrno>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Writes density and velocity fields to a field file.
+ *
+ * @param path The path of the field file, replaced if it exists.
+ * @param densities The density at every lattice node.
+ * @param flowVelocities The components of the flow velocity at every lattice node.
+ * @throws std::length_error If the velocity components differ in size from the densities.
+ * @throws std::runtime_error If the file cannot be written.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+auto writeFields(
+    const std::filesystem::path& path,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, Dimension>& flowVelocities
+) -> void
+{
+    for (const std::span<const Scalar> component : flowVelocities)
+    {
+        if (component.size() != densities.size())
+        {
+            throw std::length_error{"velocity components must hold one value per density"};
+        }
+    }
+
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    const auto write = [&](std::span<const Scalar> field) {
+        file.write(
+            reinterpret_cast<const char*>(field.data()),
+            static_cast<std::streamsize>(field.size_bytes())
+        );
+    };
+
+    write(densities);
+    for (const std::span<const Scalar> component : flowVelocities)
+    {
+        write(component);
+    }
+
+    if (!file.flush())
+    {
+        throw std::runtime_error{"cannot write fields to " + path.string()};
+    }
+}
+
+/**
+ * @brief Constructor for MappedFields that maps a field file for reading.
+ *
+ * The file is mapped privately and read-only, with a hint that it will be read sequentially.
+ *
+ * @param path The path of the field file.
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @throws std::runtime_error If the file size does not match the extents and scalar type.
+ * @throws std::system_error If the file cannot be opened or mapped.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+MappedFields<Dimension, Scalar>::MappedFields(
+    const std::filesystem::path& path,
+    const std::array<std::size_t, Dimension>& extents
+)
+    : extents_{extents},
+      nodeCount_{std::accumulate(
+          extents.begin(), extents.end(), std::size_t{1}, std::multiplies<>{}
+      )},
+      mapping_{nullptr},
+      mappingSize_{(1 + Dimension) * nodeCount_ * sizeof(Scalar)}
+{
+    const int descriptor{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (descriptor < 0)
+    {
+        throw std::system_error{
+            errno, std::generic_category(), "cannot open field file " + path.string()
+        };
+    }
+
+    struct stat status{};
+    if (::fstat(descriptor, &status) != 0)
+    {
+        const int error{errno};
+        ::close(descriptor);
+        throw std::system_error{error, std::generic_category(), "cannot inspect field file"};
+    }
+
+    if (static_cast<std::size_t>(status.st_size) != mappingSize_)
+    {
+        ::close(descriptor);
+        throw std::runtime_error{path.string() + " does not match the extents and scalar type"};
+    }
+    if (mappingSize_ == 0)
+    {
+        ::close(descriptor);
+        return;
+    }
+
+    mapping_ = ::mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    const int error{errno};
+    ::close(descriptor);
+    if (mapping_ == MAP_FAILED)
+    {
+        mapping_ = nullptr;
+        throw std::system_error{error, std::generic_category(), "cannot map field file"};
+    }
+
+    ::posix_madvise(mapping_, mappingSize_, POSIX_MADV_SEQUENTIAL);
+}
+
+/**
+ * @brief Move constructor for MappedFields that takes over the mapping of another object.
+ *
+ * @param other The fields to move from, which no longer own a mapping afterwards.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+MappedFields<Dimension, Scalar>::MappedFields(MappedFields&& other) noexcept
+    : extents_{other.extents_},
+      nodeCount_{std::exchange(other.nodeCount_, 0)},
+      mapping_{std::exchange(other.mapping_, nullptr)},
+      mappingSize_{std::exchange(other.mappingSize_, 0)}
+{
+}
+
+/**
+ * @brief Move assignment for MappedFields that releases the own mapping and takes over the
+ * mapping of another object.
+ *
+ * @param other The fields to move from, which no longer own a mapping afterwards.
+ * @return A reference to these fields.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+auto MappedFields<Dimension, Scalar>::operator=(MappedFields&& other) noexcept -> MappedFields&
+{
+    if (this != &other)
+    {
+        if (mapping_ != nullptr)
+        {
+            ::munmap(mapping_, mappingSize_);
+        }
+        extents_ = other.extents_;
+        nodeCount_ = std::exchange(other.nodeCount_, 0);
+        mapping_ = std::exchange(other.mapping_, nullptr);
+        mappingSize_ = std::exchange(other.mappingSize_, 0);
+    }
+
+    return *this;
+}
+
+/**
+ * @brief Destructor for MappedFields that unmaps the field file.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+MappedFields<Dimension, Scalar>::~MappedFields()
+{
+    if (mapping_ != nullptr)
+    {
+        ::munmap(mapping_, mappingSize_);
+    }
+}
+
+/**
+ * @brief Returns the density field in place in the mapping.
+ *
+ * @return Const view of the density at all lattice nodes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+auto MappedFields<Dimension, Scalar>::densities() const -> std::span<const Scalar>
+{
+    return {static_cast<const Scalar*>(mapping_), nodeCount_};
+}
+
+/**
+ * @brief Returns the components of the velocity field in place in the mapping.
+ *
+ * @return Const views of each velocity component at all lattice nodes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+auto MappedFields<Dimension, Scalar>::velocities() const
+    -> std::array<std::span<const Scalar>, Dimension>
+{
+    std::array<std::span<const Scalar>, Dimension> components;
+    for (std::size_t axis = 0; axis < Dimension; ++axis)
+    {
+        components[axis] = mapping_ == nullptr
+                               ? std::span<const Scalar>{}
+                               : std::span<const Scalar>{
+                                     static_cast<const Scalar*>(mapping_) + (1 + axis) * nodeCount_,
+                                     nodeCount_
+                                 };
+    }
+
+    return components;
+}
+
+/**
+ * @brief Returns the number of lattice nodes along each spatial dimension.
+ *
+ * @return Const reference to the extents of the fields.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+auto MappedFields<Dimension, Scalar>::extents() const -> const std::array<std::size_t, Dimension>&
+{
+    return extents_;
+}
+
+/**
+ * @brief Returns the total number of lattice nodes.
+ *
+ * @return The product of the extents.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::floating_point Scalar>
+auto MappedFields<Dimension, Scalar>::nodeCount() const -> std::size_t
+{
+    return nodeCount_;
+}
+
+#endif // IO_MAPPED_FIELDS_TPP
@@ -0,0 +1,67 @@
+#ifndef ALIGNED_ALLOCATOR_HPP
+#define ALIGNED_ALLOCATOR_HPP
+
+/**
+ * @file AlignedAllocator.hpp
+ * @brief Declaration of the AlignedAllocator class template that allocates over-aligned storage
+ * for lattice populations.
+ */
+
+#include <cstddef>
+#include <memory_resource>
+
+/**
+ * @brief The assumed size in bytes of a cache line.
+ */
+constexpr std::size_t CACHE_LINE_SIZE{64};
+
+/**
+ * @class AlignedAllocator
+ * @brief A standard-conforming allocator that returns storage aligned to a fixed boundary.
+ *
+ * Elements constructed without arguments are default-initialized rather than value-initialized,
+ * so resizing a container of scalars leaves the new memory untouched until its first write.
+ * Storage comes from the global aligned operator new unless the allocator is given a memory
+ * resource such as an Arena, which every allocator converted from it shares.
+ *
+ * @tparam Value The type of the allocated elements.
+ * @tparam Alignment The alignment in bytes of every allocation.
+ */
+template <typename Value, std::size_t Alignment = CACHE_LINE_SIZE>
+class AlignedAllocator
+{
+public:
+    using value_type = Value;
+
+    template <typename Other>
+    struct rebind
+    {
+        using other = AlignedAllocator<Other, Alignment>;
+    };
+
+    AlignedAllocator() = default;
+
+    explicit constexpr AlignedAllocator(std::pmr::memory_resource* resource) noexcept;
+
+    template <typename Other>
+    constexpr AlignedAllocator(const AlignedAllocator<Other, Alignment>& other) noexcept;
+
+    auto allocate(std::size_t count) -> Value*;
+    auto deallocate(Value* pointer, std::size_t count) noexcept -> void;
+
+    template <typename Other, typename... Arguments>
+    auto construct(Other* pointer, Arguments&&... arguments) -> void;
+
+    template <typename Other>
+    constexpr auto operator==(const AlignedAllocator<Other, Alignment>& other) const noexcept
+        -> bool;
+
+    constexpr auto resource() const noexcept -> std::pmr::memory_resource*;
+
+private:
+    std::pmr::memory_resource* resource_{nullptr};
+};
+
+#include "AlignedAllocator.tpp"
+
+#endif // ALIGNED_ALLOCATOR_HPP
@@ -0,0 +1,165 @@
+#ifndef ALIGNED_ALLOCATOR_TPP
+#define ALIGNED_ALLOCATOR_TPP
+
+/**
+ * @file AlignedAllocator.tpp
+ * @brief Implementation of the AlignedAllocator class template that allocates over-aligned storage
+ * for lattice populations.
+ */
+
+;
+#include "AlignedAllocator.hpp"
+
+#include <limits>
+#include <new>
+#include <utility>
+
+/**
+ * @brief Constructor for AlignedAllocator that draws storage from a memory resource.
+ *
+ * @param resource The memory resource, or nullptr for the global aligned operator new. The
+ * resource must outlive all storage allocated from it.
+ *
+ * @tparam Value The type of the allocated elements.
+ * @tparam Alignment The alignment in bytes of every allocation.
+ */
+template <typename Value, std::size_t Alignment>
+constexpr AlignedAllocator<Value, Alignment>::AlignedAllocator(std::pmr::memory_resource* resource
+) noexcept
+    : resource_{resource}
+{
+}
+
+/**
+ * @brief Converting constructor for AlignedAllocator.
+ *
+ * The converted allocator shares the memory resource of other, so storage from one can be released
+ * by the other.
+ *
+ * @param other The allocator to convert from.
+ *
+ * @tparam Value The type of the allocated elements.
+ * @tparam Alignment The alignment in bytes of every allocation.
+ * @tparam Other The element type of the allocator to convert from.
+ */
+template <typename Value, std::size_t Alignment>
+template <typename Other>
+constexpr AlignedAllocator<Value, Alignment>::AlignedAllocator(
+    const AlignedAllocator<Other, Alignment>& other
+) noexcept
+    : resource_{other.resource()}
+{
+}
+
+/**
+ * @brief Allocates uninitialized storage for a number of elements.
+ *
+ * @param count The number of elements to allocate storage for.
+ * @return Pointer to the first element of the allocated storage.
+ *
+ * @tparam Value The type of the allocated elements.
+ * @tparam Alignment The alignment in bytes of every allocation.
+ */
+template <typename Value, std::size_t Alignment>
+auto AlignedAllocator<Value, Alignment>::allocate(std::size_t count) -> Value*
+{
+    if (count > std::numeric_limits<std::size_t>::max() / sizeof(Value))
+    {
+        throw std::bad_array_new_length{};
+    }
+
+    if (resource_ != nullptr)
+    {
+        return static_cast<Value*>(resource_->allocate(count * sizeof(Value), Alignment));
+    }
+
+    return static_cast<Value*>(::operator new(count * sizeof(Value), std::align_val_t{Alignment}));
+}
+
+/**
+ * @brief Deallocates storage previously obtained from allocate.
+ *
+ * @param pointer Pointer to the storage to deallocate.
+ * @param count The number of elements the storage was allocated for.
+ *
+ * @tparam Value The type of the allocated elements.
+ * @tparam Alignment The alignment in bytes of every allocation.
+ */
+template <typename Value, std::size_t Alignment>
+auto AlignedAllocator<Value, Alignment>::deallocate(Value* pointer, std::size_t count) noexcept
+    -> void
+{
+    if (resource_ != nullptr)
+    {
+        resource_->deallocate(pointer, count * sizeof(Value), Alignment);
+        return;
+    }
+
+    ::operator delete(pointer, count * sizeof(Value), std::align_val_t{Alignment});
+}
+
+/**
+ * @brief Constructs an element in allocated storage.
+ *
+ * Without arguments the element is default-initialized, which leaves scalars indeterminate and
+ * does not write to their memory. This lets the first thread that writes a page decide on which
+ * NUMA node the page is placed.
+ *
+ * @param pointer Pointer to the storage of the element.
+ * @param arguments The constructor arguments of the element.
+ *
+ * @tparam Value The type of the allocated elements.
+ * @tparam Alignment The alignment in bytes of every allocation.
+ * @tparam Other The type of the constructed element.
+ * @tparam Arguments The types of the constructor arguments.
+ */
+template <typename Value, std::size_t Alignment>
+template <typename Other, typename... Arguments>
+auto AlignedAllocator<Value, Alignment>::construct(Other* pointer, Arguments&&... arguments) -> void
+{
+    if constexpr (sizeof...(Arguments) == 0)
+    {
+        ::new (static_cast<void*>(pointer)) Other;
+    }
+    else
+    {
+        ::new (static_cast<void*>(pointer)) Other(std::forward<Arguments>(arguments)...);
+    }
+}
+
+/**
+ * @brief Compares two aligned allocators for equality.
+ *
+ * @param other The allocator to compare with.
+ * @return Whether both allocators use the same memory resource, in which case storage from one can
+ * be released by the other.
+ *
+ * @tparam Value The type of the allocated elements.
+ * @tparam Alignment The alignment in bytes of every allocation.
+ * @tparam Other The element type of the allocator to compare with.
+ */
+template <typename Value, std::size_t Alignment>
+template <typename Other>
+constexpr auto AlignedAllocator<Value, Alignment>::operator==(
+    const AlignedAllocator<Other, Alignment>& other
+) const noexcept -> bool
+{
+    return resource_ == other.resource();
+}
+
+/**
+ * @brief Returns the memory resource of the allocator.
+ *
+ * @return The memory resource, or nullptr if storage comes from the global aligned operator new.
+ *
+ * @tparam Value The type of the allocated elements.
+ * @tparam Alignment The alignment in bytes of every allocation.
+ */
+template <typename Value, std::size_t Alignment>
+constexpr auto AlignedAllocator<Value, Alignment>::resource() const noexcept
+    -> std::pmr::memory_resource*
+{
+    return resource_;
+}
+
+#endif // ALIGNED_ALLOCATOR_TPP
@@ -0,0 +1,76 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+/**
+ * @file Arena.hpp
+ * @brief Declaration of the Arena class, a monotonic memory resource with huge-page backing for
+ * lattice blocks, halo buffers and per-thread scratch storage.
+ */
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+/**
+ * @brief The size in bytes of a transparent huge page, to which arena chunks are aligned.
+ */
+constexpr std::size_t HUGE_PAGE_SIZE{std::size_t{2} << 20U};
+
+/**
+ * @brief The default size in bytes of the chunks an arena reserves.
+ */
+constexpr std::size_t ARENA_CHUNK_SIZE{std::size_t{64} << 20U};
+
+/**
+ * @class Arena
+ * @brief A memory resource that hands out storage from a few large chunks by bumping an offset.
+ *
+ * Chunks are aligned to huge pages and, on Linux, advised to be backed by them, so a lattice that
+ * is split into many blocks neither fragments the heap nor takes a page fault per block. Single
+ * deallocations are ignored; reset makes the whole arena reusable while keeping its chunks and
+ * their pages, so rebuilding blocks after a refinement or a restart touches no new memory. An
+ * arena is not synchronized: threads that need scratch storage should each own one. Lattices take
+ * an arena through the memory resource parameter of their constructors.
+ */
+class Arena : public std::pmr::memory_resource
+{
+public:
+    explicit Arena(std::size_t chunkSize = ARENA_CHUNK_SIZE, bool hugePages = true);
+    Arena(const Arena& other) = delete;
+    Arena(Arena&& other) = delete;
+    ~Arena() override;
+
+    auto operator=(const Arena& other) -> Arena& = delete;
+    auto operator=(Arena&& other) -> Arena& = delete;
+
+    auto reset() noexcept -> void;
+    auto release() noexcept -> void;
+
+    auto bytesAllocated() const noexcept -> std::size_t;
+    auto bytesReserved() const noexcept -> std::size_t;
+    auto chunkCount() const noexcept -> std::size_t;
+
+private:
+    struct Chunk
+    {
+        std::byte* data;
+        std::size_t size;
+    };
+
+    auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override;
+    auto do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) -> void override;
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override;
+
+    auto reserveChunk(std::size_t minimumSize) -> void;
+
+    std::vector<Chunk> chunks_;
+    std::size_t chunkSize_;
+    std::size_t current_{0};
+    std::size_t offset_{0};
+    std::size_t bytesAllocated_{0};
+    bool hugePages_;
+};
+
+#include "Arena.tpp"
+
+#endif // ARENA_HPP
@@ -0,0 +1,194 @@
+#ifndef ARENA_TPP
+#define ARENA_TPP
+
+/**
+ * @file Arena.tpp
+ * @brief Implementation of the Arena class, a monotonic memory resource with huge-page backing for
+ * lattice blocks, halo buffers and per-thread scratch storage.
+ */
+
+;
+#include "Arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+/**
+ * @brief Constructor for Arena with the size of its chunks.
+ *
+ * No memory is reserved until the first allocation.
+ *
+ * @param chunkSize The size in bytes of each chunk, rounded up to whole huge pages. Allocations
+ * that do not fit into a chunk of this size get a chunk of their own.
+ * @param hugePages Whether chunks are advised to be backed by transparent huge pages. Only
+ * supported on Linux and ignored elsewhere.
+ */
+inline Arena::Arena(std::size_t chunkSize, bool hugePages)
+    : chunkSize_{chunkSize},
+      hugePages_{hugePages}
+{
+}
+
+/**
+ * @brief Destructor for Arena that returns all chunks to the system.
+ */
+inline Arena::~Arena()
+{
+    release();
+}
+
+/**
+ * @brief Makes all storage of the arena available again while keeping its chunks.
+ *
+ * All storage handed out before becomes invalid. Since the chunks stay reserved and their pages
+ * stay resident, allocations after a reset take neither system calls nor page faults.
+ */
+inline auto Arena::reset() noexcept -> void
+{
+    current_ = 0;
+    offset_ = 0;
+    bytesAllocated_ = 0;
+}
+
+/**
+ * @brief Returns all chunks to the system.
+ *
+ * All storage handed out before becomes invalid.
+ */
+inline auto Arena::release() noexcept -> void
+{
+    for (const Chunk& chunk : chunks_)
+    {
+        ::operator delete(chunk.data, chunk.size, std::align_val_t{HUGE_PAGE_SIZE});
+    }
+
+    chunks_.clear();
+    reset();
+}
+
+/**
+ * @brief Returns the number of bytes handed out since the last reset.
+ *
+ * @return The sum of the sizes of all allocations, without alignment padding.
+ */
+inline auto Arena::bytesAllocated() const noexcept -> std::size_t
+{
+    return bytesAllocated_;
+}
+
+/**
+ * @brief Returns the number of bytes reserved in chunks.
+ *
+ * @return The sum of the sizes of all chunks, of which only touched pages are resident.
+ */
+inline auto Arena::bytesReserved() const noexcept -> std::size_t
+{
+    std::size_t bytes{0};
+
+    for (const Chunk& chunk : chunks_)
+    {
+        bytes += chunk.size;
+    }
+
+    return bytes;
+}
+
+/**
+ * @brief Returns the number of reserved chunks.
+ *
+ * @return The number of chunks.
+ */
+inline auto Arena::chunkCount() const noexcept -> std::size_t
+{
+    return chunks_.size();
+}
+
+/**
+ * @brief Hands out storage from the current chunk, moving on to the next chunk or reserving a new
+ * one if it does not fit.
+ *
+ * @param bytes The size in bytes of the storage.
+ * @param alignment The alignment in bytes of the storage, a power of two.
+ * @return Pointer to the storage.
+ * @throws std::bad_alloc If no new chunk can be reserved.
+ */
+inline auto Arena::do_allocate(std::size_t bytes, std::size_t alignment) -> void*
+{
+    while (true)
+    {
+        for (; current_ < chunks_.size(); ++current_, offset_ = 0)
+        {
+            const Chunk& chunk{chunks_[current_]};
+            const auto address{reinterpret_cast<std::uintptr_t>(chunk.data) + offset_};
+            const std::size_t padding{(alignment - address % alignment) % alignment};
+
+            if (offset_ + padding <= chunk.size && bytes <= chunk.size - offset_ - padding)
+            {
+                std::byte* pointer{chunk.data + offset_ + padding};
+                offset_ += padding + bytes;
+                bytesAllocated_ += bytes;
+                return pointer;
+            }
+        }
+
+        reserveChunk(bytes + alignment);
+    }
+}
+
+/**
+ * @brief Ignores the release of single allocations, whose storage is reused after reset.
+ *
+ * @param pointer Pointer to the storage.
+ * @param bytes The size in bytes of the storage.
+ * @param alignment The alignment in bytes of the storage.
+ */
+inline auto Arena::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) -> void
+{
+    static_cast<void>(pointer);
+    static_cast<void>(bytes);
+    static_cast<void>(alignment);
+}
+
+/**
+ * @brief Compares the arena with another memory resource.
+ *
+ * @param other The memory resource to compare with.
+ * @return Whether other is this arena, the only resource that can release its storage.
+ */
+inline auto Arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool
+{
+    return this == &other;
+}
+
+/**
+ * @brief Reserves a new chunk after all existing ones.
+ *
+ * @param minimumSize The least size in bytes of the chunk.
+ * @throws std::bad_alloc If the chunk cannot be reserved.
+ */
+inline auto Arena::reserveChunk(std::size_t minimumSize) -> void
+{
+    const std::size_t size{
+        (std::max(chunkSize_, minimumSize) + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE
+    };
+    chunks_.reserve(chunks_.size() + 1);
+    auto* data{static_cast<std::byte*>(::operator new(size, std::align_val_t{HUGE_PAGE_SIZE}))};
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (hugePages_)
+    {
+        ::madvise(data, size, MADV_HUGEPAGE);
+    }
+#else
+    static_cast<void>(hugePages_);
+#endif
+
+    chunks_.push_back({data, size});
+}
+
+#endif // ARENA_TPP
@@ -0,0 +1,80 @@
+#ifndef LATTICE_HPP
+#define LATTICE_HPP
+
+/**
+ * @file Lattice.hpp
+ * @brief Declaration of the Lattice class template that stores the density distributions of a
+ * structured grid of lattice nodes.
+ */
+
+#include "../densityDistribution/DensityDistribution.hpp"
+#include "AlignedAllocator.hpp"
+#include "RevisionCounter.hpp"
+
+#include <array>
+#include <span>
+#include <vector>
+
+/**
+ * @class Lattice
+ * @brief A class template representing the density distributions of a structured grid of lattice
+ * nodes in structure-of-arrays layout.
+ *
+ * Every lattice vector owns one contiguous population array that holds its value at all nodes, and
+ * every population array starts on a cache line boundary. Nodes are numbered with the first
+ * coordinate running fastest, so kernels that sweep over a population array get unit-stride memory
+ * access. Single nodes are exchanged with the rest of the library as DensityDistribution objects.
+ * The population storage can be drawn from a memory resource such as an Arena, so that the blocks
+ * of a large domain share a few huge-page backed chunks.
+ *
+ * Every request for a non-const population array advances the revision of the lattice, so that
+ * derived data such as a MomentCache can tell whether the populations may have changed. Code that
+ * only reads populations takes a const lattice or reads through std::as_const, which leaves the
+ * revision alone.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+class Lattice
+{
+public:
+    explicit Lattice(
+        const std::array<std::size_t, Dimension>& extents,
+        std::pmr::memory_resource* resource = nullptr
+    );
+
+    template <typename FirstTouch>
+        requires(!std::convertible_to<FirstTouch, std::pmr::memory_resource*>)
+    Lattice(
+        const std::array<std::size_t, Dimension>& extents,
+        FirstTouch firstTouch,
+        std::pmr::memory_resource* resource = nullptr
+    );
+
+    auto node(std::size_t index) const -> DensityDistribution<Dimension, Size, Scalar>;
+    auto setNode(std::size_t index, const DensityDistribution<Dimension, Size, Scalar>& distribution)
+        -> void;
+    auto population(std::size_t direction) -> std::span<Scalar>;
+    auto population(std::size_t direction) const -> std::span<const Scalar>;
+
+    auto linearIndex(const std::array<std::size_t, Dimension>& coordinates) const -> std::size_t;
+    auto extents() const -> const std::array<std::size_t, Dimension>&;
+    auto nodeCount() const -> std::size_t;
+    auto revision() const -> std::uint64_t;
+
+    constexpr auto dimension() const -> std::size_t;
+    constexpr auto size() const -> std::size_t;
+
+private:
+    std::array<std::size_t, Dimension> extents_;
+    std::size_t nodeCount_;
+    std::size_t stride_;
+    std::vector<Scalar, AlignedAllocator<Scalar>> populations_;
+    RevisionCounter revision_;
+};
+
+#include "Lattice.tpp"
+
+#endif // LATTICE_HPP
@@ -0,0 +1,302 @@
+#ifndef LATTICE_TPP
+#define LATTICE_TPP
+
+/**
+ * @file Lattice.tpp
+ * @brief Implementation of the Lattice class template that stores the density distributions of a
+ * structured grid of lattice nodes.
+ */
+
+;
+#include "Lattice.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+/**
+ * @brief Constructor for Lattice with the number of nodes along each spatial dimension.
+ *
+ * Initializes all populations with zeros. Each population array is padded to a whole number of
+ * cache lines so that the next one starts on a cache line boundary.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param resource The memory resource of the population storage, or nullptr for the heap.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+Lattice<Dimension, Size, Scalar>::Lattice(
+    const std::array<std::size_t, Dimension>& extents,
+    std::pmr::memory_resource* resource
+)
+    : extents_{extents},
+      nodeCount_{std::accumulate(
+          extents.begin(), extents.end(), std::size_t{1}, std::multiplies<std::size_t>{}
+      )},
+      populations_{AlignedAllocator<Scalar>{resource}}
+{
+    constexpr std::size_t scalarsPerCacheLine{CACHE_LINE_SIZE / sizeof(Scalar)};
+
+    stride_ = (nodeCount_ + scalarsPerCacheLine - 1) / scalarsPerCacheLine * scalarsPerCacheLine;
+    populations_.assign(Size * stride_, Scalar{0.0});
+}
+
+/**
+ * @brief Constructor for Lattice that leaves the placement of population memory to the caller.
+ *
+ * The population storage is allocated without being written, and firstTouch is invoked once with
+ * a callable zero(firstNode, lastNode) that sets the populations of the nodes in [firstNode,
+ * lastNode) to zero in every population array. firstTouch must cover every node exactly once, and
+ * may call zero from several threads so that each page is placed on the NUMA node of the thread
+ * that later updates it. The padding behind each population array is zeroed by the calling
+ * thread.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param firstTouch A callable that distributes the initial writes of the node ranges.
+ * @param resource The memory resource of the population storage, or nullptr for the heap.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam FirstTouch The type of the first-touch callable.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+template <typename FirstTouch>
+    requires(!std::convertible_to<FirstTouch, std::pmr::memory_resource*>)
+Lattice<Dimension, Size, Scalar>::Lattice(
+    const std::array<std::size_t, Dimension>& extents,
+    FirstTouch firstTouch,
+    std::pmr::memory_resource* resource
+)
+    : extents_{extents},
+      nodeCount_{std::accumulate(
+          extents.begin(), extents.end(), std::size_t{1}, std::multiplies<std::size_t>{}
+      )},
+      populations_{AlignedAllocator<Scalar>{resource}}
+{
+    constexpr std::size_t scalarsPerCacheLine{CACHE_LINE_SIZE / sizeof(Scalar)};
+
+    stride_ = (nodeCount_ + scalarsPerCacheLine - 1) / scalarsPerCacheLine * scalarsPerCacheLine;
+    populations_.resize(Size * stride_);
+
+    for (std::size_t direction = 0; direction < Size; ++direction)
+    {
+        std::ranges::fill(
+            std::span<Scalar>{populations_}.subspan(
+                direction * stride_ + nodeCount_, stride_ - nodeCount_
+            ),
+            Scalar{0.0}
+        );
+    }
+
+    firstTouch([this](std::size_t firstNode, std::size_t lastNode) {
+        for (std::size_t direction = 0; direction < Size; ++direction)
+        {
+            std::ranges::fill(
+                std::span<Scalar>{populations_}.subspan(
+                    direction * stride_ + firstNode, lastNode - firstNode
+                ),
+                Scalar{0.0}
+            );
+        }
+    });
+}
+
+/**
+ * @brief Gathers the density distribution at a lattice node.
+ *
+ * @param index Linear index of the lattice node.
+ * @return A copy of the density distribution at the lattice node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto Lattice<Dimension, Size, Scalar>::node(std::size_t index) const
+    -> DensityDistribution<Dimension, Size, Scalar>
+{
+    DensityDistribution<Dimension, Size, Scalar> distribution;
+
+    for (std::size_t direction = 0; direction < Size; ++direction)
+    {
+        distribution[direction] = population(direction)[index];
+    }
+
+    return distribution;
+}
+
+/**
+ * @brief Scatters a density distribution to a lattice node.
+ *
+ * Advances the revision of the lattice once.
+ *
+ * @param index Linear index of the lattice node.
+ * @param distribution The density distribution to store at the lattice node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto Lattice<Dimension, Size, Scalar>::setNode(
+    std::size_t index,
+    const DensityDistribution<Dimension, Size, Scalar>& distribution
+) -> void
+{
+    revision_.advance();
+
+    for (std::size_t direction = 0; direction < Size; ++direction)
+    {
+        populations_[direction * stride_ + index] = distribution[direction];
+    }
+}
+
+/**
+ * @brief Returns the population array of a lattice vector for non-const Lattice objects.
+ *
+ * Advances the revision of the lattice, since the caller may write through the view. The revision
+ * is an atomic counter, so kernels fetch the view of each lattice vector once before their node
+ * loop instead of calling this function per node.
+ *
+ * @param direction Index of the lattice vector.
+ * @return Non-const view of the values of the lattice vector at all lattice nodes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto Lattice<Dimension, Size, Scalar>::population(std::size_t direction) -> std::span<Scalar>
+{
+    revision_.advance();
+
+    return std::span<Scalar>{populations_}.subspan(direction * stride_, nodeCount_);
+}
+
+/**
+ * @brief Returns the population array of a lattice vector for const Lattice objects.
+ *
+ * @param direction Index of the lattice vector.
+ * @return Const view of the values of the lattice vector at all lattice nodes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto Lattice<Dimension, Size, Scalar>::population(std::size_t direction) const
+    -> std::span<const Scalar>
+{
+    return std::span<const Scalar>{populations_}.subspan(direction * stride_, nodeCount_);
+}
+
+/**
+ * @brief Converts the coordinates of a lattice node to its linear index.
+ *
+ * @param coordinates The integer coordinates of the lattice node.
+ * @return The linear index of the lattice node, with the first coordinate running fastest.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto Lattice<Dimension, Size, Scalar>::linearIndex(
+    const std::array<std::size_t, Dimension>& coordinates
+) const -> std::size_t
+{
+    std::size_t index{0};
+
+    for (std::size_t axis = Dimension; axis-- > 0;)
+    {
+        index = index * extents_[axis] + coordinates[axis];
+    }
+
+    return index;
+}
+
+/**
+ * @brief Returns the number of lattice nodes along each spatial dimension.
+ *
+ * @return The number of lattice nodes along each spatial dimension.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto Lattice<Dimension, Size, Scalar>::extents() const -> const std::array<std::size_t, Dimension>&
+{
+    return extents_;
+}
+
+/**
+ * @brief Returns the total number of lattice nodes.
+ *
+ * @return The total number of lattice nodes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto Lattice<Dimension, Size, Scalar>::nodeCount() const -> std::size_t
+{
+    return nodeCount_;
+}
+
+/**
+ * @brief Returns the revision of the populations.
+ *
+ * @return A number that differs from every earlier result whenever a node was set or a non-const
+ * population array was requested in between.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto Lattice<Dimension, Size, Scalar>::revision() const -> std::uint64_t
+{
+    return revision_.value();
+}
+
+/**
+ * @brief Returns the dimension of the lattice.
+ *
+ * Returns the dimension of the lattice, which is a compile-time constant.
+ *
+ * @return The dimension of the lattice.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto Lattice<Dimension, Size, Scalar>::dimension() const -> std::size_t
+{
+    return Dimension;
+}
+
+/**
+ * @brief Returns the number of lattice vectors at each lattice node.
+ *
+ * Returns the number of lattice vectors at each lattice node, which is a compile-time constant.
+ *
+ * @return The number of lattice vectors at each lattice node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto Lattice<Dimension, Size, Scalar>::size() const -> std::size_t
+{
+    return Size;
+}
+
+#endif // LATTICE_TPP
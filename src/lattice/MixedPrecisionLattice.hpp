@@ -0,0 +1,82 @@
+#ifndef MIXED_PRECISION_LATTICE_HPP
+#define MIXED_PRECISION_LATTICE_HPP
+
+/**
+ * @file MixedPrecisionLattice.hpp
+ * @brief Declaration of the MixedPrecisionLattice class template that stores the density
+ * distributions of a structured grid of lattice nodes in a compact storage format.
+ */
+
+#include "../densityDistribution/DensityDistribution.hpp"
+#include "../precision/StorageFormat.hpp"
+#include "AlignedAllocator.hpp"
+
+#include <array>
+#include <span>
+#include <vector>
+
+/**
+ * @class MixedPrecisionLattice
+ * @brief A class template representing the density distributions of a structured grid of lattice
+ * nodes that are stored in a compact format and computed in a wider floating-point type.
+ *
+ * The layout matches Lattice: one cache-line aligned population array per lattice vector, with the
+ * first coordinate running fastest. Populations are widened to Scalar by load and node, and are
+ * narrowed to the storage format by store and setNode, so kernels keep all arithmetic in Scalar
+ * registers. The overloads of load and store for runs of consecutive nodes use the vectorized
+ * conversions of the storage format. Shifted formats store f - w for a lattice weight w per
+ * lattice vector, which is added back on every load.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+class MixedPrecisionLattice
+{
+public:
+    using Stored = typename Format::Stored;
+
+    MixedPrecisionLattice(
+        const std::array<std::size_t, Dimension>& extents,
+        const std::array<Scalar, Size>& weights,
+        std::pmr::memory_resource* resource = nullptr
+    );
+
+    auto load(std::size_t direction, std::size_t index) const -> Scalar;
+    auto store(std::size_t direction, std::size_t index, Scalar value) -> void;
+    auto load(std::size_t direction, std::size_t firstNode, std::span<Scalar> values) const
+        -> void;
+    auto store(std::size_t direction, std::size_t firstNode, std::span<const Scalar> values)
+        -> void;
+
+    auto node(std::size_t index) const -> DensityDistribution<Dimension, Size, Scalar>;
+    auto setNode(
+        std::size_t index,
+        const DensityDistribution<Dimension, Size, Scalar>& distribution
+    ) -> void;
+    auto population(std::size_t direction) -> std::span<Stored>;
+    auto population(std::size_t direction) const -> std::span<const Stored>;
+    auto offsets() const -> const std::array<Scalar, Size>&;
+
+    auto linearIndex(const std::array<std::size_t, Dimension>& coordinates) const -> std::size_t;
+    auto extents() const -> const std::array<std::size_t, Dimension>&;
+    auto nodeCount() const -> std::size_t;
+
+    constexpr auto dimension() const -> std::size_t;
+    constexpr auto size() const -> std::size_t;
+
+private:
+    static constexpr std::size_t conversionChunkSize_{64};
+
+    std::array<std::size_t, Dimension> extents_;
+    std::size_t nodeCount_;
+    std::size_t stride_;
+    std::array<Scalar, Size> offsets_;
+    std::vector<Stored, AlignedAllocator<Stored>> populations_;
+};
+
+#include "MixedPrecisionLattice.tpp"
+
+#endif // MIXED_PRECISION_LATTICE_HPP
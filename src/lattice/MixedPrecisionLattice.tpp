@@ -0,0 +1,401 @@
+#ifndef MIXED_PRECISION_LATTICE_TPP
+#define MIXED_PRECISION_LATTICE_TPP
+
+/**
+ * @file MixedPrecisionLattice.tpp
+ * @brief Implementation of the MixedPrecisionLattice class template that stores the density
+ * distributions of a structured grid of lattice nodes in a compact storage format.
+ */
+
+;
+#include "MixedPrecisionLattice.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+/**
+ * @brief Constructor for MixedPrecisionLattice with the number of nodes along each spatial
+ * dimension and the lattice weights of the lattice model.
+ *
+ * Initializes all populations with the lattice weights, which is the equilibrium of a fluid at rest
+ * with unit density. Shifted storage formats keep the weights as offsets and therefore store this
+ * state exactly, while other formats round the weights to the storage precision.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param weights The lattice weights of the lattice model.
+ * @param resource The memory resource of the population storage, or nullptr for the heap.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+MixedPrecisionLattice<Dimension, Size, Scalar, Format>::MixedPrecisionLattice(
+    const std::array<std::size_t, Dimension>& extents,
+    const std::array<Scalar, Size>& weights,
+    std::pmr::memory_resource* resource
+)
+    : extents_{extents},
+      nodeCount_{std::accumulate(
+          extents.begin(), extents.end(), std::size_t{1}, std::multiplies<std::size_t>{}
+      )},
+      offsets_{},
+      populations_{AlignedAllocator<Stored>{resource}}
+{
+    constexpr std::size_t valuesPerCacheLine{CACHE_LINE_SIZE / sizeof(Stored)};
+
+    stride_ = (nodeCount_ + valuesPerCacheLine - 1) / valuesPerCacheLine * valuesPerCacheLine;
+    populations_.resize(Size * stride_);
+
+    if constexpr (Format::SHIFTED)
+    {
+        offsets_ = weights;
+    }
+
+    for (std::size_t direction = 0; direction < Size; ++direction)
+    {
+        std::ranges::fill(
+            std::span<Stored>{populations_}.subspan(direction * stride_, stride_),
+            Format::encode(static_cast<float>(weights[direction] - offsets_[direction]))
+        );
+    }
+}
+
+/**
+ * @brief Widens a single population to the compute precision.
+ *
+ * @param direction Index of the lattice vector.
+ * @param index Linear index of the lattice node.
+ * @return The population of the lattice vector at the lattice node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::load(
+    std::size_t direction,
+    std::size_t index
+) const -> Scalar
+{
+    const Stored stored{populations_[direction * stride_ + index]};
+    const Scalar value{static_cast<Scalar>(Format::decode(stored))};
+
+    if constexpr (Format::SHIFTED)
+    {
+        return value + offsets_[direction];
+    }
+    else
+    {
+        return value;
+    }
+}
+
+/**
+ * @brief Narrows a single population to the storage format.
+ *
+ * @param direction Index of the lattice vector.
+ * @param index Linear index of the lattice node.
+ * @param value The population of the lattice vector at the lattice node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::store(
+    std::size_t direction,
+    std::size_t index,
+    Scalar value
+) -> void
+{
+    if constexpr (Format::SHIFTED)
+    {
+        value -= offsets_[direction];
+    }
+
+    populations_[direction * stride_ + index] = Format::encode(static_cast<float>(value));
+}
+
+/**
+ * @brief Widens the populations of a run of consecutive nodes to the compute precision.
+ *
+ * @param direction Index of the lattice vector.
+ * @param firstNode Linear index of the first lattice node of the run.
+ * @param values The populations of the lattice vector at the nodes of the run, overwritten on
+ * output.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::load(
+    std::size_t direction,
+    std::size_t firstNode,
+    std::span<Scalar> values
+) const -> void
+{
+    const auto stored{population(direction).subspan(firstNode, values.size())};
+
+    if constexpr (std::same_as<Scalar, float>)
+    {
+        Format::decode(stored, values);
+    }
+    else
+    {
+        std::array<float, conversionChunkSize_> buffer;
+
+        for (std::size_t first = 0; first < values.size(); first += conversionChunkSize_)
+        {
+            const std::size_t count{std::min(conversionChunkSize_, values.size() - first)};
+            Format::decode(stored.subspan(first, count), std::span<float>{buffer}.first(count));
+            for (std::size_t node = 0; node < count; ++node)
+            {
+                values[first + node] = static_cast<Scalar>(buffer[node]);
+            }
+        }
+    }
+
+    if constexpr (Format::SHIFTED)
+    {
+        for (Scalar& value : values)
+        {
+            value += offsets_[direction];
+        }
+    }
+}
+
+/**
+ * @brief Narrows the populations of a run of consecutive nodes to the storage format.
+ *
+ * @param direction Index of the lattice vector.
+ * @param firstNode Linear index of the first lattice node of the run.
+ * @param values The populations of the lattice vector at the nodes of the run.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::store(
+    std::size_t direction,
+    std::size_t firstNode,
+    std::span<const Scalar> values
+) -> void
+{
+    const auto stored{population(direction).subspan(firstNode, values.size())};
+    const Scalar offset{offsets_[direction]};
+    std::array<float, conversionChunkSize_> buffer;
+
+    for (std::size_t first = 0; first < values.size(); first += conversionChunkSize_)
+    {
+        const std::size_t count{std::min(conversionChunkSize_, values.size() - first)};
+        for (std::size_t node = 0; node < count; ++node)
+        {
+            buffer[node] = static_cast<float>(values[first + node] - offset);
+        }
+        Format::encode(std::span<const float>{buffer}.first(count), stored.subspan(first, count));
+    }
+}
+
+/**
+ * @brief Gathers the density distribution at a lattice node in the compute precision.
+ *
+ * @param index Linear index of the lattice node.
+ * @return A widened copy of the density distribution at the lattice node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::node(std::size_t index) const
+    -> DensityDistribution<Dimension, Size, Scalar>
+{
+    DensityDistribution<Dimension, Size, Scalar> distribution;
+
+    for (std::size_t direction = 0; direction < Size; ++direction)
+    {
+        distribution[direction] = load(direction, index);
+    }
+
+    return distribution;
+}
+
+/**
+ * @brief Scatters a density distribution to a lattice node in the storage format.
+ *
+ * @param index Linear index of the lattice node.
+ * @param distribution The density distribution to store at the lattice node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::setNode(
+    std::size_t index,
+    const DensityDistribution<Dimension, Size, Scalar>& distribution
+) -> void
+{
+    for (std::size_t direction = 0; direction < Size; ++direction)
+    {
+        store(direction, index, distribution[direction]);
+    }
+}
+
+/**
+ * @brief Returns the stored population array of a lattice vector for non-const objects.
+ *
+ * @param direction Index of the lattice vector.
+ * @return Non-const view of the stored values of the lattice vector at all lattice nodes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::population(std::size_t direction)
+    -> std::span<Stored>
+{
+    return std::span<Stored>{populations_}.subspan(direction * stride_, nodeCount_);
+}
+
+/**
+ * @brief Returns the stored population array of a lattice vector for const objects.
+ *
+ * @param direction Index of the lattice vector.
+ * @return Const view of the stored values of the lattice vector at all lattice nodes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::population(std::size_t direction) const
+    -> std::span<const Stored>
+{
+    return std::span<const Stored>{populations_}.subspan(direction * stride_, nodeCount_);
+}
+
+/**
+ * @brief Returns the values that are subtracted from populations before they are stored.
+ *
+ * @return The lattice weights for shifted storage formats and zeros otherwise.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::offsets() const
+    -> const std::array<Scalar, Size>&
+{
+    return offsets_;
+}
+
+/**
+ * @brief Converts the coordinates of a lattice node to its linear index.
+ *
+ * @param coordinates The integer coordinates of the lattice node.
+ * @return The linear index of the lattice node, with the first coordinate running fastest.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::linearIndex(
+    const std::array<std::size_t, Dimension>& coordinates
+) const -> std::size_t
+{
+    std::size_t index{0};
+
+    for (std::size_t axis = Dimension; axis-- > 0;)
+    {
+        index = index * extents_[axis] + coordinates[axis];
+    }
+
+    return index;
+}
+
+/**
+ * @brief Returns the number of lattice nodes along each spatial dimension.
+ *
+ * @return The number of lattice nodes along each spatial dimension.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::extents() const
+    -> const std::array<std::size_t, Dimension>&
+{
+    return extents_;
+}
+
+/**
+ * @brief Returns the total number of lattice nodes.
+ *
+ * @return The total number of lattice nodes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::nodeCount() const -> std::size_t
+{
+    return nodeCount_;
+}
+
+/**
+ * @brief Returns the dimension of the lattice.
+ *
+ * @return The dimension of the lattice.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+constexpr auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::dimension() const
+    -> std::size_t
+{
+    return Dimension;
+}
+
+/**
+ * @brief Returns the number of lattice vectors at each lattice node.
+ *
+ * @return The number of lattice vectors at each lattice node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+constexpr auto MixedPrecisionLattice<Dimension, Size, Scalar, Format>::size() const -> std::size_t
+{
+    return Size;
+}
+
+#endif // MIXED_PRECISION_LATTICE_TPP
@@ -0,0 +1,81 @@
+#ifndef LATTICE_MOMENT_CACHE_HPP
+#define LATTICE_MOMENT_CACHE_HPP
+
+/**
+ * @file MomentCache.hpp
+ * @brief Declaration of the MomentCache class template that keeps the macroscopic moments of all
+ * nodes of a lattice and recomputes them only after the populations changed.
+ */
+
+#include "AlignedAllocator.hpp"
+#include "Lattice.hpp"
+#include "moments.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @class MomentCache
+ * @brief A class template that caches the mass density, momentum density and optionally the flow
+ * velocity of every node of a lattice.
+ *
+ * Density and momentum are computed together in one fused pass over the populations the first
+ * time any of them is read after the revision of the lattice changed, so several readers of the
+ * moments of one time step share a single sweep. The collision kernels relaxBGK, relaxMRT and
+ * relaxCumulant read the cached moments instead of summing the populations of each node, and
+ * AsyncFieldWriter::snapshot stages the cached fields without another pass over the populations.
+ * BoundaryEngine::apply keeps a current cache current by recomputing the moments of the boundary
+ * nodes it changed with refreshNodes, so a time step of streaming, boundary conditions, output
+ * and collision makes one sweep. Flow velocities are derived from the cached density and momentum
+ * only when they are requested. The moments are those of the populations in their natural layout,
+ * which on a lattice updated with the AA pattern holds after an even number of time steps. The
+ * lattice must outlive the cache. A cache must not be read from several threads at once.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+class MomentCache
+{
+public:
+    MomentCache(
+        const Lattice<Dimension, Size, Scalar>& lattice,
+        const std::array<std::array<int, Dimension>, Size>& velocities
+    );
+
+    auto densities() -> std::span<const Scalar>;
+    auto momenta() -> std::array<std::span<const Scalar>, Dimension>;
+    auto flowVelocities() -> std::array<std::span<const Scalar>, Dimension>;
+    auto density(std::size_t index) -> Scalar;
+    auto momentum(std::size_t index) -> std::array<Scalar, Dimension>;
+    auto flowVelocity(std::size_t index) -> std::array<Scalar, Dimension>;
+
+    auto refresh() -> bool;
+    auto refreshNodes(std::span<const std::uint32_t> nodes) -> void;
+    auto invalidate() -> void;
+    auto isCurrent() const -> bool;
+    auto sweeps() const -> std::size_t;
+    auto lattice() const -> const Lattice<Dimension, Size, Scalar>&;
+
+private:
+    using Field = std::vector<Scalar, AlignedAllocator<Scalar>>;
+
+    auto refreshFlowVelocities() -> void;
+
+    const Lattice<Dimension, Size, Scalar>* lattice_;
+    std::array<std::array<int, Dimension>, Size> velocities_;
+    Field densities_;
+    std::array<Field, Dimension> momenta_;
+    std::array<Field, Dimension> flowVelocities_;
+    std::uint64_t revision_{0};
+    bool current_{false};
+    bool flowVelocitiesCurrent_{false};
+    std::size_t sweeps_{0};
+};
+
+#include "MomentCache.tpp"
+
+#endif // LATTICE_MOMENT_CACHE_HPP
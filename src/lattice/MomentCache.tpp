@@ -0,0 +1,367 @@
+#ifndef LATTICE_MOMENT_CACHE_TPP
+#define LATTICE_MOMENT_CACHE_TPP
+
+/**
+ * @file MomentCache.tpp
+ * @brief Implementation of the MomentCache class template that keeps the macroscopic moments of
+ * all nodes of a lattice and recomputes them only after the populations changed.
+ */
+
+;
+#include "MomentCache.hpp"
+
+#include <algorithm>
+
+/**
+ * @brief Constructor for MomentCache that allocates the moment fields without computing them.
+ *
+ * @param lattice The lattice whose moments are cached.
+ * @param velocities The lattice velocities of the lattice model.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+MomentCache<Dimension, Size, Scalar>::MomentCache(
+    const Lattice<Dimension, Size, Scalar>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities
+)
+    : lattice_{&lattice},
+      velocities_{velocities},
+      densities_(lattice.nodeCount())
+{
+    for (std::size_t axis = 0; axis < Dimension; ++axis)
+    {
+        momenta_[axis].resize(lattice.nodeCount());
+        flowVelocities_[axis].resize(lattice.nodeCount());
+    }
+}
+
+/**
+ * @brief Returns the mass densities of all nodes, recomputing them if the lattice changed.
+ *
+ * @return Const view of the mass densities, valid until the next refresh.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MomentCache<Dimension, Size, Scalar>::densities() -> std::span<const Scalar>
+{
+    refresh();
+
+    return densities_;
+}
+
+/**
+ * @brief Returns the momentum densities of all nodes, recomputing them if the lattice changed.
+ *
+ * @return One const view per spatial dimension, valid until the next refresh.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MomentCache<Dimension, Size, Scalar>::momenta()
+    -> std::array<std::span<const Scalar>, Dimension>
+{
+    refresh();
+
+    std::array<std::span<const Scalar>, Dimension> momenta;
+    for (std::size_t axis = 0; axis < Dimension; ++axis)
+    {
+        momenta[axis] = momenta_[axis];
+    }
+
+    return momenta;
+}
+
+/**
+ * @brief Returns the flow velocities of all nodes, deriving them from the cached moments if they
+ * have not been requested since the last refresh.
+ *
+ * @return One const view per spatial dimension, valid until the next refresh.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MomentCache<Dimension, Size, Scalar>::flowVelocities()
+    -> std::array<std::span<const Scalar>, Dimension>
+{
+    refresh();
+    refreshFlowVelocities();
+
+    std::array<std::span<const Scalar>, Dimension> flowVelocities;
+    for (std::size_t axis = 0; axis < Dimension; ++axis)
+    {
+        flowVelocities[axis] = flowVelocities_[axis];
+    }
+
+    return flowVelocities;
+}
+
+/**
+ * @brief Returns the mass density of a single node.
+ *
+ * @param index Linear index of the lattice node.
+ * @return The cached mass density of the node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MomentCache<Dimension, Size, Scalar>::density(std::size_t index) -> Scalar
+{
+    refresh();
+
+    return densities_[index];
+}
+
+/**
+ * @brief Returns the momentum density of a single node.
+ *
+ * @param index Linear index of the lattice node.
+ * @return The cached momentum density of the node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MomentCache<Dimension, Size, Scalar>::momentum(std::size_t index)
+    -> std::array<Scalar, Dimension>
+{
+    refresh();
+
+    std::array<Scalar, Dimension> momentum;
+    for (std::size_t axis = 0; axis < Dimension; ++axis)
+    {
+        momentum[axis] = momenta_[axis][index];
+    }
+
+    return momentum;
+}
+
+/**
+ * @brief Returns the flow velocity of a single node.
+ *
+ * @param index Linear index of the lattice node.
+ * @return The cached flow velocity of the node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MomentCache<Dimension, Size, Scalar>::flowVelocity(std::size_t index)
+    -> std::array<Scalar, Dimension>
+{
+    refresh();
+    refreshFlowVelocities();
+
+    std::array<Scalar, Dimension> flowVelocity;
+    for (std::size_t axis = 0; axis < Dimension; ++axis)
+    {
+        flowVelocity[axis] = flowVelocities_[axis][index];
+    }
+
+    return flowVelocity;
+}
+
+/**
+ * @brief Recomputes the mass and momentum densities in one pass if the lattice changed since they
+ * were last computed.
+ *
+ * @return Whether the moments were recomputed.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MomentCache<Dimension, Size, Scalar>::refresh() -> bool
+{
+    if (isCurrent())
+    {
+        return false;
+    }
+
+    std::array<std::span<Scalar>, Dimension> momenta;
+    for (std::size_t axis = 0; axis < Dimension; ++axis)
+    {
+        momenta[axis] = momenta_[axis];
+    }
+    computeMoments(populationSpans(*lattice_), velocities_, std::span<Scalar>{densities_}, momenta);
+
+    revision_ = lattice_->revision();
+    current_ = true;
+    flowVelocitiesCurrent_ = false;
+    ++sweeps_;
+
+    return true;
+}
+
+/**
+ * @brief Recomputes the mass and momentum densities of some nodes after only these nodes changed.
+ *
+ * The populations of the nodes are gathered in blocks of WIDENING_BLOCK_SIZE into local buffers,
+ * from which the batched kernel computes their moments, and the cache then counts as computed at
+ * the current revision of the lattice. The cache must have been current before the populations of
+ * the listed nodes were modified, and no other node may have changed since. An invalidated cache
+ * stays invalidated, so that the next read recomputes all nodes.
+ *
+ * @param nodes Linear indices of the modified nodes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MomentCache<Dimension, Size, Scalar>::refreshNodes(std::span<const std::uint32_t> nodes)
+    -> void
+{
+    if (!current_)
+    {
+        return;
+    }
+
+    const auto populations{populationSpans(*lattice_)};
+
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, WIDENING_BLOCK_SIZE>, Size> block;
+    alignas(CACHE_LINE_SIZE) std::array<Scalar, WIDENING_BLOCK_SIZE> densities;
+    alignas(CACHE_LINE_SIZE)
+        std::array<std::array<Scalar, WIDENING_BLOCK_SIZE>, Dimension> momenta;
+    std::array<std::span<const Scalar>, Size> blockPopulations;
+    std::array<std::span<Scalar>, Dimension> blockMomenta;
+
+    for (std::size_t first = 0; first < nodes.size(); first += WIDENING_BLOCK_SIZE)
+    {
+        const std::size_t count{std::min(WIDENING_BLOCK_SIZE, nodes.size() - first)};
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            for (std::size_t node = 0; node < count; ++node)
+            {
+                block[i][node] = populations[i][nodes[first + node]];
+            }
+            blockPopulations[i] = std::span<const Scalar>{block[i]}.first(count);
+        }
+        for (std::size_t axis = 0; axis < Dimension; ++axis)
+        {
+            blockMomenta[axis] = std::span<Scalar>{momenta[axis]}.first(count);
+        }
+
+        computeMoments(
+            blockPopulations, velocities_, std::span<Scalar>{densities}.first(count), blockMomenta
+        );
+
+        for (std::size_t node = 0; node < count; ++node)
+        {
+            densities_[nodes[first + node]] = densities[node];
+            for (std::size_t axis = 0; axis < Dimension; ++axis)
+            {
+                momenta_[axis][nodes[first + node]] = momenta[axis][node];
+            }
+        }
+    }
+
+    revision_ = lattice_->revision();
+    flowVelocitiesCurrent_ = false;
+}
+
+/**
+ * @brief Marks the cached moments as stale, for populations that were modified through a view
+ * requested before the last refresh.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MomentCache<Dimension, Size, Scalar>::invalidate() -> void
+{
+    current_ = false;
+}
+
+/**
+ * @brief Checks whether the cached moments match the current populations of the lattice.
+ *
+ * @return Whether the moments were computed at the current revision of the lattice and have not
+ * been invalidated since.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MomentCache<Dimension, Size, Scalar>::isCurrent() const -> bool
+{
+    return current_ && revision_ == lattice_->revision();
+}
+
+/**
+ * @brief Returns the number of passes over the populations that the cache has made.
+ *
+ * @return The number of times the moments were recomputed.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MomentCache<Dimension, Size, Scalar>::sweeps() const -> std::size_t
+{
+    return sweeps_;
+}
+
+/**
+ * @brief Returns the lattice whose moments are cached.
+ *
+ * @return Const reference to the lattice.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MomentCache<Dimension, Size, Scalar>::lattice() const
+    -> const Lattice<Dimension, Size, Scalar>&
+{
+    return *lattice_;
+}
+
+/**
+ * @brief Derives the flow velocities from the cached mass and momentum densities if they have not
+ * been derived since the last refresh.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto MomentCache<Dimension, Size, Scalar>::refreshFlowVelocities() -> void
+{
+    if (flowVelocitiesCurrent_)
+    {
+        return;
+    }
+
+    for (std::size_t node = 0; node < densities_.size(); ++node)
+    {
+        const Scalar inverseDensity{Scalar{1.0} / densities_[node]};
+        for (std::size_t axis = 0; axis < Dimension; ++axis)
+        {
+            flowVelocities_[axis][node] = momenta_[axis][node] * inverseDensity;
+        }
+    }
+
+    flowVelocitiesCurrent_ = true;
+}
+
+#endif // LATTICE_MOMENT_CACHE_TPP
@@ -0,0 +1,43 @@
+#ifndef LATTICE_REVISION_COUNTER_HPP
+#define LATTICE_REVISION_COUNTER_HPP
+
+/**
+ * @file RevisionCounter.hpp
+ * @brief Declaration of a counter that advances whenever the contents of an object may have
+ * changed.
+ */
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class RevisionCounter
+ * @brief A copyable counter that is advanced on every access that may modify the owning object.
+ *
+ * Derived data such as cached moments remember the revision they were computed from and are stale
+ * once it differs. The counter is advanced with a relaxed atomic increment, so advances from
+ * several threads at once are all counted and the counter never returns to a value that was
+ * observed before an advance. Assigning to a counter advances it instead of copying the other
+ * value, since the owning object then holds new contents.
+ */
+class RevisionCounter
+{
+public:
+    RevisionCounter() = default;
+    RevisionCounter(const RevisionCounter& other);
+    RevisionCounter(RevisionCounter&& other) noexcept;
+    ~RevisionCounter() = default;
+
+    auto operator=(const RevisionCounter& other) -> RevisionCounter&;
+    auto operator=(RevisionCounter&& other) noexcept -> RevisionCounter&;
+
+    auto advance() -> void;
+    auto value() const -> std::uint64_t;
+
+private:
+    std::atomic<std::uint64_t> value_{0};
+};
+
+#include "RevisionCounter.tpp"
+
+#endif // LATTICE_REVISION_COUNTER_HPP
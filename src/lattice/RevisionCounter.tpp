@@ -0,0 +1,81 @@
+#ifndef LATTICE_REVISION_COUNTER_TPP
+#define LATTICE_REVISION_COUNTER_TPP
+
+/**
+ * @file RevisionCounter.tpp
+ * @brief Implementation of a counter that advances whenever the contents of an object may have
+ * changed.
+ */
+
+;
+#include "RevisionCounter.hpp"
+
+/**
+ * @brief Copy constructor for RevisionCounter that starts at the revision of the other counter.
+ *
+ * @param other The counter to copy.
+ */
+inline RevisionCounter::RevisionCounter(const RevisionCounter& other)
+    : value_{other.value_.load(std::memory_order_relaxed)}
+{
+}
+
+/**
+ * @brief Move constructor for RevisionCounter that starts at the revision of the other counter.
+ *
+ * @param other The counter to move.
+ */
+inline RevisionCounter::RevisionCounter(RevisionCounter&& other) noexcept
+    : value_{other.value_.load(std::memory_order_relaxed)}
+{
+}
+
+/**
+ * @brief Copy assignment operator for RevisionCounter that advances the counter.
+ *
+ * @param other The counter of the object whose contents are assigned.
+ * @return Reference to this counter.
+ */
+inline auto RevisionCounter::operator=(const RevisionCounter& other) -> RevisionCounter&
+{
+    static_cast<void>(other);
+    advance();
+
+    return *this;
+}
+
+/**
+ * @brief Move assignment operator for RevisionCounter that advances the counter.
+ *
+ * @param other The counter of the object whose contents are assigned.
+ * @return Reference to this counter.
+ */
+inline auto RevisionCounter::operator=(RevisionCounter&& other) noexcept -> RevisionCounter&
+{
+    static_cast<void>(other);
+    advance();
+
+    return *this;
+}
+
+/**
+ * @brief Marks the owning object as possibly modified.
+ *
+ * May be called from several threads at once.
+ */
+inline auto RevisionCounter::advance() -> void
+{
+    value_.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the current revision.
+ *
+ * @return The number of advances so far.
+ */
+inline auto RevisionCounter::value() const -> std::uint64_t
+{
+    return value_.load(std::memory_order_relaxed);
+}
+
+#endif // LATTICE_REVISION_COUNTER_TPP
@@ -0,0 +1,84 @@
+#ifndef SPARSE_LATTICE_HPP
+#define SPARSE_LATTICE_HPP
+
+/**
+ * @file SparseLattice.hpp
+ * @brief Declaration of the SparseLattice class template that stores the density distributions of
+ * only the fluid nodes of a structured grid.
+ */
+
+#include "../densityDistribution/DensityDistribution.hpp"
+#include "AlignedAllocator.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @class SparseLattice
+ * @brief A class template representing the density distributions of the fluid nodes of a
+ * structured grid whose other nodes are solid.
+ *
+ * Fluid nodes are numbered compactly in the order of their linear index in the bounding box, and
+ * every lattice vector owns one cache-line aligned population array over the fluid nodes, as in
+ * Lattice. A precomputed table holds, for every lattice vector and fluid node, the population slot
+ * that a post-collision population streams into: the slot of the same lattice vector at the
+ * neighbor if the neighbor is fluid, and the slot of the opposite lattice vector at the node itself
+ * if it is solid, which realizes halfway bounce-back. Memory use and the work of a time step thus
+ * scale with the number of fluid nodes instead of the bounding box. The bounding box is periodic
+ * like the one of Lattice.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+class SparseLattice
+{
+public:
+    SparseLattice(
+        const std::array<std::size_t, Dimension>& extents,
+        const std::array<std::array<int, Dimension>, Size>& velocities,
+        const std::array<std::size_t, Size>& opposites,
+        const std::vector<bool>& fluid,
+        std::pmr::memory_resource* resource = nullptr
+    );
+
+    auto node(std::size_t index) const -> DensityDistribution<Dimension, Size, Scalar>;
+    auto setNode(
+        std::size_t index,
+        const DensityDistribution<Dimension, Size, Scalar>& distribution
+    ) -> void;
+    auto population(std::size_t direction) -> std::span<Scalar>;
+    auto population(std::size_t direction) const -> std::span<const Scalar>;
+    auto slots() -> std::span<Scalar>;
+    auto slots() const -> std::span<const Scalar>;
+    auto streamSlots(std::size_t direction) const -> std::span<const std::uint32_t>;
+
+    auto boxIndex(std::size_t index) const -> std::size_t;
+    auto fluidIndex(const std::array<std::size_t, Dimension>& coordinates) const -> std::size_t;
+    auto velocities() const -> const std::array<std::array<int, Dimension>, Size>&;
+    auto opposites() const -> const std::array<std::size_t, Size>&;
+    auto extents() const -> const std::array<std::size_t, Dimension>&;
+    auto nodeCount() const -> std::size_t;
+    auto boxNodeCount() const -> std::size_t;
+
+    constexpr auto dimension() const -> std::size_t;
+    constexpr auto size() const -> std::size_t;
+
+private:
+    std::array<std::size_t, Dimension> extents_;
+    std::array<std::array<int, Dimension>, Size> velocities_;
+    std::array<std::size_t, Size> opposites_;
+    std::size_t boxNodeCount_;
+    std::size_t nodeCount_;
+    std::size_t stride_;
+    std::vector<std::size_t, AlignedAllocator<std::size_t>> boxIndices_;
+    std::vector<std::uint32_t, AlignedAllocator<std::uint32_t>> streamSlots_;
+    std::vector<Scalar, AlignedAllocator<Scalar>> populations_;
+};
+
+#include "SparseLattice.tpp"
+
+#endif // SPARSE_LATTICE_HPP
@@ -0,0 +1,399 @@
+#ifndef SPARSE_LATTICE_TPP
+#define SPARSE_LATTICE_TPP
+
+/**
+ * @file SparseLattice.tpp
+ * @brief Implementation of the SparseLattice class template that stores the density distributions
+ * of only the fluid nodes of a structured grid.
+ */
+
+;
+#include "SparseLattice.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+/**
+ * @brief Constructor for SparseLattice with the bounding box, the lattice model and a fluid mask.
+ *
+ * Numbers the fluid nodes, builds the stream-slot table and initializes all populations with
+ * zeros. A temporary index over the bounding box is needed while the table is built and released
+ * afterwards.
+ *
+ * @param extents The number of lattice nodes of the bounding box along each spatial dimension.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param fluid Whether each node of the bounding box, by linear index, is a fluid node.
+ * @param resource The memory resource of the population storage and tables, or nullptr for the
+ * heap.
+ * @throws std::invalid_argument If the size of the mask differs from the bounding box.
+ * @throws std::length_error If the population slots cannot be indexed with 32 bits.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+SparseLattice<Dimension, Size, Scalar>::SparseLattice(
+    const std::array<std::size_t, Dimension>& extents,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    const std::vector<bool>& fluid,
+    std::pmr::memory_resource* resource
+)
+    : extents_{extents},
+      velocities_{velocities},
+      opposites_{opposites},
+      boxNodeCount_{std::accumulate(
+          extents.begin(), extents.end(), std::size_t{1}, std::multiplies<std::size_t>{}
+      )},
+      nodeCount_{static_cast<std::size_t>(std::ranges::count(fluid, true))},
+      boxIndices_{AlignedAllocator<std::size_t>{resource}},
+      streamSlots_{AlignedAllocator<std::uint32_t>{resource}},
+      populations_{AlignedAllocator<Scalar>{resource}}
+{
+    constexpr std::size_t scalarsPerCacheLine{CACHE_LINE_SIZE / sizeof(Scalar)};
+    constexpr std::uint32_t solid{std::numeric_limits<std::uint32_t>::max()};
+
+    if (fluid.size() != boxNodeCount_)
+    {
+        throw std::invalid_argument{"fluid mask must cover the bounding box"};
+    }
+
+    stride_ = (nodeCount_ + scalarsPerCacheLine - 1) / scalarsPerCacheLine * scalarsPerCacheLine;
+    if (Size * stride_ >= solid)
+    {
+        throw std::length_error{"too many fluid nodes for 32-bit stream slots"};
+    }
+
+    std::vector<std::uint32_t> fluidIndices(boxNodeCount_, solid);
+    boxIndices_.reserve(nodeCount_);
+    for (std::size_t boxIndex = 0; boxIndex < boxNodeCount_; ++boxIndex)
+    {
+        if (fluid[boxIndex])
+        {
+            fluidIndices[boxIndex] = static_cast<std::uint32_t>(boxIndices_.size());
+            boxIndices_.push_back(boxIndex);
+        }
+    }
+
+    streamSlots_.resize(Size * nodeCount_);
+    for (std::size_t index = 0; index < nodeCount_; ++index)
+    {
+        std::array<std::size_t, Dimension> coordinates;
+        std::size_t remainder{boxIndices_[index]};
+        for (std::size_t axis = 0; axis < Dimension; ++axis)
+        {
+            coordinates[axis] = remainder % extents_[axis];
+            remainder /= extents_[axis];
+        }
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            std::size_t neighbor{0};
+            for (std::size_t axis = Dimension; axis-- > 0;)
+            {
+                const auto extent{static_cast<std::ptrdiff_t>(extents_[axis])};
+                const auto coordinate{static_cast<std::ptrdiff_t>(coordinates[axis])};
+                const auto shifted{(coordinate + velocities_[i][axis] + extent) % extent};
+                neighbor = neighbor * extents_[axis] + static_cast<std::size_t>(shifted);
+            }
+
+            const std::uint32_t neighborIndex{fluidIndices[neighbor]};
+            streamSlots_[i * nodeCount_ + index] = static_cast<std::uint32_t>(
+                neighborIndex != solid ? i * stride_ + neighborIndex
+                                       : opposites_[i] * stride_ + index
+            );
+        }
+    }
+
+    populations_.assign(Size * stride_, Scalar{0.0});
+}
+
+/**
+ * @brief Gathers the density distribution at a fluid node.
+ *
+ * @param index Compact index of the fluid node.
+ * @return A copy of the density distribution at the fluid node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::node(std::size_t index) const
+    -> DensityDistribution<Dimension, Size, Scalar>
+{
+    DensityDistribution<Dimension, Size, Scalar> distribution;
+
+    for (std::size_t direction = 0; direction < Size; ++direction)
+    {
+        distribution[direction] = population(direction)[index];
+    }
+
+    return distribution;
+}
+
+/**
+ * @brief Scatters a density distribution to a fluid node.
+ *
+ * @param index Compact index of the fluid node.
+ * @param distribution The density distribution to store at the fluid node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::setNode(
+    std::size_t index,
+    const DensityDistribution<Dimension, Size, Scalar>& distribution
+) -> void
+{
+    for (std::size_t direction = 0; direction < Size; ++direction)
+    {
+        population(direction)[index] = distribution[direction];
+    }
+}
+
+/**
+ * @brief Returns the population array of a lattice vector for non-const SparseLattice objects.
+ *
+ * @param direction Index of the lattice vector.
+ * @return Non-const view of the values of the lattice vector at all fluid nodes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::population(std::size_t direction) -> std::span<Scalar>
+{
+    return std::span<Scalar>{populations_}.subspan(direction * stride_, nodeCount_);
+}
+
+/**
+ * @brief Returns the population array of a lattice vector for const SparseLattice objects.
+ *
+ * @param direction Index of the lattice vector.
+ * @return Const view of the values of the lattice vector at all fluid nodes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::population(std::size_t direction) const
+    -> std::span<const Scalar>
+{
+    return std::span<const Scalar>{populations_}.subspan(direction * stride_, nodeCount_);
+}
+
+/**
+ * @brief Returns all population slots, which the stream-slot table indexes, for non-const
+ * SparseLattice objects.
+ *
+ * @return Non-const view of the population arrays including their padding.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::slots() -> std::span<Scalar>
+{
+    return populations_;
+}
+
+/**
+ * @brief Returns all population slots, which the stream-slot table indexes, for const
+ * SparseLattice objects.
+ *
+ * @return Const view of the population arrays including their padding.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::slots() const -> std::span<const Scalar>
+{
+    return populations_;
+}
+
+/**
+ * @brief Returns the slots that the post-collision populations of a lattice vector stream into.
+ *
+ * @param direction Index of the lattice vector.
+ * @return For every fluid node, the index into slots of the target of its population.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::streamSlots(std::size_t direction) const
+    -> std::span<const std::uint32_t>
+{
+    return std::span<const std::uint32_t>{streamSlots_}.subspan(direction * nodeCount_, nodeCount_);
+}
+
+/**
+ * @brief Converts the compact index of a fluid node to its linear index in the bounding box.
+ *
+ * @param index Compact index of the fluid node.
+ * @return The linear index of the node in the bounding box, with the first coordinate running
+ * fastest.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::boxIndex(std::size_t index) const -> std::size_t
+{
+    return boxIndices_[index];
+}
+
+/**
+ * @brief Looks up the compact index of the node at some coordinates.
+ *
+ * @param coordinates The integer coordinates of the node in the bounding box.
+ * @return The compact index of the node, or nodeCount() if the node is solid.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::fluidIndex(
+    const std::array<std::size_t, Dimension>& coordinates
+) const -> std::size_t
+{
+    std::size_t boxIndex{0};
+    for (std::size_t axis = Dimension; axis-- > 0;)
+    {
+        boxIndex = boxIndex * extents_[axis] + coordinates[axis];
+    }
+
+    const auto position{std::ranges::lower_bound(boxIndices_, boxIndex)};
+    if (position == boxIndices_.end() || *position != boxIndex)
+    {
+        return nodeCount_;
+    }
+
+    return static_cast<std::size_t>(position - boxIndices_.begin());
+}
+
+/**
+ * @brief Returns the lattice velocities of the lattice model.
+ *
+ * @return Const reference to the lattice velocities.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::velocities() const
+    -> const std::array<std::array<int, Dimension>, Size>&
+{
+    return velocities_;
+}
+
+/**
+ * @brief Returns the opposite-direction table of the lattice model.
+ *
+ * @return Const reference to the opposite-direction table.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::opposites() const
+    -> const std::array<std::size_t, Size>&
+{
+    return opposites_;
+}
+
+/**
+ * @brief Returns the number of nodes of the bounding box along each spatial dimension.
+ *
+ * @return Const reference to the extents of the bounding box.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::extents() const
+    -> const std::array<std::size_t, Dimension>&
+{
+    return extents_;
+}
+
+/**
+ * @brief Returns the number of fluid nodes.
+ *
+ * @return The number of fluid nodes, which is the size of every population array.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::nodeCount() const -> std::size_t
+{
+    return nodeCount_;
+}
+
+/**
+ * @brief Returns the number of nodes of the bounding box.
+ *
+ * @return The product of the extents.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto SparseLattice<Dimension, Size, Scalar>::boxNodeCount() const -> std::size_t
+{
+    return boxNodeCount_;
+}
+
+/**
+ * @brief Returns the number of spatial dimensions.
+ *
+ * @return The number of spatial dimensions.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto SparseLattice<Dimension, Size, Scalar>::dimension() const -> std::size_t
+{
+    return Dimension;
+}
+
+/**
+ * @brief Returns the number of lattice vectors at each lattice node.
+ *
+ * @return The number of lattice vectors.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto SparseLattice<Dimension, Size, Scalar>::size() const -> std::size_t
+{
+    return Size;
+}
+
+#endif // SPARSE_LATTICE_TPP
@@ -0,0 +1,54 @@
+#ifndef TILING_HPP
+#define TILING_HPP
+
+/**
+ * @file Tiling.hpp
+ * @brief Declaration of functions that split a structured lattice into rectangular tiles.
+ */
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief The assumed cache size in bytes that the populations of one tile should fit into.
+ */
+constexpr std::size_t TILE_CACHE_SIZE{256 * 1024};
+
+/**
+ * @struct LatticeTile
+ * @brief A rectangular block of lattice nodes given by its half-open coordinate range.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ */
+template <std::size_t Dimension>
+struct LatticeTile
+{
+    std::array<std::size_t, Dimension> begin;
+    std::array<std::size_t, Dimension> end;
+};
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto defaultTileExtents(const std::array<std::size_t, Dimension>& extents)
+    -> std::array<std::size_t, Dimension>;
+
+template <std::size_t Dimension>
+auto tileLattice(
+    const std::array<std::size_t, Dimension>& extents,
+    const std::array<std::size_t, Dimension>& tileExtents
+) -> std::vector<LatticeTile<Dimension>>;
+
+template <std::size_t Dimension>
+constexpr auto tileNodeCount(const LatticeTile<Dimension>& tile) -> std::size_t;
+
+template <std::size_t Dimension, typename Function>
+auto forEachRow(
+    const LatticeTile<Dimension>& tile,
+    const std::array<std::size_t, Dimension>& extents,
+    Function function
+) -> void;
+
+#include "Tiling.tpp"
+
+#endif // TILING_HPP
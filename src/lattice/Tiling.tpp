@@ -0,0 +1,160 @@
+#ifndef TILING_TPP
+#define TILING_TPP
+
+/**
+ * @file Tiling.tpp
+ * @brief Implementation of functions that split a structured lattice into rectangular tiles.
+ */
+
+;
+#include "Tiling.hpp"
+
+#include <algorithm>
+
+/**
+ * @brief Returns tile extents whose populations fit into TILE_CACHE_SIZE bytes.
+ *
+ * Tiles span whole rows along the first axis whenever a row fits into the cache budget, so every
+ * tile covers contiguous ranges of the population arrays. The remaining budget is spent on the
+ * second axis, and all further axes have a tile extent of one.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @return The number of lattice nodes of a tile along each spatial dimension.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto defaultTileExtents(const std::array<std::size_t, Dimension>& extents)
+    -> std::array<std::size_t, Dimension>
+{
+    constexpr std::size_t nodeBytes{Size * sizeof(Scalar)};
+    constexpr std::size_t budget{std::max(TILE_CACHE_SIZE / nodeBytes, std::size_t{1})};
+
+    std::array<std::size_t, Dimension> tileExtents;
+    tileExtents.fill(1);
+    tileExtents[0] = std::clamp(extents[0], std::size_t{1}, budget);
+
+    if constexpr (Dimension > 1)
+    {
+        tileExtents[1] = std::clamp(budget / tileExtents[0], std::size_t{1}, extents[1]);
+    }
+
+    return tileExtents;
+}
+
+/**
+ * @brief Splits a lattice into tiles of at most the given extents.
+ *
+ * Tiles at the upper end of an axis are truncated to the lattice. Tiles are ordered with the
+ * first axis running fastest, which matches the order of lattice nodes in memory, so consecutive
+ * tiles touch neighboring memory.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param tileExtents The largest number of lattice nodes of a tile along each spatial dimension.
+ * @return The tiles that together cover every lattice node exactly once.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ */
+template <std::size_t Dimension>
+auto tileLattice(
+    const std::array<std::size_t, Dimension>& extents,
+    const std::array<std::size_t, Dimension>& tileExtents
+) -> std::vector<LatticeTile<Dimension>>
+{
+    std::array<std::size_t, Dimension> tileCounts;
+    std::size_t tileCount{1};
+
+    for (std::size_t axis = 0; axis < Dimension; ++axis)
+    {
+        tileCounts[axis] = (extents[axis] + tileExtents[axis] - 1) / tileExtents[axis];
+        tileCount *= tileCounts[axis];
+    }
+
+    std::vector<LatticeTile<Dimension>> tiles(tileCount);
+
+    for (std::size_t index = 0; index < tileCount; ++index)
+    {
+        std::size_t remainder{index};
+
+        for (std::size_t axis = 0; axis < Dimension; ++axis)
+        {
+            const std::size_t tile{remainder % tileCounts[axis]};
+            remainder /= tileCounts[axis];
+            tiles[index].begin[axis] = tile * tileExtents[axis];
+            tiles[index].end[axis] = std::min((tile + 1) * tileExtents[axis], extents[axis]);
+        }
+    }
+
+    return tiles;
+}
+
+/**
+ * @brief Returns the number of lattice nodes in a tile.
+ *
+ * @param tile The tile.
+ * @return The product of the extents of the tile along all axes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ */
+template <std::size_t Dimension>
+constexpr auto tileNodeCount(const LatticeTile<Dimension>& tile) -> std::size_t
+{
+    std::size_t count{1};
+    for (std::size_t axis = 0; axis < Dimension; ++axis)
+    {
+        count *= tile.end[axis] - tile.begin[axis];
+    }
+
+    return count;
+}
+
+/**
+ * @brief Calls a function for every row of a tile along the first axis.
+ *
+ * @param tile The tile whose rows are visited.
+ * @param extents The number of lattice nodes of the lattice along each spatial dimension.
+ * @param function A callable invoked as function(firstNode, lastNode) with the half-open range of
+ * linear node indices of each row.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Function The type of the callable.
+ */
+template <std::size_t Dimension, typename Function>
+auto forEachRow(
+    const LatticeTile<Dimension>& tile,
+    const std::array<std::size_t, Dimension>& extents,
+    Function function
+) -> void
+{
+    std::array<std::size_t, Dimension> coordinates{tile.begin};
+
+    while (true)
+    {
+        std::size_t rowStart{0};
+        for (std::size_t axis = Dimension; axis-- > 1;)
+        {
+            rowStart = (rowStart + coordinates[axis]) * extents[axis - 1];
+        }
+
+        function(rowStart + tile.begin[0], rowStart + tile.end[0]);
+
+        std::size_t axis{1};
+        for (; axis < Dimension; ++axis)
+        {
+            if (++coordinates[axis] < tile.end[axis])
+            {
+                break;
+            }
+            coordinates[axis] = tile.begin[axis];
+        }
+
+        if (axis == Dimension)
+        {
+            return;
+        }
+    }
+}
+
+#endif // TILING_TPP
@@ -0,0 +1,112 @@
+#ifndef LATTICE_EQUILIBRIUM_HPP
+#define LATTICE_EQUILIBRIUM_HPP
+
+/**
+ * @file equilibrium.hpp
+ * @brief Declaration of batched functions that fill the populations of a lattice with the
+ * equilibrium of given density and velocity fields.
+ */
+
+#include "../densityDistribution/d2q5.hpp"
+#include "../densityDistribution/d2q9.hpp"
+#include "../parallel/TiledScheduler.hpp"
+#include "Lattice.hpp"
+#include "Tiling.hpp"
+
+#include <array>
+#include <span>
+
+/**
+ * @brief The number of lattice nodes whose fields the equilibrium kernel copies into local buffers
+ * at once.
+ */
+constexpr std::size_t EQUILIBRIUM_BLOCK_SIZE{256};
+
+namespace detail
+{
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto checkFieldSizes(
+    const Lattice<Dimension, Size, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, Dimension>& flowVelocities
+) -> void;
+
+} // namespace detail
+
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, Dimension>& flowVelocities,
+    const LatticeTile<Dimension>& tile
+) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, Dimension>& flowVelocities
+) -> void;
+
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, Dimension>& flowVelocities,
+    TiledScheduler<Dimension>& scheduler
+) -> void;
+
+template <const auto& Descriptor, std::size_t Dimension, std::floating_point Scalar>
+auto makeEquilibriumLattice(
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, Dimension>& flowVelocities,
+    TiledScheduler<Dimension>& scheduler,
+    std::pmr::memory_resource* resource = nullptr
+) -> Lattice<Dimension, Descriptor.velocities.size(), Scalar>;
+
+template <std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, D2Q5_DIMENSION>& flowVelocities
+) -> void;
+
+template <std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, D2Q9_DIMENSION>& flowVelocities
+) -> void;
+
+template <std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, D2Q5_DIMENSION>& flowVelocities,
+    TiledScheduler<D2Q5_DIMENSION>& scheduler
+) -> void;
+
+template <std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, D2Q9_DIMENSION>& flowVelocities,
+    TiledScheduler<D2Q9_DIMENSION>& scheduler
+) -> void;
+
+#include "equilibrium.tpp"
+
+#endif // LATTICE_EQUILIBRIUM_HPP
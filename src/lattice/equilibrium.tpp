@@ -0,0 +1,337 @@
+#ifndef LATTICE_EQUILIBRIUM_TPP
+#define LATTICE_EQUILIBRIUM_TPP
+
+/**
+ * @file equilibrium.tpp
+ * @brief Implementation of batched functions that fill the populations of a lattice with the
+ * equilibrium of given density and velocity fields.
+ */
+
+;
+#include "equilibrium.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace detail
+{
+
+/**
+ * @brief Checks that density and velocity fields hold one value per node of a lattice.
+ *
+ * @param lattice The lattice.
+ * @param densities The density field.
+ * @param flowVelocities The components of the velocity field.
+ * @throws std::length_error If a field does not hold one value per lattice node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto checkFieldSizes(
+    const Lattice<Dimension, Size, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, Dimension>& flowVelocities
+) -> void
+{
+    if (densities.size() != lattice.nodeCount() ||
+        std::ranges::any_of(flowVelocities, [&](std::span<const Scalar> component) {
+            return component.size() != lattice.nodeCount();
+        }))
+    {
+        throw std::length_error{"fields must hold one value per lattice node"};
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Fills the populations of the nodes of a tile with the equilibrium of density and velocity
+ * fields.
+ *
+ * The fields of up to EQUILIBRIUM_BLOCK_SIZE consecutive nodes of a row are copied into local
+ * buffers, and each population array is then written in one unit-stride pass over the block that
+ * the compiler vectorizes. Every population is computed by computeEquilibriumPopulation, so the
+ * result is the equilibrium of computeEquilibrium for the squared speed of sound of the descriptor.
+ * The fields must hold one value per lattice node.
+ *
+ * @param lattice The lattice whose populations are overwritten.
+ * @param densities The density at every lattice node.
+ * @param flowVelocities The components of the flow velocity at every lattice node.
+ * @param tile The tile of lattice nodes to fill.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, Dimension>& flowVelocities,
+    const LatticeTile<Dimension>& tile
+) -> void
+{
+    static_assert(Descriptor.velocities.size() == Size, "descriptor does not match lattice");
+
+    std::array<std::span<Scalar>, Size> populations;
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        populations[i] = lattice.population(i);
+    }
+
+    alignas(CACHE_LINE_SIZE) std::array<Scalar, EQUILIBRIUM_BLOCK_SIZE> density;
+    alignas(CACHE_LINE_SIZE) std::array<Scalar, EQUILIBRIUM_BLOCK_SIZE> velocitySquared;
+    alignas(CACHE_LINE_SIZE) std::array<Scalar, EQUILIBRIUM_BLOCK_SIZE> projection;
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, EQUILIBRIUM_BLOCK_SIZE>, Dimension>
+        velocity;
+
+    forEachRow(tile, lattice.extents(), [&](std::size_t firstNode, std::size_t lastNode) {
+        for (std::size_t first = firstNode; first < lastNode; first += EQUILIBRIUM_BLOCK_SIZE)
+        {
+            const std::size_t count{std::min(EQUILIBRIUM_BLOCK_SIZE, lastNode - first)};
+
+            std::copy_n(densities.begin() + first, count, density.begin());
+            std::fill_n(velocitySquared.begin(), count, Scalar{0.0});
+            for (std::size_t axis = 0; axis < Dimension; ++axis)
+            {
+                std::copy_n(flowVelocities[axis].begin() + first, count, velocity[axis].begin());
+                for (std::size_t node = 0; node < count; ++node)
+                {
+                    velocitySquared[node] += velocity[axis][node] * velocity[axis][node];
+                }
+            }
+
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                const auto fillDirection{[&]<std::size_t Direction>() {
+                    std::fill_n(projection.begin(), count, Scalar{0.0});
+                    for (std::size_t axis = 0; axis < Dimension; ++axis)
+                    {
+                        const auto component{
+                            static_cast<Scalar>(Descriptor.velocities[Direction][axis])
+                        };
+                        if (component == 0)
+                        {
+                            continue;
+                        }
+                        for (std::size_t node = 0; node < count; ++node)
+                        {
+                            projection[node] += component * velocity[axis][node];
+                        }
+                    }
+
+                    Scalar* const population{populations[Direction].data() + first};
+                    for (std::size_t node = 0; node < count; ++node)
+                    {
+                        population[node] = computeEquilibriumPopulation<Descriptor, Direction>(
+                            density[node], projection[node], velocitySquared[node]
+                        );
+                    }
+                }};
+
+                (fillDirection.template operator()<I>(), ...);
+            }(std::make_index_sequence<Size>{});
+        }
+    });
+}
+
+/**
+ * @brief Fills the populations of all nodes of a lattice with the equilibrium of density and
+ * velocity fields.
+ *
+ * @param lattice The lattice whose populations are overwritten.
+ * @param densities The density at every lattice node.
+ * @param flowVelocities The components of the flow velocity at every lattice node.
+ * @throws std::length_error If a field does not hold one value per lattice node.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, Dimension>& flowVelocities
+) -> void
+{
+    detail::checkFieldSizes(lattice, densities, flowVelocities);
+
+    LatticeTile<Dimension> tile;
+    tile.begin.fill(0);
+    tile.end = lattice.extents();
+
+    initializeEquilibrium<Descriptor>(lattice, densities, flowVelocities, tile);
+}
+
+/**
+ * @brief Fills the populations of all nodes of a lattice with the equilibrium of density and
+ * velocity fields on all tiles of a scheduler in parallel.
+ *
+ * Each tile is written by the worker that owns it. This does not decide where the population pages
+ * are placed, since the constructors of Lattice already write every page, except the first-touch
+ * constructor driven by the same scheduler. makeEquilibriumLattice constructs the lattice that way.
+ *
+ * @param lattice The lattice whose populations are overwritten.
+ * @param densities The density at every lattice node.
+ * @param flowVelocities The components of the flow velocity at every lattice node.
+ * @param scheduler A scheduler created for the extents of the lattice.
+ * @throws std::length_error If a field does not hold one value per lattice node.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <
+    const auto& Descriptor,
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, Dimension>& flowVelocities,
+    TiledScheduler<Dimension>& scheduler
+) -> void
+{
+    detail::checkFieldSizes(lattice, densities, flowVelocities);
+
+    scheduler.forEachOwnedTile([&](const LatticeTile<Dimension>& tile) {
+        initializeEquilibrium<Descriptor>(lattice, densities, flowVelocities, tile);
+    });
+}
+
+/**
+ * @brief Creates a lattice whose populations are the equilibrium of density and velocity fields,
+ * with its pages placed by the workers of a scheduler.
+ *
+ * The lattice is constructed with the first-touch constructor of Lattice driven by the scheduler
+ * and then initialized on the same tiles, so every population page is first written by the worker
+ * that owns its tile and later sweeps it.
+ *
+ * @param densities The density at every lattice node.
+ * @param flowVelocities The components of the flow velocity at every lattice node.
+ * @param scheduler A scheduler created for the extents of the lattice.
+ * @param resource The memory resource of the population storage, or nullptr for the heap.
+ * @return A lattice with the extents of the scheduler holding the equilibrium populations.
+ * @throws std::length_error If a field does not hold one value per lattice node.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::size_t Dimension, std::floating_point Scalar>
+auto makeEquilibriumLattice(
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, Dimension>& flowVelocities,
+    TiledScheduler<Dimension>& scheduler,
+    std::pmr::memory_resource* resource
+) -> Lattice<Dimension, Descriptor.velocities.size(), Scalar>
+{
+    Lattice<Dimension, Descriptor.velocities.size(), Scalar> lattice{
+        scheduler.extents(), [&](const auto& zero) { scheduler.firstTouch(zero); }, resource
+    };
+
+    initializeEquilibrium<Descriptor>(lattice, densities, flowVelocities, scheduler);
+
+    return lattice;
+}
+
+/**
+ * @brief Fills a D2Q5 lattice with the equilibrium of density and velocity fields.
+ *
+ * @param lattice A D2Q5 lattice, overwritten.
+ * @param densities The density at every lattice node.
+ * @param flowVelocities The components of the flow velocity at every lattice node.
+ * @throws std::length_error If a field does not hold one value per lattice node.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, D2Q5_DIMENSION>& flowVelocities
+) -> void
+{
+    initializeEquilibrium<D2Q5_DESCRIPTOR>(lattice, densities, flowVelocities);
+}
+
+/**
+ * @brief Fills a D2Q9 lattice with the equilibrium of density and velocity fields.
+ *
+ * @param lattice A D2Q9 lattice, overwritten.
+ * @param densities The density at every lattice node.
+ * @param flowVelocities The components of the flow velocity at every lattice node.
+ * @throws std::length_error If a field does not hold one value per lattice node.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, D2Q9_DIMENSION>& flowVelocities
+) -> void
+{
+    initializeEquilibrium<D2Q9_DESCRIPTOR>(lattice, densities, flowVelocities);
+}
+
+/**
+ * @brief Fills a D2Q5 lattice with the equilibrium of density and velocity fields in parallel.
+ *
+ * @param lattice A D2Q5 lattice, overwritten.
+ * @param densities The density at every lattice node.
+ * @param flowVelocities The components of the flow velocity at every lattice node.
+ * @param scheduler A scheduler created for the extents of the lattice.
+ * @throws std::length_error If a field does not hold one value per lattice node.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, D2Q5_DIMENSION>& flowVelocities,
+    TiledScheduler<D2Q5_DIMENSION>& scheduler
+) -> void
+{
+    initializeEquilibrium<D2Q5_DESCRIPTOR>(lattice, densities, flowVelocities, scheduler);
+}
+
+/**
+ * @brief Fills a D2Q9 lattice with the equilibrium of density and velocity fields in parallel.
+ *
+ * @param lattice A D2Q9 lattice, overwritten.
+ * @param densities The density at every lattice node.
+ * @param flowVelocities The components of the flow velocity at every lattice node.
+ * @param scheduler A scheduler created for the extents of the lattice.
+ * @throws std::length_error If a field does not hold one value per lattice node.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto initializeEquilibrium(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::span<const Scalar> densities,
+    const std::array<std::span<const Scalar>, D2Q9_DIMENSION>& flowVelocities,
+    TiledScheduler<D2Q9_DIMENSION>& scheduler
+) -> void
+{
+    initializeEquilibrium<D2Q9_DESCRIPTOR>(lattice, densities, flowVelocities, scheduler);
+}
+
+#endif // LATTICE_EQUILIBRIUM_TPP
@@ -0,0 +1,174 @@
+#ifndef LATTICE_MOMENTS_HPP
+#define LATTICE_MOMENTS_HPP
+
+/**
+ * @file moments.hpp
+ * @brief Declaration of batched functions that compute the macroscopic moments of many lattice
+ * nodes stored in structure-of-arrays layout.
+ */
+
+#include "../densityDistribution/d2q5.hpp"
+#include "../densityDistribution/d2q9.hpp"
+#include "../densityDistribution/d3q19.hpp"
+#include "../densityDistribution/d3q27.hpp"
+#include "../instrumentation/PhaseRecorder.hpp"
+#include "../simd/SimdPack.hpp"
+#include "Lattice.hpp"
+#include "MixedPrecisionLattice.hpp"
+#include "SparseLattice.hpp"
+
+/**
+ * @brief The number of lattice nodes that the moment kernels of mixed-precision lattices widen at
+ * once.
+ */
+constexpr std::size_t WIDENING_BLOCK_SIZE{256};
+
+template <std::size_t Size, std::floating_point Scalar>
+auto computeDensities(
+    const std::array<std::span<const Scalar>, Size>& populations,
+    std::span<Scalar> densities
+) -> void;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto computeMomenta(
+    const std::array<std::span<const Scalar>, Size>& populations,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::span<Scalar>, Dimension>& momenta
+) -> void;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto computeMoments(
+    const std::array<std::span<const Scalar>, Size>& populations,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, Dimension>& momenta
+) -> void;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto computeMoments(
+    const MixedPrecisionLattice<Dimension, Size, Scalar, Format>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, Dimension>& momenta
+) -> void;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto populationSpans(const Lattice<Dimension, Size, Scalar>& lattice)
+    -> std::array<std::span<const Scalar>, Size>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto populationSpans(const SparseLattice<Dimension, Size, Scalar>& lattice)
+    -> std::array<std::span<const Scalar>, Size>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto computeDensity(
+    const SparseLattice<Dimension, Size, Scalar>& lattice,
+    std::span<Scalar> densities
+) -> void;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto computeMomentum(
+    const SparseLattice<Dimension, Size, Scalar>& lattice,
+    const std::array<std::span<Scalar>, Dimension>& momenta
+) -> void;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto computeMoments(
+    const SparseLattice<Dimension, Size, Scalar>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, Dimension>& momenta
+) -> void;
+
+template <std::floating_point Scalar>
+auto computeDensity(
+    const Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities
+) -> void;
+
+template <std::floating_point Scalar>
+auto computeDensity(
+    const Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities
+) -> void;
+
+template <std::floating_point Scalar>
+auto computeDensity(
+    const Lattice<D3Q19_DIMENSION, D3Q19_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities
+) -> void;
+
+template <std::floating_point Scalar>
+auto computeDensity(
+    const Lattice<D3Q27_DIMENSION, D3Q27_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities
+) -> void;
+
+template <std::floating_point Scalar>
+auto computeMomentum(
+    const Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    const std::array<std::span<Scalar>, D2Q5_DIMENSION>& momenta
+) -> void;
+
+template <std::floating_point Scalar>
+auto computeMomentum(
+    const Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    const std::array<std::span<Scalar>, D2Q9_DIMENSION>& momenta
+) -> void;
+
+template <std::floating_point Scalar>
+auto computeMomentum(
+    const Lattice<D3Q19_DIMENSION, D3Q19_SIZE, Scalar>& lattice,
+    const std::array<std::span<Scalar>, D3Q19_DIMENSION>& momenta
+) -> void;
+
+template <std::floating_point Scalar>
+auto computeMomentum(
+    const Lattice<D3Q27_DIMENSION, D3Q27_SIZE, Scalar>& lattice,
+    const std::array<std::span<Scalar>, D3Q27_DIMENSION>& momenta
+) -> void;
+
+template <std::floating_point Scalar>
+auto computeMoments(
+    const Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, D2Q5_DIMENSION>& momenta
+) -> void;
+
+template <std::floating_point Scalar>
+auto computeMoments(
+    const Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, D2Q9_DIMENSION>& momenta
+) -> void;
+
+template <std::floating_point Scalar>
+auto computeMoments(
+    const Lattice<D3Q19_DIMENSION, D3Q19_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, D3Q19_DIMENSION>& momenta
+) -> void;
+
+template <std::floating_point Scalar>
+auto computeMoments(
+    const Lattice<D3Q27_DIMENSION, D3Q27_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, D3Q27_DIMENSION>& momenta
+) -> void;
+
+template <std::floating_point Scalar, StorageFormat Format>
+auto computeMoments(
+    const MixedPrecisionLattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar, Format>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, D2Q5_DIMENSION>& momenta
+) -> void;
+
+template <std::floating_point Scalar, StorageFormat Format>
+auto computeMoments(
+    const MixedPrecisionLattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar, Format>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, D2Q9_DIMENSION>& momenta
+) -> void;
+
+#include "moments.tpp"
+
+#endif // LATTICE_MOMENTS_HPP
@@ -0,0 +1,687 @@
+#ifndef LATTICE_MOMENTS_TPP
+#define LATTICE_MOMENTS_TPP
+
+/**
+ * @file moments.tpp
+ * @brief Implementation of batched functions that compute the macroscopic moments of many lattice
+ * nodes stored in structure-of-arrays layout.
+ */
+
+;
+#include "moments.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Computes the mass densities of many lattice nodes.
+ *
+ * Processes SimdPack<Scalar>::width nodes per iteration and the remaining nodes one at a time. The
+ * populations are summed in lattice vector order, so every density equals the one of the per-node
+ * computeDensity function exactly.
+ *
+ * @param populations One population array per lattice vector, all holding the same nodes.
+ * @param densities The mass densities of the nodes, overwritten on output.
+ * @throws std::length_error If a population array does not hold one value per density.
+ *
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Size, std::floating_point Scalar>
+auto computeDensities(
+    const std::array<std::span<const Scalar>, Size>& populations,
+    std::span<Scalar> densities
+) -> void
+{
+    if (std::ranges::any_of(populations, [&](std::span<const Scalar> population) {
+            return population.size() != densities.size();
+        }))
+    {
+        throw std::length_error{"populations must hold one value per density"};
+    }
+
+    const ScopedPhase phase{Phase::Moments, densities.size()};
+
+    using Pack = SimdPack<Scalar>;
+
+    std::size_t node{0};
+
+    for (; node + Pack::width <= densities.size(); node += Pack::width)
+    {
+        Pack density;
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            density = density + Pack::load(&populations[i][node]);
+        }
+        density.store(&densities[node]);
+    }
+
+    for (; node < densities.size(); ++node)
+    {
+        Scalar density{0.0};
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            density += populations[i][node];
+        }
+        densities[node] = density;
+    }
+}
+
+/**
+ * @brief Computes the momentum densities of many lattice nodes.
+ *
+ * Populations with positive and negative velocity components are accumulated separately in
+ * lattice vector order and subtracted at the end, which reproduces the per-node computeMomentum
+ * functions of the D2Q5, D2Q9, D3Q19 and D3Q27 lattice models exactly. Velocity components must
+ * lie in {-1, 0, 1}.
+ *
+ * @param populations One population array per lattice vector, all holding the same nodes.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param momenta One momentum density array per spatial dimension, overwritten on output.
+ * @throws std::length_error If the population and momentum arrays differ in size.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto computeMomenta(
+    const std::array<std::span<const Scalar>, Size>& populations,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::span<Scalar>, Dimension>& momenta
+) -> void
+{
+    const auto differsInSize = [&](auto values) { return values.size() != momenta[0].size(); };
+    if (std::ranges::any_of(populations, differsInSize) ||
+        std::ranges::any_of(momenta, differsInSize))
+    {
+        throw std::length_error{"populations and momenta must hold the same nodes"};
+    }
+
+    const ScopedPhase phase{Phase::Moments, momenta[0].size()};
+
+    using Pack = SimdPack<Scalar>;
+
+    const std::size_t nodeCount{momenta[0].size()};
+    std::size_t node{0};
+
+    for (; node + Pack::width <= nodeCount; node += Pack::width)
+    {
+        std::array<Pack, Dimension> positive;
+        std::array<Pack, Dimension> negative;
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const Pack population{Pack::load(&populations[i][node])};
+            for (std::size_t axis = 0; axis < Dimension; ++axis)
+            {
+                if (velocities[i][axis] > 0)
+                {
+                    positive[axis] = positive[axis] + population;
+                }
+                else if (velocities[i][axis] < 0)
+                {
+                    negative[axis] = negative[axis] + population;
+                }
+            }
+        }
+
+        for (std::size_t axis = 0; axis < Dimension; ++axis)
+        {
+            (positive[axis] - negative[axis]).store(&momenta[axis][node]);
+        }
+    }
+
+    for (; node < nodeCount; ++node)
+    {
+        std::array<Scalar, Dimension> positive{};
+        std::array<Scalar, Dimension> negative{};
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            for (std::size_t axis = 0; axis < Dimension; ++axis)
+            {
+                if (velocities[i][axis] > 0)
+                {
+                    positive[axis] += populations[i][node];
+                }
+                else if (velocities[i][axis] < 0)
+                {
+                    negative[axis] += populations[i][node];
+                }
+            }
+        }
+
+        for (std::size_t axis = 0; axis < Dimension; ++axis)
+        {
+            momenta[axis][node] = positive[axis] - negative[axis];
+        }
+    }
+}
+
+/**
+ * @brief Computes the mass and momentum densities of many lattice nodes in a single pass.
+ *
+ * Equivalent to computeDensities followed by computeMomenta, but reads every population only
+ * once.
+ *
+ * @param populations One population array per lattice vector, all holding the same nodes.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param densities The mass densities of the nodes, overwritten on output.
+ * @param momenta One momentum density array per spatial dimension, overwritten on output.
+ * @throws std::length_error If the population, density and momentum arrays differ in size.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto computeMoments(
+    const std::array<std::span<const Scalar>, Size>& populations,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, Dimension>& momenta
+) -> void
+{
+    const auto differsInSize = [&](auto values) { return values.size() != densities.size(); };
+    if (std::ranges::any_of(populations, differsInSize) ||
+        std::ranges::any_of(momenta, differsInSize))
+    {
+        throw std::length_error{"populations, densities and momenta must hold the same nodes"};
+    }
+
+    const ScopedPhase phase{Phase::Moments, densities.size()};
+
+    using Pack = SimdPack<Scalar>;
+
+    std::size_t node{0};
+
+    for (; node + Pack::width <= densities.size(); node += Pack::width)
+    {
+        Pack density;
+        std::array<Pack, Dimension> positive;
+        std::array<Pack, Dimension> negative;
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            const Pack population{Pack::load(&populations[i][node])};
+            density = density + population;
+            for (std::size_t axis = 0; axis < Dimension; ++axis)
+            {
+                if (velocities[i][axis] > 0)
+                {
+                    positive[axis] = positive[axis] + population;
+                }
+                else if (velocities[i][axis] < 0)
+                {
+                    negative[axis] = negative[axis] + population;
+                }
+            }
+        }
+
+        density.store(&densities[node]);
+        for (std::size_t axis = 0; axis < Dimension; ++axis)
+        {
+            (positive[axis] - negative[axis]).store(&momenta[axis][node]);
+        }
+    }
+
+    const std::size_t remainder{densities.size() - node};
+    std::array<std::span<const Scalar>, Size> remainingPopulations;
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        remainingPopulations[i] = populations[i].subspan(node, remainder);
+    }
+    std::array<std::span<Scalar>, Dimension> remainingMomenta;
+    for (std::size_t axis = 0; axis < Dimension; ++axis)
+    {
+        remainingMomenta[axis] = momenta[axis].subspan(node, remainder);
+    }
+
+    computeDensities(remainingPopulations, densities.subspan(node, remainder));
+    computeMomenta(remainingPopulations, velocities, remainingMomenta);
+}
+
+/**
+ * @brief Computes the mass and momentum densities of all nodes of a mixed-precision lattice in
+ * one pass.
+ *
+ * Each block of WIDENING_BLOCK_SIZE nodes is widened from the storage format into a local buffer
+ * of Scalar values, from which the vectorized kernel computes the moments of the block.
+ *
+ * @param lattice The lattice.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param densities The mass densities of all nodes, overwritten on output.
+ * @param momenta One momentum density array per spatial dimension, overwritten on output.
+ * @throws std::length_error If a moment array does not hold one value per lattice node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto computeMoments(
+    const MixedPrecisionLattice<Dimension, Size, Scalar, Format>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, Dimension>& momenta
+) -> void
+{
+    if (densities.size() != lattice.nodeCount() ||
+        std::ranges::any_of(momenta, [&](std::span<Scalar> component) {
+            return component.size() != lattice.nodeCount();
+        }))
+    {
+        throw std::length_error{"moments must hold one value per lattice node"};
+    }
+
+    const ScopedPhase phase{Phase::Moments, lattice.nodeCount()};
+
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, WIDENING_BLOCK_SIZE>, Size> block;
+    std::array<std::span<const Scalar>, Size> blockPopulations;
+    std::array<std::span<Scalar>, Dimension> blockMomenta;
+
+    for (std::size_t first = 0; first < lattice.nodeCount(); first += WIDENING_BLOCK_SIZE)
+    {
+        const std::size_t count{std::min(WIDENING_BLOCK_SIZE, lattice.nodeCount() - first)};
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            lattice.load(i, first, std::span<Scalar>{block[i]}.first(count));
+            blockPopulations[i] = std::span<const Scalar>{block[i]}.first(count);
+        }
+        for (std::size_t axis = 0; axis < Dimension; ++axis)
+        {
+            blockMomenta[axis] = momenta[axis].subspan(first, count);
+        }
+
+        computeMoments(blockPopulations, velocities, densities.subspan(first, count), blockMomenta);
+    }
+}
+
+/**
+ * @brief Returns const views of all population arrays of a lattice.
+ *
+ * @param lattice The lattice to view.
+ * @return One const view per lattice vector.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto populationSpans(const Lattice<Dimension, Size, Scalar>& lattice)
+    -> std::array<std::span<const Scalar>, Size>
+{
+    std::array<std::span<const Scalar>, Size> populations;
+
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        populations[i] = lattice.population(i);
+    }
+
+    return populations;
+}
+
+/**
+ * @brief Returns const views of all population arrays of a sparse lattice.
+ *
+ * @param lattice The sparse lattice to view.
+ * @return One const view per lattice vector over the fluid nodes.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto populationSpans(const SparseLattice<Dimension, Size, Scalar>& lattice)
+    -> std::array<std::span<const Scalar>, Size>
+{
+    std::array<std::span<const Scalar>, Size> populations;
+
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        populations[i] = lattice.population(i);
+    }
+
+    return populations;
+}
+
+/**
+ * @brief Computes the mass densities of all fluid nodes of a sparse lattice.
+ *
+ * @param lattice A sparse lattice.
+ * @param densities The mass densities of all fluid nodes in compact order, overwritten on output.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto computeDensity(
+    const SparseLattice<Dimension, Size, Scalar>& lattice,
+    std::span<Scalar> densities
+) -> void
+{
+    computeDensities(populationSpans(lattice), densities);
+}
+
+/**
+ * @brief Computes the momentum densities of all fluid nodes of a sparse lattice.
+ *
+ * @param lattice A sparse lattice.
+ * @param momenta One momentum density array per spatial dimension in compact order, overwritten on
+ * output.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto computeMomentum(
+    const SparseLattice<Dimension, Size, Scalar>& lattice,
+    const std::array<std::span<Scalar>, Dimension>& momenta
+) -> void
+{
+    computeMomenta(populationSpans(lattice), lattice.velocities(), momenta);
+}
+
+/**
+ * @brief Computes the mass and momentum densities of all fluid nodes of a sparse lattice in one
+ * pass.
+ *
+ * @param lattice A sparse lattice.
+ * @param densities The mass densities of all fluid nodes in compact order, overwritten on output.
+ * @param momenta One momentum density array per spatial dimension in compact order, overwritten on
+ * output.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto computeMoments(
+    const SparseLattice<Dimension, Size, Scalar>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, Dimension>& momenta
+) -> void
+{
+    computeMoments(populationSpans(lattice), lattice.velocities(), densities, momenta);
+}
+
+/**
+ * @brief Computes the mass densities of all nodes of a D2Q5 lattice.
+ *
+ * @param lattice A D2Q5 lattice.
+ * @param densities The mass densities of all nodes, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto computeDensity(
+    const Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities
+) -> void
+{
+    computeDensities(populationSpans(lattice), densities);
+}
+
+/**
+ * @brief Computes the mass densities of all nodes of a D2Q9 lattice.
+ *
+ * @param lattice A D2Q9 lattice.
+ * @param densities The mass densities of all nodes, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto computeDensity(
+    const Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities
+) -> void
+{
+    computeDensities(populationSpans(lattice), densities);
+}
+
+/**
+ * @brief Computes the mass densities of all nodes of a D3Q19 lattice.
+ *
+ * @param lattice A D3Q19 lattice.
+ * @param densities The mass densities of all nodes, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto computeDensity(
+    const Lattice<D3Q19_DIMENSION, D3Q19_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities
+) -> void
+{
+    computeDensities(populationSpans(lattice), densities);
+}
+
+/**
+ * @brief Computes the mass densities of all nodes of a D3Q27 lattice.
+ *
+ * @param lattice A D3Q27 lattice.
+ * @param densities The mass densities of all nodes, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto computeDensity(
+    const Lattice<D3Q27_DIMENSION, D3Q27_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities
+) -> void
+{
+    computeDensities(populationSpans(lattice), densities);
+}
+
+/**
+ * @brief Computes the momentum densities of all nodes of a D2Q5 lattice.
+ *
+ * @param lattice A D2Q5 lattice.
+ * @param momenta One momentum density array per spatial dimension, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto computeMomentum(
+    const Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    const std::array<std::span<Scalar>, D2Q5_DIMENSION>& momenta
+) -> void
+{
+    constexpr D2Q5<Scalar> model;
+
+    computeMomenta(populationSpans(lattice), latticeVelocities(model), momenta);
+}
+
+/**
+ * @brief Computes the momentum densities of all nodes of a D2Q9 lattice.
+ *
+ * @param lattice A D2Q9 lattice.
+ * @param momenta One momentum density array per spatial dimension, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto computeMomentum(
+    const Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    const std::array<std::span<Scalar>, D2Q9_DIMENSION>& momenta
+) -> void
+{
+    constexpr D2Q9<Scalar> model;
+
+    computeMomenta(populationSpans(lattice), latticeVelocities(model), momenta);
+}
+
+/**
+ * @brief Computes the momentum densities of all nodes of a D3Q19 lattice.
+ *
+ * @param lattice A D3Q19 lattice.
+ * @param momenta One momentum density array per spatial dimension, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto computeMomentum(
+    const Lattice<D3Q19_DIMENSION, D3Q19_SIZE, Scalar>& lattice,
+    const std::array<std::span<Scalar>, D3Q19_DIMENSION>& momenta
+) -> void
+{
+    constexpr D3Q19<Scalar> model;
+
+    computeMomenta(populationSpans(lattice), latticeVelocities(model), momenta);
+}
+
+/**
+ * @brief Computes the momentum densities of all nodes of a D3Q27 lattice.
+ *
+ * @param lattice A D3Q27 lattice.
+ * @param momenta One momentum density array per spatial dimension, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto computeMomentum(
+    const Lattice<D3Q27_DIMENSION, D3Q27_SIZE, Scalar>& lattice,
+    const std::array<std::span<Scalar>, D3Q27_DIMENSION>& momenta
+) -> void
+{
+    constexpr D3Q27<Scalar> model;
+
+    computeMomenta(populationSpans(lattice), latticeVelocities(model), momenta);
+}
+
+/**
+ * @brief Computes the mass and momentum densities of all nodes of a D2Q5 lattice in one pass.
+ *
+ * @param lattice A D2Q5 lattice.
+ * @param densities The mass densities of all nodes, overwritten on output.
+ * @param momenta One momentum density array per spatial dimension, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto computeMoments(
+    const Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, D2Q5_DIMENSION>& momenta
+) -> void
+{
+    constexpr D2Q5<Scalar> model;
+
+    computeMoments(populationSpans(lattice), latticeVelocities(model), densities, momenta);
+}
+
+/**
+ * @brief Computes the mass and momentum densities of all nodes of a D2Q9 lattice in one pass.
+ *
+ * @param lattice A D2Q9 lattice.
+ * @param densities The mass densities of all nodes, overwritten on output.
+ * @param momenta One momentum density array per spatial dimension, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto computeMoments(
+    const Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, D2Q9_DIMENSION>& momenta
+) -> void
+{
+    constexpr D2Q9<Scalar> model;
+
+    computeMoments(populationSpans(lattice), latticeVelocities(model), densities, momenta);
+}
+
+/**
+ * @brief Computes the mass and momentum densities of all nodes of a D3Q19 lattice in one pass.
+ *
+ * @param lattice A D3Q19 lattice.
+ * @param densities The mass densities of all nodes, overwritten on output.
+ * @param momenta One momentum density array per spatial dimension, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto computeMoments(
+    const Lattice<D3Q19_DIMENSION, D3Q19_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, D3Q19_DIMENSION>& momenta
+) -> void
+{
+    constexpr D3Q19<Scalar> model;
+
+    computeMoments(populationSpans(lattice), latticeVelocities(model), densities, momenta);
+}
+
+/**
+ * @brief Computes the mass and momentum densities of all nodes of a D3Q27 lattice in one pass.
+ *
+ * @param lattice A D3Q27 lattice.
+ * @param densities The mass densities of all nodes, overwritten on output.
+ * @param momenta One momentum density array per spatial dimension, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto computeMoments(
+    const Lattice<D3Q27_DIMENSION, D3Q27_SIZE, Scalar>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, D3Q27_DIMENSION>& momenta
+) -> void
+{
+    constexpr D3Q27<Scalar> model;
+
+    computeMoments(populationSpans(lattice), latticeVelocities(model), densities, momenta);
+}
+
+/**
+ * @brief Computes the mass and momentum densities of all nodes of a mixed-precision D2Q5 lattice in
+ * one pass.
+ *
+ * @param lattice A mixed-precision D2Q5 lattice.
+ * @param densities The mass densities of all nodes, overwritten on output.
+ * @param momenta One momentum density array per spatial dimension, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::floating_point Scalar, StorageFormat Format>
+auto computeMoments(
+    const MixedPrecisionLattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar, Format>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, D2Q5_DIMENSION>& momenta
+) -> void
+{
+    constexpr D2Q5<Scalar> model;
+
+    computeMoments(lattice, latticeVelocities(model), densities, momenta);
+}
+
+/**
+ * @brief Computes the mass and momentum densities of all nodes of a mixed-precision D2Q9 lattice in
+ * one pass.
+ *
+ * @param lattice A mixed-precision D2Q9 lattice.
+ * @param densities The mass densities of all nodes, overwritten on output.
+ * @param momenta One momentum density array per spatial dimension, overwritten on output.
+ *
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::floating_point Scalar, StorageFormat Format>
+auto computeMoments(
+    const MixedPrecisionLattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar, Format>& lattice,
+    std::span<Scalar> densities,
+    const std::array<std::span<Scalar>, D2Q9_DIMENSION>& momenta
+) -> void
+{
+    constexpr D2Q9<Scalar> model;
+
+    computeMoments(lattice, latticeVelocities(model), densities, momenta);
+}
+
+#endif // LATTICE_MOMENTS_TPP
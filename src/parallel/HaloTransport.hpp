@@ -0,0 +1,83 @@
+#ifndef HALO_TRANSPORT_HPP
+#define HALO_TRANSPORT_HPP
+
+/**
+ * @file HaloTransport.hpp
+ * @brief Declaration of the HaloTransport concept and of SharedMemoryTransport, which passes halo
+ * messages between the subdomains of a decomposed lattice through POSIX shared memory.
+ */
+
+#include "SharedMemoryRing.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @enum HaloSide
+ * @brief The neighbor of a subdomain along the decomposed axis, below or above it.
+ */
+enum class HaloSide : std::size_t
+{
+    Lower = 0,
+    Upper = 1
+};
+
+/**
+ * @concept HaloTransport
+ * @brief A message channel from a subdomain to its two neighbors along the decomposed axis.
+ *
+ * send(side, message) passes a message to the neighbor on a side and may return before the
+ * neighbor has received it. receive(side, message) waits for the next message from the neighbor
+ * on a side. Messages between two neighbors arrive in the order they were sent. A transport that
+ * wraps MPI point-to-point calls satisfies this concept as well as SharedMemoryTransport does.
+ */
+template <typename Transport>
+concept HaloTransport = requires(
+    Transport transport,
+    HaloSide side,
+    std::span<const std::byte> outgoing,
+    std::span<std::byte> incoming
+) {
+    transport.send(side, outgoing);
+    transport.receive(side, incoming);
+};
+
+/**
+ * @class SharedMemoryTransport
+ * @brief A HaloTransport between the ranks of a periodic chain of subdomains on one machine, which
+ * may be threads of one process or separate processes.
+ *
+ * Every rank sends into one SharedMemoryRing per side, whose consumer is the neighbor on that
+ * side. The rings are created up front with createRings, for instance by the process that starts
+ * the ranks, and must outlive the transports that open them.
+ */
+class SharedMemoryTransport
+{
+public:
+    SharedMemoryTransport(const std::string& prefix, std::size_t rank, std::size_t rankCount);
+
+    static auto createRings(const std::string& prefix, std::size_t rankCount, std::size_t capacity)
+        -> std::vector<SharedMemoryRing>;
+    static auto ringName(const std::string& prefix, std::size_t rank, HaloSide side)
+        -> std::string;
+
+    auto send(HaloSide side, std::span<const std::byte> message) -> void;
+    auto receive(HaloSide side, std::span<std::byte> message) -> void;
+
+    auto rank() const -> std::size_t;
+    auto rankCount() const -> std::size_t;
+
+private:
+    std::size_t rank_;
+    std::size_t rankCount_;
+    std::array<SharedMemoryRing, 2> outgoing_;
+    std::array<SharedMemoryRing, 2> incoming_;
+};
+
+#include "HaloTransport.tpp"
+
+#endif // HALO_TRANSPORT_HPP
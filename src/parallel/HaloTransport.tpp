@@ -0,0 +1,131 @@
+#ifndef HALO_TRANSPORT_TPP
+#define HALO_TRANSPORT_TPP
+
+/**
+ * @file HaloTransport.tpp
+ * @brief Implementation of SharedMemoryTransport, which passes halo messages between the
+ * subdomains of a decomposed lattice through POSIX shared memory.
+ */
+
+;
+#include "HaloTransport.hpp"
+
+#include <stdexcept>
+
+/**
+ * @brief Constructor for SharedMemoryTransport that opens the rings of a rank.
+ *
+ * @param prefix The name prefix the rings were created with, starting with a slash.
+ * @param rank The index of the rank in the chain.
+ * @param rankCount The number of ranks in the chain.
+ * @throws std::invalid_argument If the rank is not below the number of ranks.
+ * @throws std::system_error If a ring does not exist or cannot be mapped.
+ */
+inline SharedMemoryTransport::SharedMemoryTransport(
+    const std::string& prefix,
+    std::size_t rank,
+    std::size_t rankCount
+)
+    : rank_{rank < rankCount ? rank : throw std::invalid_argument{"rank out of range"}},
+      rankCount_{rankCount},
+      outgoing_{
+          SharedMemoryRing{ringName(prefix, rank, HaloSide::Lower)},
+          SharedMemoryRing{ringName(prefix, rank, HaloSide::Upper)}
+      },
+      incoming_{
+          SharedMemoryRing{ringName(prefix, (rank + rankCount - 1) % rankCount, HaloSide::Upper)},
+          SharedMemoryRing{ringName(prefix, (rank + 1) % rankCount, HaloSide::Lower)}
+      }
+{
+}
+
+/**
+ * @brief Creates the rings of all ranks of a chain.
+ *
+ * @param prefix The name prefix of the rings, starting with a slash and unique on the machine.
+ * @param rankCount The number of ranks in the chain.
+ * @param capacity The capacity in bytes of every ring, which must hold the halo messages that one
+ * rank can send ahead of its neighbor.
+ * @return The rings, which remove their names when destroyed.
+ * @throws std::system_error If a ring exists already or cannot be created.
+ */
+inline auto SharedMemoryTransport::createRings(
+    const std::string& prefix,
+    std::size_t rankCount,
+    std::size_t capacity
+) -> std::vector<SharedMemoryRing>
+{
+    std::vector<SharedMemoryRing> rings;
+    rings.reserve(2 * rankCount);
+
+    for (std::size_t rank = 0; rank < rankCount; ++rank)
+    {
+        rings.emplace_back(ringName(prefix, rank, HaloSide::Lower), capacity);
+        rings.emplace_back(ringName(prefix, rank, HaloSide::Upper), capacity);
+    }
+
+    return rings;
+}
+
+/**
+ * @brief Returns the name of the ring that a rank sends into towards one side.
+ *
+ * @param prefix The name prefix of the rings.
+ * @param rank The index of the sending rank.
+ * @param side The side of the receiving neighbor.
+ * @return The name of the shared memory object of the ring.
+ */
+inline auto SharedMemoryTransport::ringName(
+    const std::string& prefix,
+    std::size_t rank,
+    HaloSide side
+) -> std::string
+{
+    return prefix + "." + std::to_string(rank) + (side == HaloSide::Lower ? ".lower" : ".upper");
+}
+
+/**
+ * @brief Passes a message to the neighbor on a side, waiting only while its ring is full.
+ *
+ * @param side The side of the receiving neighbor.
+ * @param message The bytes of the message.
+ * @throws std::invalid_argument If the message is larger than the capacity of the ring.
+ */
+inline auto SharedMemoryTransport::send(HaloSide side, std::span<const std::byte> message) -> void
+{
+    outgoing_[static_cast<std::size_t>(side)].send(message);
+}
+
+/**
+ * @brief Waits for the next message from the neighbor on a side.
+ *
+ * @param side The side of the sending neighbor.
+ * @param message The storage for the bytes of the message.
+ * @throws std::invalid_argument If the message is larger than the capacity of the ring.
+ */
+inline auto SharedMemoryTransport::receive(HaloSide side, std::span<std::byte> message) -> void
+{
+    incoming_[static_cast<std::size_t>(side)].receive(message);
+}
+
+/**
+ * @brief Returns the index of the rank in the chain.
+ *
+ * @return The rank.
+ */
+inline auto SharedMemoryTransport::rank() const -> std::size_t
+{
+    return rank_;
+}
+
+/**
+ * @brief Returns the number of ranks in the chain.
+ *
+ * @return The number of ranks.
+ */
+inline auto SharedMemoryTransport::rankCount() const -> std::size_t
+{
+    return rankCount_;
+}
+
+#endif // HALO_TRANSPORT_TPP
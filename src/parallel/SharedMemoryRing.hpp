@@ -0,0 +1,65 @@
+#ifndef SHARED_MEMORY_RING_HPP
+#define SHARED_MEMORY_RING_HPP
+
+/**
+ * @file SharedMemoryRing.hpp
+ * @brief Declaration of the SharedMemoryRing class, a single-producer single-consumer byte ring
+ * buffer in POSIX shared memory.
+ */
+
+#include "../lattice/AlignedAllocator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+/**
+ * @class SharedMemoryRing
+ * @brief A byte ring buffer in a named POSIX shared memory object that one producer and one
+ * consumer, in the same or in different processes, use to pass messages.
+ *
+ * The head and tail counters live on separate cache lines at the start of the object and are
+ * accessed atomically, so no lock or system call is involved once the ring is mapped. A zero-filled
+ * object is an empty ring. The object that creates the shared memory object removes its name on
+ * destruction, while objects that open an existing name only unmap it. Messages must be received
+ * in the order and with the sizes they were sent in.
+ */
+class SharedMemoryRing
+{
+public:
+    SharedMemoryRing(const std::string& name, std::size_t capacity);
+    explicit SharedMemoryRing(const std::string& name);
+    SharedMemoryRing(const SharedMemoryRing& other) = delete;
+    SharedMemoryRing(SharedMemoryRing&& other) noexcept;
+    ~SharedMemoryRing();
+
+    auto operator=(const SharedMemoryRing& other) -> SharedMemoryRing& = delete;
+    auto operator=(SharedMemoryRing&& other) noexcept -> SharedMemoryRing&;
+
+    auto send(std::span<const std::byte> message) -> void;
+    auto receive(std::span<std::byte> message) -> void;
+
+    auto name() const -> const std::string&;
+    auto capacity() const -> std::size_t;
+
+private:
+    struct Header
+    {
+        alignas(CACHE_LINE_SIZE) std::uint64_t head;
+        alignas(CACHE_LINE_SIZE) std::uint64_t tail;
+    };
+
+    auto map(int descriptor, std::size_t size) -> void;
+    auto release() noexcept -> void;
+
+    std::string name_;
+    Header* header_{nullptr};
+    std::byte* data_{nullptr};
+    std::size_t capacity_{0};
+    bool owner_{false};
+};
+
+#include "SharedMemoryRing.tpp"
+
+#endif // SHARED_MEMORY_RING_HPP
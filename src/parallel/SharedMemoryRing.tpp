@@ -0,0 +1,287 @@
+#ifndef SHARED_MEMORY_RING_TPP
+#define SHARED_MEMORY_RING_TPP
+
+/**
+ * @file SharedMemoryRing.tpp
+ * @brief Implementation of the SharedMemoryRing class, a single-producer single-consumer byte ring
+ * buffer in POSIX shared memory.
+ */
+
+;
+#include "SharedMemoryRing.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief The number of times a blocked ring end polls before it starts yielding its processor.
+ */
+constexpr std::size_t RING_SPIN_COUNT{4096};
+
+/**
+ * @brief Constructor for SharedMemoryRing that creates a new shared memory object.
+ *
+ * @param name The name of the shared memory object, starting with a slash.
+ * @param capacity The number of bytes that can be in flight at once.
+ * @throws std::invalid_argument If the capacity is zero.
+ * @throws std::system_error If the object exists already or cannot be created or mapped.
+ */
+inline SharedMemoryRing::SharedMemoryRing(const std::string& name, std::size_t capacity)
+    : name_{name},
+      owner_{true}
+{
+    if (capacity == 0)
+    {
+        throw std::invalid_argument{"ring capacity must be positive"};
+    }
+
+    const int descriptor{::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600)};
+    if (descriptor < 0)
+    {
+        throw std::system_error{errno, std::generic_category(), "cannot create ring " + name};
+    }
+
+    const std::size_t size{sizeof(Header) + capacity};
+    if (::ftruncate(descriptor, static_cast<off_t>(size)) != 0)
+    {
+        const int error{errno};
+        ::close(descriptor);
+        ::shm_unlink(name.c_str());
+        throw std::system_error{error, std::generic_category(), "cannot size ring " + name};
+    }
+
+    try
+    {
+        map(descriptor, size);
+    }
+    catch (...)
+    {
+        ::shm_unlink(name.c_str());
+        throw;
+    }
+    capacity_ = capacity;
+}
+
+/**
+ * @brief Constructor for SharedMemoryRing that opens a shared memory object created by another
+ * SharedMemoryRing.
+ *
+ * @param name The name of the shared memory object, starting with a slash.
+ * @throws std::system_error If the object does not exist or cannot be mapped.
+ * @throws std::runtime_error If the object is too small to be a ring.
+ */
+inline SharedMemoryRing::SharedMemoryRing(const std::string& name) : name_{name}
+{
+    const int descriptor{::shm_open(name.c_str(), O_RDWR, 0)};
+    if (descriptor < 0)
+    {
+        throw std::system_error{errno, std::generic_category(), "cannot open ring " + name};
+    }
+
+    struct stat status{};
+    if (::fstat(descriptor, &status) != 0)
+    {
+        const int error{errno};
+        ::close(descriptor);
+        throw std::system_error{error, std::generic_category(), "cannot inspect ring " + name};
+    }
+    if (static_cast<std::size_t>(status.st_size) <= sizeof(Header))
+    {
+        ::close(descriptor);
+        throw std::runtime_error{name + " is not a ring"};
+    }
+
+    map(descriptor, static_cast<std::size_t>(status.st_size));
+    capacity_ = static_cast<std::size_t>(status.st_size) - sizeof(Header);
+}
+
+/**
+ * @brief Move constructor for SharedMemoryRing that takes over the mapping of another object.
+ *
+ * @param other The ring to move from, which no longer owns a mapping afterwards.
+ */
+inline SharedMemoryRing::SharedMemoryRing(SharedMemoryRing&& other) noexcept
+    : name_{std::move(other.name_)},
+      header_{std::exchange(other.header_, nullptr)},
+      data_{std::exchange(other.data_, nullptr)},
+      capacity_{std::exchange(other.capacity_, 0)},
+      owner_{std::exchange(other.owner_, false)}
+{
+}
+
+/**
+ * @brief Destructor for SharedMemoryRing that unmaps the ring and, if this object created it,
+ * removes its name.
+ */
+inline SharedMemoryRing::~SharedMemoryRing()
+{
+    release();
+}
+
+/**
+ * @brief Move assignment for SharedMemoryRing that releases the own mapping and takes over the
+ * mapping of another object.
+ *
+ * @param other The ring to move from, which no longer owns a mapping afterwards.
+ * @return A reference to this ring.
+ */
+inline auto SharedMemoryRing::operator=(SharedMemoryRing&& other) noexcept -> SharedMemoryRing&
+{
+    if (this != &other)
+    {
+        release();
+        name_ = std::move(other.name_);
+        header_ = std::exchange(other.header_, nullptr);
+        data_ = std::exchange(other.data_, nullptr);
+        capacity_ = std::exchange(other.capacity_, 0);
+        owner_ = std::exchange(other.owner_, false);
+    }
+
+    return *this;
+}
+
+/**
+ * @brief Appends a message to the ring, waiting while the ring lacks the space for it.
+ *
+ * Must only be called by the single producer of the ring.
+ *
+ * @param message The bytes of the message.
+ * @throws std::invalid_argument If the message is larger than the capacity of the ring.
+ */
+inline auto SharedMemoryRing::send(std::span<const std::byte> message) -> void
+{
+    if (message.size() > capacity_)
+    {
+        throw std::invalid_argument{"message does not fit into ring " + name_};
+    }
+
+    const std::uint64_t head{std::atomic_ref<std::uint64_t>{header_->head}.load(
+        std::memory_order_relaxed
+    )};
+    const std::atomic_ref<std::uint64_t> tail{header_->tail};
+    for (std::size_t spin = 0; head - tail.load(std::memory_order_acquire) >
+                               capacity_ - message.size();
+         ++spin)
+    {
+        if (spin >= RING_SPIN_COUNT)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    const std::size_t offset{head % capacity_};
+    const std::size_t first{std::min(message.size(), capacity_ - offset)};
+    std::memcpy(data_ + offset, message.data(), first);
+    std::memcpy(data_, message.data() + first, message.size() - first);
+    std::atomic_ref<std::uint64_t>{header_->head}.store(
+        head + message.size(), std::memory_order_release
+    );
+}
+
+/**
+ * @brief Removes a message from the ring, waiting until all of its bytes have been sent.
+ *
+ * Must only be called by the single consumer of the ring.
+ *
+ * @param message The storage for the bytes of the message, whose size is the size of the message.
+ * @throws std::invalid_argument If the message is larger than the capacity of the ring.
+ */
+inline auto SharedMemoryRing::receive(std::span<std::byte> message) -> void
+{
+    if (message.size() > capacity_)
+    {
+        throw std::invalid_argument{"message does not fit into ring " + name_};
+    }
+
+    const std::uint64_t tail{std::atomic_ref<std::uint64_t>{header_->tail}.load(
+        std::memory_order_relaxed
+    )};
+    const std::atomic_ref<std::uint64_t> head{header_->head};
+    for (std::size_t spin = 0; head.load(std::memory_order_acquire) - tail < message.size(); ++spin)
+    {
+        if (spin >= RING_SPIN_COUNT)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    const std::size_t offset{tail % capacity_};
+    const std::size_t first{std::min(message.size(), capacity_ - offset)};
+    std::memcpy(message.data(), data_ + offset, first);
+    std::memcpy(message.data() + first, data_, message.size() - first);
+    std::atomic_ref<std::uint64_t>{header_->tail}.store(
+        tail + message.size(), std::memory_order_release
+    );
+}
+
+/**
+ * @brief Returns the name of the shared memory object.
+ *
+ * @return Const reference to the name.
+ */
+inline auto SharedMemoryRing::name() const -> const std::string&
+{
+    return name_;
+}
+
+/**
+ * @brief Returns the number of bytes that can be in flight at once.
+ *
+ * @return The capacity of the ring.
+ */
+inline auto SharedMemoryRing::capacity() const -> std::size_t
+{
+    return capacity_;
+}
+
+/**
+ * @brief Maps a shared memory object and closes its descriptor.
+ *
+ * @param descriptor The open descriptor of the shared memory object.
+ * @param size The size in bytes of the shared memory object.
+ * @throws std::system_error If the object cannot be mapped.
+ */
+inline auto SharedMemoryRing::map(int descriptor, std::size_t size) -> void
+{
+    void* mapping{::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0)};
+    const int error{errno};
+    ::close(descriptor);
+    if (mapping == MAP_FAILED)
+    {
+        throw std::system_error{error, std::generic_category(), "cannot map ring " + name_};
+    }
+
+    header_ = static_cast<Header*>(mapping);
+    data_ = static_cast<std::byte*>(mapping) + sizeof(Header);
+}
+
+/**
+ * @brief Unmaps the ring and, if this object created it, removes its name.
+ */
+inline auto SharedMemoryRing::release() noexcept -> void
+{
+    if (header_ != nullptr)
+    {
+        ::munmap(header_, sizeof(Header) + capacity_);
+        header_ = nullptr;
+        data_ = nullptr;
+    }
+    if (owner_)
+    {
+        ::shm_unlink(name_.c_str());
+        owner_ = false;
+    }
+}
+
+#endif // SHARED_MEMORY_RING_TPP
@@ -0,0 +1,102 @@
+#ifndef SUBDOMAIN_HPP
+#define SUBDOMAIN_HPP
+
+/**
+ * @file Subdomain.hpp
+ * @brief Declaration of the Subdomain class template, one slab of a lattice that is decomposed
+ * along its last axis and advanced with the AA pattern while halos are exchanged.
+ */
+
+#include "../instrumentation/PhaseRecorder.hpp"
+#include "../lattice/AlignedAllocator.hpp"
+#include "../lattice/Lattice.hpp"
+#include "../lattice/Tiling.hpp"
+#include "HaloTransport.hpp"
+
+#include <array>
+#include <vector>
+
+/**
+ * @class Subdomain
+ * @brief A class template representing the slab of a periodic lattice that one rank owns, stored
+ * in a Lattice with one ghost layer below and above it.
+ *
+ * With the AA pattern, even time steps only touch the own populations of each node, so the ranks
+ * only exchange data around odd time steps. Before an odd time step a rank sends the populations
+ * that its boundary layers stored for its neighbors, and after it the populations that its
+ * boundary layers streamed into its ghost layers. Only populations whose lattice vector crosses the
+ * slab boundary are sent. In both kinds of time steps the inner layers are updated while messages
+ * are in flight, and the boundary layers once they have arrived. All other axes are periodic within
+ * the slab, and lattice velocity components must lie in {-1, 0, 1}. The populations and the halo
+ * buffer are drawn from the same memory resource.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+class Subdomain
+{
+public:
+    Subdomain(
+        const std::array<std::size_t, Dimension>& extents,
+        const std::array<std::array<int, Dimension>, Size>& velocities,
+        const std::array<std::size_t, Size>& opposites,
+        std::size_t rank,
+        std::size_t rankCount,
+        Transport& transport,
+        std::pmr::memory_resource* resource = nullptr
+    );
+
+    template <typename Collision>
+    auto step(std::size_t timeStep, Collision collision) -> void;
+    auto synchronize() -> void;
+
+    auto node(const std::array<std::size_t, Dimension>& coordinates) const
+        -> DensityDistribution<Dimension, Size, Scalar>;
+    auto setNode(
+        const std::array<std::size_t, Dimension>& coordinates,
+        const DensityDistribution<Dimension, Size, Scalar>& distribution
+    ) -> void;
+    auto owns(const std::array<std::size_t, Dimension>& coordinates) const -> bool;
+
+    auto lattice() -> Lattice<Dimension, Size, Scalar>&;
+    auto lattice() const -> const Lattice<Dimension, Size, Scalar>&;
+    auto extents() const -> const std::array<std::size_t, Dimension>&;
+    auto firstLayer() const -> std::size_t;
+    auto layerCount() const -> std::size_t;
+    auto messageBytes() const -> std::size_t;
+
+private:
+    static auto partition(std::size_t layers, std::size_t rank, std::size_t rankCount)
+        -> std::array<std::size_t, 2>;
+
+    auto localIndex(const std::array<std::size_t, Dimension>& coordinates) const -> std::size_t;
+    auto layerTile(std::size_t begin, std::size_t end) const -> LatticeTile<Dimension>;
+    auto sendLayer(HaloSide side, std::size_t layer, const std::vector<std::size_t>& directions)
+        -> void;
+    auto receiveLayer(HaloSide side, std::size_t layer, const std::vector<std::size_t>& directions)
+        -> void;
+
+    std::array<std::size_t, Dimension> extents_;
+    std::array<std::array<int, Dimension>, Size> velocities_;
+    std::array<std::size_t, Size> opposites_;
+    std::size_t firstLayer_;
+    std::size_t layerCount_;
+    std::size_t layerNodeCount_;
+    std::vector<std::size_t> upward_;
+    std::vector<std::size_t> downward_;
+    std::vector<Scalar, AlignedAllocator<Scalar>> buffer_;
+    Lattice<Dimension, Size, Scalar> lattice_;
+    Transport& transport_;
+    bool pending_{false};
+};
+
+#include "Subdomain.tpp"
+
+#endif // SUBDOMAIN_HPP
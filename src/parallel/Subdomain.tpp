@@ -0,0 +1,558 @@
+#ifndef SUBDOMAIN_TPP
+#define SUBDOMAIN_TPP
+
+/**
+ * @file Subdomain.tpp
+ * @brief Implementation of the Subdomain class template, one slab of a lattice that is decomposed
+ * along its last axis and advanced with the AA pattern while halos are exchanged.
+ */
+
+;
+#include "Subdomain.hpp"
+
+#include "../streaming/aaPattern.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Constructor for Subdomain with the global lattice, the lattice model and the rank.
+ *
+ * The layers along the last axis are split as evenly as possible, with the lower ranks getting
+ * one more layer if they do not divide evenly. All populations are initialized with zeros.
+ *
+ * @param extents The number of lattice nodes of the whole lattice along each spatial dimension.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param rank The index of the slab, counted from the lowest layers.
+ * @param rankCount The number of slabs.
+ * @param transport The channel to the ranks that own the neighboring slabs, which must outlive
+ * the subdomain.
+ * @param resource The memory resource of the populations and the halo buffer, or nullptr for the
+ * heap.
+ * @throws std::invalid_argument If the rank is not below the number of ranks or if the slab would
+ * have less than two layers.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+Subdomain<Dimension, Size, Scalar, Transport>::Subdomain(
+    const std::array<std::size_t, Dimension>& extents,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t rank,
+    std::size_t rankCount,
+    Transport& transport,
+    std::pmr::memory_resource* resource
+)
+    : extents_{extents},
+      velocities_{velocities},
+      opposites_{opposites},
+      firstLayer_{partition(extents[Dimension - 1], rank, rankCount)[0]},
+      layerCount_{partition(extents[Dimension - 1], rank, rankCount)[1]},
+      layerNodeCount_{std::accumulate(
+          extents.begin(), extents.end() - 1, std::size_t{1}, std::multiplies<std::size_t>{}
+      )},
+      buffer_{AlignedAllocator<Scalar>{resource}},
+      lattice_{[&] {
+          std::array<std::size_t, Dimension> localExtents{extents};
+          localExtents[Dimension - 1] = layerCount_ + 2;
+          return localExtents;
+      }(), resource},
+      transport_{transport}
+{
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        if (velocities_[i][Dimension - 1] > 0)
+        {
+            upward_.push_back(i);
+        }
+        else if (velocities_[i][Dimension - 1] < 0)
+        {
+            downward_.push_back(i);
+        }
+    }
+
+    buffer_.resize(std::max(upward_.size(), downward_.size()) * layerNodeCount_);
+}
+
+/**
+ * @brief Performs one fused collide-and-stream time step of the AA pattern on the slab and
+ * exchanges the halos it needs with the neighboring ranks.
+ *
+ * All ranks must perform the same sequence of time steps. After an odd time step the populations
+ * of the boundary layers are only complete once the next time step or synchronize has received
+ * them.
+ *
+ * @param timeStep The index of the time step, whose parity selects the kind of access.
+ * @param collision A callable that updates the populations of one node, passed as an array of Size
+ * scalar values in lattice vector order.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ * @tparam Collision The type of the collision callable.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+template <typename Collision>
+auto Subdomain<Dimension, Size, Scalar, Transport>::step(std::size_t timeStep, Collision collision)
+    -> void
+{
+    const std::size_t ghostLayer{layerCount_ + 1};
+    const auto update{[&](std::size_t begin, std::size_t end) {
+        if (begin < end)
+        {
+            streamAA(lattice_, velocities_, opposites_, timeStep, collision, layerTile(begin, end));
+        }
+    }};
+
+    if (timeStep % 2 == 0)
+    {
+        update(2, layerCount_);
+        synchronize();
+        update(1, 2);
+        update(layerCount_, ghostLayer);
+        return;
+    }
+
+    synchronize();
+    sendLayer(HaloSide::Upper, layerCount_, downward_);
+    sendLayer(HaloSide::Lower, 1, upward_);
+    update(2, layerCount_);
+    receiveLayer(HaloSide::Lower, 0, downward_);
+    receiveLayer(HaloSide::Upper, ghostLayer, upward_);
+    update(1, 2);
+    update(layerCount_, ghostLayer);
+    sendLayer(HaloSide::Lower, 0, downward_);
+    sendLayer(HaloSide::Upper, ghostLayer, upward_);
+    pending_ = true;
+}
+
+/**
+ * @brief Receives the populations that the neighboring ranks streamed into the boundary layers
+ * during the last odd time step, if that has not happened yet.
+ *
+ * Must be called by every rank before the populations of an odd number of completed steps plus
+ * one are read, such as before node or before writing a checkpoint.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::synchronize() -> void
+{
+    if (!pending_)
+    {
+        return;
+    }
+
+    receiveLayer(HaloSide::Upper, layerCount_, downward_);
+    receiveLayer(HaloSide::Lower, 1, upward_);
+    pending_ = false;
+}
+
+/**
+ * @brief Gathers the density distribution at an owned node of the whole lattice.
+ *
+ * Only valid after an even number of time steps and synchronize.
+ *
+ * @param coordinates The integer coordinates of the node in the whole lattice.
+ * @return A copy of the density distribution at the node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::node(
+    const std::array<std::size_t, Dimension>& coordinates
+) const -> DensityDistribution<Dimension, Size, Scalar>
+{
+    return lattice_.node(localIndex(coordinates));
+}
+
+/**
+ * @brief Scatters a density distribution to an owned node of the whole lattice.
+ *
+ * @param coordinates The integer coordinates of the node in the whole lattice.
+ * @param distribution The density distribution to store at the node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::setNode(
+    const std::array<std::size_t, Dimension>& coordinates,
+    const DensityDistribution<Dimension, Size, Scalar>& distribution
+) -> void
+{
+    lattice_.setNode(localIndex(coordinates), distribution);
+}
+
+/**
+ * @brief Checks whether a node of the whole lattice lies in the slab.
+ *
+ * @param coordinates The integer coordinates of the node in the whole lattice.
+ * @return Whether the slab owns the node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::owns(
+    const std::array<std::size_t, Dimension>& coordinates
+) const -> bool
+{
+    return coordinates[Dimension - 1] >= firstLayer_ &&
+           coordinates[Dimension - 1] < firstLayer_ + layerCount_;
+}
+
+/**
+ * @brief Returns the lattice of the slab and its ghost layers for non-const Subdomain objects.
+ *
+ * @return Reference to the lattice, whose layer l along the last axis is layer firstLayer() + l - 1
+ * of the whole lattice.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::lattice() -> Lattice<Dimension, Size, Scalar>&
+{
+    return lattice_;
+}
+
+/**
+ * @brief Returns the lattice of the slab and its ghost layers for const Subdomain objects.
+ *
+ * @return Const reference to the lattice, whose layer l along the last axis is layer
+ * firstLayer() + l - 1 of the whole lattice.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::lattice() const
+    -> const Lattice<Dimension, Size, Scalar>&
+{
+    return lattice_;
+}
+
+/**
+ * @brief Returns the number of nodes of the whole lattice along each spatial dimension.
+ *
+ * @return Const reference to the extents of the whole lattice.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::extents() const
+    -> const std::array<std::size_t, Dimension>&
+{
+    return extents_;
+}
+
+/**
+ * @brief Returns the first layer of the slab along the last axis.
+ *
+ * @return The coordinate of the lowest owned layer in the whole lattice.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::firstLayer() const -> std::size_t
+{
+    return firstLayer_;
+}
+
+/**
+ * @brief Returns the number of layers of the slab along the last axis.
+ *
+ * @return The number of owned layers.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::layerCount() const -> std::size_t
+{
+    return layerCount_;
+}
+
+/**
+ * @brief Returns the size of the largest halo message the slab sends.
+ *
+ * An odd time step sends two messages to each neighbor, and a rank can run at most one odd time
+ * step ahead of its neighbors, so rings of four times this size never block a sender.
+ *
+ * @return The size in bytes of the largest halo message.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::messageBytes() const -> std::size_t
+{
+    return buffer_.size() * sizeof(Scalar);
+}
+
+/**
+ * @brief Splits the layers of the whole lattice among the ranks.
+ *
+ * @param layers The number of layers of the whole lattice along the last axis.
+ * @param rank The index of the slab.
+ * @param rankCount The number of slabs.
+ * @return The first layer and the number of layers of the slab.
+ * @throws std::invalid_argument If the rank is not below the number of ranks or if the slab would
+ * have less than two layers.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::partition(
+    std::size_t layers,
+    std::size_t rank,
+    std::size_t rankCount
+) -> std::array<std::size_t, 2>
+{
+    if (rank >= rankCount)
+    {
+        throw std::invalid_argument{"rank out of range"};
+    }
+
+    const std::size_t base{layers / rankCount};
+    const std::size_t remainder{layers % rankCount};
+    const std::size_t count{base + (rank < remainder ? 1 : 0)};
+    if (count < 2)
+    {
+        throw std::invalid_argument{"every slab needs at least two layers"};
+    }
+
+    return {rank * base + std::min(rank, remainder), count};
+}
+
+/**
+ * @brief Converts the coordinates of an owned node of the whole lattice to its index in the
+ * lattice of the slab.
+ *
+ * @param coordinates The integer coordinates of the node in the whole lattice.
+ * @return The linear index of the node in the lattice of the slab.
+ * @throws std::out_of_range If the slab does not own the node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::localIndex(
+    const std::array<std::size_t, Dimension>& coordinates
+) const -> std::size_t
+{
+    if (!owns(coordinates))
+    {
+        throw std::out_of_range{"node is not owned by this subdomain"};
+    }
+
+    std::array<std::size_t, Dimension> localCoordinates{coordinates};
+    localCoordinates[Dimension - 1] = coordinates[Dimension - 1] - firstLayer_ + 1;
+    return lattice_.linearIndex(localCoordinates);
+}
+
+/**
+ * @brief Returns the tile of a range of layers of the lattice of the slab.
+ *
+ * @param begin The first layer of the tile.
+ * @param end The layer after the last layer of the tile.
+ * @return The tile that spans all other axes completely.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::layerTile(
+    std::size_t begin,
+    std::size_t end
+) const -> LatticeTile<Dimension>
+{
+    LatticeTile<Dimension> tile;
+    tile.begin.fill(0);
+    tile.end = lattice_.extents();
+    tile.begin[Dimension - 1] = begin;
+    tile.end[Dimension - 1] = end;
+
+    return tile;
+}
+
+/**
+ * @brief Packs populations of one layer and sends them to a neighbor.
+ *
+ * @param side The side of the receiving neighbor.
+ * @param layer The layer of the lattice of the slab.
+ * @param directions The lattice vectors whose populations are sent.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::sendLayer(
+    HaloSide side,
+    std::size_t layer,
+    const std::vector<std::size_t>& directions
+) -> void
+{
+    const ScopedPhase phase{Phase::Communication, layerNodeCount_};
+
+    for (std::size_t k = 0; k < directions.size(); ++k)
+    {
+        const auto source{
+            std::as_const(lattice_).population(directions[k]).subspan(
+                layer * layerNodeCount_, layerNodeCount_
+            )
+        };
+        std::ranges::copy(source, buffer_.begin() + k * layerNodeCount_);
+    }
+
+    transport_.send(
+        side, std::as_bytes(std::span{buffer_}.first(directions.size() * layerNodeCount_))
+    );
+}
+
+/**
+ * @brief Receives populations of one layer from a neighbor and unpacks them.
+ *
+ * @param side The side of the sending neighbor.
+ * @param layer The layer of the lattice of the slab.
+ * @param directions The lattice vectors whose populations are received.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Transport The type of the channel to the neighboring ranks.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    HaloTransport Transport>
+auto Subdomain<Dimension, Size, Scalar, Transport>::receiveLayer(
+    HaloSide side,
+    std::size_t layer,
+    const std::vector<std::size_t>& directions
+) -> void
+{
+    const ScopedPhase phase{Phase::Communication, layerNodeCount_};
+
+    transport_.receive(
+        side, std::as_writable_bytes(std::span{buffer_}.first(directions.size() * layerNodeCount_))
+    );
+
+    for (std::size_t k = 0; k < directions.size(); ++k)
+    {
+        const auto source{std::span{buffer_}.subspan(k * layerNodeCount_, layerNodeCount_)};
+        std::ranges::copy(
+            source, lattice_.population(directions[k]).begin() + layer * layerNodeCount_
+        );
+    }
+}
+
+#endif // SUBDOMAIN_TPP
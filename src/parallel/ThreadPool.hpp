@@ -0,0 +1,120 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+/**
+ * @file ThreadPool.hpp
+ * @brief Declaration of the ThreadPool class that runs batches of indexed tasks on a fixed set of
+ * worker threads with work stealing.
+ */
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+/**
+ * @enum ThreadPinning
+ * @brief The threads of a ThreadPool that are bound to CPUs.
+ */
+enum class ThreadPinning
+{
+    None,
+    Workers,
+    WorkersAndCaller
+};
+
+/**
+ * @class ThreadPool
+ * @brief A fixed set of worker threads that run batches of indexed tasks.
+ *
+ * The calling thread takes part in every batch as worker zero, so a pool with one thread runs all
+ * tasks inline. The tasks of a batch are dealt out in contiguous blocks, worker w receiving the
+ * w-th block, so the same task index is given to the same worker in every batch. A worker that
+ * runs out of tasks steals from the back of the other queues unless stealing is disabled for the
+ * batch. The worker threads can be pinned to the CPUs that the process may run on so that
+ * first-touch page placement stays valid, and pools that exist at the same time receive different
+ * CPUs as long as there are enough of them, in whatever order they are destroyed. Pinning the
+ * thread that constructs the pool as well must be requested explicitly. That thread must then also
+ * be the one that runs batches, and its previous CPU affinity is restored when the pool is
+ * destroyed. Pinning is best effort: a thread that cannot be bound keeps its affinity, which pinned
+ * reports.
+ */
+class ThreadPool
+{
+public:
+    explicit ThreadPool(
+        std::size_t threadCount = std::thread::hardware_concurrency(),
+        ThreadPinning pinning = ThreadPinning::Workers
+    );
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool(ThreadPool&& other) = delete;
+    ~ThreadPool();
+
+    auto operator=(const ThreadPool& other) -> ThreadPool& = delete;
+    auto operator=(ThreadPool&& other) -> ThreadPool& = delete;
+
+    auto run(
+        std::size_t taskCount,
+        const std::function<void(std::size_t)>& task,
+        bool stealing = true
+    ) -> void;
+
+    auto threadCount() const -> std::size_t;
+    auto owner(std::size_t task, std::size_t taskCount) const -> std::size_t;
+    auto pinned() const -> bool;
+
+private:
+    struct TaskQueue
+    {
+        std::mutex mutex;
+        std::deque<std::size_t> tasks;
+    };
+
+#ifdef __linux__
+    struct CpuReservations
+    {
+        std::mutex mutex;
+        std::map<int, std::size_t> users;
+    };
+#endif
+
+    auto workerLoop(std::size_t worker) -> void;
+    auto work(std::size_t worker) -> void;
+    auto nextTask(std::size_t worker, std::size_t& task) -> bool;
+#ifdef __linux__
+    auto pin(ThreadPinning pinning) -> void;
+
+    static auto cpuReservations() -> CpuReservations&;
+#endif
+
+    std::vector<TaskQueue> queues_;
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(std::size_t)>* task_{nullptr};
+    std::exception_ptr exception_;
+    std::size_t generation_{0};
+    std::size_t busyWorkers_{0};
+    bool stealing_{true};
+    bool stopping_{false};
+    bool pinned_{false};
+#ifdef __linux__
+    cpu_set_t callerCpus_{};
+    bool callerPinned_{false};
+    std::vector<int> reservedCpus_;
+#endif
+};
+
+#include "ThreadPool.tpp"
+
+#endif // THREAD_POOL_HPP
@@ -0,0 +1,347 @@
+#ifndef THREAD_POOL_TPP
+#define THREAD_POOL_TPP
+
+/**
+ * @file ThreadPool.tpp
+ * @brief Implementation of the ThreadPool class that runs batches of indexed tasks on a fixed set
+ * of worker threads with work stealing.
+ */
+
+;
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+/**
+ * @brief Constructor for ThreadPool with the number of threads.
+ *
+ * Starts threadCount - 1 worker threads, since the calling thread acts as worker zero.
+ *
+ * @param threadCount The number of threads that run tasks, at least one.
+ * @param pinning The threads that are bound to CPUs, which keeps first-touch page placement valid
+ * on NUMA systems. Every worker is bound to a CPU of the affinity mask of the calling thread that
+ * no other pinned pool holds, or to the least shared one once the mask is exhausted. Only supported
+ * on Linux and ignored elsewhere.
+ */
+inline ThreadPool::ThreadPool(std::size_t threadCount, ThreadPinning pinning)
+    : queues_(std::max(threadCount, std::size_t{1}))
+{
+    threads_.reserve(queues_.size() - 1);
+
+    for (std::size_t worker = 1; worker < queues_.size(); ++worker)
+    {
+        threads_.emplace_back([this, worker] { workerLoop(worker); });
+    }
+
+#ifdef __linux__
+    if (pinning != ThreadPinning::None)
+    {
+        pin(pinning);
+    }
+#else
+    static_cast<void>(pinning);
+#endif
+}
+
+/**
+ * @brief Destructor for ThreadPool.
+ *
+ * Stops and joins all worker threads, restores the CPU affinity of a pinned calling thread and
+ * releases the CPUs reserved by the pool. Must not be called while a batch is running.
+ */
+inline ThreadPool::~ThreadPool()
+{
+    {
+        const std::scoped_lock lock{mutex_};
+        stopping_ = true;
+    }
+    wake_.notify_all();
+
+    for (std::thread& thread : threads_)
+    {
+        thread.join();
+    }
+
+#ifdef __linux__
+    if (callerPinned_)
+    {
+        pthread_setaffinity_np(pthread_self(), sizeof(callerCpus_), &callerCpus_);
+    }
+    CpuReservations& reservations{cpuReservations()};
+    const std::scoped_lock lock{reservations.mutex};
+    for (const int cpu : reservedCpus_)
+    {
+        if (--reservations.users[cpu] == 0)
+        {
+            reservations.users.erase(cpu);
+        }
+    }
+#endif
+}
+
+/**
+ * @brief Runs a batch of tasks and waits until all of them are finished.
+ *
+ * Tasks may run concurrently and in any order. If tasks throw, the remaining tasks still run and
+ * the first exception is rethrown to the caller.
+ *
+ * @param taskCount The number of tasks, which are identified by the indices 0 to taskCount - 1.
+ * @param task A callable invoked once with the index of each task.
+ * @param stealing Whether idle workers take tasks from other workers. Without stealing every task
+ * runs on the worker returned by owner.
+ */
+inline auto ThreadPool::run(
+    std::size_t taskCount,
+    const std::function<void(std::size_t)>& task,
+    bool stealing
+) -> void
+{
+    for (std::size_t index = 0; index < taskCount; ++index)
+    {
+        queues_[owner(index, taskCount)].tasks.push_back(index);
+    }
+
+    {
+        const std::scoped_lock lock{mutex_};
+        task_ = &task;
+        stealing_ = stealing;
+        exception_ = nullptr;
+        busyWorkers_ = threads_.size();
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    work(0);
+
+    std::unique_lock lock{mutex_};
+    done_.wait(lock, [this] { return busyWorkers_ == 0; });
+    task_ = nullptr;
+
+    if (exception_)
+    {
+        std::rethrow_exception(exception_);
+    }
+}
+
+/**
+ * @brief Returns the number of threads that run tasks, including the calling thread.
+ *
+ * @return The number of threads that run tasks.
+ */
+inline auto ThreadPool::threadCount() const -> std::size_t
+{
+    return queues_.size();
+}
+
+/**
+ * @brief Returns the worker that a task is dealt to.
+ *
+ * Tasks are dealt in contiguous blocks of nearly equal size, in the order of the workers.
+ *
+ * @param task The index of the task.
+ * @param taskCount The number of tasks in the batch.
+ * @return The index of the worker whose queue receives the task.
+ */
+inline auto ThreadPool::owner(std::size_t task, std::size_t taskCount) const -> std::size_t
+{
+    return task * queues_.size() / taskCount;
+}
+
+/**
+ * @brief Returns whether every thread that was to be pinned is bound to its CPU.
+ *
+ * @return Whether pinning was requested and succeeded for all requested threads.
+ */
+inline auto ThreadPool::pinned() const -> bool
+{
+    return pinned_;
+}
+
+/**
+ * @brief Waits for batches and works on them until the pool is stopped.
+ *
+ * @param worker The index of the worker run by the calling thread.
+ */
+inline auto ThreadPool::workerLoop(std::size_t worker) -> void
+{
+    std::size_t generation{0};
+
+    while (true)
+    {
+        {
+            std::unique_lock lock{mutex_};
+            wake_.wait(lock, [&] { return stopping_ || generation_ != generation; });
+            if (stopping_)
+            {
+                return;
+            }
+            generation = generation_;
+        }
+
+        work(worker);
+
+        bool last{false};
+        {
+            const std::scoped_lock lock{mutex_};
+            last = --busyWorkers_ == 0;
+        }
+        if (last)
+        {
+            done_.notify_one();
+        }
+    }
+}
+
+/**
+ * @brief Runs tasks of the current batch until no task is left for a worker.
+ *
+ * @param worker The index of the worker run by the calling thread.
+ */
+inline auto ThreadPool::work(std::size_t worker) -> void
+{
+    std::size_t task{0};
+
+    while (nextTask(worker, task))
+    {
+        try
+        {
+            (*task_)(task);
+        }
+        catch (...)
+        {
+            const std::scoped_lock lock{mutex_};
+            if (!exception_)
+            {
+                exception_ = std::current_exception();
+            }
+        }
+    }
+}
+
+/**
+ * @brief Takes the next task for a worker.
+ *
+ * A worker takes tasks from the front of its own queue first and then, if stealing is enabled,
+ * from the back of the queues of the other workers.
+ *
+ * @param worker The index of the worker.
+ * @param task Set to the index of the taken task.
+ * @return Whether a task was taken.
+ */
+inline auto ThreadPool::nextTask(std::size_t worker, std::size_t& task) -> bool
+{
+    {
+        TaskQueue& queue{queues_[worker]};
+        const std::scoped_lock lock{queue.mutex};
+        if (!queue.tasks.empty())
+        {
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+
+    if (!stealing_)
+    {
+        return false;
+    }
+
+    for (std::size_t offset = 1; offset < queues_.size(); ++offset)
+    {
+        TaskQueue& victim{queues_[(worker + offset) % queues_.size()]};
+        const std::scoped_lock lock{victim.mutex};
+        if (!victim.tasks.empty())
+        {
+            task = victim.tasks.back();
+            victim.tasks.pop_back();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+#ifdef __linux__
+/**
+ * @brief Binds the requested threads to the CPUs that the calling thread may run on.
+ *
+ * Reserves one CPU for every thread of the pool, the calling thread included. Each thread takes the
+ * allowed CPU with the fewest pools holding it, the first one on ties, so that concurrent pools do
+ * not share CPUs unless the affinity mask is exhausted. The pool gives back exactly these CPUs
+ * when it is destroyed.
+ *
+ * @param pinning The threads that are bound to CPUs.
+ */
+inline auto ThreadPool::pin(ThreadPinning pinning) -> void
+{
+    cpu_set_t allowed;
+    if (pthread_getaffinity_np(pthread_self(), sizeof(allowed), &allowed) != 0)
+    {
+        return;
+    }
+
+    std::vector<int> cpus;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+        if (CPU_ISSET(cpu, &allowed))
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    if (cpus.empty())
+    {
+        return;
+    }
+
+    {
+        CpuReservations& reservations{cpuReservations()};
+        const std::scoped_lock lock{reservations.mutex};
+        reservedCpus_.reserve(queues_.size());
+        for (std::size_t worker = 0; worker < queues_.size(); ++worker)
+        {
+            const int cpu{*std::ranges::min_element(cpus, {}, [&](int candidate) {
+                const auto users{reservations.users.find(candidate)};
+                return users == reservations.users.end() ? std::size_t{0} : users->second;
+            })};
+            ++reservations.users[cpu];
+            reservedCpus_.push_back(cpu);
+        }
+    }
+
+    const auto bindThread{[&](pthread_t thread, std::size_t worker) {
+        cpu_set_t cpu;
+        CPU_ZERO(&cpu);
+        CPU_SET(reservedCpus_[worker], &cpu);
+        return pthread_setaffinity_np(thread, sizeof(cpu), &cpu) == 0;
+    }};
+
+    pinned_ = true;
+    if (pinning == ThreadPinning::WorkersAndCaller)
+    {
+        callerCpus_ = allowed;
+        callerPinned_ = bindThread(pthread_self(), 0);
+        pinned_ = callerPinned_;
+    }
+    for (std::size_t worker = 1; worker < queues_.size(); ++worker)
+    {
+        pinned_ = bindThread(threads_[worker - 1].native_handle(), worker) && pinned_;
+    }
+}
+
+/**
+ * @brief Returns the CPUs reserved by the pinned pools of the process.
+ *
+ * @return Reference to the process-wide number of pools holding each reserved CPU.
+ */
+inline auto ThreadPool::cpuReservations() -> CpuReservations&
+{
+    static CpuReservations reservations;
+    return reservations;
+}
+#endif
+
+#endif // THREAD_POOL_TPP
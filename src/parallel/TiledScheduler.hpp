@@ -0,0 +1,55 @@
+#ifndef TILED_SCHEDULER_HPP
+#define TILED_SCHEDULER_HPP
+
+/**
+ * @file TiledScheduler.hpp
+ * @brief Declaration of the TiledScheduler class template that distributes the tiles of a lattice
+ * over a thread pool.
+ */
+
+#include "../lattice/Tiling.hpp"
+#include "ThreadPool.hpp"
+
+/**
+ * @class TiledScheduler
+ * @brief A class template that runs work on the tiles of a structured lattice in parallel.
+ *
+ * Every tile has an owning worker of the thread pool, and owners receive contiguous blocks of
+ * tiles. The first touch of a lattice runs every tile on its owner, so population pages are placed
+ * on the NUMA node of that worker. Kernels that rely on this placement, such as the AA time steps,
+ * use forEachOwnedTile to keep every tile on its owner, while forEachTile balances the load of
+ * placement-independent work by work stealing.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ */
+template <std::size_t Dimension>
+class TiledScheduler
+{
+public:
+    TiledScheduler(
+        const std::array<std::size_t, Dimension>& extents,
+        const std::array<std::size_t, Dimension>& tileExtents,
+        std::size_t threadCount = std::thread::hardware_concurrency(),
+        ThreadPinning pinning = ThreadPinning::Workers
+    );
+
+    template <typename Task>
+    auto forEachTile(Task task) -> void;
+    template <typename Task>
+    auto forEachOwnedTile(Task task) -> void;
+    template <typename Zero>
+    auto firstTouch(const Zero& zero) -> void;
+
+    auto extents() const -> const std::array<std::size_t, Dimension>&;
+    auto tiles() const -> const std::vector<LatticeTile<Dimension>>&;
+    auto threadCount() const -> std::size_t;
+
+private:
+    std::array<std::size_t, Dimension> extents_;
+    std::vector<LatticeTile<Dimension>> tiles_;
+    ThreadPool pool_;
+};
+
+#include "TiledScheduler.tpp"
+
+#endif // TILED_SCHEDULER_HPP
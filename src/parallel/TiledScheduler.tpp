@@ -0,0 +1,121 @@
+#ifndef TILED_SCHEDULER_TPP
+#define TILED_SCHEDULER_TPP
+
+/**
+ * @file TiledScheduler.tpp
+ * @brief Implementation of the TiledScheduler class template that distributes the tiles of a
+ * lattice over a thread pool.
+ */
+
+;
+#include "TiledScheduler.hpp"
+
+/**
+ * @brief Constructor for TiledScheduler with the lattice extents, tile extents and thread count.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param tileExtents The largest number of lattice nodes of a tile along each spatial dimension.
+ * @param threadCount The number of threads that work on tiles, including the calling thread.
+ * @param pinning The threads of the pool that are bound to CPUs. The tiles of worker zero stay on
+ * their NUMA node only if the calling thread is pinned as well or does not migrate.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ */
+template <std::size_t Dimension>
+TiledScheduler<Dimension>::TiledScheduler(
+    const std::array<std::size_t, Dimension>& extents,
+    const std::array<std::size_t, Dimension>& tileExtents,
+    std::size_t threadCount,
+    ThreadPinning pinning
+)
+    : extents_{extents}, tiles_{tileLattice(extents, tileExtents)}, pool_{threadCount, pinning}
+{
+}
+
+/**
+ * @brief Runs a task on every tile with work stealing and waits for all of them.
+ *
+ * @param task A callable invoked as task(tile) for every tile, possibly concurrently.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Task The type of the callable.
+ */
+template <std::size_t Dimension>
+template <typename Task>
+auto TiledScheduler<Dimension>::forEachTile(Task task) -> void
+{
+    pool_.run(tiles_.size(), [&](std::size_t index) { task(tiles_[index]); });
+}
+
+/**
+ * @brief Runs a task on every tile on the worker that owns the tile and waits for all of them.
+ *
+ * @param task A callable invoked as task(tile) for every tile, possibly concurrently.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Task The type of the callable.
+ */
+template <std::size_t Dimension>
+template <typename Task>
+auto TiledScheduler<Dimension>::forEachOwnedTile(Task task) -> void
+{
+    pool_.run(tiles_.size(), [&](std::size_t index) { task(tiles_[index]); }, false);
+}
+
+/**
+ * @brief Zeroes every row of every tile on the worker that owns the tile.
+ *
+ * Meant to be called from the first-touch constructor of Lattice.
+ *
+ * @param zero A callable invoked as zero(firstNode, lastNode) for every row of every tile.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Zero The type of the callable.
+ */
+template <std::size_t Dimension>
+template <typename Zero>
+auto TiledScheduler<Dimension>::firstTouch(const Zero& zero) -> void
+{
+    forEachOwnedTile([&](const LatticeTile<Dimension>& tile) { forEachRow(tile, extents_, zero); });
+}
+
+/**
+ * @brief Returns the number of lattice nodes along each spatial dimension.
+ *
+ * @return The number of lattice nodes along each spatial dimension.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ */
+template <std::size_t Dimension>
+auto TiledScheduler<Dimension>::extents() const -> const std::array<std::size_t, Dimension>&
+{
+    return extents_;
+}
+
+/**
+ * @brief Returns the tiles of the lattice.
+ *
+ * @return The tiles of the lattice, ordered with the first axis running fastest.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ */
+template <std::size_t Dimension>
+auto TiledScheduler<Dimension>::tiles() const -> const std::vector<LatticeTile<Dimension>>&
+{
+    return tiles_;
+}
+
+/**
+ * @brief Returns the number of threads that work on tiles.
+ *
+ * @return The number of threads that work on tiles, including the calling thread.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ */
+template <std::size_t Dimension>
+auto TiledScheduler<Dimension>::threadCount() const -> std::size_t
+{
+    return pool_.threadCount();
+}
+
+#endif // TILED_SCHEDULER_TPP
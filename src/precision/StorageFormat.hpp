@@ -0,0 +1,124 @@
+#ifndef PRECISION_STORAGE_FORMAT_HPP
+#define PRECISION_STORAGE_FORMAT_HPP
+
+/**
+ * @file StorageFormat.hpp
+ * @brief Declaration of compact storage formats for lattice populations and of the conversions
+ * between them and single precision.
+ *
+ * Lattice Boltzmann kernels are bound by memory bandwidth, so storing populations in fewer bytes
+ * than they are computed in raises the throughput of every time step. Populations are widened to
+ * the compute precision when they are loaded and narrowed again when they are stored, with
+ * rounding to nearest even in both 16-bit formats.
+ */
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+constexpr auto encodeFloat16(float value) -> std::uint16_t;
+
+constexpr auto decodeFloat16(std::uint16_t bits) -> float;
+
+auto encodeFloat16(std::span<const float> values, std::span<std::uint16_t> bits) -> void;
+
+auto decodeFloat16(std::span<const std::uint16_t> bits, std::span<float> values) -> void;
+
+constexpr auto encodeBFloat16(float value) -> std::uint16_t;
+
+constexpr auto decodeBFloat16(std::uint16_t bits) -> float;
+
+/**
+ * @brief Concept of a storage format for lattice populations.
+ *
+ * A storage format names the type of a stored population, converts single-precision values to and
+ * from it one at a time or in contiguous runs, and tells whether populations are stored as the
+ * deviation f - w from their lattice weight instead of as f. The deviation is much smaller than f
+ * near equilibrium, so a shifted format spends its significant bits on the part of f that changes.
+ * At low Mach numbers the unshifted 16-bit formats round away most of the velocity signal, and the
+ * shifted ones should be preferred.
+ *
+ * @tparam Format The type of the storage format.
+ */
+template <typename Format>
+concept StorageFormat = requires(
+    float value,
+    typename Format::Stored stored,
+    std::span<float> values,
+    std::span<typename Format::Stored> storedValues
+) {
+    { Format::encode(value) } -> std::same_as<typename Format::Stored>;
+    { Format::decode(stored) } -> std::same_as<float>;
+    Format::encode(std::span<const float>{values}, storedValues);
+    Format::decode(std::span<const typename Format::Stored>{storedValues}, values);
+    { Format::SHIFTED } -> std::convertible_to<bool>;
+};
+
+/**
+ * @brief IEEE 754 half precision with 11 significant bits and a range of about 6e-8 to 65504.
+ */
+struct Float16Storage
+{
+    using Stored = std::uint16_t;
+
+    static constexpr bool SHIFTED{false};
+
+    static constexpr auto encode(float value) -> Stored;
+    static constexpr auto decode(Stored stored) -> float;
+    static auto encode(std::span<const float> values, std::span<Stored> stored) -> void;
+    static auto decode(std::span<const Stored> stored, std::span<float> values) -> void;
+};
+
+/**
+ * @brief IEEE 754 half precision that stores the deviation f - w of each population.
+ */
+struct ShiftedFloat16Storage
+{
+    using Stored = std::uint16_t;
+
+    static constexpr bool SHIFTED{true};
+
+    static constexpr auto encode(float value) -> Stored;
+    static constexpr auto decode(Stored stored) -> float;
+    static auto encode(std::span<const float> values, std::span<Stored> stored) -> void;
+    static auto decode(std::span<const Stored> stored, std::span<float> values) -> void;
+};
+
+/**
+ * @brief Brain floating point with 8 significant bits and the exponent range of single precision.
+ */
+struct BFloat16Storage
+{
+    using Stored = std::uint16_t;
+
+    static constexpr bool SHIFTED{false};
+
+    static constexpr auto encode(float value) -> Stored;
+    static constexpr auto decode(Stored stored) -> float;
+    static auto encode(std::span<const float> values, std::span<Stored> stored) -> void;
+    static auto decode(std::span<const Stored> stored, std::span<float> values) -> void;
+};
+
+/**
+ * @brief Single precision that stores the deviation f - w of each population, for computing in
+ * double precision with half of the memory traffic.
+ */
+struct ShiftedFloat32Storage
+{
+    using Stored = float;
+
+    static constexpr bool SHIFTED{true};
+
+    static constexpr auto encode(float value) -> Stored;
+    static constexpr auto decode(Stored stored) -> float;
+    static auto encode(std::span<const float> values, std::span<Stored> stored) -> void;
+    static auto decode(std::span<const Stored> stored, std::span<float> values) -> void;
+};
+
+#include "StorageFormat.tpp"
+
+#endif // PRECISION_STORAGE_FORMAT_HPP
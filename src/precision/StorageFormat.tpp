@@ -0,0 +1,419 @@
+#ifndef PRECISION_STORAGE_FORMAT_TPP
+#define PRECISION_STORAGE_FORMAT_TPP
+
+/**
+ * @file StorageFormat.tpp
+ * @brief Implementation of compact storage formats for lattice populations and of the conversions
+ * between them and single precision.
+ */
+
+;
+#include "StorageFormat.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <type_traits>
+
+/**
+ * @brief Rounds a single-precision value to the nearest IEEE 754 half-precision value.
+ *
+ * Ties round to even, values beyond the largest finite half-precision value become infinities,
+ * values below the smallest normal one become subnormals, and NaNs stay quiet NaNs. If the compiler
+ * provides _Float16, run-time conversions use it and thus the conversion instructions of the
+ * target, while constant evaluation uses the portable bit manipulation below.
+ *
+ * @param value The single-precision value.
+ * @return The bit pattern of the half-precision value.
+ */
+constexpr auto encodeFloat16(float value) -> std::uint16_t
+{
+#ifdef __FLT16_MAX__
+    if (!std::is_constant_evaluated())
+    {
+        return std::bit_cast<std::uint16_t>(static_cast<_Float16>(value));
+    }
+#endif
+
+    constexpr std::uint32_t infinity{0x7F800000U};
+    constexpr std::uint32_t overflow{0x477FF000U};
+    constexpr std::uint32_t smallestNormal{0x38800000U};
+    constexpr std::uint32_t halfSmallestSubnormal{0x33000000U};
+    constexpr std::uint32_t exponentRebias{0x38000000U};
+    constexpr std::uint32_t droppedBits{13};
+
+    const auto bits{std::bit_cast<std::uint32_t>(value)};
+    const std::uint32_t sign{(bits >> 16U) & 0x8000U};
+    const std::uint32_t magnitude{bits & 0x7FFFFFFFU};
+
+    if (magnitude >= infinity)
+    {
+        return static_cast<std::uint16_t>(sign | 0x7C00U | (magnitude > infinity ? 0x0200U : 0U));
+    }
+    if (magnitude >= overflow)
+    {
+        return static_cast<std::uint16_t>(sign | 0x7C00U);
+    }
+    if (magnitude <= halfSmallestSubnormal)
+    {
+        return static_cast<std::uint16_t>(sign);
+    }
+
+    std::uint32_t result{};
+    std::uint32_t remainder{};
+    std::uint32_t halfway{};
+
+    if (magnitude < smallestNormal)
+    {
+        const std::uint32_t significand{(magnitude & 0x007FFFFFU) | 0x00800000U};
+        const std::uint32_t shift{126U - (magnitude >> 23U)};
+
+        result = significand >> shift;
+        remainder = significand & ((1U << shift) - 1U);
+        halfway = 1U << (shift - 1U);
+    }
+    else
+    {
+        result = (magnitude - exponentRebias) >> droppedBits;
+        remainder = magnitude & ((1U << droppedBits) - 1U);
+        halfway = 1U << (droppedBits - 1U);
+    }
+
+    if (remainder > halfway || (remainder == halfway && (result & 1U) != 0U))
+    {
+        ++result;
+    }
+
+    return static_cast<std::uint16_t>(sign | result);
+}
+
+/**
+ * @brief Widens an IEEE 754 half-precision value to single precision without rounding.
+ *
+ * Like encodeFloat16, run-time conversions use _Float16 if the compiler provides it.
+ *
+ * @param bits The bit pattern of the half-precision value.
+ * @return The single-precision value.
+ */
+constexpr auto decodeFloat16(std::uint16_t bits) -> float
+{
+#ifdef __FLT16_MAX__
+    if (!std::is_constant_evaluated())
+    {
+        return static_cast<float>(std::bit_cast<_Float16>(bits));
+    }
+#endif
+
+    const std::uint32_t sign{static_cast<std::uint32_t>(bits & 0x8000U) << 16U};
+    const std::uint32_t exponent{(bits >> 10U) & 0x1FU};
+    const std::uint32_t significand{bits & 0x03FFU};
+
+    if (exponent == 0x1FU)
+    {
+        return std::bit_cast<float>(sign | 0x7F800000U | (significand << 13U));
+    }
+    if (exponent == 0)
+    {
+        const float subnormal{static_cast<float>(significand) * 0x1p-24F};
+        return sign != 0 ? -subnormal : subnormal;
+    }
+
+    return std::bit_cast<float>(sign | ((exponent + 112U) << 23U) | (significand << 13U));
+}
+
+/**
+ * @brief Rounds a run of single-precision values to IEEE 754 half precision.
+ *
+ * With F16C, eight values are converted per instruction. The result equals that of the element-wise
+ * conversion.
+ *
+ * @param values The single-precision values.
+ * @param bits The bit patterns of the half-precision values, with the size of values.
+ */
+inline auto encodeFloat16(std::span<const float> values, std::span<std::uint16_t> bits) -> void
+{
+    std::size_t index{0};
+
+#if defined(__F16C__)
+    constexpr std::size_t width{8};
+
+    for (; index + width <= values.size(); index += width)
+    {
+        const __m128i converted{
+            _mm256_cvtps_ph(_mm256_loadu_ps(&values[index]), _MM_FROUND_TO_NEAREST_INT)
+        };
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&bits[index]), converted);
+    }
+#endif
+
+    for (; index < values.size(); ++index)
+    {
+        bits[index] = encodeFloat16(values[index]);
+    }
+}
+
+/**
+ * @brief Widens a run of IEEE 754 half-precision values to single precision.
+ *
+ * With F16C, eight values are converted per instruction.
+ *
+ * @param bits The bit patterns of the half-precision values.
+ * @param values The single-precision values, with the size of bits.
+ */
+inline auto decodeFloat16(std::span<const std::uint16_t> bits, std::span<float> values) -> void
+{
+    std::size_t index{0};
+
+#if defined(__F16C__)
+    constexpr std::size_t width{8};
+
+    for (; index + width <= bits.size(); index += width)
+    {
+        const __m128i loaded{_mm_loadu_si128(reinterpret_cast<const __m128i*>(&bits[index]))};
+        _mm256_storeu_ps(&values[index], _mm256_cvtph_ps(loaded));
+    }
+#endif
+
+    for (; index < bits.size(); ++index)
+    {
+        values[index] = decodeFloat16(bits[index]);
+    }
+}
+
+/**
+ * @brief Rounds a single-precision value to the nearest brain floating-point value.
+ *
+ * Ties round to even, and NaNs stay quiet NaNs.
+ *
+ * @param value The single-precision value.
+ * @return The bit pattern of the brain floating-point value.
+ */
+constexpr auto encodeBFloat16(float value) -> std::uint16_t
+{
+    const auto bits{std::bit_cast<std::uint32_t>(value)};
+
+    if ((bits & 0x7FFFFFFFU) > 0x7F800000U)
+    {
+        return static_cast<std::uint16_t>((bits >> 16U) | 0x0040U);
+    }
+
+    return static_cast<std::uint16_t>((bits + 0x7FFFU + ((bits >> 16U) & 1U)) >> 16U);
+}
+
+/**
+ * @brief Widens a brain floating-point value to single precision without rounding.
+ *
+ * @param bits The bit pattern of the brain floating-point value.
+ * @return The single-precision value.
+ */
+constexpr auto decodeBFloat16(std::uint16_t bits) -> float
+{
+    return std::bit_cast<float>(static_cast<std::uint32_t>(bits) << 16U);
+}
+
+/**
+ * @brief Narrows a population to half precision.
+ *
+ * @param value The single-precision population.
+ * @return The stored population.
+ */
+constexpr auto Float16Storage::encode(float value) -> Stored
+{
+    return encodeFloat16(value);
+}
+
+/**
+ * @brief Widens a stored population from half precision.
+ *
+ * @param stored The stored population.
+ * @return The single-precision population.
+ */
+constexpr auto Float16Storage::decode(Stored stored) -> float
+{
+    return decodeFloat16(stored);
+}
+
+/**
+ * @brief Narrows the deviation of a population from its lattice weight to half precision.
+ *
+ * @param value The single-precision deviation.
+ * @return The stored deviation.
+ */
+constexpr auto ShiftedFloat16Storage::encode(float value) -> Stored
+{
+    return encodeFloat16(value);
+}
+
+/**
+ * @brief Widens the stored deviation of a population from half precision.
+ *
+ * @param stored The stored deviation.
+ * @return The single-precision deviation.
+ */
+constexpr auto ShiftedFloat16Storage::decode(Stored stored) -> float
+{
+    return decodeFloat16(stored);
+}
+
+/**
+ * @brief Narrows a population to brain floating point.
+ *
+ * @param value The single-precision population.
+ * @return The stored population.
+ */
+constexpr auto BFloat16Storage::encode(float value) -> Stored
+{
+    return encodeBFloat16(value);
+}
+
+/**
+ * @brief Widens a stored population from brain floating point.
+ *
+ * @param stored The stored population.
+ * @return The single-precision population.
+ */
+constexpr auto BFloat16Storage::decode(Stored stored) -> float
+{
+    return decodeBFloat16(stored);
+}
+
+/**
+ * @brief Stores the deviation of a population from its lattice weight unchanged.
+ *
+ * @param value The single-precision deviation.
+ * @return The stored deviation.
+ */
+constexpr auto ShiftedFloat32Storage::encode(float value) -> Stored
+{
+    return value;
+}
+
+/**
+ * @brief Loads the stored deviation of a population unchanged.
+ *
+ * @param stored The stored deviation.
+ * @return The single-precision deviation.
+ */
+constexpr auto ShiftedFloat32Storage::decode(Stored stored) -> float
+{
+    return stored;
+}
+
+/**
+ * @brief Narrows a run of populations to half precision.
+ *
+ * @param values The single-precision values.
+ * @param stored The stored values, with the size of values.
+ */
+inline auto Float16Storage::encode(
+    std::span<const float> values,
+    std::span<Stored> stored
+) -> void
+{
+    encodeFloat16(values, stored);
+}
+
+/**
+ * @brief Widens a run of stored populations from half precision.
+ *
+ * @param stored The stored values.
+ * @param values The single-precision values, with the size of stored.
+ */
+inline auto Float16Storage::decode(
+    std::span<const Stored> stored,
+    std::span<float> values
+) -> void
+{
+    decodeFloat16(stored, values);
+}
+
+/**
+ * @brief Narrows a run of deviations to half precision.
+ *
+ * @param values The single-precision values.
+ * @param stored The stored values, with the size of values.
+ */
+inline auto ShiftedFloat16Storage::encode(
+    std::span<const float> values,
+    std::span<Stored> stored
+) -> void
+{
+    encodeFloat16(values, stored);
+}
+
+/**
+ * @brief Widens a run of stored deviations from half precision.
+ *
+ * @param stored The stored values.
+ * @param values The single-precision values, with the size of stored.
+ */
+inline auto ShiftedFloat16Storage::decode(
+    std::span<const Stored> stored,
+    std::span<float> values
+) -> void
+{
+    decodeFloat16(stored, values);
+}
+
+/**
+ * @brief Narrows a run of populations to brain floating point.
+ *
+ * @param values The single-precision values.
+ * @param stored The stored values, with the size of values.
+ */
+inline auto BFloat16Storage::encode(
+    std::span<const float> values,
+    std::span<Stored> stored
+) -> void
+{
+    for (std::size_t index = 0; index < values.size(); ++index)
+    {
+        stored[index] = encode(values[index]);
+    }
+}
+
+/**
+ * @brief Widens a run of stored populations from brain floating point.
+ *
+ * @param stored The stored values.
+ * @param values The single-precision values, with the size of stored.
+ */
+inline auto BFloat16Storage::decode(
+    std::span<const Stored> stored,
+    std::span<float> values
+) -> void
+{
+    for (std::size_t index = 0; index < stored.size(); ++index)
+    {
+        values[index] = decode(stored[index]);
+    }
+}
+
+/**
+ * @brief Stores a run of deviations unchanged.
+ *
+ * @param values The single-precision values.
+ * @param stored The stored values, with the size of values.
+ */
+inline auto ShiftedFloat32Storage::encode(
+    std::span<const float> values,
+    std::span<Stored> stored
+) -> void
+{
+    std::ranges::copy(values, stored.begin());
+}
+
+/**
+ * @brief Loads a run of stored deviations unchanged.
+ *
+ * @param stored The stored values.
+ * @param values The single-precision values, with the size of stored.
+ */
+inline auto ShiftedFloat32Storage::decode(
+    std::span<const Stored> stored,
+    std::span<float> values
+) -> void
+{
+    std::ranges::copy(stored, values.begin());
+}
+
+#endif // PRECISION_STORAGE_FORMAT_TPP
@@ -0,0 +1,188 @@
+#ifndef REFINEMENT_REFINED_GRID_HPP
+#define REFINEMENT_REFINED_GRID_HPP
+
+/**
+ * @file RefinedGrid.hpp
+ * @brief Declaration of the RefinedGrid class template that covers a periodic domain with blocks
+ * of lattice nodes at several levels of resolution.
+ */
+
+#include "../collision/bgk.hpp"
+#include "../densityDistribution/LatticeDescriptor.hpp"
+#include "../instrumentation/PhaseRecorder.hpp"
+#include "../lattice/Lattice.hpp"
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <set>
+#include <vector>
+
+/**
+ * @brief The number of lattice nodes of a block of a refined grid along each spatial dimension.
+ */
+constexpr std::size_t REFINED_BLOCK_EXTENT{16};
+
+/**
+ * @struct RefinedBlockKey
+ * @brief The position of a block in a refined grid, given by its level and its block coordinates
+ * on that level.
+ *
+ * Level zero is the coarsest level. The block with coordinates b on level l covers the nodes
+ * b * REFINED_BLOCK_EXTENT to (b + 1) * REFINED_BLOCK_EXTENT - 1 of level l, and its children are
+ * the blocks 2b + o on level l + 1 for all offsets o in {0, 1} along each axis.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ */
+template <std::size_t Dimension>
+struct RefinedBlockKey
+{
+    std::size_t level;
+    std::array<std::size_t, Dimension> coordinates;
+
+    auto operator<=>(const RefinedBlockKey& other) const = default;
+};
+
+/**
+ * @class RefinedGrid
+ * @brief A class template for a block-structured refined lattice whose levels advance with their
+ * own time steps.
+ *
+ * The leaves of a tree of fixed-size blocks cover a periodic domain exactly once. A block on level
+ * l has half the node spacing and takes half the time step of a block on level l - 1, and its
+ * relaxation frequency follows from the coarsest one so that all levels share one viscosity. Every
+ * block holds a layer of ghost nodes, and a plan built from the leaves around the block fills them
+ * before each time step of its level: from a leaf on the same level by copying, from a coarser
+ * leaf by interpolating in time, and from finer leaves by averaging. Populations that cross a level
+ * interface keep their equilibrium part and rescale their non-equilibrium part by the ratio of the
+ * relaxation times \cite Dupuis2003. Adjacent leaves differ by at most one level.
+ *
+ * Blocks are refined and coarsened one at a time between time steps. Only the blocks around the
+ * changed region rebuild their ghost plans and update the level lists and the prolongation counts
+ * of the blocks they read from, so the rest of the grid is left untouched.
+ *
+ * @tparam Descriptor The lattice descriptor.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+class RefinedGrid
+{
+public:
+    static constexpr std::size_t dimension{Descriptor.velocities[0].size()};
+    static constexpr std::size_t size{Descriptor.velocities.size()};
+
+    using Key = RefinedBlockKey<dimension>;
+    using Position = std::array<Scalar, dimension>;
+    using Distribution = DensityDistribution<dimension, size, Scalar>;
+
+    RefinedGrid(const std::array<std::size_t, dimension>& rootBlocks, Scalar relaxationFrequency);
+
+    auto setSolid(std::function<bool(const Position&)> solid) -> void;
+    auto initialize(const std::function<Distribution(const Position&)>& field) -> void;
+    auto initialize(Scalar density, const std::array<Scalar, dimension>& velocity) -> void;
+
+    auto refine(const Key& key) -> void;
+    auto coarsen(const Key& key) -> void;
+
+    auto advance() -> void;
+
+    auto node(const Position& position) const -> Distribution;
+    auto isLeaf(const Key& key) const -> bool;
+    auto leaves() const -> std::vector<Key>;
+    auto blockCount() const -> std::size_t;
+    auto nodeCount() const -> std::size_t;
+    auto finestLevel() const -> std::size_t;
+    auto relaxationFrequency(std::size_t level) const -> Scalar;
+
+private:
+    using Coordinates = std::array<std::size_t, dimension>;
+
+    static constexpr std::size_t childCount{std::size_t{1} << dimension};
+
+    struct Block;
+
+    /**
+     * @brief A ghost node filled from one interior node of another block.
+     */
+    struct GhostCopy
+    {
+        std::size_t node;
+        const Block* source;
+        std::size_t sourceNode;
+    };
+
+    /**
+     * @brief A ghost node filled with the average of the interior nodes of finer blocks that it
+     * covers.
+     */
+    struct GhostRestriction
+    {
+        std::size_t node;
+        std::array<const Block*, childCount> sources;
+        std::array<std::size_t, childCount> sourceNodes;
+    };
+
+    /**
+     * @brief The populations, solid mask and ghost plan of one leaf block.
+     *
+     * The number of prolongations of finer leaves that read from the block is updated through the
+     * const pointers of their ghost plans, so it and the flag derived from it are mutable.
+     */
+    struct Block
+    {
+        explicit Block(const Coordinates& extents);
+
+        Lattice<dimension, size, Scalar> current;
+        Lattice<dimension, size, Scalar> next;
+        Lattice<dimension, size, Scalar> previous;
+        std::vector<bool> solid;
+        std::vector<GhostCopy> copies;
+        std::vector<GhostCopy> prolongations;
+        std::vector<GhostRestriction> restrictions;
+        mutable std::size_t prolongationReferences{0};
+        mutable bool coarseSource{false};
+    };
+
+    using Entry = std::pair<const Key, Block>;
+
+    auto levelExtent(std::size_t level, std::size_t axis) const -> std::size_t;
+    auto findLeaf(std::size_t level, const Coordinates& node) const -> const Entry*;
+    auto paddedNode(const Coordinates& node) const -> std::size_t;
+    auto paddedCoordinates(std::size_t node) const -> Coordinates;
+    template <typename Function>
+    auto forEachRingNode(
+        std::size_t level,
+        const Coordinates& first,
+        std::size_t width,
+        Function function
+    ) const -> void;
+
+    auto insertBlock(const Key& key) -> Block&;
+    auto eraseBlock(typename std::map<Key, Block>::iterator block) -> void;
+    auto nodePosition(const Key& key, std::size_t node) const -> Position;
+    auto updateSolid(const Key& key, Block& block) const -> void;
+    auto relink(const Key& key, Block& block) -> void;
+    auto releaseProlongations(Block& block) -> void;
+    auto affectedAround(const Key& parent) const -> std::set<Key>;
+    auto releaseAround(const Key& parent) -> void;
+    auto relinkAround(const Key& parent) -> void;
+
+    auto rescale(Distribution& distribution, Scalar factor) const -> void;
+    auto fillGhosts(Block& block, std::size_t level, Scalar fraction) const -> void;
+    auto stepBlock(Block& block, std::size_t level) const -> void;
+    auto stepLevel(std::size_t level, Scalar fraction) -> void;
+
+    std::array<std::size_t, dimension> rootBlocks_;
+    Scalar relaxationTime_;
+    std::vector<std::size_t> interior_;
+    std::array<std::ptrdiff_t, size> offsets_;
+    std::function<bool(const Position&)> solid_;
+    std::map<Key, Block> blocks_;
+    std::vector<std::vector<Block*>> levels_;
+};
+
+#include "RefinedGrid.tpp"
+
+#endif // REFINEMENT_REFINED_GRID_HPP
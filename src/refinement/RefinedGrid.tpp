@@ -0,0 +1,1098 @@
+#ifndef REFINEMENT_REFINED_GRID_TPP
+#define REFINEMENT_REFINED_GRID_TPP
+
+/**
+ * @file RefinedGrid.tpp
+ * @brief Implementation of the RefinedGrid class template that covers a periodic domain with
+ * blocks of lattice nodes at several levels of resolution.
+ */
+
+;
+#include "RefinedGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief The number of nodes of a block including its ghost layer along each spatial dimension.
+ */
+constexpr std::size_t REFINED_PADDED_EXTENT{REFINED_BLOCK_EXTENT + 2};
+
+/**
+ * @brief Constructor for Block that allocates the populations and the solid mask of a block
+ * including its ghost layer.
+ *
+ * @param extents The number of nodes including the ghost layer along each spatial dimension.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+RefinedGrid<Descriptor, Scalar>::Block::Block(const Coordinates& extents)
+    : current{extents},
+      next{extents},
+      previous{extents},
+      solid(current.nodeCount(), false)
+{
+}
+
+/**
+ * @brief Constructor for RefinedGrid that covers the domain with blocks on level zero, holding the
+ * equilibrium at rest.
+ *
+ * @param rootBlocks The number of blocks on level zero along each spatial dimension.
+ * @param relaxationFrequency The relaxation frequency on level zero.
+ * @throws std::invalid_argument If a number of root blocks is zero or the relaxation frequency
+ * does not lie in (0, 2).
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+RefinedGrid<Descriptor, Scalar>::RefinedGrid(
+    const std::array<std::size_t, dimension>& rootBlocks,
+    Scalar relaxationFrequency
+)
+    : rootBlocks_{rootBlocks},
+      relaxationTime_{Scalar{1.0} / relaxationFrequency},
+      solid_{[](const Position& position) {
+          static_cast<void>(position);
+          return false;
+      }}
+{
+    if (std::ranges::find(rootBlocks, std::size_t{0}) != rootBlocks.end())
+    {
+        throw std::invalid_argument{"number of root blocks must be positive"};
+    }
+    if (!(relaxationFrequency > 0) || !(relaxationFrequency < 2))
+    {
+        throw std::invalid_argument{"relaxation frequency must lie in (0, 2)"};
+    }
+
+    std::size_t paddedCount{1};
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        paddedCount *= REFINED_PADDED_EXTENT;
+    }
+
+    for (std::size_t node = 0; node < paddedCount; ++node)
+    {
+        const Coordinates coordinates{paddedCoordinates(node)};
+        if (std::ranges::all_of(coordinates, [](std::size_t coordinate) {
+                return coordinate >= 1 && coordinate <= REFINED_BLOCK_EXTENT;
+            }))
+        {
+            interior_.push_back(node);
+        }
+    }
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        std::ptrdiff_t offset{0};
+        std::ptrdiff_t stride{1};
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            offset += Descriptor.velocities[i][axis] * stride;
+            stride *= static_cast<std::ptrdiff_t>(REFINED_PADDED_EXTENT);
+        }
+        offsets_[i] = offset;
+    }
+
+    std::size_t rootCount{1};
+    for (const std::size_t count : rootBlocks)
+    {
+        rootCount *= count;
+    }
+
+    for (std::size_t index = 0; index < rootCount; ++index)
+    {
+        Key key{0, {}};
+        std::size_t remainder{index};
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            key.coordinates[axis] = remainder % rootBlocks[axis];
+            remainder /= rootBlocks[axis];
+        }
+        insertBlock(key);
+    }
+
+    for (auto& [key, block] : blocks_)
+    {
+        relink(key, block);
+    }
+    initialize(Scalar{1.0}, std::array<Scalar, dimension>{});
+}
+
+/**
+ * @brief Sets the solid nodes of all current and future blocks.
+ *
+ * A node is solid if the predicate holds at its center. Solid nodes reflect the populations of
+ * their fluid neighbors by halfway bounce-back.
+ *
+ * @param solid A predicate on positions in units of the node spacing of level zero.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::setSolid(std::function<bool(const Position&)> solid) -> void
+{
+    solid_ = std::move(solid);
+
+    for (auto& [key, block] : blocks_)
+    {
+        updateSolid(key, block);
+    }
+}
+
+/**
+ * @brief Sets every node of every block to the populations of a field at its center.
+ *
+ * @param field A callable that returns the density distribution at a position in units of the node
+ * spacing of level zero.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::initialize(
+    const std::function<Distribution(const Position&)>& field
+) -> void
+{
+    for (auto& [key, block] : blocks_)
+    {
+        for (std::size_t node = 0; node < block.current.nodeCount(); ++node)
+        {
+            const Distribution distribution{field(nodePosition(key, node))};
+            block.current.setNode(node, distribution);
+            block.next.setNode(node, distribution);
+            block.previous.setNode(node, distribution);
+        }
+    }
+}
+
+/**
+ * @brief Sets every node of every block to the same equilibrium.
+ *
+ * @param density The density.
+ * @param velocity The flow velocity.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::initialize(
+    Scalar density,
+    const std::array<Scalar, dimension>& velocity
+) -> void
+{
+    const Distribution equilibrium{computeEquilibrium<Descriptor>(density, velocity)};
+
+    initialize([&](const Position& position) {
+        static_cast<void>(position);
+        return equilibrium;
+    });
+}
+
+/**
+ * @brief Replaces a leaf block by its children on the next finer level.
+ *
+ * Every node of a child takes the populations of the node of the block that contains it, with the
+ * non-equilibrium part rescaled to the finer level.
+ *
+ * @param key The key of the leaf block.
+ * @throws std::invalid_argument If the block is not a leaf, or if an adjacent leaf is coarser than
+ * the block so that the children would differ from it by two levels.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::refine(const Key& key) -> void
+{
+    const auto parent{blocks_.find(key)};
+    if (parent == blocks_.end())
+    {
+        throw std::invalid_argument{"block is not a leaf"};
+    }
+
+    Coordinates first;
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        first[axis] = key.coordinates[axis] * REFINED_BLOCK_EXTENT;
+    }
+    forEachRingNode(key.level, first, REFINED_BLOCK_EXTENT, [&](const Coordinates& node, auto) {
+        if (findLeaf(key.level, node)->first.level < key.level)
+        {
+            throw std::invalid_argument{"refinement would break the balance of adjacent levels"};
+        }
+    });
+
+    const Scalar factor{
+        (Scalar{1.0} / relaxationFrequency(key.level + 1)) /
+        (Scalar{2.0} / relaxationFrequency(key.level))
+    };
+    releaseAround(key);
+
+    for (std::size_t child = 0; child < childCount; ++child)
+    {
+        Key childKey{key.level + 1, {}};
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            childKey.coordinates[axis] = 2 * key.coordinates[axis] + ((child >> axis) & 1U);
+        }
+        Block& block{insertBlock(childKey)};
+
+        for (const std::size_t node : interior_)
+        {
+            const Coordinates local{paddedCoordinates(node)};
+            Coordinates source;
+            for (std::size_t axis = 0; axis < dimension; ++axis)
+            {
+                const std::size_t fine{
+                    childKey.coordinates[axis] * REFINED_BLOCK_EXTENT + local[axis] - 1
+                };
+                source[axis] = (fine / 2) % REFINED_BLOCK_EXTENT + 1;
+            }
+
+            Distribution distribution{parent->second.current.node(paddedNode(source))};
+            rescale(distribution, factor);
+            block.current.setNode(node, distribution);
+        }
+    }
+
+    eraseBlock(parent);
+    relinkAround(key);
+}
+
+/**
+ * @brief Replaces the children of a block by the block on the next coarser level.
+ *
+ * Every node of the block takes the average of the populations of the child nodes it contains,
+ * with the non-equilibrium part rescaled to the coarser level.
+ *
+ * @param key The key of the block whose children are all leaves.
+ * @throws std::invalid_argument If a child of the block is not a leaf, or if an adjacent leaf is
+ * finer than the children so that it would differ from the block by two levels.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::coarsen(const Key& key) -> void
+{
+    std::array<typename std::map<Key, Block>::iterator, childCount> children;
+    for (std::size_t child = 0; child < childCount; ++child)
+    {
+        Key childKey{key.level + 1, {}};
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            childKey.coordinates[axis] = 2 * key.coordinates[axis] + ((child >> axis) & 1U);
+        }
+        children[child] = blocks_.find(childKey);
+        if (children[child] == blocks_.end())
+        {
+            throw std::invalid_argument{"block does not have leaf children"};
+        }
+    }
+
+    Coordinates first;
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        first[axis] = key.coordinates[axis] * REFINED_BLOCK_EXTENT;
+    }
+    forEachRingNode(key.level, first, REFINED_BLOCK_EXTENT, [&](const Coordinates& node, auto) {
+        for (std::size_t child = 0; child < childCount; ++child)
+        {
+            Coordinates fine;
+            for (std::size_t axis = 0; axis < dimension; ++axis)
+            {
+                fine[axis] = 2 * node[axis] + ((child >> axis) & 1U);
+            }
+            if (findLeaf(key.level + 1, fine)->first.level > key.level + 1)
+            {
+                throw std::invalid_argument{
+                    "coarsening would break the balance of adjacent levels"
+                };
+            }
+        }
+    });
+
+    const Scalar factor{
+        (Scalar{2.0} / relaxationFrequency(key.level)) /
+        (Scalar{1.0} / relaxationFrequency(key.level + 1))
+    };
+    const Scalar inverseCount{Scalar{1.0} / static_cast<Scalar>(childCount)};
+    releaseAround(key);
+    Block& block{insertBlock(key)};
+
+    for (const std::size_t node : interior_)
+    {
+        const Coordinates local{paddedCoordinates(node)};
+        Distribution distribution;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            distribution[i] = Scalar{0.0};
+        }
+
+        for (std::size_t child = 0; child < childCount; ++child)
+        {
+            std::size_t owner{0};
+            Coordinates source;
+            for (std::size_t axis = 0; axis < dimension; ++axis)
+            {
+                const std::size_t fine{
+                    2 * (key.coordinates[axis] * REFINED_BLOCK_EXTENT + local[axis] - 1) +
+                    ((child >> axis) & 1U)
+                };
+                owner |= ((fine / REFINED_BLOCK_EXTENT) & 1U) << axis;
+                source[axis] = fine % REFINED_BLOCK_EXTENT + 1;
+            }
+
+            const Distribution fine{children[owner]->second.current.node(paddedNode(source))};
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                distribution[i] += fine[i];
+            }
+        }
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            distribution[i] *= inverseCount;
+        }
+        rescale(distribution, factor);
+        block.current.setNode(node, distribution);
+    }
+
+    for (const auto child : children)
+    {
+        eraseBlock(child);
+    }
+    relinkAround(key);
+}
+
+/**
+ * @brief Advances the grid by one time step of level zero.
+ *
+ * Each level takes one time step and then lets the next finer level take two, so level l takes
+ * 2^l time steps of its own.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::advance() -> void
+{
+    stepLevel(0, Scalar{0.0});
+}
+
+/**
+ * @brief Returns the populations of the finest node at a position.
+ *
+ * @param position A position in units of the node spacing of level zero.
+ * @return A copy of the density distribution of the node of the leaf that contains the position.
+ * @throws std::out_of_range If the position lies outside of the domain.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::node(const Position& position) const -> Distribution
+{
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        if (!(position[axis] >= 0) ||
+            !(position[axis] < static_cast<Scalar>(levelExtent(0, axis))))
+        {
+            throw std::out_of_range{"position lies outside of the domain"};
+        }
+    }
+
+    for (std::size_t level = 0; level < levels_.size(); ++level)
+    {
+        Coordinates coordinates;
+        Key key{level, {}};
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            const auto scaled{static_cast<std::size_t>(
+                std::floor(std::ldexp(position[axis], static_cast<int>(level)))
+            )};
+            const std::size_t global{std::min(scaled, levelExtent(level, axis) - 1)};
+            key.coordinates[axis] = global / REFINED_BLOCK_EXTENT;
+            coordinates[axis] = global % REFINED_BLOCK_EXTENT + 1;
+        }
+
+        const auto block{blocks_.find(key)};
+        if (block != blocks_.end())
+        {
+            return block->second.current.node(paddedNode(coordinates));
+        }
+    }
+
+    throw std::out_of_range{"position is not covered by a leaf"};
+}
+
+/**
+ * @brief Returns whether a block is a leaf of the grid.
+ *
+ * @param key The key of the block.
+ * @return Whether the block holds populations.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::isLeaf(const Key& key) const -> bool
+{
+    return blocks_.contains(key);
+}
+
+/**
+ * @brief Returns the keys of all leaf blocks.
+ *
+ * @return The keys ordered by level and then by block coordinates.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::leaves() const -> std::vector<Key>
+{
+    std::vector<Key> keys;
+    keys.reserve(blocks_.size());
+    for (const auto& [key, block] : blocks_)
+    {
+        keys.push_back(key);
+    }
+
+    return keys;
+}
+
+/**
+ * @brief Returns the number of leaf blocks.
+ *
+ * @return The number of blocks that hold populations.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::blockCount() const -> std::size_t
+{
+    return blocks_.size();
+}
+
+/**
+ * @brief Returns the number of lattice nodes of all leaf blocks, excluding ghost nodes.
+ *
+ * @return The number of nodes that are updated per time step of their level.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::nodeCount() const -> std::size_t
+{
+    return blocks_.size() * interior_.size();
+}
+
+/**
+ * @brief Returns the finest level that holds a leaf block.
+ *
+ * @return The index of the finest level.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::finestLevel() const -> std::size_t
+{
+    return levels_.size() - 1;
+}
+
+/**
+ * @brief Returns the relaxation frequency of a level.
+ *
+ * Halving the node spacing and the time step doubles the viscosity in lattice units, so the
+ * relaxation time minus one half doubles with every level.
+ *
+ * @param level The level.
+ * @return The relaxation frequency that gives every level the viscosity of level zero.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::relaxationFrequency(std::size_t level) const -> Scalar
+{
+    const Scalar relaxationTime{
+        Scalar{0.5} +
+        std::ldexp(relaxationTime_ - Scalar{0.5}, static_cast<int>(level))
+    };
+
+    return Scalar{1.0} / relaxationTime;
+}
+
+/**
+ * @brief Returns the number of nodes of a level along an axis.
+ *
+ * @param level The level.
+ * @param axis The axis.
+ * @return The number of nodes of the periodic domain on the level.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::levelExtent(std::size_t level, std::size_t axis) const
+    -> std::size_t
+{
+    return (rootBlocks_[axis] * REFINED_BLOCK_EXTENT) << level;
+}
+
+/**
+ * @brief Finds the leaf block that contains a node of a level.
+ *
+ * The ancestors of the block that would contain the node on its level are searched first, then
+ * its descendants that contain the first corner of the node.
+ *
+ * @param level The level of the node.
+ * @param node The coordinates of the node on its level.
+ * @return Pointer to the key and block of the leaf, or nullptr if there is none.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::findLeaf(std::size_t level, const Coordinates& node) const
+    -> const Entry*
+{
+    Coordinates coordinates{node};
+    for (std::size_t candidate = level + 1; candidate-- > 0;)
+    {
+        Key key{candidate, {}};
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            key.coordinates[axis] = coordinates[axis] / REFINED_BLOCK_EXTENT;
+            coordinates[axis] /= 2;
+        }
+
+        const auto block{blocks_.find(key)};
+        if (block != blocks_.end())
+        {
+            return &*block;
+        }
+    }
+
+    coordinates = node;
+    for (std::size_t candidate = level + 1; candidate < levels_.size(); ++candidate)
+    {
+        Key key{candidate, {}};
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            coordinates[axis] *= 2;
+            key.coordinates[axis] = coordinates[axis] / REFINED_BLOCK_EXTENT;
+        }
+
+        const auto block{blocks_.find(key)};
+        if (block != blocks_.end())
+        {
+            return &*block;
+        }
+    }
+
+    return nullptr;
+}
+
+/**
+ * @brief Returns the linear index of a node of a block including its ghost layer.
+ *
+ * @param node The coordinates of the node, with the ghost layer at zero and
+ * REFINED_BLOCK_EXTENT + 1.
+ * @return The linear index of the node within the populations of the block.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::paddedNode(const Coordinates& node) const -> std::size_t
+{
+    std::size_t index{0};
+    for (std::size_t axis = dimension; axis-- > 0;)
+    {
+        index = index * REFINED_PADDED_EXTENT + node[axis];
+    }
+
+    return index;
+}
+
+/**
+ * @brief Returns the coordinates of a node of a block including its ghost layer.
+ *
+ * @param node The linear index of the node within the populations of the block.
+ * @return The coordinates of the node, with the ghost layer at zero and REFINED_BLOCK_EXTENT + 1.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::paddedCoordinates(std::size_t node) const -> Coordinates
+{
+    Coordinates coordinates;
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        coordinates[axis] = node % REFINED_PADDED_EXTENT;
+        node /= REFINED_PADDED_EXTENT;
+    }
+
+    return coordinates;
+}
+
+/**
+ * @brief Calls a function for every node in the layer around a box of nodes of a level.
+ *
+ * @param level The level of the box.
+ * @param first The coordinates of the first node of the box on its level.
+ * @param width The number of nodes of the box along each spatial dimension.
+ * @param function A callable function(node, offset) that receives the coordinates of a node of
+ * the layer on the level, wrapped around the periodic domain, and its coordinates relative to the
+ * node before the first node of the box.
+ *
+ * @tparam Function The type of the callable.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+template <typename Function>
+auto RefinedGrid<Descriptor, Scalar>::forEachRingNode(
+    std::size_t level,
+    const Coordinates& first,
+    std::size_t width,
+    Function function
+) const -> void
+{
+    std::size_t count{1};
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        count *= width + 2;
+    }
+
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        Coordinates offset;
+        Coordinates node;
+        bool inside{true};
+        std::size_t remainder{index};
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            const std::size_t extent{levelExtent(level, axis)};
+            offset[axis] = remainder % (width + 2);
+            remainder /= width + 2;
+            inside = inside && offset[axis] >= 1 && offset[axis] <= width;
+            node[axis] = (first[axis] + extent + offset[axis] - 1) % extent;
+        }
+
+        if (!inside)
+        {
+            function(node, offset);
+        }
+    }
+}
+
+/**
+ * @brief Creates a leaf block with its solid mask and adds it to the list of its level.
+ *
+ * @param key The key of the block.
+ * @return Reference to the block, whose populations are left to the caller.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::insertBlock(const Key& key) -> Block&
+{
+    Coordinates extents;
+    extents.fill(REFINED_PADDED_EXTENT);
+
+    Block& block{blocks_.try_emplace(key, extents).first->second};
+    updateSolid(key, block);
+
+    if (key.level >= levels_.size())
+    {
+        levels_.resize(key.level + 1);
+    }
+    levels_[key.level].push_back(&block);
+
+    return block;
+}
+
+/**
+ * @brief Removes a leaf block from the list of its level and destroys it.
+ *
+ * Trailing levels without blocks are dropped, so that the finest level holds blocks. The block
+ * must have released its prolongations, and no ghost plan may refer to it anymore once the blocks
+ * around it are relinked.
+ *
+ * @param block Iterator to the block.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::eraseBlock(typename std::map<Key, Block>::iterator block)
+    -> void
+{
+    std::vector<Block*>& level{levels_[block->first.level]};
+    level.erase(std::ranges::find(level, &block->second));
+    while (levels_.back().empty())
+    {
+        levels_.pop_back();
+    }
+
+    blocks_.erase(block);
+}
+
+/**
+ * @brief Returns the center of a node of a block including its ghost layer.
+ *
+ * @param key The key of the block.
+ * @param node The linear index of the node within the populations of the block.
+ * @return The position of the node in units of the node spacing of level zero, wrapped around the
+ * periodic domain.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::nodePosition(const Key& key, std::size_t node) const
+    -> Position
+{
+    const Coordinates local{paddedCoordinates(node)};
+    Position position;
+
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        const std::size_t extent{levelExtent(key.level, axis)};
+        const std::size_t global{
+            (key.coordinates[axis] * REFINED_BLOCK_EXTENT + extent + local[axis] - 1) % extent
+        };
+        position[axis] =
+            std::ldexp(static_cast<Scalar>(global) + Scalar{0.5}, -static_cast<int>(key.level));
+    }
+
+    return position;
+}
+
+/**
+ * @brief Evaluates the solid predicate at the centers of all nodes of a block including its ghost
+ * layer.
+ *
+ * @param key The key of the block.
+ * @param block The block whose solid mask is updated.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::updateSolid(const Key& key, Block& block) const -> void
+{
+    for (std::size_t node = 0; node < block.solid.size(); ++node)
+    {
+        block.solid[node] = solid_(nodePosition(key, node));
+    }
+}
+
+/**
+ * @brief Rebuilds the ghost plan of a block from the leaves around it.
+ *
+ * Every prolongation counts as a reference to the coarser block it reads from, which is thereby
+ * marked as a coarse source.
+ *
+ * @param key The key of the block.
+ * @param block The block whose ghost plan is rebuilt.
+ * @throws std::logic_error If a ghost node is not covered by leaves on an adjacent level.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::relink(const Key& key, Block& block) -> void
+{
+    block.copies.clear();
+    releaseProlongations(block);
+    block.restrictions.clear();
+
+    const auto locate{[&](std::size_t level, const Coordinates& node) {
+        Key owner{level, {}};
+        Coordinates local;
+        for (std::size_t axis = 0; axis < dimension; ++axis)
+        {
+            owner.coordinates[axis] = node[axis] / REFINED_BLOCK_EXTENT;
+            local[axis] = node[axis] % REFINED_BLOCK_EXTENT + 1;
+        }
+        return std::pair{blocks_.find(owner), paddedNode(local)};
+    }};
+
+    Coordinates first;
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        first[axis] = key.coordinates[axis] * REFINED_BLOCK_EXTENT;
+    }
+
+    forEachRingNode(
+        key.level,
+        first,
+        REFINED_BLOCK_EXTENT,
+        [&](const Coordinates& node, const Coordinates& offset) {
+            const std::size_t ghost{paddedNode(offset)};
+
+            const auto [same, sameNode]{locate(key.level, node)};
+            if (same != blocks_.end())
+            {
+                block.copies.push_back({ghost, &same->second, sameNode});
+                return;
+            }
+
+            if (key.level > 0)
+            {
+                Coordinates coarse;
+                for (std::size_t axis = 0; axis < dimension; ++axis)
+                {
+                    coarse[axis] = node[axis] / 2;
+                }
+                const auto [parent, parentNode]{locate(key.level - 1, coarse)};
+                if (parent != blocks_.end())
+                {
+                    block.prolongations.push_back({ghost, &parent->second, parentNode});
+                    ++parent->second.prolongationReferences;
+                    parent->second.coarseSource = true;
+                    return;
+                }
+            }
+
+            GhostRestriction restriction{ghost, {}, {}};
+            for (std::size_t child = 0; child < childCount; ++child)
+            {
+                Coordinates fine;
+                for (std::size_t axis = 0; axis < dimension; ++axis)
+                {
+                    fine[axis] = 2 * node[axis] + ((child >> axis) & 1U);
+                }
+                const auto [source, sourceNode]{locate(key.level + 1, fine)};
+                if (source == blocks_.end())
+                {
+                    throw std::logic_error{"adjacent leaves differ by more than one level"};
+                }
+                restriction.sources[child] = &source->second;
+                restriction.sourceNodes[child] = sourceNode;
+            }
+            block.restrictions.push_back(restriction);
+        }
+    );
+}
+
+/**
+ * @brief Drops the prolongations of a block and the references they hold on their sources.
+ *
+ * A source that no longer feeds any prolongation stops being a coarse source.
+ *
+ * @param block The block whose prolongations are dropped.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::releaseProlongations(Block& block) -> void
+{
+    for (const GhostCopy& prolongation : block.prolongations)
+    {
+        const Block& source{*prolongation.source};
+        --source.prolongationReferences;
+        source.coarseSource = source.prolongationReferences > 0;
+    }
+    block.prolongations.clear();
+}
+
+/**
+ * @brief Returns the leaves in and around the region of a block whose ghost plans depend on
+ * whether the block is refined.
+ *
+ * These are the leaves that cover the ring of nodes around the region on the next finer level,
+ * together with the block itself if it is a leaf and its children otherwise. Since the ring lies
+ * outside the region, the same leaves are found before and after the block is refined or
+ * coarsened.
+ *
+ * @param parent The key of the block whose region changes.
+ * @return The keys of the affected leaves.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::affectedAround(const Key& parent) const -> std::set<Key>
+{
+    std::set<Key> affected;
+
+    Coordinates first;
+    for (std::size_t axis = 0; axis < dimension; ++axis)
+    {
+        first[axis] = 2 * parent.coordinates[axis] * REFINED_BLOCK_EXTENT;
+    }
+    forEachRingNode(parent.level + 1, first, 2 * REFINED_BLOCK_EXTENT, [&](const auto& node, auto) {
+        if (const Entry* leaf{findLeaf(parent.level + 1, node)}; leaf != nullptr)
+        {
+            affected.insert(leaf->first);
+        }
+    });
+
+    if (blocks_.contains(parent))
+    {
+        affected.insert(parent);
+    }
+    else
+    {
+        for (std::size_t child = 0; child < childCount; ++child)
+        {
+            Key childKey{parent.level + 1, {}};
+            for (std::size_t axis = 0; axis < dimension; ++axis)
+            {
+                childKey.coordinates[axis] = 2 * parent.coordinates[axis] + ((child >> axis) & 1U);
+            }
+            affected.insert(childKey);
+        }
+    }
+
+    return affected;
+}
+
+/**
+ * @brief Drops the prolongations of the leaves in and around the region of a block before the
+ * block is refined or coarsened.
+ *
+ * Every prolongation that reads from a block of the region belongs to one of these leaves, so no
+ * reference to a block that is about to be destroyed remains.
+ *
+ * @param parent The key of the block whose region changes.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::releaseAround(const Key& parent) -> void
+{
+    for (const Key& key : affectedAround(parent))
+    {
+        releaseProlongations(blocks_.at(key));
+    }
+}
+
+/**
+ * @brief Rebuilds the ghost plans of the leaves in and around the region of a block after the
+ * block was refined or coarsened.
+ *
+ * Only the prolongation counts of the blocks that these plans read from change.
+ *
+ * @param parent The key of the block whose region changed.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::relinkAround(const Key& parent) -> void
+{
+    for (const Key& key : affectedAround(parent))
+    {
+        relink(key, blocks_.at(key));
+    }
+}
+
+/**
+ * @brief Scales the non-equilibrium part of a density distribution.
+ *
+ * @param distribution The density distribution, updated in place.
+ * @param factor The factor of the non-equilibrium part.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::rescale(Distribution& distribution, Scalar factor) const
+    -> void
+{
+    const Scalar density{computeDensity<Descriptor>(distribution)};
+    std::array<Scalar, dimension> velocity{computeMomentum<Descriptor>(distribution)};
+    for (Scalar& component : velocity)
+    {
+        component /= density;
+    }
+
+    const Distribution equilibrium{computeEquilibrium<Descriptor>(density, velocity)};
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        distribution[i] = equilibrium[i] + factor * (distribution[i] - equilibrium[i]);
+    }
+}
+
+/**
+ * @brief Fills the ghost layer of a block with the populations of the leaves around it at the
+ * current time of its level.
+ *
+ * @param block The block whose ghost layer is filled.
+ * @param level The level of the block.
+ * @param fraction The fraction of the time step of the next coarser level that has passed, used to
+ * interpolate populations of coarser leaves between their previous and current time step.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::fillGhosts(Block& block, std::size_t level, Scalar fraction)
+    const -> void
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto populations{block.current.population(i)};
+        for (const GhostCopy& copy : block.copies)
+        {
+            populations[copy.node] = copy.source->current.population(i)[copy.sourceNode];
+        }
+    }
+
+    if (!block.prolongations.empty())
+    {
+        const Scalar factor{
+            (Scalar{1.0} / relaxationFrequency(level)) /
+            (Scalar{2.0} / relaxationFrequency(level - 1))
+        };
+
+        for (const GhostCopy& prolongation : block.prolongations)
+        {
+            Distribution distribution;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                const Scalar previous{
+                    prolongation.source->previous.population(i)[prolongation.sourceNode]
+                };
+                const Scalar current{
+                    prolongation.source->current.population(i)[prolongation.sourceNode]
+                };
+                distribution[i] = previous + fraction * (current - previous);
+            }
+            rescale(distribution, factor);
+            block.current.setNode(prolongation.node, distribution);
+        }
+    }
+
+    if (!block.restrictions.empty())
+    {
+        const Scalar factor{
+            (Scalar{2.0} / relaxationFrequency(level)) /
+            (Scalar{1.0} / relaxationFrequency(level + 1))
+        };
+        const Scalar inverseCount{Scalar{1.0} / static_cast<Scalar>(childCount)};
+
+        for (const GhostRestriction& restriction : block.restrictions)
+        {
+            Distribution distribution;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                Scalar sum{0.0};
+                for (std::size_t child = 0; child < childCount; ++child)
+                {
+                    sum += restriction.sources[child]->current.population(i)[
+                        restriction.sourceNodes[child]
+                    ];
+                }
+                distribution[i] = sum * inverseCount;
+            }
+            rescale(distribution, factor);
+            block.current.setNode(restriction.node, distribution);
+        }
+    }
+}
+
+/**
+ * @brief Performs one collide-and-stream time step on the interior nodes of a block.
+ *
+ * The ghost layer is collided with the interior, and the interior then pulls the post-collision
+ * populations of its neighbors, reflecting those that would come from a solid node.
+ *
+ * @param block The block whose ghost layer holds the populations of its neighbors.
+ * @param level The level of the block.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::stepBlock(Block& block, std::size_t level) const -> void
+{
+    if (block.coarseSource)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            const auto from{std::as_const(block.current).population(i)};
+            std::ranges::copy(from, block.previous.population(i).begin());
+        }
+    }
+
+    relaxBGK<Descriptor>(block.current, relaxationFrequency(level));
+
+    const ScopedPhase phase{Phase::Stream, interior_.size()};
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto from{std::as_const(block.current).population(i)};
+        const auto reflected{std::as_const(block.current).population(Descriptor.opposites[i])};
+        const auto to{block.next.population(i)};
+        const std::ptrdiff_t offset{offsets_[i]};
+
+        for (const std::size_t node : interior_)
+        {
+            const auto source{static_cast<std::size_t>(static_cast<std::ptrdiff_t>(node) - offset)};
+            to[node] = block.solid[source] ? reflected[node] : from[source];
+        }
+    }
+
+    std::swap(block.current, block.next);
+}
+
+/**
+ * @brief Performs one time step of a level and then two time steps of every finer level.
+ *
+ * @param level The level.
+ * @param fraction The fraction of the time step of the next coarser level that has passed.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto RefinedGrid<Descriptor, Scalar>::stepLevel(std::size_t level, Scalar fraction) -> void
+{
+    if (level >= levels_.size())
+    {
+        return;
+    }
+
+    {
+        const ScopedPhase phase{Phase::Boundary, levels_[level].size() * interior_.size()};
+
+        for (Block* block : levels_[level])
+        {
+            fillGhosts(*block, level, fraction);
+        }
+    }
+
+    for (Block* block : levels_[level])
+    {
+        stepBlock(*block, level);
+    }
+
+    stepLevel(level + 1, Scalar{0.0});
+    stepLevel(level + 1, Scalar{0.5});
+}
+
+#endif // REFINEMENT_REFINED_GRID_TPP
@@ -0,0 +1,204 @@
+#ifndef SIMD_PACK_HPP
+#define SIMD_PACK_HPP
+
+/**
+ * @file SimdPack.hpp
+ * @brief Declaration of the SimdPack class template that wraps the widest vector registers
+ * available at compile time.
+ *
+ * The instruction set is selected from the target macros of the compiler, in the order AVX-512,
+ * AVX, SSE2 and a portable scalar fallback. Compile with -march=native or an equivalent flag to
+ * enable the wider instruction sets.
+ */
+
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+
+#if defined(__AVX512F__) || defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @class SimdPack
+ * @brief A class template representing a pack of scalar values that are processed by a single
+ * vector instruction.
+ *
+ * The primary template is the scalar fallback with a width of one. Explicit specializations for
+ * float and double hold a vector register of the selected instruction set.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+class SimdPack
+{
+public:
+    static constexpr std::size_t width{1};
+
+    SimdPack();
+
+    static auto load(const Scalar* address) -> SimdPack;
+    auto store(Scalar* address) const -> void;
+
+    auto operator+(const SimdPack& rhs) const -> SimdPack;
+    auto operator-(const SimdPack& rhs) const -> SimdPack;
+
+private:
+    explicit SimdPack(Scalar value);
+
+    Scalar value_;
+};
+
+#if defined(__AVX512F__)
+
+/**
+ * @brief The name of the instruction set used by SimdPack.
+ */
+constexpr std::string_view SIMD_INSTRUCTION_SET{"AVX-512"};
+
+template <>
+class SimdPack<float>
+{
+public:
+    static constexpr std::size_t width{16};
+
+    SimdPack();
+
+    static auto load(const float* address) -> SimdPack;
+    auto store(float* address) const -> void;
+
+    auto operator+(const SimdPack& rhs) const -> SimdPack;
+    auto operator-(const SimdPack& rhs) const -> SimdPack;
+
+private:
+    explicit SimdPack(__m512 value);
+
+    __m512 value_;
+};
+
+template <>
+class SimdPack<double>
+{
+public:
+    static constexpr std::size_t width{8};
+
+    SimdPack();
+
+    static auto load(const double* address) -> SimdPack;
+    auto store(double* address) const -> void;
+
+    auto operator+(const SimdPack& rhs) const -> SimdPack;
+    auto operator-(const SimdPack& rhs) const -> SimdPack;
+
+private:
+    explicit SimdPack(__m512d value);
+
+    __m512d value_;
+};
+
+#elif defined(__AVX__)
+
+/**
+ * @brief The name of the instruction set used by SimdPack.
+ */
+constexpr std::string_view SIMD_INSTRUCTION_SET{"AVX"};
+
+template <>
+class SimdPack<float>
+{
+public:
+    static constexpr std::size_t width{8};
+
+    SimdPack();
+
+    static auto load(const float* address) -> SimdPack;
+    auto store(float* address) const -> void;
+
+    auto operator+(const SimdPack& rhs) const -> SimdPack;
+    auto operator-(const SimdPack& rhs) const -> SimdPack;
+
+private:
+    explicit SimdPack(__m256 value);
+
+    __m256 value_;
+};
+
+template <>
+class SimdPack<double>
+{
+public:
+    static constexpr std::size_t width{4};
+
+    SimdPack();
+
+    static auto load(const double* address) -> SimdPack;
+    auto store(double* address) const -> void;
+
+    auto operator+(const SimdPack& rhs) const -> SimdPack;
+    auto operator-(const SimdPack& rhs) const -> SimdPack;
+
+private:
+    explicit SimdPack(__m256d value);
+
+    __m256d value_;
+};
+
+#elif defined(__SSE2__)
+
+/**
+ * @brief The name of the instruction set used by SimdPack.
+ */
+constexpr std::string_view SIMD_INSTRUCTION_SET{"SSE2"};
+
+template <>
+class SimdPack<float>
+{
+public:
+    static constexpr std::size_t width{4};
+
+    SimdPack();
+
+    static auto load(const float* address) -> SimdPack;
+    auto store(float* address) const -> void;
+
+    auto operator+(const SimdPack& rhs) const -> SimdPack;
+    auto operator-(const SimdPack& rhs) const -> SimdPack;
+
+private:
+    explicit SimdPack(__m128 value);
+
+    __m128 value_;
+};
+
+template <>
+class SimdPack<double>
+{
+public:
+    static constexpr std::size_t width{2};
+
+    SimdPack();
+
+    static auto load(const double* address) -> SimdPack;
+    auto store(double* address) const -> void;
+
+    auto operator+(const SimdPack& rhs) const -> SimdPack;
+    auto operator-(const SimdPack& rhs) const -> SimdPack;
+
+private:
+    explicit SimdPack(__m128d value);
+
+    __m128d value_;
+};
+
+#else
+
+/**
+ * @brief The name of the instruction set used by SimdPack.
+ */
+constexpr std::string_view SIMD_INSTRUCTION_SET{"Scalar"};
+
+#endif
+
+#include "SimdPack.tpp"
+
+#endif // SIMD_PACK_HPP
@@ -0,0 +1,466 @@
+#ifndef SIMD_PACK_TPP
+#define SIMD_PACK_TPP
+
+/**
+ * @file SimdPack.tpp
+ * @brief Implementation of the SimdPack class template that wraps the widest vector registers
+ * available at compile time.
+ */
+
+;
+#include "SimdPack.hpp"
+
+/**
+ * @brief Default constructor for SimdPack.
+ *
+ * Initializes all values of the pack with zeros.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+SimdPack<Scalar>::SimdPack() : value_{0.0}
+{
+}
+
+/**
+ * @brief Constructor for SimdPack from a register.
+ *
+ * @param value The register holding the values of the pack.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+SimdPack<Scalar>::SimdPack(Scalar value) : value_{value}
+{
+}
+
+/**
+ * @brief Loads a pack from memory without alignment requirements.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ * @return The loaded pack.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto SimdPack<Scalar>::load(const Scalar* address) -> SimdPack
+{
+    return SimdPack{*address};
+}
+
+/**
+ * @brief Stores a pack to memory without alignment requirements.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto SimdPack<Scalar>::store(Scalar* address) const -> void
+{
+    *address = value_;
+}
+
+/**
+ * @brief Adds two packs element-wise.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise sum of this pack and rhs.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto SimdPack<Scalar>::operator+(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{value_ + rhs.value_};
+}
+
+/**
+ * @brief Subtracts two packs element-wise.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise difference between this pack and rhs.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto SimdPack<Scalar>::operator-(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{value_ - rhs.value_};
+}
+
+#if defined(__AVX512F__)
+
+/**
+ * @brief Default constructor for SimdPack<float> using AVX-512.
+ *
+ * Initializes all values of the pack with zeros.
+ */
+inline SimdPack<float>::SimdPack() : value_{_mm512_setzero_ps()}
+{
+}
+
+/**
+ * @brief Constructor for SimdPack<float> from a AVX-512 register.
+ *
+ * @param value The register holding the values of the pack.
+ */
+inline SimdPack<float>::SimdPack(__m512 value) : value_{value}
+{
+}
+
+/**
+ * @brief Loads a pack from memory without alignment requirements using AVX-512.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ * @return The loaded pack.
+ */
+inline auto SimdPack<float>::load(const float* address) -> SimdPack
+{
+    return SimdPack{_mm512_loadu_ps(address)};
+}
+
+/**
+ * @brief Stores a pack to memory without alignment requirements using AVX-512.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ */
+inline auto SimdPack<float>::store(float* address) const -> void
+{
+    _mm512_storeu_ps(address, value_);
+}
+
+/**
+ * @brief Adds two packs element-wise using AVX-512.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise sum of this pack and rhs.
+ */
+inline auto SimdPack<float>::operator+(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{_mm512_add_ps(value_, rhs.value_)};
+}
+
+/**
+ * @brief Subtracts two packs element-wise using AVX-512.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise difference between this pack and rhs.
+ */
+inline auto SimdPack<float>::operator-(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{_mm512_sub_ps(value_, rhs.value_)};
+}
+
+/**
+ * @brief Default constructor for SimdPack<double> using AVX-512.
+ *
+ * Initializes all values of the pack with zeros.
+ */
+inline SimdPack<double>::SimdPack() : value_{_mm512_setzero_pd()}
+{
+}
+
+/**
+ * @brief Constructor for SimdPack<double> from a AVX-512 register.
+ *
+ * @param value The register holding the values of the pack.
+ */
+inline SimdPack<double>::SimdPack(__m512d value) : value_{value}
+{
+}
+
+/**
+ * @brief Loads a pack from memory without alignment requirements using AVX-512.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ * @return The loaded pack.
+ */
+inline auto SimdPack<double>::load(const double* address) -> SimdPack
+{
+    return SimdPack{_mm512_loadu_pd(address)};
+}
+
+/**
+ * @brief Stores a pack to memory without alignment requirements using AVX-512.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ */
+inline auto SimdPack<double>::store(double* address) const -> void
+{
+    _mm512_storeu_pd(address, value_);
+}
+
+/**
+ * @brief Adds two packs element-wise using AVX-512.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise sum of this pack and rhs.
+ */
+inline auto SimdPack<double>::operator+(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{_mm512_add_pd(value_, rhs.value_)};
+}
+
+/**
+ * @brief Subtracts two packs element-wise using AVX-512.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise difference between this pack and rhs.
+ */
+inline auto SimdPack<double>::operator-(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{_mm512_sub_pd(value_, rhs.value_)};
+}
+
+#elif defined(__AVX__)
+
+/**
+ * @brief Default constructor for SimdPack<float> using AVX.
+ *
+ * Initializes all values of the pack with zeros.
+ */
+inline SimdPack<float>::SimdPack() : value_{_mm256_setzero_ps()}
+{
+}
+
+/**
+ * @brief Constructor for SimdPack<float> from a AVX register.
+ *
+ * @param value The register holding the values of the pack.
+ */
+inline SimdPack<float>::SimdPack(__m256 value) : value_{value}
+{
+}
+
+/**
+ * @brief Loads a pack from memory without alignment requirements using AVX.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ * @return The loaded pack.
+ */
+inline auto SimdPack<float>::load(const float* address) -> SimdPack
+{
+    return SimdPack{_mm256_loadu_ps(address)};
+}
+
+/**
+ * @brief Stores a pack to memory without alignment requirements using AVX.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ */
+inline auto SimdPack<float>::store(float* address) const -> void
+{
+    _mm256_storeu_ps(address, value_);
+}
+
+/**
+ * @brief Adds two packs element-wise using AVX.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise sum of this pack and rhs.
+ */
+inline auto SimdPack<float>::operator+(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{_mm256_add_ps(value_, rhs.value_)};
+}
+
+/**
+ * @brief Subtracts two packs element-wise using AVX.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise difference between this pack and rhs.
+ */
+inline auto SimdPack<float>::operator-(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{_mm256_sub_ps(value_, rhs.value_)};
+}
+
+/**
+ * @brief Default constructor for SimdPack<double> using AVX.
+ *
+ * Initializes all values of the pack with zeros.
+ */
+inline SimdPack<double>::SimdPack() : value_{_mm256_setzero_pd()}
+{
+}
+
+/**
+ * @brief Constructor for SimdPack<double> from a AVX register.
+ *
+ * @param value The register holding the values of the pack.
+ */
+inline SimdPack<double>::SimdPack(__m256d value) : value_{value}
+{
+}
+
+/**
+ * @brief Loads a pack from memory without alignment requirements using AVX.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ * @return The loaded pack.
+ */
+inline auto SimdPack<double>::load(const double* address) -> SimdPack
+{
+    return SimdPack{_mm256_loadu_pd(address)};
+}
+
+/**
+ * @brief Stores a pack to memory without alignment requirements using AVX.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ */
+inline auto SimdPack<double>::store(double* address) const -> void
+{
+    _mm256_storeu_pd(address, value_);
+}
+
+/**
+ * @brief Adds two packs element-wise using AVX.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise sum of this pack and rhs.
+ */
+inline auto SimdPack<double>::operator+(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{_mm256_add_pd(value_, rhs.value_)};
+}
+
+/**
+ * @brief Subtracts two packs element-wise using AVX.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise difference between this pack and rhs.
+ */
+inline auto SimdPack<double>::operator-(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{_mm256_sub_pd(value_, rhs.value_)};
+}
+
+#elif defined(__SSE2__)
+
+/**
+ * @brief Default constructor for SimdPack<float> using SSE2.
+ *
+ * Initializes all values of the pack with zeros.
+ */
+inline SimdPack<float>::SimdPack() : value_{_mm_setzero_ps()}
+{
+}
+
+/**
+ * @brief Constructor for SimdPack<float> from a SSE2 register.
+ *
+ * @param value The register holding the values of the pack.
+ */
+inline SimdPack<float>::SimdPack(__m128 value) : value_{value}
+{
+}
+
+/**
+ * @brief Loads a pack from memory without alignment requirements using SSE2.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ * @return The loaded pack.
+ */
+inline auto SimdPack<float>::load(const float* address) -> SimdPack
+{
+    return SimdPack{_mm_loadu_ps(address)};
+}
+
+/**
+ * @brief Stores a pack to memory without alignment requirements using SSE2.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ */
+inline auto SimdPack<float>::store(float* address) const -> void
+{
+    _mm_storeu_ps(address, value_);
+}
+
+/**
+ * @brief Adds two packs element-wise using SSE2.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise sum of this pack and rhs.
+ */
+inline auto SimdPack<float>::operator+(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{_mm_add_ps(value_, rhs.value_)};
+}
+
+/**
+ * @brief Subtracts two packs element-wise using SSE2.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise difference between this pack and rhs.
+ */
+inline auto SimdPack<float>::operator-(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{_mm_sub_ps(value_, rhs.value_)};
+}
+
+/**
+ * @brief Default constructor for SimdPack<double> using SSE2.
+ *
+ * Initializes all values of the pack with zeros.
+ */
+inline SimdPack<double>::SimdPack() : value_{_mm_setzero_pd()}
+{
+}
+
+/**
+ * @brief Constructor for SimdPack<double> from a SSE2 register.
+ *
+ * @param value The register holding the values of the pack.
+ */
+inline SimdPack<double>::SimdPack(__m128d value) : value_{value}
+{
+}
+
+/**
+ * @brief Loads a pack from memory without alignment requirements using SSE2.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ * @return The loaded pack.
+ */
+inline auto SimdPack<double>::load(const double* address) -> SimdPack
+{
+    return SimdPack{_mm_loadu_pd(address)};
+}
+
+/**
+ * @brief Stores a pack to memory without alignment requirements using SSE2.
+ *
+ * @param address Pointer to the first of width consecutive scalar values.
+ */
+inline auto SimdPack<double>::store(double* address) const -> void
+{
+    _mm_storeu_pd(address, value_);
+}
+
+/**
+ * @brief Adds two packs element-wise using SSE2.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise sum of this pack and rhs.
+ */
+inline auto SimdPack<double>::operator+(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{_mm_add_pd(value_, rhs.value_)};
+}
+
+/**
+ * @brief Subtracts two packs element-wise using SSE2.
+ *
+ * @param rhs The right-hand side pack.
+ * @return The element-wise difference between this pack and rhs.
+ */
+inline auto SimdPack<double>::operator-(const SimdPack& rhs) const -> SimdPack
+{
+    return SimdPack{_mm_sub_pd(value_, rhs.value_)};
+}
+
+#endif
+
+#endif // SIMD_PACK_TPP
@@ -0,0 +1,266 @@
+#ifndef STREAMING_AA_PATTERN_HPP
+#define STREAMING_AA_PATTERN_HPP
+
+/**
+ * @file aaPattern.hpp
+ * @brief Declaration of in-place streaming functions that follow the AA access pattern on a single
+ * population buffer.
+ *
+ * The AA pattern alternates between two kinds of time steps. Even time steps read the populations
+ * of a node, collide them and write them back to the same node in the slots of the opposite
+ * lattice vectors. Odd time steps read the populations that neighbors stored for a node, collide
+ * them and write them to the neighbors they stream to. Every population is read and written once
+ * per time step without a second buffer. After an even number of time steps the lattice holds the
+ * populations in their natural layout, otherwise gatherAA recovers the density distribution of a
+ * node. All boundaries are periodic and lattice velocity components must lie in {-1, 0, 1}.
+ *
+ * Each node reads and writes the same set of population slots in both kinds of time steps, and the
+ * slot sets of different nodes are disjoint. Tiles of a lattice can therefore be updated
+ * concurrently and in any order with bit-identical results.
+ *
+ * On a SparseLattice, odd time steps take the slots from its stream-slot table instead of from
+ * neighbor arithmetic, which applies halfway bounce-back at solid nodes with the same access.
+ *
+ * A collision callable updates the populations of one node, passed as an array of Size scalar
+ * values. On a Lattice or MixedPrecisionLattice, a callable that instead accepts a block of up to
+ * STREAM_BLOCK_SIZE consecutive nodes of a row, passed as one array of nodes per lattice vector
+ * together with the number of nodes, is called once per block, so it can vectorize across nodes.
+ */
+
+#include "../densityDistribution/d2q5.hpp"
+#include "../densityDistribution/d2q9.hpp"
+#include "../instrumentation/PhaseRecorder.hpp"
+#include "../lattice/Lattice.hpp"
+#include "../lattice/MixedPrecisionLattice.hpp"
+#include "../lattice/SparseLattice.hpp"
+#include "../lattice/Tiling.hpp"
+#include "../parallel/TiledScheduler.hpp"
+#include <concepts>
+
+/**
+ * @brief The number of lattice nodes of a row that a sweep passes to a block collision at once.
+ */
+constexpr std::size_t STREAM_BLOCK_SIZE{64};
+
+constexpr auto periodicShift(std::size_t coordinate, int velocity, std::size_t extent)
+    -> std::size_t;
+
+template <std::size_t Dimension>
+constexpr auto periodicNeighbor(
+    const std::array<std::size_t, Dimension>& extents,
+    std::size_t index,
+    const std::array<int, Dimension>& velocity
+) -> std::size_t;
+
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Collision,
+    typename Load,
+    typename Store>
+auto sweepBlocksAA(
+    const std::array<std::size_t, Dimension>& extents,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    const LatticeTile<Dimension>& tile,
+    Load load,
+    Store store
+) -> void;
+
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Collision,
+    typename Load,
+    typename Store>
+auto sweepNodesAA(
+    const std::array<std::size_t, Dimension>& extents,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    const LatticeTile<Dimension>& tile,
+    Load load,
+    Store store
+) -> void;
+
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Collision,
+    typename Load,
+    typename Store>
+auto sweepAA(
+    const std::array<std::size_t, Dimension>& extents,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    const LatticeTile<Dimension>& tile,
+    Load load,
+    Store store
+) -> void;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision
+) -> void;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    const LatticeTile<Dimension>& tile
+) -> void;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    TiledScheduler<Dimension>& scheduler
+) -> void;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto gatherAA(
+    const Lattice<Dimension, Size, Scalar>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t index,
+    std::size_t completedSteps
+) -> DensityDistribution<Dimension, Size, Scalar>;
+
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    StorageFormat Format,
+    typename Collision>
+auto streamAA(
+    MixedPrecisionLattice<Dimension, Size, Scalar, Format>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision
+) -> void;
+
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    StorageFormat Format,
+    typename Collision>
+auto streamAA(
+    MixedPrecisionLattice<Dimension, Size, Scalar, Format>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    const LatticeTile<Dimension>& tile
+) -> void;
+
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    StorageFormat Format,
+    typename Collision>
+auto streamAA(
+    MixedPrecisionLattice<Dimension, Size, Scalar, Format>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    TiledScheduler<Dimension>& scheduler
+) -> void;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto gatherAA(
+    const MixedPrecisionLattice<Dimension, Size, Scalar, Format>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t index,
+    std::size_t completedSteps
+) -> DensityDistribution<Dimension, Size, Scalar>;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Collision>
+auto streamAA(
+    SparseLattice<Dimension, Size, Scalar>& lattice,
+    std::size_t timeStep,
+    Collision collision
+) -> void;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto gatherAA(
+    const SparseLattice<Dimension, Size, Scalar>& lattice,
+    std::size_t index,
+    std::size_t completedSteps
+) -> DensityDistribution<Dimension, Size, Scalar>;
+
+template <std::floating_point Scalar>
+auto streamAA(Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice, std::size_t timeStep) -> void;
+
+template <std::floating_point Scalar>
+auto streamAA(Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice, std::size_t timeStep) -> void;
+
+template <std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::size_t timeStep,
+    Collision collision
+) -> void;
+
+template <std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::size_t timeStep,
+    Collision collision
+) -> void;
+
+template <std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::size_t timeStep,
+    Collision collision,
+    TiledScheduler<D2Q5_DIMENSION>& scheduler
+) -> void;
+
+template <std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::size_t timeStep,
+    Collision collision,
+    TiledScheduler<D2Q9_DIMENSION>& scheduler
+) -> void;
+
+template <std::floating_point Scalar>
+auto gatherAA(
+    const Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::size_t index,
+    std::size_t completedSteps
+) -> D2Q5<Scalar>;
+
+template <std::floating_point Scalar>
+auto gatherAA(
+    const Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::size_t index,
+    std::size_t completedSteps
+) -> D2Q9<Scalar>;
+
+#include "aaPattern.tpp"
+
+#endif // STREAMING_AA_PATTERN_HPP
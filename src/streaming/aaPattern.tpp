@@ -0,0 +1,962 @@
+#ifndef STREAMING_AA_PATTERN_TPP
+#define STREAMING_AA_PATTERN_TPP
+
+/**
+ * @file aaPattern.tpp
+ * @brief Implementation of in-place streaming functions that follow the AA access pattern on a
+ * single population buffer.
+ */
+
+;
+#include "aaPattern.hpp"
+
+/**
+ * @brief Shifts a coordinate by one velocity component on a periodic axis.
+ *
+ * @param coordinate The coordinate along the axis.
+ * @param velocity The velocity component along the axis, which must lie in {-1, 0, 1}.
+ * @param extent The number of lattice nodes along the axis.
+ * @return The shifted coordinate, wrapped around the ends of the axis.
+ */
+constexpr auto periodicShift(std::size_t coordinate, int velocity, std::size_t extent)
+    -> std::size_t
+{
+    if (velocity < 0)
+    {
+        return coordinate == 0 ? extent - 1 : coordinate - 1;
+    }
+    if (velocity > 0)
+    {
+        return coordinate + 1 == extent ? 0 : coordinate + 1;
+    }
+    return coordinate;
+}
+
+/**
+ * @brief Returns the linear index of the neighbor of a lattice node on a periodic lattice.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param index The linear index of the lattice node.
+ * @param velocity The lattice velocity that points from the lattice node to its neighbor.
+ * @return The linear index of the neighbor.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ */
+template <std::size_t Dimension>
+constexpr auto periodicNeighbor(
+    const std::array<std::size_t, Dimension>& extents,
+    std::size_t index,
+    const std::array<int, Dimension>& velocity
+) -> std::size_t
+{
+    std::size_t neighbor{0};
+    std::size_t stride{1};
+
+    for (std::size_t axis = 0; axis < Dimension; ++axis)
+    {
+        const std::size_t coordinate{index % extents[axis]};
+        index /= extents[axis];
+        neighbor += periodicShift(coordinate, velocity[axis], extents[axis]) * stride;
+        stride *= extents[axis];
+    }
+
+    return neighbor;
+}
+
+/**
+ * @brief Performs one fused collide-and-stream time step of the AA pattern.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param timeStep The index of the time step, whose parity selects the kind of access.
+ * @param collision A callable that updates the populations of one node, passed as an array of Size
+ * scalar values in lattice vector order.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Collision The type of the collision callable.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision
+) -> void
+{
+    LatticeTile<Dimension> tile;
+    tile.begin.fill(0);
+    tile.end = lattice.extents();
+
+    streamAA(lattice, velocities, opposites, timeStep, collision, tile);
+}
+
+/**
+ * @brief Sweeps a tile with the access of one AA time step through population accessors, passing
+ * blocks of nodes to the collision.
+ *
+ * Each row is cut into blocks of up to STREAM_BLOCK_SIZE nodes. The populations of a block are
+ * loaded lattice vector by lattice vector into a local buffer, collided in one call and stored
+ * back in the same order, so every load and store loop runs along the row with unit stride apart
+ * from the periodic wrap. Every node reads and writes only its own slots, so the result equals
+ * that of a node-by-node sweep with the same collision.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param timeStep The index of the time step, whose parity selects the kind of access.
+ * @param collision A callable collision(block, count) that updates the populations of the first
+ * count nodes of a block, passed as one array of STREAM_BLOCK_SIZE scalar values per lattice
+ * vector.
+ * @param tile The tile of lattice nodes to update.
+ * @param load A callable load(direction, node) that returns a population as Scalar.
+ * @param store A callable store(direction, node, value) that writes a population.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type in which populations are collided.
+ * @tparam Collision The type of the collision callable.
+ * @tparam Load The type of the load callable.
+ * @tparam Store The type of the store callable.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Collision,
+    typename Load,
+    typename Store>
+auto sweepBlocksAA(
+    const std::array<std::size_t, Dimension>& extents,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    const LatticeTile<Dimension>& tile,
+    Load load,
+    Store store
+) -> void
+{
+    const ScopedPhase phase{Phase::Stream, tileNodeCount(tile)};
+
+    alignas(CACHE_LINE_SIZE) std::array<std::array<Scalar, STREAM_BLOCK_SIZE>, Size> block;
+    const bool even{timeStep % 2 == 0};
+    const std::size_t rowLength{extents[0]};
+    std::array<std::size_t, Size> rowStarts;
+
+    forEachRow(tile, extents, [&](std::size_t firstNode, std::size_t lastNode) {
+        const std::size_t rowStart{firstNode - tile.begin[0]};
+
+        if (!even)
+        {
+            for (std::size_t i = 0; i < Size; ++i)
+            {
+                std::array<int, Dimension> rowVelocity{velocities[i]};
+                rowVelocity[0] = 0;
+                rowStarts[i] = periodicNeighbor(extents, rowStart, rowVelocity);
+            }
+        }
+
+        for (std::size_t first = 0; first < lastNode - firstNode; first += STREAM_BLOCK_SIZE)
+        {
+            const std::size_t count{std::min(STREAM_BLOCK_SIZE, lastNode - firstNode - first)};
+            const std::size_t firstX{tile.begin[0] + first};
+
+            for (std::size_t i = 0; i < Size; ++i)
+            {
+                if (even)
+                {
+                    for (std::size_t node = 0; node < count; ++node)
+                    {
+                        block[i][node] = load(i, firstNode + first + node);
+                    }
+                    continue;
+                }
+
+                const std::size_t opposite{opposites[i]};
+                for (std::size_t node = 0; node < count; ++node)
+                {
+                    block[i][node] = load(
+                        opposite,
+                        rowStarts[opposite] +
+                            periodicShift(firstX + node, velocities[opposite][0], rowLength)
+                    );
+                }
+            }
+
+            collision(block, count);
+
+            for (std::size_t i = 0; i < Size; ++i)
+            {
+                if (even)
+                {
+                    for (std::size_t node = 0; node < count; ++node)
+                    {
+                        store(opposites[i], firstNode + first + node, block[i][node]);
+                    }
+                    continue;
+                }
+
+                for (std::size_t node = 0; node < count; ++node)
+                {
+                    store(
+                        i,
+                        rowStarts[i] + periodicShift(firstX + node, velocities[i][0], rowLength),
+                        block[i][node]
+                    );
+                }
+            }
+        }
+    });
+}
+
+/**
+ * @brief Sweeps a tile with the access of one AA time step through population accessors, passing
+ * one node at a time to the collision.
+ *
+ * Nodes are swept row by row along the first axis, so the populations of a node and of its
+ * neighbors are accessed with unit stride within each population array.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param timeStep The index of the time step, whose parity selects the kind of access.
+ * @param collision A callable that updates the populations of one node, passed as an array of Size
+ * scalar values in lattice vector order.
+ * @param tile The tile of lattice nodes to update.
+ * @param load A callable load(direction, node) that returns a population as Scalar.
+ * @param store A callable store(direction, node, value) that writes a population.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type in which populations are collided.
+ * @tparam Collision The type of the collision callable.
+ * @tparam Load The type of the load callable.
+ * @tparam Store The type of the store callable.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Collision,
+    typename Load,
+    typename Store>
+auto sweepNodesAA(
+    const std::array<std::size_t, Dimension>& extents,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    const LatticeTile<Dimension>& tile,
+    Load load,
+    Store store
+) -> void
+{
+    const ScopedPhase phase{Phase::Stream, tileNodeCount(tile)};
+
+    std::array<Scalar, Size> values;
+
+    if (timeStep % 2 == 0)
+    {
+        forEachRow(tile, extents, [&](std::size_t firstNode, std::size_t lastNode) {
+            for (std::size_t node = firstNode; node < lastNode; ++node)
+            {
+                for (std::size_t i = 0; i < Size; ++i)
+                {
+                    values[i] = load(i, node);
+                }
+
+                collision(values);
+
+                for (std::size_t i = 0; i < Size; ++i)
+                {
+                    store(opposites[i], node, values[i]);
+                }
+            }
+        });
+
+        return;
+    }
+
+    const std::size_t rowLength{extents[0]};
+    std::array<std::size_t, Size> rowStarts;
+    std::array<std::size_t, Size> neighbors;
+
+    forEachRow(tile, extents, [&](std::size_t firstNode, std::size_t lastNode) {
+        const std::size_t rowStart{firstNode - tile.begin[0]};
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            std::array<int, Dimension> rowVelocity{velocities[i]};
+            rowVelocity[0] = 0;
+            rowStarts[i] = periodicNeighbor(extents, rowStart, rowVelocity);
+        }
+
+        for (std::size_t x = tile.begin[0]; x < tile.begin[0] + lastNode - firstNode; ++x)
+        {
+            for (std::size_t i = 0; i < Size; ++i)
+            {
+                neighbors[i] = rowStarts[i] + periodicShift(x, velocities[i][0], rowLength);
+            }
+
+            for (std::size_t i = 0; i < Size; ++i)
+            {
+                values[i] = load(opposites[i], neighbors[opposites[i]]);
+            }
+
+            collision(values);
+
+            for (std::size_t i = 0; i < Size; ++i)
+            {
+                store(i, neighbors[i], values[i]);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Sweeps a tile with the access of one AA time step through population accessors.
+ *
+ * Hands a collision that accepts a block of STREAM_BLOCK_SIZE nodes and a node count to
+ * sweepBlocksAA and any other collision to sweepNodesAA.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param timeStep The index of the time step, whose parity selects the kind of access.
+ * @param collision A callable that updates the populations of one node or of a block of nodes.
+ * @param tile The tile of lattice nodes to update.
+ * @param load A callable load(direction, node) that returns a population as Scalar.
+ * @param store A callable store(direction, node, value) that writes a population.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type in which populations are collided.
+ * @tparam Collision The type of the collision callable.
+ * @tparam Load The type of the load callable.
+ * @tparam Store The type of the store callable.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    typename Collision,
+    typename Load,
+    typename Store>
+auto sweepAA(
+    const std::array<std::size_t, Dimension>& extents,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    const LatticeTile<Dimension>& tile,
+    Load load,
+    Store store
+) -> void
+{
+    if constexpr (std::invocable<
+                      Collision&,
+                      std::array<std::array<Scalar, STREAM_BLOCK_SIZE>, Size>&,
+                      std::size_t>)
+    {
+        sweepBlocksAA<Dimension, Size, Scalar>(
+            extents, velocities, opposites, timeStep, collision, tile, load, store
+        );
+    }
+    else
+    {
+        sweepNodesAA<Dimension, Size, Scalar>(
+            extents, velocities, opposites, timeStep, collision, tile, load, store
+        );
+    }
+}
+
+/**
+ * @brief Performs one fused collide-and-stream time step of the AA pattern on a tile.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param timeStep The index of the time step, whose parity selects the kind of access.
+ * @param collision A callable that updates the populations of one node, passed as an array of Size
+ * scalar values in lattice vector order.
+ * @param tile The tile of lattice nodes to update.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Collision The type of the collision callable.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    const LatticeTile<Dimension>& tile
+) -> void
+{
+    std::array<std::span<Scalar>, Size> populations;
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        populations[i] = lattice.population(i);
+    }
+
+    sweepAA<Dimension, Size, Scalar>(
+        lattice.extents(),
+        velocities,
+        opposites,
+        timeStep,
+        collision,
+        tile,
+        [&](std::size_t direction, std::size_t node) { return populations[direction][node]; },
+        [&](std::size_t direction, std::size_t node, Scalar value) {
+            populations[direction][node] = value;
+        }
+    );
+}
+
+/**
+ * @brief Performs one fused collide-and-stream time step of the AA pattern on all tiles of a
+ * scheduler in parallel.
+ *
+ * Every tile runs on the worker that owns it, without work stealing, so each worker touches only
+ * the population pages that the first-touch constructor of the lattice placed on its NUMA node.
+ * The result is bit-identical to the sequential time step for any number of threads.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param timeStep The index of the time step, whose parity selects the kind of access.
+ * @param collision A callable that updates the populations of one node, which must be safe to call
+ * concurrently from several threads.
+ * @param scheduler A scheduler created for the extents of the lattice.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Collision The type of the collision callable.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    TiledScheduler<Dimension>& scheduler
+) -> void
+{
+    scheduler.forEachOwnedTile([&](const LatticeTile<Dimension>& tile) {
+        streamAA(lattice, velocities, opposites, timeStep, collision, tile);
+    });
+}
+
+/**
+ * @brief Gathers the density distribution at a lattice node after a number of AA time steps.
+ *
+ * @param lattice The lattice that was updated with streamAA.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param index Linear index of the lattice node.
+ * @param completedSteps The number of AA time steps performed on the lattice so far.
+ * @return A copy of the streamed density distribution at the lattice node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto gatherAA(
+    const Lattice<Dimension, Size, Scalar>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t index,
+    std::size_t completedSteps
+) -> DensityDistribution<Dimension, Size, Scalar>
+{
+    if (completedSteps % 2 == 0)
+    {
+        return lattice.node(index);
+    }
+
+    DensityDistribution<Dimension, Size, Scalar> distribution;
+
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        const std::size_t opposite{opposites[i]};
+        const std::size_t neighbor{
+            periodicNeighbor(lattice.extents(), index, velocities[opposite])
+        };
+        distribution[i] = lattice.population(opposite)[neighbor];
+    }
+
+    return distribution;
+}
+
+/**
+ * @brief Performs one fused collide-and-stream time step of the AA pattern on a mixed-precision
+ * lattice.
+ *
+ * Populations are widened to Scalar before the collision and narrowed to the storage format after
+ * it, so only the stored values are rounded to the storage precision.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param timeStep The index of the time step, whose parity selects the kind of access.
+ * @param collision A callable that updates the populations of one node, passed as an array of Size
+ * scalar values in lattice vector order.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ * @tparam Collision The type of the collision callable.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    StorageFormat Format,
+    typename Collision>
+auto streamAA(
+    MixedPrecisionLattice<Dimension, Size, Scalar, Format>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision
+) -> void
+{
+    LatticeTile<Dimension> tile;
+    tile.begin.fill(0);
+    tile.end = lattice.extents();
+
+    streamAA(lattice, velocities, opposites, timeStep, collision, tile);
+}
+
+/**
+ * @brief Performs one fused collide-and-stream time step of the AA pattern on a tile of a
+ * mixed-precision lattice.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param timeStep The index of the time step, whose parity selects the kind of access.
+ * @param collision A callable that updates the populations of one node, passed as an array of Size
+ * scalar values in lattice vector order.
+ * @param tile The tile of lattice nodes to update.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ * @tparam Collision The type of the collision callable.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    StorageFormat Format,
+    typename Collision>
+auto streamAA(
+    MixedPrecisionLattice<Dimension, Size, Scalar, Format>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    const LatticeTile<Dimension>& tile
+) -> void
+{
+    sweepAA<Dimension, Size, Scalar>(
+        lattice.extents(),
+        velocities,
+        opposites,
+        timeStep,
+        collision,
+        tile,
+        [&](std::size_t direction, std::size_t node) { return lattice.load(direction, node); },
+        [&](std::size_t direction, std::size_t node, Scalar value) {
+            lattice.store(direction, node, value);
+        }
+    );
+}
+
+/**
+ * @brief Performs one fused collide-and-stream time step of the AA pattern on all tiles of a
+ * mixed-precision lattice in parallel.
+ *
+ * Every tile runs on the worker that owns it, without work stealing.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param timeStep The index of the time step, whose parity selects the kind of access.
+ * @param collision A callable that updates the populations of one node, which must be safe to call
+ * concurrently from several threads.
+ * @param scheduler A scheduler created for the extents of the lattice.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ * @tparam Collision The type of the collision callable.
+ */
+template <
+    std::size_t Dimension,
+    std::size_t Size,
+    std::floating_point Scalar,
+    StorageFormat Format,
+    typename Collision>
+auto streamAA(
+    MixedPrecisionLattice<Dimension, Size, Scalar, Format>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t timeStep,
+    Collision collision,
+    TiledScheduler<Dimension>& scheduler
+) -> void
+{
+    scheduler.forEachOwnedTile([&](const LatticeTile<Dimension>& tile) {
+        streamAA(lattice, velocities, opposites, timeStep, collision, tile);
+    });
+}
+
+/**
+ * @brief Gathers the density distribution at a node of a mixed-precision lattice after a number
+ * of AA time steps.
+ *
+ * @param lattice The lattice that was updated with streamAA.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param index Linear index of the lattice node.
+ * @param completedSteps The number of AA time steps performed on the lattice so far.
+ * @return A widened copy of the streamed density distribution at the lattice node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of computed values.
+ * @tparam Format The storage format of populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, StorageFormat Format>
+auto gatherAA(
+    const MixedPrecisionLattice<Dimension, Size, Scalar, Format>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t index,
+    std::size_t completedSteps
+) -> DensityDistribution<Dimension, Size, Scalar>
+{
+    if (completedSteps % 2 == 0)
+    {
+        return lattice.node(index);
+    }
+
+    DensityDistribution<Dimension, Size, Scalar> distribution;
+
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        const std::size_t opposite{opposites[i]};
+        const std::size_t neighbor{
+            periodicNeighbor(lattice.extents(), index, velocities[opposite])
+        };
+        distribution[i] = lattice.load(opposite, neighbor);
+    }
+
+    return distribution;
+}
+
+/**
+ * @brief Performs one fused collide-and-stream time step of the AA pattern on a sparse lattice.
+ *
+ * Even time steps are the same as on a dense lattice. Odd time steps read and write the slots of
+ * the stream-slot table, so only fluid nodes are visited and populations that would stream into a
+ * solid node are reflected back to their origin.
+ *
+ * @param lattice The sparse lattice whose populations are updated in place.
+ * @param timeStep The index of the time step, whose parity selects the kind of access.
+ * @param collision A callable that updates the populations of one node, passed as an array of Size
+ * scalar values in lattice vector order.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Collision The type of the collision callable.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Collision>
+auto streamAA(
+    SparseLattice<Dimension, Size, Scalar>& lattice,
+    std::size_t timeStep,
+    Collision collision
+) -> void
+{
+    const ScopedPhase phase{Phase::Stream, lattice.nodeCount()};
+
+    const std::array<std::size_t, Size>& opposites{lattice.opposites()};
+    const std::span<Scalar> slots{lattice.slots()};
+    std::array<Scalar, Size> values;
+
+    if (timeStep % 2 == 0)
+    {
+        std::array<std::span<Scalar>, Size> populations;
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            populations[i] = lattice.population(i);
+        }
+
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            for (std::size_t i = 0; i < Size; ++i)
+            {
+                values[i] = populations[i][node];
+            }
+
+            collision(values);
+
+            for (std::size_t i = 0; i < Size; ++i)
+            {
+                populations[opposites[i]][node] = values[i];
+            }
+        }
+
+        return;
+    }
+
+    std::array<std::span<const std::uint32_t>, Size> streamSlots;
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        streamSlots[i] = lattice.streamSlots(i);
+    }
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            values[i] = slots[streamSlots[opposites[i]][node]];
+        }
+
+        collision(values);
+
+        for (std::size_t i = 0; i < Size; ++i)
+        {
+            slots[streamSlots[i][node]] = values[i];
+        }
+    }
+}
+
+/**
+ * @brief Gathers the density distribution at a fluid node of a sparse lattice after a number of AA
+ * time steps.
+ *
+ * @param lattice The sparse lattice that was updated with streamAA.
+ * @param index Compact index of the fluid node.
+ * @param completedSteps The number of AA time steps performed on the lattice so far.
+ * @return A copy of the streamed density distribution at the fluid node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto gatherAA(
+    const SparseLattice<Dimension, Size, Scalar>& lattice,
+    std::size_t index,
+    std::size_t completedSteps
+) -> DensityDistribution<Dimension, Size, Scalar>
+{
+    if (completedSteps % 2 == 0)
+    {
+        return lattice.node(index);
+    }
+
+    DensityDistribution<Dimension, Size, Scalar> distribution;
+
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        distribution[i] = lattice.slots()[lattice.streamSlots(lattice.opposites()[i])[index]];
+    }
+
+    return distribution;
+}
+
+/**
+ * @brief Performs one AA streaming time step without collision on a D2Q5 lattice.
+ *
+ * @param lattice A D2Q5 lattice, updated in place.
+ * @param timeStep The index of the time step.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto streamAA(Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice, std::size_t timeStep) -> void
+{
+    streamAA(lattice, timeStep, [](std::array<Scalar, D2Q5_SIZE>& values) {
+        static_cast<void>(values);
+    });
+}
+
+/**
+ * @brief Performs one AA streaming time step without collision on a D2Q9 lattice.
+ *
+ * @param lattice A D2Q9 lattice, updated in place.
+ * @param timeStep The index of the time step.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto streamAA(Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice, std::size_t timeStep) -> void
+{
+    streamAA(lattice, timeStep, [](std::array<Scalar, D2Q9_SIZE>& values) {
+        static_cast<void>(values);
+    });
+}
+
+/**
+ * @brief Performs one fused collide-and-stream AA time step on a D2Q5 lattice.
+ *
+ * @param lattice A D2Q5 lattice, updated in place.
+ * @param timeStep The index of the time step.
+ * @param collision A callable that updates the populations of one node.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Collision The type of the collision callable.
+ */
+template <std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::size_t timeStep,
+    Collision collision
+) -> void
+{
+    constexpr D2Q5<Scalar> model;
+
+    streamAA(lattice, latticeVelocities(model), latticeOpposites(model), timeStep, collision);
+}
+
+/**
+ * @brief Performs one fused collide-and-stream AA time step on a D2Q9 lattice.
+ *
+ * @param lattice A D2Q9 lattice, updated in place.
+ * @param timeStep The index of the time step.
+ * @param collision A callable that updates the populations of one node.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Collision The type of the collision callable.
+ */
+template <std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::size_t timeStep,
+    Collision collision
+) -> void
+{
+    constexpr D2Q9<Scalar> model;
+
+    streamAA(lattice, latticeVelocities(model), latticeOpposites(model), timeStep, collision);
+}
+
+/**
+ * @brief Performs one fused collide-and-stream AA time step on a D2Q5 lattice in parallel.
+ *
+ * @param lattice A D2Q5 lattice, updated in place.
+ * @param timeStep The index of the time step.
+ * @param collision A callable that updates the populations of one node concurrently.
+ * @param scheduler A scheduler created for the extents of the lattice.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Collision The type of the collision callable.
+ */
+template <std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::size_t timeStep,
+    Collision collision,
+    TiledScheduler<D2Q5_DIMENSION>& scheduler
+) -> void
+{
+    constexpr D2Q5<Scalar> model;
+
+    streamAA(
+        lattice, latticeVelocities(model), latticeOpposites(model), timeStep, collision, scheduler
+    );
+}
+
+/**
+ * @brief Performs one fused collide-and-stream AA time step on a D2Q9 lattice in parallel.
+ *
+ * @param lattice A D2Q9 lattice, updated in place.
+ * @param timeStep The index of the time step.
+ * @param collision A callable that updates the populations of one node concurrently.
+ * @param scheduler A scheduler created for the extents of the lattice.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Collision The type of the collision callable.
+ */
+template <std::floating_point Scalar, typename Collision>
+auto streamAA(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::size_t timeStep,
+    Collision collision,
+    TiledScheduler<D2Q9_DIMENSION>& scheduler
+) -> void
+{
+    constexpr D2Q9<Scalar> model;
+
+    streamAA(
+        lattice, latticeVelocities(model), latticeOpposites(model), timeStep, collision, scheduler
+    );
+}
+
+/**
+ * @brief Gathers the density distribution at a node of a D2Q5 lattice after AA time steps.
+ *
+ * @param lattice A D2Q5 lattice that was updated with streamAA.
+ * @param index Linear index of the lattice node.
+ * @param completedSteps The number of AA time steps performed on the lattice so far.
+ * @return A copy of the streamed D2Q5 density distribution at the lattice node.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto gatherAA(
+    const Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::size_t index,
+    std::size_t completedSteps
+) -> D2Q5<Scalar>
+{
+    constexpr D2Q5<Scalar> model;
+
+    return gatherAA(
+        lattice, latticeVelocities(model), latticeOpposites(model), index, completedSteps
+    );
+}
+
+/**
+ * @brief Gathers the density distribution at a node of a D2Q9 lattice after AA time steps.
+ *
+ * @param lattice A D2Q9 lattice that was updated with streamAA.
+ * @param index Linear index of the lattice node.
+ * @param completedSteps The number of AA time steps performed on the lattice so far.
+ * @return A copy of the streamed D2Q9 density distribution at the lattice node.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::floating_point Scalar>
+auto gatherAA(
+    const Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::size_t index,
+    std::size_t completedSteps
+) -> D2Q9<Scalar>
+{
+    constexpr D2Q9<Scalar> model;
+
+    return gatherAA(
+        lattice, latticeVelocities(model), latticeOpposites(model), index, completedSteps
+    );
+}
+
+#endif // STREAMING_AA_PATTERN_TPP
@@ -0,0 +1,57 @@
+#ifndef STREAMING_WAVEFRONT_HPP
+#define STREAMING_WAVEFRONT_HPP
+
+/**
+ * @file wavefront.hpp
+ * @brief Declaration of temporally blocked AA time stepping that advances bands of a lattice by
+ * several time steps while they are held in cache.
+ *
+ * The lattice is cut into bands of layers along its last axis. A wave advances every time step of
+ * a block by one band, with each time step lagging one layer behind the previous one, so the
+ * layers of a band are read from memory once and then updated by all time steps of the block
+ * before they are evicted. Time step t of a block covers the layers t to t + extent - 1, wrapped
+ * around the periodic last axis, which places the seam of every time step behind the seam of the
+ * previous one. Every population slot is therefore accessed by consecutive time steps in order,
+ * and the result is bit-identical to calling streamAA once per time step.
+ */
+
+#include "aaPattern.hpp"
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto defaultWavefrontExtent(
+    const std::array<std::size_t, Dimension>& extents,
+    std::size_t depth
+) -> std::size_t;
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Collision>
+auto streamWavefrontAA(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t firstStep,
+    std::size_t depth,
+    std::size_t bandExtent,
+    Collision collision
+) -> void;
+
+template <std::floating_point Scalar, typename Collision>
+auto streamWavefrontAA(
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::size_t firstStep,
+    std::size_t depth,
+    std::size_t bandExtent,
+    Collision collision
+) -> void;
+
+template <std::floating_point Scalar, typename Collision>
+auto streamWavefrontAA(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::size_t firstStep,
+    std::size_t depth,
+    std::size_t bandExtent,
+    Collision collision
+) -> void;
+
+#include "wavefront.tpp"
+
+#endif // STREAMING_WAVEFRONT_HPP
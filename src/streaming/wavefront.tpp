@@ -0,0 +1,205 @@
+#ifndef STREAMING_WAVEFRONT_TPP
+#define STREAMING_WAVEFRONT_TPP
+
+/**
+ * @file wavefront.tpp
+ * @brief Implementation of temporally blocked AA time stepping that advances bands of a lattice by
+ * several time steps while they are held in cache.
+ */
+
+;
+#include "wavefront.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Returns the band extent whose working set fits into TILE_CACHE_SIZE bytes.
+ *
+ * A wave touches the layers of one band plus one layer per time step of the block and one layer
+ * of neighbors on either side, so the band extent is what remains of the cache budget after the
+ * lag of the time steps has been accounted for.
+ *
+ * @param extents The number of lattice nodes along each spatial dimension.
+ * @param depth The number of time steps per block.
+ * @return The number of layers along the last axis that a wave advances by, at least one.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+constexpr auto defaultWavefrontExtent(
+    const std::array<std::size_t, Dimension>& extents,
+    std::size_t depth
+) -> std::size_t
+{
+    std::size_t layerBytes{Size * sizeof(Scalar)};
+    for (std::size_t axis = 0; axis + 1 < Dimension; ++axis)
+    {
+        layerBytes *= extents[axis];
+    }
+
+    const std::size_t layers{TILE_CACHE_SIZE / std::max(layerBytes, std::size_t{1})};
+    const std::size_t lag{depth + 2};
+
+    const std::size_t bandExtent{layers > lag ? layers - lag : std::size_t{1}};
+
+    return std::clamp(bandExtent, std::size_t{1}, extents[Dimension - 1]);
+}
+
+/**
+ * @brief Performs several fused collide-and-stream time steps of the AA pattern with temporal
+ * blocking along the last axis.
+ *
+ * Wave w updates the layers u - t of time step firstStep + t for all u in the band
+ * [w * bandExtent, (w + 1) * bandExtent) that lie in [2t, 2t + extent), in order of t, and then
+ * moves on to the next band. The time steps of a block see the same populations as with plain
+ * stepping, so the collision must not depend on the order in which nodes are visited.
+ *
+ * @param lattice The lattice whose populations are updated in place.
+ * @param velocities The lattice velocities of the lattice model.
+ * @param opposites The opposite-direction table of the lattice model.
+ * @param firstStep The index of the first time step of the block.
+ * @param depth The number of time steps to perform.
+ * @param bandExtent The number of layers along the last axis that a wave advances by.
+ * @param collision A callable that updates the populations of one node, passed as an array of Size
+ * scalar values in lattice vector order.
+ * @throws std::invalid_argument If the band extent is zero.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Collision The type of the collision callable.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Collision>
+auto streamWavefrontAA(
+    Lattice<Dimension, Size, Scalar>& lattice,
+    const std::array<std::array<int, Dimension>, Size>& velocities,
+    const std::array<std::size_t, Size>& opposites,
+    std::size_t firstStep,
+    std::size_t depth,
+    std::size_t bandExtent,
+    Collision collision
+) -> void
+{
+    if (bandExtent == 0)
+    {
+        throw std::invalid_argument{"band extent must be positive"};
+    }
+
+    const ScopedPhase phase{Phase::Stream, lattice.nodeCount() * depth};
+
+    constexpr std::size_t axis{Dimension - 1};
+    const std::size_t extent{lattice.extents()[axis]};
+    const std::size_t waveEnd{depth == 0 ? 0 : extent + 2 * (depth - 1)};
+
+    LatticeTile<Dimension> tile;
+    tile.begin.fill(0);
+    tile.end = lattice.extents();
+
+    const auto update{[&](std::size_t timeStep, std::size_t first, std::size_t last) {
+        tile.begin[axis] = first;
+        tile.end[axis] = last;
+        streamAA(lattice, velocities, opposites, timeStep, collision, tile);
+    }};
+
+    for (std::size_t band = 0; band < waveEnd; band += bandExtent)
+    {
+        for (std::size_t step = 0; step < depth; ++step)
+        {
+            const std::size_t lower{std::max(band, 2 * step)};
+            const std::size_t upper{std::min(band + bandExtent, 2 * step + extent)};
+            if (lower >= upper)
+            {
+                continue;
+            }
+
+            const std::size_t first{(lower - step) % extent};
+            const std::size_t count{upper - lower};
+            if (first + count <= extent)
+            {
+                update(firstStep + step, first, first + count);
+            }
+            else
+            {
+                update(firstStep + step, first, extent);
+                update(firstStep + step, 0, first + count - extent);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Performs several fused collide-and-stream AA time steps on a D2Q5 lattice with temporal
+ * blocking.
+ *
+ * @param lattice A D2Q5 lattice, updated in place.
+ * @param firstStep The index of the first time step of the block.
+ * @param depth The number of time steps to perform.
+ * @param bandExtent The number of rows that a wave advances by.
+ * @param collision A callable that updates the populations of one node.
+ * @throws std::invalid_argument If the band extent is zero.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Collision The type of the collision callable.
+ */
+template <std::floating_point Scalar, typename Collision>
+auto streamWavefrontAA(
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, Scalar>& lattice,
+    std::size_t firstStep,
+    std::size_t depth,
+    std::size_t bandExtent,
+    Collision collision
+) -> void
+{
+    constexpr D2Q5<Scalar> model;
+
+    streamWavefrontAA(
+        lattice,
+        latticeVelocities(model),
+        latticeOpposites(model),
+        firstStep,
+        depth,
+        bandExtent,
+        collision
+    );
+}
+
+/**
+ * @brief Performs several fused collide-and-stream AA time steps on a D2Q9 lattice with temporal
+ * blocking.
+ *
+ * @param lattice A D2Q9 lattice, updated in place.
+ * @param firstStep The index of the first time step of the block.
+ * @param depth The number of time steps to perform.
+ * @param bandExtent The number of rows that a wave advances by.
+ * @param collision A callable that updates the populations of one node.
+ * @throws std::invalid_argument If the band extent is zero.
+ *
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Collision The type of the collision callable.
+ */
+template <std::floating_point Scalar, typename Collision>
+auto streamWavefrontAA(
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>& lattice,
+    std::size_t firstStep,
+    std::size_t depth,
+    std::size_t bandExtent,
+    Collision collision
+) -> void
+{
+    constexpr D2Q9<Scalar> model;
+
+    streamWavefrontAA(
+        lattice,
+        latticeVelocities(model),
+        latticeOpposites(model),
+        firstStep,
+        depth,
+        bandExtent,
+        collision
+    );
+}
+
+#endif // STREAMING_WAVEFRONT_TPP
@@ -0,0 +1,41 @@
+#ifndef TEST_LATTICE_FILL_HPP
+#define TEST_LATTICE_FILL_HPP
+
+/**
+ * @file LatticeFill.hpp
+ * @brief Common helper that fills the populations of a lattice in tests.
+ */
+
+#include "../src/lattice/Lattice.hpp"
+
+#include <cstddef>
+
+/**
+ * @brief Stores a value given by a formula in every population of a lattice.
+ *
+ * Tests choose a formula that makes the populations distinct, so that a kernel that mixes up
+ * lattice vectors or nodes changes its result.
+ *
+ * @param lattice The lattice whose populations are overwritten.
+ * @param value A callable invoked as value(direction, node) that returns the population of a
+ * lattice vector at a node.
+ *
+ * @tparam Dimension The number of spatial dimensions.
+ * @tparam Size The number of lattice vectors at each lattice node.
+ * @tparam Scalar The floating-point type of scalar values.
+ * @tparam Value The type of the callable that gives the populations.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar, typename Value>
+auto fillLattice(Lattice<Dimension, Size, Scalar>& lattice, Value value) -> void
+{
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        const auto population{lattice.population(i)};
+        for (std::size_t node = 0; node < population.size(); ++node)
+        {
+            population[node] = static_cast<Scalar>(value(i, node));
+        }
+    }
+}
+
+#endif // TEST_LATTICE_FILL_HPP
@@ -0,0 +1,393 @@
+#include "../../src/boundary/BoundaryEngine.hpp"
+#include "../../src/collision/bgk.hpp"
+#include "../../src/densityDistribution/d3q19.hpp"
+#include "../LatticeFill.hpp"
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ * Returns the solid mask of a channel along the first axis whose first and last rows are walls.
+ */
+auto channelMask(const std::array<std::size_t, 2>& extents) -> std::vector<bool>
+{
+    std::vector<bool> solid(extents[0] * extents[1], false);
+    for (std::size_t x = 0; x < extents[0]; ++x)
+    {
+        solid[x] = true;
+        solid[(extents[1] - 1) * extents[0] + x] = true;
+    }
+
+    return solid;
+}
+
+/**
+ * Returns distinct positive populations that are not in equilibrium.
+ */
+template <std::floating_point Scalar>
+auto nonEquilibriumPopulation(std::size_t i, std::size_t node) -> Scalar
+{
+    return Scalar{0.05} + static_cast<Scalar>((i + 3) * (node + 5) % 17) / 100;
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class BoundaryEngineTest : public ::testing::Test
+{
+protected:
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    const std::array<std::size_t, 2> extents{6, 5};
+    const Scalar tolerance{64 * std::numeric_limits<Scalar>::epsilon()};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(BoundaryEngineTest, FloatingPointTypes);
+
+TYPED_TEST(BoundaryEngineTest, ChannelWallsLinkAdjacentFluidNodes)
+{
+    // When
+
+    const BoundaryEngine<D2Q9_DESCRIPTOR, TypeParam> engine{
+        this->extents, channelMask(this->extents)
+    };
+
+    // Then
+
+    EXPECT_EQ(engine.nodeType(0), BoundaryType::BounceBack);
+    EXPECT_EQ(engine.nodeType(this->extents[0]), BoundaryType::Periodic);
+    EXPECT_EQ(engine.linkCount(), 2 * this->extents[0] * 3);
+    EXPECT_EQ(engine.boundaryNodeCount(), 2 * this->extents[0]);
+}
+
+TYPED_TEST(BoundaryEngineTest, FluidAtRestStaysAtRest)
+{
+    // Given
+
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> lattice{this->extents};
+    BoundaryEngine<D2Q9_DESCRIPTOR, TypeParam> engine{this->extents, channelMask(this->extents)};
+    const D2Q9<TypeParam> rest{
+        computeEquilibrium<D2Q9_DESCRIPTOR>(TypeParam{1.0}, std::array<TypeParam, 2>{})
+    };
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        lattice.setNode(node, rest);
+    }
+    const std::size_t steps{5};
+
+    // When
+
+    for (std::size_t timeStep = 0; timeStep < steps; ++timeStep)
+    {
+        collideBGK(lattice, TypeParam{1.3});
+        streamAA(lattice, timeStep);
+        engine.apply(lattice, timeStep + 1);
+    }
+
+    // Then
+
+    for (std::size_t node = this->extents[0]; node < 4 * this->extents[0]; ++node)
+    {
+        const D2Q9<TypeParam> distribution{gatherAA(lattice, node, steps)};
+        for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+        {
+            EXPECT_NEAR(distribution[i], rest[i], this->tolerance);
+        }
+    }
+}
+
+TYPED_TEST(BoundaryEngineTest, BounceBackConservesFluidMass)
+{
+    // Given
+
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> lattice{this->extents};
+    const std::vector<bool> solid{channelMask(this->extents)};
+    BoundaryEngine<D2Q9_DESCRIPTOR, TypeParam> engine{this->extents, solid};
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const TypeParam scale{solid[node] ? TypeParam{0.0} : TypeParam{1.0}};
+        const std::array<TypeParam, 2> velocity{scale * TypeParam{0.05}, scale * TypeParam{-0.03}};
+        lattice.setNode(node, computeEquilibrium<D2Q9_DESCRIPTOR>(TypeParam{1.0}, velocity));
+    }
+    const auto fluidMass{[&](std::size_t completedSteps) {
+        TypeParam mass{0.0};
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            mass += solid[node] ? TypeParam{0.0}
+                                : computeDensity(gatherAA(lattice, node, completedSteps));
+        }
+        return mass;
+    }};
+    const TypeParam expectedMass{fluidMass(0)};
+    const std::size_t steps{11};
+    const TypeParam relaxationFrequency{1.6};
+
+    // When
+
+    for (std::size_t timeStep = 0; timeStep < steps; ++timeStep)
+    {
+        streamAA(lattice, timeStep, [&](std::array<TypeParam, D2Q9_SIZE>& populations) {
+            relaxBGK<D2Q9_DESCRIPTOR>(populations, relaxationFrequency);
+        });
+        engine.apply(lattice, timeStep + 1);
+    }
+
+    // Then
+
+    EXPECT_NEAR(fluidMass(steps), expectedMass, 16 * this->tolerance * expectedMass);
+}
+
+TYPED_TEST(BoundaryEngineTest, ZouHeVelocityNodesCarryPrescribedVelocity)
+{
+    // Given
+
+    const std::array<TypeParam, 2> velocity{0.04, 0.01};
+    BoundaryEngine<D2Q9_DESCRIPTOR, TypeParam> engine{
+        this->extents, std::vector<bool>(this->extents[0] * this->extents[1], false)
+    };
+    for (std::size_t y = 0; y < this->extents[1]; ++y)
+    {
+        engine.addVelocityNode(y * this->extents[0], {0, 1}, velocity);
+    }
+
+    for (std::size_t completedSteps = 0; completedSteps < 2; ++completedSteps)
+    {
+        Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> lattice{this->extents};
+        fillLattice(lattice, nonEquilibriumPopulation<TypeParam>);
+
+        // When
+
+        engine.apply(lattice, completedSteps);
+
+        // Then
+
+        for (std::size_t y = 0; y < this->extents[1]; ++y)
+        {
+            const D2Q9<TypeParam> distribution{
+                gatherAA(lattice, y * this->extents[0], completedSteps)
+            };
+            const TypeParam density{computeDensity(distribution)};
+            const std::array<TypeParam, 2> momentum{computeMomentum(distribution)};
+            EXPECT_NEAR(momentum[0] / density, velocity[0], this->tolerance);
+            EXPECT_NEAR(momentum[1] / density, velocity[1], this->tolerance);
+        }
+    }
+}
+
+TYPED_TEST(BoundaryEngineTest, ZouHePressureNodesCarryPrescribedDensity)
+{
+    // Given
+
+    const TypeParam density{1.02};
+    BoundaryEngine<D2Q9_DESCRIPTOR, TypeParam> engine{
+        this->extents, std::vector<bool>(this->extents[0] * this->extents[1], false)
+    };
+    for (std::size_t y = 0; y < this->extents[1]; ++y)
+    {
+        engine.addPressureNode((y + 1) * this->extents[0] - 1, {0, -1}, density);
+    }
+
+    for (std::size_t completedSteps = 0; completedSteps < 2; ++completedSteps)
+    {
+        Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> lattice{this->extents};
+        fillLattice(lattice, nonEquilibriumPopulation<TypeParam>);
+
+        // When
+
+        engine.apply(lattice, completedSteps);
+
+        // Then
+
+        for (std::size_t y = 0; y < this->extents[1]; ++y)
+        {
+            const D2Q9<TypeParam> distribution{
+                gatherAA(lattice, (y + 1) * this->extents[0] - 1, completedSteps)
+            };
+            EXPECT_NEAR(computeDensity(distribution), density, this->tolerance);
+            EXPECT_NEAR(computeMomentum(distribution)[1], TypeParam{0.0}, this->tolerance);
+        }
+    }
+}
+
+TYPED_TEST(BoundaryEngineTest, D3Q19ZouHeVelocityNodesCarryPrescribedVelocity)
+{
+    // Given
+
+    const std::array<std::size_t, 3> extents{3, 4, 3};
+    const std::array<TypeParam, 3> velocity{0.01, -0.02, -0.03};
+    BoundaryEngine<D3Q19_DESCRIPTOR, TypeParam> engine{
+        extents, std::vector<bool>(extents[0] * extents[1] * extents[2], false)
+    };
+    const std::size_t topLayer{(extents[2] - 1) * extents[0] * extents[1]};
+    for (std::size_t node = 0; node < extents[0] * extents[1]; ++node)
+    {
+        engine.addVelocityNode(topLayer + node, {2, -1}, velocity);
+    }
+    const D3Q19<TypeParam> model;
+
+    for (std::size_t completedSteps = 0; completedSteps < 2; ++completedSteps)
+    {
+        Lattice<D3Q19_DIMENSION, D3Q19_SIZE, TypeParam> lattice{extents};
+        fillLattice(lattice, nonEquilibriumPopulation<TypeParam>);
+
+        // When
+
+        engine.apply(lattice, completedSteps);
+
+        // Then
+
+        for (std::size_t node = 0; node < extents[0] * extents[1]; ++node)
+        {
+            const D3Q19<TypeParam> distribution{gatherAA(
+                lattice,
+                latticeVelocities(model),
+                latticeOpposites(model),
+                topLayer + node,
+                completedSteps
+            )};
+            const TypeParam density{computeDensity(distribution)};
+            const std::array<TypeParam, 3> momentum{computeMomentum(distribution)};
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                EXPECT_NEAR(momentum[axis] / density, velocity[axis], this->tolerance);
+            }
+        }
+    }
+}
+
+TYPED_TEST(BoundaryEngineTest, ChannelFlowKeepsParabolicProfile)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{24, 11};
+    const std::vector<bool> solid{channelMask(extents)};
+    BoundaryEngine<D2Q9_DESCRIPTOR, TypeParam> engine{extents, solid};
+    const TypeParam maximumVelocity{0.04};
+    const auto width{static_cast<TypeParam>(extents[1] - 2)};
+    const auto profile{[&](std::size_t y) {
+        const TypeParam distance{static_cast<TypeParam>(y) - TypeParam{0.5}};
+        return 4 * maximumVelocity * distance * (width - distance) / (width * width);
+    }};
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> lattice{extents};
+    for (std::size_t y = 0; y < extents[1]; ++y)
+    {
+        for (std::size_t x = 0; x < extents[0]; ++x)
+        {
+            const std::size_t node{y * extents[0] + x};
+            const TypeParam velocity{solid[node] ? TypeParam{0.0} : profile(y)};
+            lattice.setNode(
+                node,
+                computeEquilibrium<D2Q9_DESCRIPTOR>(
+                    TypeParam{1.0}, std::array<TypeParam, 2>{velocity, TypeParam{0.0}}
+                )
+            );
+        }
+        if (!solid[y * extents[0]])
+        {
+            engine.addVelocityNode(y * extents[0], {0, 1}, {profile(y), TypeParam{0.0}});
+            engine.addPressureNode((y + 1) * extents[0] - 1, {0, -1}, TypeParam{1.0});
+        }
+    }
+    const std::size_t steps{400};
+    const TypeParam relaxationFrequency{1.0};
+
+    // When
+
+    for (std::size_t timeStep = 0; timeStep < steps; ++timeStep)
+    {
+        streamAA(lattice, timeStep, [&](std::array<TypeParam, D2Q9_SIZE>& populations) {
+            relaxBGK<D2Q9_DESCRIPTOR>(populations, relaxationFrequency);
+        });
+        engine.apply(lattice, timeStep + 1);
+    }
+
+    // Then
+
+    for (std::size_t y = 1; y + 1 < extents[1]; ++y)
+    {
+        const D2Q9<TypeParam> distribution{
+            gatherAA(lattice, y * extents[0] + extents[0] / 2, steps)
+        };
+        const std::array<TypeParam, 2> momentum{computeMomentum(distribution)};
+        const TypeParam density{computeDensity(distribution)};
+        EXPECT_NEAR(momentum[0] / density, profile(y), 0.03 * maximumVelocity);
+        EXPECT_NEAR(momentum[1] / density, TypeParam{0.0}, 0.01 * maximumVelocity);
+    }
+}
+
+TYPED_TEST(BoundaryEngineTest, InvalidBoundariesThrow)
+{
+    // Given
+
+    BoundaryEngine<D2Q9_DESCRIPTOR, TypeParam> engine{this->extents, channelMask(this->extents)};
+    const std::array<TypeParam, 2> velocity{};
+
+    // Then
+
+    EXPECT_THROW(
+        (BoundaryEngine<D2Q9_DESCRIPTOR, TypeParam>{this->extents, std::vector<bool>(3, false)}),
+        std::invalid_argument
+    );
+    EXPECT_THROW(engine.addVelocityNode(0, {0, 1}, velocity), std::invalid_argument);
+    EXPECT_THROW(engine.addVelocityNode(this->extents[0], {2, 1}, velocity), std::invalid_argument);
+    EXPECT_THROW(engine.addPressureNode(this->extents[0], {1, 0}, 1), std::invalid_argument);
+    EXPECT_THROW(engine.addPressureNode(1000, {0, 1}, 1), std::out_of_range);
+    engine.addPressureNode(this->extents[0], {0, 1}, 1);
+    EXPECT_THROW(engine.addPressureNode(this->extents[0], {0, 1}, 1), std::invalid_argument);
+}
+
+TYPED_TEST(BoundaryEngineTest, ApplyKeepsCurrentMomentCacheCurrent)
+{
+    // Given
+
+    const std::vector<bool> solid{channelMask(this->extents)};
+    BoundaryEngine<D2Q9_DESCRIPTOR, TypeParam> engine{this->extents, solid};
+    engine.addVelocityNode(this->extents[0] + 1, {0, 1}, {0.04, 0.0});
+    engine.addPressureNode(2 * this->extents[0] - 1, {0, -1}, 1.02);
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> lattice{this->extents};
+    fillLattice(lattice, nonEquilibriumPopulation<TypeParam>);
+    MomentCache<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> cache{
+        lattice, latticeVelocities(D2Q9<TypeParam>{})
+    };
+    static_cast<void>(cache.densities());
+
+    // When
+
+    engine.apply(lattice, 2, cache);
+
+    // Then
+
+    EXPECT_TRUE(cache.isCurrent());
+    EXPECT_EQ(cache.sweeps(), 1);
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const D2Q9<TypeParam> distribution{lattice.node(node)};
+        EXPECT_NEAR(cache.density(node), computeDensity(distribution), this->tolerance);
+        EXPECT_NEAR(cache.momentum(node)[0], computeMomentum(distribution)[0], this->tolerance);
+        EXPECT_NEAR(cache.momentum(node)[1], computeMomentum(distribution)[1], this->tolerance);
+    }
+}
+
+TYPED_TEST(BoundaryEngineTest, OddStepsLeaveMomentCacheStale)
+{
+    // Given
+
+    BoundaryEngine<D2Q9_DESCRIPTOR, TypeParam> engine{this->extents, channelMask(this->extents)};
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> lattice{this->extents};
+    fillLattice(lattice, nonEquilibriumPopulation<TypeParam>);
+    MomentCache<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> cache{
+        lattice, latticeVelocities(D2Q9<TypeParam>{})
+    };
+    static_cast<void>(cache.densities());
+
+    // When
+
+    engine.apply(lattice, 1, cache);
+
+    // Then
+
+    EXPECT_FALSE(cache.isCurrent());
+}
@@ -0,0 +1,213 @@
+#include "../../src/collision/MomentTransform.hpp"
+#include "../../src/densityDistribution/d2q9.hpp"
+#include "../../src/densityDistribution/d3q19.hpp"
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ * Fills a density distribution with distinct values near the lattice weights.
+ */
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto perturbedWeights(const LatticeDescriptor<Dimension, Size>& descriptor)
+    -> DensityDistribution<Dimension, Size, Scalar>
+{
+    DensityDistribution<Dimension, Size, Scalar> distribution;
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        distribution[i] = static_cast<Scalar>(
+            descriptor.weights[i] * (1.0 + static_cast<double>((7 * i) % 5) / 20.0)
+        );
+    }
+
+    return distribution;
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class MomentTransformTest : public ::testing::Test
+{
+protected:
+    MomentTransformTest()
+        : d2q9Distribution{perturbedWeights<2, 9, Scalar>(D2Q9_DESCRIPTOR)},
+          d3q19Distribution{perturbedWeights<3, 19, Scalar>(D3Q19_DESCRIPTOR)}
+    {
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    D2Q9<Scalar> d2q9Distribution;
+    D3Q19<Scalar> d3q19Distribution;
+    const Scalar tolerance{20 * std::numeric_limits<Scalar>::epsilon()};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(MomentTransformTest, FloatingPointTypes);
+
+TYPED_TEST(MomentTransformTest, D2Q9BasisIsOrderedByDegree)
+{
+    // Given
+
+    const std::array<std::array<int, 2>, 9> expected{
+        {{0, 0}, {1, 0}, {0, 1}, {2, 0}, {1, 1}, {0, 2}, {2, 1}, {1, 2}, {2, 2}}
+    };
+
+    // When
+
+    constexpr auto exponents{momentExponents<D2Q9_DESCRIPTOR>()};
+    constexpr auto kinds{momentKinds<D2Q9_DESCRIPTOR>()};
+
+    // Then
+
+    EXPECT_EQ(exponents, expected);
+    EXPECT_EQ(kinds[0], MomentKind::Conserved);
+    EXPECT_EQ(kinds[2], MomentKind::Conserved);
+    EXPECT_EQ(kinds[3], MomentKind::NormalStress);
+    EXPECT_EQ(kinds[4], MomentKind::ShearStress);
+    EXPECT_EQ(kinds[5], MomentKind::NormalStress);
+    EXPECT_EQ(kinds[8], MomentKind::Higher);
+}
+
+TYPED_TEST(MomentTransformTest, D3Q19BasisSkipsMomentsThatVanishOnAllVectors)
+{
+    // Given
+
+    const std::array<int, 3> xyz{1, 1, 1};
+
+    // When
+
+    constexpr auto exponents{momentExponents<D3Q19_DESCRIPTOR>()};
+
+    // Then
+
+    EXPECT_EQ(std::ranges::count(exponents, xyz), 0);
+    EXPECT_EQ(std::ranges::count(momentKinds<D3Q19_DESCRIPTOR>(), MomentKind::Conserved), 4);
+    EXPECT_EQ(std::ranges::count(momentKinds<D3Q19_DESCRIPTOR>(), MomentKind::NormalStress), 3);
+    EXPECT_EQ(std::ranges::count(momentKinds<D3Q19_DESCRIPTOR>(), MomentKind::ShearStress), 3);
+}
+
+TYPED_TEST(MomentTransformTest, D2Q9LowestMomentsAreDensityAndMomentum)
+{
+    // Given
+
+    const TypeParam density{computeDensity(this->d2q9Distribution)};
+    const std::array<TypeParam, 2> momentum{computeMomentum(this->d2q9Distribution)};
+    std::array<TypeParam, D2Q9_SIZE> moments;
+
+    // When
+
+    transformToMoments<D2Q9_DESCRIPTOR>(this->d2q9Distribution, moments);
+
+    // Then
+
+    EXPECT_NEAR(moments[0], density, this->tolerance);
+    EXPECT_NEAR(moments[1], momentum[0], this->tolerance);
+    EXPECT_NEAR(moments[2], momentum[1], this->tolerance);
+}
+
+TYPED_TEST(MomentTransformTest, D2Q9RoundTripRestoresPopulations)
+{
+    // Given
+
+    std::array<TypeParam, D2Q9_SIZE> moments;
+    D2Q9<TypeParam> distribution;
+
+    // When
+
+    transformToMoments<D2Q9_DESCRIPTOR>(this->d2q9Distribution, moments);
+    transformFromMoments<D2Q9_DESCRIPTOR>(moments, distribution);
+
+    // Then
+
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        EXPECT_NEAR(distribution[i], this->d2q9Distribution[i], this->tolerance);
+    }
+}
+
+TYPED_TEST(MomentTransformTest, D3Q19RoundTripRestoresPopulations)
+{
+    // Given
+
+    std::array<TypeParam, D3Q19_SIZE> moments;
+    D3Q19<TypeParam> distribution;
+
+    // When
+
+    transformToMoments<D3Q19_DESCRIPTOR>(this->d3q19Distribution, moments);
+    transformFromMoments<D3Q19_DESCRIPTOR>(moments, distribution);
+
+    // Then
+
+    for (std::size_t i = 0; i < D3Q19_SIZE; ++i)
+    {
+        EXPECT_NEAR(distribution[i], this->d3q19Distribution[i], this->tolerance);
+    }
+}
+
+TYPED_TEST(MomentTransformTest, D3Q19BlockTransformsEqualNodeTransforms)
+{
+    // Given
+
+    constexpr std::size_t blockSize{8};
+    const std::size_t count{5};
+    std::array<std::array<TypeParam, blockSize>, D3Q19_SIZE> block;
+    for (std::size_t i = 0; i < D3Q19_SIZE; ++i)
+    {
+        for (std::size_t node = 0; node < count; ++node)
+        {
+            block[i][node] = this->d3q19Distribution[i] * static_cast<TypeParam>(node + 1);
+        }
+    }
+    std::array<std::array<TypeParam, blockSize>, D3Q19_SIZE> moments;
+    std::array<std::array<TypeParam, blockSize>, D3Q19_SIZE> populations;
+
+    // When
+
+    transformBlockToMoments<D3Q19_DESCRIPTOR>(block, count, moments);
+    transformBlockFromMoments<D3Q19_DESCRIPTOR>(moments, count, populations);
+
+    // Then
+
+    for (std::size_t node = 0; node < count; ++node)
+    {
+        std::array<TypeParam, D3Q19_SIZE> expectedMoments;
+        std::array<TypeParam, D3Q19_SIZE> expectedPopulations;
+        transformToMoments<D3Q19_DESCRIPTOR>(
+            BlockColumn<D3Q19_SIZE, blockSize, TypeParam>{block, node}, expectedMoments
+        );
+        transformFromMoments<D3Q19_DESCRIPTOR>(expectedMoments, expectedPopulations);
+        for (std::size_t k = 0; k < D3Q19_SIZE; ++k)
+        {
+            EXPECT_EQ(moments[k][node], expectedMoments[k]);
+            EXPECT_EQ(populations[k][node], expectedPopulations[k]);
+        }
+    }
+}
+
+TYPED_TEST(MomentTransformTest, D3Q19EquilibriumMomentsAreMomentsOfEquilibrium)
+{
+    // Given
+
+    const TypeParam density{1.1};
+    const std::array<TypeParam, 3> velocity{0.05, -0.02, 0.03};
+    const D3Q19<TypeParam> equilibrium{computeEquilibrium<D3Q19_DESCRIPTOR>(density, velocity)};
+    std::array<TypeParam, D3Q19_SIZE> expected;
+    transformToMoments<D3Q19_DESCRIPTOR>(equilibrium, expected);
+
+    // When
+
+    const std::array<TypeParam, D3Q19_SIZE> moments{
+        computeEquilibriumMoments<D3Q19_DESCRIPTOR>(density, velocity)
+    };
+
+    // Then
+
+    for (std::size_t k = 0; k < D3Q19_SIZE; ++k)
+    {
+        EXPECT_NEAR(moments[k], expected[k], this->tolerance);
+    }
+}
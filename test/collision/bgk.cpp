@@ -0,0 +1,332 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/densityDistribution/arithmetic.hpp"
+#include "../../src/densityDistribution/d3q19.hpp"
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ * A five-velocity model whose squared speed of sound is 1/2 instead of 1/3.
+ */
+constexpr LatticeDescriptor<2, 5> WIDE_D2Q5_DESCRIPTOR{makeLatticeDescriptor<2, 5>(
+    {{{0, 0}, {1, 0}, {-1, 0}, {0, 1}, {0, -1}}}, {0.0, 0.25, 0.25, 0.25, 0.25}, 0.5
+)};
+
+/**
+ * Composes a BGK collision from the moment functions, the lattice weights and the arithmetic
+ * operators.
+ */
+template <std::size_t Size, std::floating_point Scalar>
+auto composedBGK(
+    const DensityDistribution<2, Size, Scalar>& distribution,
+    Scalar relaxationFrequency
+) -> DensityDistribution<2, Size, Scalar>
+{
+    const Scalar density{computeDensity(distribution)};
+    const std::array<Scalar, 2> momentum{computeMomentum(distribution)};
+    const std::array<Scalar, 2> velocity{momentum[0] / density, momentum[1] / density};
+    const Scalar velocitySquared{velocity[0] * velocity[0] + velocity[1] * velocity[1]};
+    const auto weights{latticeWeights(distribution)};
+    const auto velocities{latticeVelocities(distribution)};
+
+    DensityDistribution<2, Size, Scalar> equilibrium;
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        const Scalar projection{velocities[i][0] * velocity[0] + velocities[i][1] * velocity[1]};
+        equilibrium[i] = weights[i] * density *
+                         (1 + 3 * projection + Scalar{4.5} * projection * projection -
+                          Scalar{1.5} * velocitySquared);
+    }
+
+    return distribution + (equilibrium - distribution) * relaxationFrequency;
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class BGKTest : public ::testing::Test
+{
+private:
+    static constexpr std::initializer_list<Scalar> d2q5Distribution_{
+        1.0 / 3.0, 2.0 / 4.0, 4.0 / 6.0, 3.0 / 5.0, 5.0 / 7.0
+    };
+    static constexpr std::initializer_list<Scalar> d2q9Distribution_{
+        1.0 / 3.0, 2.0 / 4.0, 3.0 / 5.0,  4.0 / 6.0, 5.0 / 7.0,
+        6.0 / 8.0, 7.0 / 9.0, 8.0 / 10.0, 9.0 / 11.0
+    };
+
+protected:
+    BGKTest() : d2q5Distribution{d2q5Distribution_}, d2q9Distribution{d2q9Distribution_} {}
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    D2Q5<Scalar> d2q5Distribution;
+    D2Q9<Scalar> d2q9Distribution;
+    const Scalar relaxationFrequency{1.7};
+    const Scalar tolerance{20 * std::numeric_limits<Scalar>::epsilon()};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(BGKTest, FloatingPointTypes);
+
+TYPED_TEST(BGKTest, D2Q5CollisionConservesDensity)
+{
+    // Given
+
+    const TypeParam expectedDensity{computeDensity(this->d2q5Distribution)};
+
+    // When
+
+    collideBGK(this->d2q5Distribution, this->relaxationFrequency);
+
+    // Then
+
+    EXPECT_NEAR(computeDensity(this->d2q5Distribution), expectedDensity, this->tolerance);
+}
+
+TYPED_TEST(BGKTest, D2Q9CollisionConservesDensityAndMomentum)
+{
+    // Given
+
+    const TypeParam expectedDensity{computeDensity(this->d2q9Distribution)};
+    const std::array<TypeParam, 2> expectedMomentum{computeMomentum(this->d2q9Distribution)};
+
+    // When
+
+    collideBGK(this->d2q9Distribution, this->relaxationFrequency);
+    const std::array<TypeParam, 2> momentum{computeMomentum(this->d2q9Distribution)};
+
+    // Then
+
+    EXPECT_NEAR(computeDensity(this->d2q9Distribution), expectedDensity, this->tolerance);
+    EXPECT_NEAR(momentum[0], expectedMomentum[0], this->tolerance);
+    EXPECT_NEAR(momentum[1], expectedMomentum[1], this->tolerance);
+}
+
+TYPED_TEST(BGKTest, D2Q5FusedCollisionEqualsComposedCollision)
+{
+    // Given
+
+    const D2Q5<TypeParam> expected{composedBGK(this->d2q5Distribution, this->relaxationFrequency)};
+
+    // When
+
+    collideBGK(this->d2q5Distribution, this->relaxationFrequency);
+
+    // Then
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_NEAR(this->d2q5Distribution[i], expected[i], this->tolerance);
+    }
+}
+
+TYPED_TEST(BGKTest, D2Q9FusedCollisionEqualsComposedCollision)
+{
+    // Given
+
+    const D2Q9<TypeParam> expected{composedBGK(this->d2q9Distribution, this->relaxationFrequency)};
+
+    // When
+
+    collideBGK(this->d2q9Distribution, this->relaxationFrequency);
+
+    // Then
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_NEAR(this->d2q9Distribution[i], expected[i], this->tolerance);
+    }
+}
+
+TYPED_TEST(BGKTest, D2Q9EquilibriumIsFixedPoint)
+{
+    // Given
+
+    const TypeParam unitRelaxationFrequency{1.0};
+    collideBGK(this->d2q9Distribution, unitRelaxationFrequency);
+    const D2Q9<TypeParam> equilibrium{this->d2q9Distribution};
+
+    // When
+
+    collideBGK(this->d2q9Distribution, this->relaxationFrequency);
+
+    // Then
+
+    for (std::size_t i = 0; i < equilibrium.size(); ++i)
+    {
+        EXPECT_NEAR(this->d2q9Distribution[i], equilibrium[i], this->tolerance);
+    }
+}
+
+TYPED_TEST(BGKTest, CollisionRelaxesToEquilibriumOfDescriptor)
+{
+    // Given
+
+    const TypeParam density{computeDensity<WIDE_D2Q5_DESCRIPTOR>(this->d2q5Distribution)};
+    const std::array<TypeParam, 2> momentum{
+        computeMomentum<WIDE_D2Q5_DESCRIPTOR>(this->d2q5Distribution)
+    };
+    const std::array<TypeParam, 2> velocity{momentum[0] / density, momentum[1] / density};
+    const D2Q5<TypeParam> equilibrium{computeEquilibrium<WIDE_D2Q5_DESCRIPTOR>(density, velocity)};
+    Lattice<2, 5, TypeParam> lattice{{3, 2}};
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        lattice.setNode(node, this->d2q5Distribution);
+    }
+
+    // When
+
+    relaxBGK<WIDE_D2Q5_DESCRIPTOR>(this->d2q5Distribution, TypeParam{1.0});
+    relaxBGK<WIDE_D2Q5_DESCRIPTOR>(lattice, TypeParam{1.0});
+
+    // Then
+
+    for (std::size_t i = 0; i < D2Q5_SIZE; ++i)
+    {
+        EXPECT_NEAR(this->d2q5Distribution[i], equilibrium[i], this->tolerance);
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            EXPECT_NEAR(lattice.population(i)[node], equilibrium[i], this->tolerance);
+        }
+    }
+}
+
+TYPED_TEST(BGKTest, D2Q5LatticeCollisionEqualsNodeCollision)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{13, 11};
+    Lattice<2, 5, TypeParam> lattice{extents};
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        D2Q5<TypeParam> distribution{this->d2q5Distribution};
+        distribution[node % distribution.size()] += static_cast<TypeParam>(node) / 100;
+        lattice.setNode(node, distribution);
+    }
+    const Lattice<2, 5, TypeParam> initial{lattice};
+
+    // When
+
+    collideBGK(lattice, this->relaxationFrequency);
+
+    // Then
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        D2Q5<TypeParam> expected{initial.node(node)};
+        collideBGK(expected, this->relaxationFrequency);
+        const D2Q5<TypeParam> actual{lattice.node(node)};
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_NEAR(actual[i], expected[i], this->tolerance);
+        }
+    }
+}
+
+TYPED_TEST(BGKTest, D2Q9LatticeCollisionEqualsNodeCollision)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{13, 11};
+    Lattice<2, 9, TypeParam> lattice{extents};
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        D2Q9<TypeParam> distribution{this->d2q9Distribution};
+        distribution[node % distribution.size()] += static_cast<TypeParam>(node) / 100;
+        lattice.setNode(node, distribution);
+    }
+    const Lattice<2, 9, TypeParam> initial{lattice};
+
+    // When
+
+    collideBGK(lattice, this->relaxationFrequency);
+
+    // Then
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        D2Q9<TypeParam> expected{initial.node(node)};
+        collideBGK(expected, this->relaxationFrequency);
+        const D2Q9<TypeParam> actual{lattice.node(node)};
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_NEAR(actual[i], expected[i], this->tolerance);
+        }
+    }
+}
+
+TYPED_TEST(BGKTest, D3Q19LatticeCollisionEqualsNodeCollision)
+{
+    // Given
+
+    const std::array<std::size_t, 3> extents{9, 5, 4};
+    Lattice<3, D3Q19_SIZE, TypeParam> lattice{extents};
+    for (std::size_t i = 0; i < D3Q19_SIZE; ++i)
+    {
+        const auto population{lattice.population(i)};
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            population[node] = static_cast<TypeParam>(D3Q19_DESCRIPTOR.weights[i]) +
+                               static_cast<TypeParam>((i * 7 + node * 3) % 17) / 200;
+        }
+    }
+    const Lattice<3, D3Q19_SIZE, TypeParam> initial{lattice};
+
+    // When
+
+    relaxBGK<D3Q19_DESCRIPTOR>(lattice, this->relaxationFrequency);
+
+    // Then
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        std::array<TypeParam, D3Q19_SIZE> expected;
+        for (std::size_t i = 0; i < D3Q19_SIZE; ++i)
+        {
+            expected[i] = initial.population(i)[node];
+        }
+        relaxBGK<D3Q19_DESCRIPTOR>(expected, this->relaxationFrequency);
+        for (std::size_t i = 0; i < D3Q19_SIZE; ++i)
+        {
+            EXPECT_NEAR(lattice.population(i)[node], expected[i], this->tolerance);
+        }
+    }
+}
+
+TYPED_TEST(BGKTest, D2Q9CachedMomentCollisionEqualsLatticeCollision)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{13, 11};
+    Lattice<2, 9, TypeParam> lattice{extents};
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        D2Q9<TypeParam> distribution{this->d2q9Distribution};
+        distribution[node % distribution.size()] += static_cast<TypeParam>(node) / 100;
+        lattice.setNode(node, distribution);
+    }
+    Lattice<2, 9, TypeParam> expected{lattice};
+    MomentCache<2, 9, TypeParam> cache{lattice, latticeVelocities(D2Q9<TypeParam>{})};
+
+    // When
+
+    collideBGK(lattice, cache, this->relaxationFrequency);
+    collideBGK(expected, this->relaxationFrequency);
+
+    // Then
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const D2Q9<TypeParam> actual{lattice.node(node)};
+        const D2Q9<TypeParam> reference{expected.node(node)};
+        for (std::size_t i = 0; i < actual.size(); ++i)
+        {
+            EXPECT_NEAR(actual[i], reference[i], this->tolerance);
+        }
+    }
+    EXPECT_EQ(cache.sweeps(), 1);
+    EXPECT_FALSE(cache.isCurrent());
+}
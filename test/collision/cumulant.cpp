@@ -0,0 +1,189 @@
+#include "../../src/collision/cumulant.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <numbers>
+
+namespace
+{
+
+constexpr std::size_t waveLength{16};
+constexpr std::size_t waveSteps{60};
+
+/**
+ * Initializes a periodic lattice with the equilibrium of a shear wave whose velocity along the
+ * first axis varies sinusoidally along the second axis.
+ */
+template <std::floating_point Scalar>
+auto shearWave(Scalar amplitude) -> Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar>
+{
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar> lattice{{4, waveLength}};
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const auto y{static_cast<Scalar>(node / 4)};
+        const std::array<Scalar, 2> velocity{
+            amplitude * std::sin(Scalar{2.0} * std::numbers::pi_v<Scalar> * y / waveLength),
+            Scalar{0.0}
+        };
+        lattice.setNode(node, computeEquilibrium<D2Q9_DESCRIPTOR>(Scalar{1.0}, velocity));
+    }
+
+    return lattice;
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class CumulantTest : public ::testing::Test
+{
+private:
+    static constexpr std::initializer_list<Scalar> d2q9Distribution_{
+        1.0 / 3.0, 2.0 / 4.0, 3.0 / 5.0,  4.0 / 6.0, 5.0 / 7.0,
+        6.0 / 8.0, 7.0 / 9.0, 8.0 / 10.0, 9.0 / 11.0
+    };
+
+protected:
+    CumulantTest() : d2q9Distribution{d2q9Distribution_} {}
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    D2Q9<Scalar> d2q9Distribution;
+    const RelaxationRates<Scalar> rates{1.7, 1.2, 1.1};
+    const Scalar tolerance{40 * std::numeric_limits<Scalar>::epsilon()};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(CumulantTest, FloatingPointTypes);
+
+TYPED_TEST(CumulantTest, D2Q9CollisionConservesDensityAndMomentum)
+{
+    // Given
+
+    const TypeParam expectedDensity{computeDensity(this->d2q9Distribution)};
+    const std::array<TypeParam, 2> expectedMomentum{computeMomentum(this->d2q9Distribution)};
+
+    // When
+
+    collideCumulant(this->d2q9Distribution, this->rates);
+    const std::array<TypeParam, 2> momentum{computeMomentum(this->d2q9Distribution)};
+
+    // Then
+
+    EXPECT_NEAR(computeDensity(this->d2q9Distribution), expectedDensity, this->tolerance);
+    EXPECT_NEAR(momentum[0], expectedMomentum[0], this->tolerance);
+    EXPECT_NEAR(momentum[1], expectedMomentum[1], this->tolerance);
+}
+
+TYPED_TEST(CumulantTest, D2Q9ZeroRatesLeavePopulationsUnchanged)
+{
+    // Given
+
+    const D2Q9<TypeParam> expected{this->d2q9Distribution};
+
+    // When
+
+    collideCumulant(this->d2q9Distribution, RelaxationRates<TypeParam>{0.0, 0.0, 0.0});
+
+    // Then
+
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        EXPECT_NEAR(this->d2q9Distribution[i], expected[i], this->tolerance);
+    }
+}
+
+TYPED_TEST(CumulantTest, D2Q9UnitRatesAtRestEqualBGK)
+{
+    // Given
+
+    D2Q9<TypeParam> distribution;
+    const auto weights{latticeWeights(distribution)};
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        const auto& velocity{D2Q9_DESCRIPTOR.velocities[i]};
+        const int offset{std::abs(velocity[0]) + 2 * std::abs(velocity[1])};
+        distribution[i] = weights[i] * (TypeParam{1.0} + static_cast<TypeParam>(offset) / 10);
+    }
+    D2Q9<TypeParam> expected{distribution};
+    collideBGK(expected, TypeParam{1.0});
+
+    // When
+
+    collideCumulant(distribution, RelaxationRates<TypeParam>{1.0, 1.0, 1.0});
+
+    // Then
+
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        EXPECT_NEAR(distribution[i], expected[i], this->tolerance);
+    }
+}
+
+TYPED_TEST(CumulantTest, D2Q9ShearWaveDecaysLikeBGK)
+{
+    // Given
+
+    const TypeParam amplitude{0.01};
+    const TypeParam relaxationFrequency{1.4};
+    auto cumulantLattice{shearWave(amplitude)};
+    auto bgkLattice{shearWave(amplitude)};
+    const RelaxationRates<TypeParam> rates{relaxationFrequency, TypeParam{1.0}, TypeParam{1.0}};
+
+    // When
+
+    for (std::size_t timeStep = 0; timeStep < waveSteps; ++timeStep)
+    {
+        streamAA(cumulantLattice, timeStep, [&](std::array<TypeParam, D2Q9_SIZE>& populations) {
+            relaxCumulant<D2Q9_DESCRIPTOR>(populations, rates);
+        });
+        streamAA(bgkLattice, timeStep, [&](std::array<TypeParam, D2Q9_SIZE>& populations) {
+            relaxBGK<D2Q9_DESCRIPTOR>(populations, relaxationFrequency);
+        });
+    }
+
+    // Then
+
+    const TypeParam viscosity{(TypeParam{1.0} / relaxationFrequency - TypeParam{0.5}) / 3};
+    const TypeParam wavenumber{TypeParam{2.0} * std::numbers::pi_v<TypeParam> / waveLength};
+    const TypeParam decay{std::exp(-viscosity * wavenumber * wavenumber * waveSteps)};
+    for (std::size_t node = 0; node < cumulantLattice.nodeCount(); ++node)
+    {
+        const auto y{static_cast<TypeParam>(node / 4)};
+        const TypeParam expected{amplitude * decay * std::sin(wavenumber * y)};
+        const TypeParam velocity{computeMomentum(gatherAA(cumulantLattice, node, waveSteps))[0]};
+        const TypeParam bgkVelocity{computeMomentum(gatherAA(bgkLattice, node, waveSteps))[0]};
+        EXPECT_NEAR(velocity, bgkVelocity, 5e-3 * amplitude);
+        EXPECT_NEAR(velocity, expected, 2e-2 * amplitude);
+    }
+}
+
+TYPED_TEST(CumulantTest, D2Q9CachedMomentCollisionEqualsLatticeCollision)
+{
+    // Given
+
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> lattice{shearWave(TypeParam{0.05})};
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> expected{lattice};
+    MomentCache<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> cache{
+        lattice, latticeVelocities(D2Q9<TypeParam>{})
+    };
+
+    // When
+
+    collideCumulant(lattice, cache, this->rates);
+    collideCumulant(expected, this->rates);
+
+    // Then
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const D2Q9<TypeParam> actual{lattice.node(node)};
+        const D2Q9<TypeParam> reference{expected.node(node)};
+        for (std::size_t i = 0; i < actual.size(); ++i)
+        {
+            EXPECT_NEAR(actual[i], reference[i], this->tolerance);
+        }
+    }
+    EXPECT_EQ(cache.sweeps(), 1);
+}
@@ -0,0 +1,231 @@
+#include "../../src/collision/mrt.hpp"
+#include <gtest/gtest.h>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class MRTTest : public ::testing::Test
+{
+private:
+    static constexpr std::initializer_list<Scalar> d2q9Distribution_{
+        1.0 / 3.0, 2.0 / 4.0, 3.0 / 5.0,  4.0 / 6.0, 5.0 / 7.0,
+        6.0 / 8.0, 7.0 / 9.0, 8.0 / 10.0, 9.0 / 11.0
+    };
+
+protected:
+    MRTTest() : d2q9Distribution{d2q9Distribution_}
+    {
+        const auto weights{latticeWeights(d3q19Distribution)};
+        for (std::size_t i = 0; i < D3Q19_SIZE; ++i)
+        {
+            d3q19Distribution[i] = weights[i] * (1 + static_cast<Scalar>(i % 4) / 10);
+        }
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    D2Q9<Scalar> d2q9Distribution;
+    D3Q19<Scalar> d3q19Distribution;
+    const RelaxationRates<Scalar> rates{1.7, 1.2, 1.1};
+    const Scalar tolerance{40 * std::numeric_limits<Scalar>::epsilon()};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(MRTTest, FloatingPointTypes);
+
+TYPED_TEST(MRTTest, D2Q9EqualRatesEqualBGK)
+{
+    // Given
+
+    const TypeParam relaxationFrequency{1.7};
+    D2Q9<TypeParam> expected{this->d2q9Distribution};
+    collideBGK(expected, relaxationFrequency);
+
+    // When
+
+    collideMRT(
+        this->d2q9Distribution,
+        RelaxationRates<TypeParam>{relaxationFrequency, relaxationFrequency, relaxationFrequency}
+    );
+
+    // Then
+
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        EXPECT_NEAR(this->d2q9Distribution[i], expected[i], this->tolerance);
+    }
+}
+
+TYPED_TEST(MRTTest, D3Q19EqualRatesEqualBGK)
+{
+    // Given
+
+    const TypeParam relaxationFrequency{1.7};
+    D3Q19<TypeParam> expected{this->d3q19Distribution};
+    relaxBGK<D3Q19_DESCRIPTOR>(expected, relaxationFrequency);
+
+    // When
+
+    collideMRT(
+        this->d3q19Distribution,
+        RelaxationRates<TypeParam>{relaxationFrequency, relaxationFrequency, relaxationFrequency}
+    );
+
+    // Then
+
+    for (std::size_t i = 0; i < D3Q19_SIZE; ++i)
+    {
+        EXPECT_NEAR(this->d3q19Distribution[i], expected[i], this->tolerance);
+    }
+}
+
+TYPED_TEST(MRTTest, D2Q9CollisionConservesDensityAndMomentum)
+{
+    // Given
+
+    const TypeParam expectedDensity{computeDensity(this->d2q9Distribution)};
+    const std::array<TypeParam, 2> expectedMomentum{computeMomentum(this->d2q9Distribution)};
+
+    // When
+
+    collideMRT(this->d2q9Distribution, this->rates);
+    const std::array<TypeParam, 2> momentum{computeMomentum(this->d2q9Distribution)};
+
+    // Then
+
+    EXPECT_NEAR(computeDensity(this->d2q9Distribution), expectedDensity, this->tolerance);
+    EXPECT_NEAR(momentum[0], expectedMomentum[0], this->tolerance);
+    EXPECT_NEAR(momentum[1], expectedMomentum[1], this->tolerance);
+}
+
+TYPED_TEST(MRTTest, D3Q19CollisionConservesDensityAndMomentum)
+{
+    // Given
+
+    const TypeParam expectedDensity{computeDensity(this->d3q19Distribution)};
+    const std::array<TypeParam, 3> expectedMomentum{computeMomentum(this->d3q19Distribution)};
+
+    // When
+
+    collideMRT(this->d3q19Distribution, this->rates);
+    const std::array<TypeParam, 3> momentum{computeMomentum(this->d3q19Distribution)};
+
+    // Then
+
+    EXPECT_NEAR(computeDensity(this->d3q19Distribution), expectedDensity, this->tolerance);
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        EXPECT_NEAR(momentum[axis], expectedMomentum[axis], this->tolerance);
+    }
+}
+
+TYPED_TEST(MRTTest, D2Q9LatticeCollisionEqualsNodeCollision)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{13, 11};
+    Lattice<2, 9, TypeParam> lattice{extents};
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        D2Q9<TypeParam> distribution{this->d2q9Distribution};
+        distribution[node % distribution.size()] += static_cast<TypeParam>(node) / 100;
+        lattice.setNode(node, distribution);
+    }
+    const Lattice<2, 9, TypeParam> initial{lattice};
+
+    // When
+
+    collideMRT(lattice, this->rates);
+
+    // Then
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        D2Q9<TypeParam> expected{initial.node(node)};
+        collideMRT(expected, this->rates);
+        const D2Q9<TypeParam> actual{lattice.node(node)};
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(actual[i], expected[i]);
+        }
+    }
+}
+
+TYPED_TEST(MRTTest, D3Q19LatticeCollisionEqualsNodeCollision)
+{
+    // Given
+
+    const std::array<std::size_t, 3> extents{9, 5, 4};
+    Lattice<3, D3Q19_SIZE, TypeParam> lattice{extents};
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        D3Q19<TypeParam> distribution{this->d3q19Distribution};
+        distribution[node % distribution.size()] += static_cast<TypeParam>(node) / 1000;
+        lattice.setNode(node, distribution);
+    }
+    const Lattice<3, D3Q19_SIZE, TypeParam> initial{lattice};
+
+    // When
+
+    collideMRT(lattice, this->rates);
+
+    // Then
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        D3Q19<TypeParam> expected{initial.node(node)};
+        collideMRT(expected, this->rates);
+        const D3Q19<TypeParam> actual{lattice.node(node)};
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(actual[i], expected[i]);
+        }
+    }
+}
+
+TYPED_TEST(MRTTest, D2Q9CachedMomentCollisionEqualsLatticeCollision)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{13, 11};
+    Lattice<2, 9, TypeParam> lattice{extents};
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        D2Q9<TypeParam> distribution{this->d2q9Distribution};
+        distribution[node % distribution.size()] += static_cast<TypeParam>(node) / 100;
+        lattice.setNode(node, distribution);
+    }
+    Lattice<2, 9, TypeParam> expected{lattice};
+    MomentCache<2, 9, TypeParam> cache{lattice, latticeVelocities(D2Q9<TypeParam>{})};
+
+    // When
+
+    collideMRT(lattice, cache, this->rates);
+    collideMRT(expected, this->rates);
+
+    // Then
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const D2Q9<TypeParam> actual{lattice.node(node)};
+        const D2Q9<TypeParam> reference{expected.node(node)};
+        for (std::size_t i = 0; i < actual.size(); ++i)
+        {
+            EXPECT_NEAR(actual[i], reference[i], this->tolerance);
+        }
+    }
+    EXPECT_EQ(cache.sweeps(), 1);
+}
+
+TYPED_TEST(MRTTest, CacheOfAnotherLatticeThrows)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{4, 3};
+    Lattice<2, 9, TypeParam> lattice{extents};
+    const Lattice<2, 9, TypeParam> other{extents};
+    MomentCache<2, 9, TypeParam> cache{other, latticeVelocities(D2Q9<TypeParam>{})};
+
+    // When / Then
+
+    EXPECT_THROW(collideMRT(lattice, cache, this->rates), std::invalid_argument);
+}
@@ -290,3 +290,70 @@ TYPED_TEST(DensityDistributionTest, DistributionEqualsSetValues)
         EXPECT_EQ(this->nonConstNonDefaultDistribution[i], expectedValue.at(i));
     }
 }
+
+TYPED_TEST(DensityDistributionTest, GetValueWithCompileTimeIndex)
+{
+    // Given
+
+    const TypeParam expectedValue{4.0 / 6.0};
+
+    // When
+
+    const TypeParam& nonConstValue{this->nonConstNonDefaultDistribution.template get<3>()};
+    const TypeParam& constValue{this->constNonDefaultDistribution.template get<3>()};
+
+    // Then
+
+    EXPECT_EQ(nonConstValue, expectedValue);
+    EXPECT_EQ(constValue, expectedValue);
+}
+
+TYPED_TEST(DensityDistributionTest, SetValueWithCompileTimeIndex)
+{
+    // Given
+
+    const TypeParam expectedValue{5.0};
+
+    // When
+
+    this->nonConstNonDefaultDistribution.template get<8>() = expectedValue;
+
+    // Then
+
+    EXPECT_EQ(this->nonConstNonDefaultDistribution[8], expectedValue);
+}
+
+TYPED_TEST(DensityDistributionTest, OutOfRangeSubscriptThrowsWhenBoundsCheckingIsEnabled)
+{
+    // Given
+
+    const std::size_t index{9};
+
+    // When / Then
+
+    if constexpr (LATTICEFLOW_BOUNDS_CHECKING)
+    {
+        EXPECT_THROW(this->nonConstNonDefaultDistribution[index], std::out_of_range);
+        EXPECT_THROW(this->constNonDefaultDistribution[index], std::out_of_range);
+    }
+    else
+    {
+        GTEST_SKIP() << "Bounds checking is disabled";
+    }
+}
+
+TYPED_TEST(DensityDistributionTest, DistributionIsUsableInConstantExpressions)
+{
+    // Given
+
+    constexpr DensityDistribution<2, 9, TypeParam> distribution{3, 5, 7, 11, 13, 17, 19, 23, 29};
+    constexpr DensityDistribution<2, 9, TypeParam> defaultDistribution;
+
+    // When / Then
+
+    static_assert(distribution[3] == TypeParam{11});
+    static_assert(distribution.template get<8>() == TypeParam{29});
+    static_assert(*distribution.cbegin() == TypeParam{3});
+    static_assert(*(distribution.cend() - 1) == TypeParam{29});
+    static_assert(defaultDistribution[0] == TypeParam{0});
+}
@@ -0,0 +1,102 @@
+#include "../../src/densityDistribution/arithmetic.hpp"
+#include <gtest/gtest.h>
+#include <type_traits>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class DensityDistributionExpressionTest : public ::testing::Test
+{
+protected:
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    DensityDistribution<2, 5, Scalar> distribution1{1, 2, 3, 4, 5};
+    DensityDistribution<2, 5, Scalar> distribution2{5, 4, 3, 2, 1};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(DensityDistributionExpressionTest, FloatingPointTypes);
+
+TYPED_TEST(DensityDistributionExpressionTest, DistributionsAreStoredByReference)
+{
+    // Given
+
+    using Distribution = DensityDistribution<2, 5, TypeParam>;
+    using Sum = DensityDistributionSum<2, 5, TypeParam, Distribution, Distribution>;
+
+    // When / Then
+
+    static_assert(std::is_same_v<
+                  typename ExpressionOperand<Distribution>::type,
+                  const Distribution&>);
+    static_assert(std::is_same_v<typename ExpressionOperand<Sum>::type, Sum>);
+}
+
+TYPED_TEST(DensityDistributionExpressionTest, TemporaryDistributionsAreStoredByValue)
+{
+    // Given
+
+    using Distribution = DensityDistribution<2, 5, TypeParam>;
+    using Owned = OwnedDensityDistribution<2, 5, TypeParam>;
+    const auto makeTemporary{[] { return Distribution{1, 1, 1, 1, 1}; }};
+
+    // When
+
+    const auto sum{this->distribution1 + makeTemporary()};
+    const auto difference{makeTemporary() - makeTemporary()};
+    const auto product{TypeParam{2} * makeTemporary()};
+
+    // Then
+
+    static_assert(std::is_same_v<typename ExpressionOperand<Owned>::type, Distribution>);
+    static_assert(std::is_same_v<
+                  std::remove_const_t<decltype(sum)>,
+                  DensityDistributionSum<2, 5, TypeParam, Distribution, Owned>>);
+    EXPECT_EQ(sum[0], TypeParam{2});
+    EXPECT_EQ(sum[4], TypeParam{6});
+    EXPECT_EQ(difference[2], TypeParam{0});
+    EXPECT_EQ(product[3], TypeParam{2});
+}
+
+TYPED_TEST(DensityDistributionExpressionTest, ExpressionIsEvaluatedWhenIndexed)
+{
+    // Given
+
+    const auto expression{this->distribution1 - this->distribution2};
+
+    // When
+
+    this->distribution1[4] = TypeParam{11};
+
+    // Then
+
+    EXPECT_EQ(expression[0], TypeParam{-4});
+    EXPECT_EQ(expression[4], TypeParam{10});
+}
+
+TYPED_TEST(DensityDistributionExpressionTest, DerivedReturnsExpressionItself)
+{
+    // Given
+
+    const DensityDistributionExpression<2, 5, TypeParam, DensityDistribution<2, 5, TypeParam>>&
+        base{this->distribution1};
+
+    // When
+
+    const DensityDistribution<2, 5, TypeParam>& derived{base.derived()};
+
+    // Then
+
+    EXPECT_EQ(&derived, &this->distribution1);
+    EXPECT_EQ(base[2], TypeParam{3});
+}
+
+TYPED_TEST(DensityDistributionExpressionTest, DistributionSizeIsUnchanged)
+{
+    // Given
+
+    const std::size_t expectedSize{5 * sizeof(TypeParam)};
+
+    // When / Then
+
+    EXPECT_EQ(sizeof(DensityDistribution<2, 5, TypeParam>), expectedSize);
+}
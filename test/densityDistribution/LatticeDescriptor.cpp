@@ -0,0 +1,118 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/densityDistribution/LatticeDescriptor.hpp"
+#include "../../src/densityDistribution/d2q9.hpp"
+#include <gtest/gtest.h>
+
+namespace
+{
+
+constexpr LatticeDescriptor<1, 3> D1Q3_DESCRIPTOR{
+    makeLatticeDescriptor<1, 3>({{{0}, {1}, {-1}}}, {2.0 / 3.0, 1.0 / 6.0, 1.0 / 6.0}, 1.0 / 3.0)
+};
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class LatticeDescriptorTest : public ::testing::Test
+{
+private:
+    static constexpr std::initializer_list<Scalar> distribution_{1.0 / 3.0, 2.0 / 4.0,  3.0 / 5.0,
+                                                                 4.0 / 6.0, 5.0 / 7.0,  6.0 / 8.0,
+                                                                 7.0 / 9.0, 8.0 / 10.0, 9.0 / 11.0};
+
+protected:
+    LatticeDescriptorTest() : distribution{distribution_} {}
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    D2Q9<Scalar> distribution;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(LatticeDescriptorTest, FloatingPointTypes);
+
+TYPED_TEST(LatticeDescriptorTest, OppositesAreDerivedFromVelocities)
+{
+    // Given
+
+    constexpr std::array<std::size_t, 9> expectedD2Q9Opposites{0, 3, 4, 1, 2, 7, 8, 5, 6};
+    constexpr std::array<std::size_t, 3> expectedD1Q3Opposites{0, 2, 1};
+
+    // When / Then
+
+    static_assert(D2Q9_DESCRIPTOR.opposites == expectedD2Q9Opposites);
+    static_assert(D1Q3_DESCRIPTOR.opposites == expectedD1Q3Opposites);
+}
+
+TYPED_TEST(LatticeDescriptorTest, DensityMatchesHandWrittenSum)
+{
+    // Given
+
+    const D2Q9<TypeParam>& f{this->distribution};
+    const TypeParam expectedDensity{f[0] + f[1] + f[2] + f[3] + f[4] + f[5] + f[6] + f[7] + f[8]};
+
+    // When
+
+    const TypeParam density{computeDensity<D2Q9_DESCRIPTOR>(this->distribution)};
+
+    // Then
+
+    EXPECT_EQ(density, expectedDensity);
+}
+
+TYPED_TEST(LatticeDescriptorTest, MomentumMatchesHandWrittenSums)
+{
+    // Given
+
+    const D2Q9<TypeParam>& f{this->distribution};
+    const std::array<TypeParam, 2> expectedMomentum{
+        (f[1] + f[5] + f[8]) - (f[3] + f[6] + f[7]), (f[2] + f[5] + f[6]) - (f[4] + f[7] + f[8])
+    };
+
+    // When
+
+    const std::array<TypeParam, 2> momentum{computeMomentum<D2Q9_DESCRIPTOR>(this->distribution)};
+
+    // Then
+
+    EXPECT_EQ(momentum, expectedMomentum);
+}
+
+TYPED_TEST(LatticeDescriptorTest, EquilibriumIsFixedPointOfBGK)
+{
+    // Given
+
+    const TypeParam density{1.1};
+    const std::array<TypeParam, 2> velocity{0.05, -0.02};
+    const TypeParam tolerance{10 * std::numeric_limits<TypeParam>::epsilon()};
+
+    // When
+
+    const D2Q9<TypeParam> equilibrium{computeEquilibrium<D2Q9_DESCRIPTOR>(density, velocity)};
+    D2Q9<TypeParam> relaxed{equilibrium};
+    collideBGK(relaxed, TypeParam{1.0});
+
+    // Then
+
+    for (std::size_t i = 0; i < equilibrium.size(); ++i)
+    {
+        EXPECT_NEAR(relaxed[i], equilibrium[i], tolerance);
+    }
+}
+
+TYPED_TEST(LatticeDescriptorTest, GenericFunctionsSupportOtherModels)
+{
+    // Given
+
+    constexpr DensityDistribution<1, 3, TypeParam> distribution{4, 2, 1};
+
+    // When / Then
+
+    static_assert(computeDensity<D1Q3_DESCRIPTOR>(distribution) == TypeParam{7});
+    static_assert(computeMomentum<D1Q3_DESCRIPTOR>(distribution) == std::array<TypeParam, 1>{1});
+    static_assert(
+        computeEquilibrium<D1Q3_DESCRIPTOR>(TypeParam{3}, std::array<TypeParam, 1>{0})[0] ==
+        TypeParam{2}
+    );
+}
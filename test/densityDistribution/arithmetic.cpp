@@ -67,3 +67,128 @@ TYPED_TEST(
         EXPECT_EQ(summedDistribution[i], expectedDistribution[i]);
     }
 }
+
+TYPED_TEST(DensityDistributionArithmeticTest, MultiplyingDistributionByScalarScalesElements)
+{
+    // Given
+
+    const TypeParam factor{0.5};
+    const DensityDistribution<2, 9, TypeParam> expectedDistribution{
+        0.5, 1.0, 1.5, 2.0, 2.5, 3.0, 3.5, 4.0, 4.5
+    };
+
+    // When
+
+    const DensityDistribution<2, 9, TypeParam> rightScaled = this->distribution1 * factor;
+    const DensityDistribution<2, 9, TypeParam> leftScaled = factor * this->distribution1;
+
+    // Then
+
+    for (std::size_t i = 0; i < expectedDistribution.size(); ++i)
+    {
+        EXPECT_EQ(rightScaled[i], expectedDistribution[i]);
+        EXPECT_EQ(leftScaled[i], expectedDistribution[i]);
+    }
+}
+
+TYPED_TEST(DensityDistributionArithmeticTest, DividingDistributionByScalarScalesElements)
+{
+    // Given
+
+    const TypeParam divisor{2.0};
+    const DensityDistribution<2, 9, TypeParam> expectedDistribution{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    // When
+
+    const DensityDistribution<2, 9, TypeParam> scaled = this->distribution2 / divisor;
+
+    // Then
+
+    for (std::size_t i = 0; i < expectedDistribution.size(); ++i)
+    {
+        EXPECT_EQ(scaled[i], expectedDistribution[i]);
+    }
+}
+
+TYPED_TEST(DensityDistributionArithmeticTest, NestedExpressionEqualsElementWiseEvaluation)
+{
+    // Given
+
+    const TypeParam relaxationFrequency{0.25};
+    DensityDistribution<2, 9, TypeParam> expectedDistribution;
+    for (std::size_t i = 0; i < expectedDistribution.size(); ++i)
+    {
+        expectedDistribution[i] = this->distribution1[i] +
+                                  (this->distribution2[i] - this->distribution1[i]) *
+                                      relaxationFrequency;
+    }
+
+    // When
+
+    this->distribution1 = this->distribution1 +
+                          (this->distribution2 - this->distribution1) * relaxationFrequency;
+
+    // Then
+
+    for (std::size_t i = 0; i < expectedDistribution.size(); ++i)
+    {
+        EXPECT_EQ(this->distribution1[i], expectedDistribution[i]);
+    }
+}
+
+TYPED_TEST(DensityDistributionArithmeticTest, CompoundAssignmentUpdatesDistributionInPlace)
+{
+    // Given
+
+    const DensityDistribution<2, 9, TypeParam> expectedDistribution{5,  10, 15, 20, 25,
+                                                                    30, 35, 40, 45};
+
+    // When
+
+    this->distribution1 += this->distribution2;
+    this->distribution1 -= this->distribution2 * TypeParam{0.5};
+    this->distribution1 *= TypeParam{5.0};
+    this->distribution1 /= TypeParam{2.0};
+
+    // Then
+
+    for (std::size_t i = 0; i < expectedDistribution.size(); ++i)
+    {
+        EXPECT_EQ(this->distribution1[i], expectedDistribution[i]);
+    }
+}
+
+TYPED_TEST(DensityDistributionArithmeticTest, OperandsMustHaveMatchingTemplateParameters)
+{
+    // Given
+
+    using D2Q9 = DensityDistribution<2, 9, TypeParam>;
+    using D3Q9 = DensityDistribution<3, 9, TypeParam>;
+    using D2Q5 = DensityDistribution<2, 5, TypeParam>;
+    using D2Q9Long = DensityDistribution<2, 9, long double>;
+
+    // When / Then
+
+    static_assert(requires(D2Q9 lhs, D2Q9 rhs) { lhs + rhs; });
+    static_assert(!requires(D2Q9 lhs, D3Q9 rhs) { lhs + rhs; });
+    static_assert(!requires(D2Q9 lhs, D2Q5 rhs) { lhs - rhs; });
+    static_assert(!requires(D2Q9 lhs, D2Q9Long rhs) { lhs + rhs; });
+    static_assert(!requires(D2Q9 lhs, D2Q5 rhs) { lhs += rhs; });
+}
+
+TYPED_TEST(DensityDistributionArithmeticTest, ExpressionsAreUsableInConstantExpressions)
+{
+    // Given
+
+    constexpr DensityDistribution<2, 9, TypeParam> lhs{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    constexpr DensityDistribution<2, 9, TypeParam> rhs{9, 8, 7, 6, 5, 4, 3, 2, 1};
+
+    // When
+
+    constexpr DensityDistribution<2, 9, TypeParam> result = (lhs + rhs) * TypeParam{2} - lhs;
+
+    // Then
+
+    static_assert(result[0] == TypeParam{19});
+    static_assert(result[8] == TypeParam{11});
+}
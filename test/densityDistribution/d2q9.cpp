@@ -128,3 +128,82 @@ TYPED_TEST(D2Q9Test, WeightsEqualLiteratureValues)
     EXPECT_EQ(weight[7], expectedWeightBottomLeft);
     EXPECT_EQ(weight[8], expectedWeightBottomRight);
 }
+
+TYPED_TEST(D2Q9Test, VelocitiesMatchMomentumDefinition)
+{
+    // Given
+
+    const std::array<TypeParam, 2> expectedMomentum{computeMomentum(this->nonDefaultDistribution)};
+    const TypeParam tolerance{10 * std::numeric_limits<TypeParam>::epsilon()};
+
+    // When
+
+    const std::array<std::array<int, 2>, 9> velocities{
+        latticeVelocities(this->nonDefaultDistribution)
+    };
+    std::array<TypeParam, 2> momentum{0.0, 0.0};
+    for (std::size_t i = 0; i < velocities.size(); ++i)
+    {
+        momentum[0] += static_cast<TypeParam>(velocities[i][0]) * this->nonDefaultDistribution[i];
+        momentum[1] += static_cast<TypeParam>(velocities[i][1]) * this->nonDefaultDistribution[i];
+    }
+
+    // Then
+
+    EXPECT_EQ(velocities[0], (std::array<int, 2>{0, 0}));
+    EXPECT_NEAR(momentum[0], expectedMomentum[0], tolerance);
+    EXPECT_NEAR(momentum[1], expectedMomentum[1], tolerance);
+}
+
+TYPED_TEST(D2Q9Test, OppositeVelocitiesCancel)
+{
+    // Given
+
+    const std::array<std::array<int, 2>, 9> velocities{
+        latticeVelocities(this->nonDefaultDistribution)
+    };
+
+    // When
+
+    const std::array<std::size_t, 9> opposites{latticeOpposites(this->nonDefaultDistribution)};
+
+    // Then
+
+    for (std::size_t i = 0; i < opposites.size(); ++i)
+    {
+        EXPECT_EQ(opposites[opposites[i]], i);
+        EXPECT_EQ(velocities[i][0] + velocities[opposites[i]][0], 0);
+        EXPECT_EQ(velocities[i][1] + velocities[opposites[i]][1], 0);
+    }
+}
+
+TYPED_TEST(D2Q9Test, MomentsAreComputableInConstantExpressions)
+{
+    // Given
+
+    constexpr D2Q9<TypeParam> distribution{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    // When / Then
+
+    static_assert(computeDensity(distribution) == TypeParam{45});
+    static_assert(computeMomentum(distribution) == std::array<TypeParam, 2>{-2, -6});
+}
+
+TYPED_TEST(D2Q9Test, EquilibriumPreservesDensityAndMomentum)
+{
+    // Given
+
+    const TypeParam expectedDensity{computeDensity(this->nonDefaultDistribution)};
+    const std::array<TypeParam, 2> expectedMomentum{computeMomentum(this->nonDefaultDistribution)};
+    const TypeParam tolerance{100 * std::numeric_limits<TypeParam>::epsilon()};
+
+    // When
+
+    const D2Q9<TypeParam> equilibrium{computeEquilibrium(this->nonDefaultDistribution)};
+
+    // Then
+
+    EXPECT_NEAR(computeDensity(equilibrium), expectedDensity, tolerance);
+    EXPECT_NEAR(computeMomentum(equilibrium)[0], expectedMomentum[0], tolerance);
+    EXPECT_NEAR(computeMomentum(equilibrium)[1], expectedMomentum[1], tolerance);
+}
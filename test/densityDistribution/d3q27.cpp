@@ -0,0 +1,154 @@
+#include "../../src/densityDistribution/d3q27.hpp"
+#include <gtest/gtest.h>
+#include <numeric>
+
+template <typename Scalar>
+class D3Q27Test : public ::testing::Test
+{
+protected:
+    D3Q27Test()
+    {
+        for (std::size_t i = 0; i < nonDefaultDistribution.size(); ++i)
+        {
+            nonDefaultDistribution[i] = static_cast<Scalar>(i + 1) / static_cast<Scalar>(i + 3);
+        }
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    D3Q27<Scalar> defaultDistribution;
+    D3Q27<Scalar> nonDefaultDistribution;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(D3Q27Test, FloatingPointTypes);
+
+TYPED_TEST(D3Q27Test, DefaultMomentsEqualZero)
+{
+    // Given
+
+    const TypeParam expectedDensity{0.0};
+    const std::array<TypeParam, 3> expectedMomentum{0.0, 0.0, 0.0};
+
+    // When
+
+    const TypeParam density{computeDensity(this->defaultDistribution)};
+    const std::array<TypeParam, 3> momentum{computeMomentum(this->defaultDistribution)};
+
+    // Then
+
+    EXPECT_EQ(density, expectedDensity);
+    EXPECT_EQ(momentum, expectedMomentum);
+}
+
+TYPED_TEST(D3Q27Test, WeightsMatchVelocityShells)
+{
+    // Reference:
+
+    //  @book{
+    //      author = {Krüger, Timm and Kusumaatmaja, Halim and Kuzmin, Alexandr and Shardt, Orest
+    //      and Silva, Goncalo and Viggen, Erlend Magnus},
+    //      title = {The Lattice Boltzmann Method},
+    //      year = {2017},
+    //      publisher = {Springer},
+    //      isbn = {978-3-319-83103-9},
+    //      doi = {10.1007/978-3-319-44649-3}
+    //  }
+
+    // Given
+
+    const std::array<TypeParam, 4> expectedShellWeights{
+        8.0 / 27.0, 2.0 / 27.0, 1.0 / 54.0, 1.0 / 216.0
+    };
+
+    // When
+
+    const std::array<TypeParam, 27> weights{latticeWeights(this->nonDefaultDistribution)};
+    const std::array<std::array<int, 3>, 27> velocities{
+        latticeVelocities(this->nonDefaultDistribution)
+    };
+
+    // Then
+
+    EXPECT_NEAR(std::accumulate(weights.begin(), weights.end(), TypeParam{0.0}), 1.0, 1e-6);
+    for (std::size_t i = 0; i < weights.size(); ++i)
+    {
+        const std::size_t shell{static_cast<std::size_t>(
+            std::abs(velocities[i][0]) + std::abs(velocities[i][1]) + std::abs(velocities[i][2])
+        )};
+        EXPECT_EQ(weights[i], expectedShellWeights[shell]);
+    }
+}
+
+TYPED_TEST(D3Q27Test, MomentumMatchesVelocityDefinition)
+{
+    // Given
+
+    const D3Q27<TypeParam>& distribution{this->nonDefaultDistribution};
+    const std::array<std::array<int, 3>, 27> velocities{latticeVelocities(distribution)};
+    const TypeParam tolerance{100 * std::numeric_limits<TypeParam>::epsilon()};
+    std::array<TypeParam, 3> expectedMomentum{0.0, 0.0, 0.0};
+    for (std::size_t i = 0; i < velocities.size(); ++i)
+    {
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            expectedMomentum[axis] += static_cast<TypeParam>(velocities[i][axis]) * distribution[i];
+        }
+    }
+
+    // When
+
+    const std::array<TypeParam, 3> momentum{computeMomentum(distribution)};
+
+    // Then
+
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        EXPECT_NEAR(momentum[axis], expectedMomentum[axis], tolerance);
+    }
+}
+
+TYPED_TEST(D3Q27Test, OppositeVelocitiesCancel)
+{
+    // Given
+
+    const std::array<std::array<int, 3>, 27> velocities{
+        latticeVelocities(this->nonDefaultDistribution)
+    };
+
+    // When
+
+    const std::array<std::size_t, 27> opposites{latticeOpposites(this->nonDefaultDistribution)};
+
+    // Then
+
+    for (std::size_t i = 0; i < opposites.size(); ++i)
+    {
+        EXPECT_EQ(opposites[opposites[i]], i);
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            EXPECT_EQ(velocities[i][axis] + velocities[opposites[i]][axis], 0);
+        }
+    }
+}
+
+TYPED_TEST(D3Q27Test, EquilibriumPreservesDensityAndMomentum)
+{
+    // Given
+
+    const TypeParam expectedDensity{computeDensity(this->nonDefaultDistribution)};
+    const std::array<TypeParam, 3> expectedMomentum{computeMomentum(this->nonDefaultDistribution)};
+    const TypeParam tolerance{100 * std::numeric_limits<TypeParam>::epsilon()};
+
+    // When
+
+    const D3Q27<TypeParam> equilibrium{computeEquilibrium(this->nonDefaultDistribution)};
+
+    // Then
+
+    EXPECT_NEAR(computeDensity(equilibrium), expectedDensity, tolerance);
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        EXPECT_NEAR(computeMomentum(equilibrium)[axis], expectedMomentum[axis], tolerance);
+    }
+}
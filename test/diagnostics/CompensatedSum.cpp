@@ -0,0 +1,79 @@
+#include "../../src/diagnostics/CompensatedSum.hpp"
+#include <gtest/gtest.h>
+#include <limits>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class CompensatedSumTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(CompensatedSumTest, FloatingPointTypes);
+
+TYPED_TEST(CompensatedSumTest, ManySmallTermsSumToTheExactValue)
+{
+    // Given
+
+    constexpr std::size_t termCount{std::size_t{1} << 22};
+    const TypeParam term{0.1};
+    CompensatedSum<TypeParam> sum;
+    TypeParam plainSum{0.0};
+
+    // When
+
+    for (std::size_t index = 0; index < termCount; ++index)
+    {
+        sum.add(term);
+        plainSum += term;
+    }
+
+    // Then
+
+    const long double exact{static_cast<long double>(term) * termCount};
+    const auto error{[&](TypeParam value) {
+        return std::abs(static_cast<long double>(value) - exact) / exact;
+    }};
+    EXPECT_LE(error(sum.value()), std::numeric_limits<TypeParam>::epsilon());
+    EXPECT_LT(error(sum.value()), error(plainSum));
+}
+
+TYPED_TEST(CompensatedSumTest, TermsLargerThanTheSumAreCompensated)
+{
+    // Given
+
+    const TypeParam large{TypeParam{2.0} / std::numeric_limits<TypeParam>::epsilon()};
+    CompensatedSum<TypeParam> sum;
+
+    // When
+
+    sum.add(TypeParam{1.0});
+    sum.add(large);
+    sum.add(TypeParam{1.0});
+    sum.add(-large);
+
+    // Then
+
+    EXPECT_EQ(sum.value(), TypeParam{2.0});
+}
+
+TYPED_TEST(CompensatedSumTest, MergedPartialSumsEqualOneSum)
+{
+    // Given
+
+    CompensatedSum<TypeParam> first;
+    CompensatedSum<TypeParam> second;
+    for (std::size_t index = 0; index < 1000; ++index)
+    {
+        first.add(TypeParam{0.1});
+        second.add(TypeParam{0.3});
+    }
+
+    // When
+
+    first.merge(second);
+
+    // Then
+
+    EXPECT_NEAR(first.value(), TypeParam{400.0}, 400 * std::numeric_limits<TypeParam>::epsilon());
+}
@@ -0,0 +1,212 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/diagnostics/ConvergenceMonitor.hpp"
+#include "../../src/lattice/equilibrium.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <numbers>
+#include <set>
+#include <vector>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class ConvergenceMonitorTest : public ::testing::Test
+{
+private:
+    static constexpr std::array<std::size_t, 2> extents_{8, 32};
+
+protected:
+    // A uniform flow along the first axis with a decaying shear wave across it, which converges to
+    // the uniform flow.
+    ConvergenceMonitorTest() : lattice{extents_}
+    {
+        const std::vector<Scalar> densities(lattice.nodeCount(), Scalar{1.0});
+        std::vector<Scalar> velocityX(lattice.nodeCount());
+        const std::vector<Scalar> velocityY(lattice.nodeCount(), Scalar{0.0});
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            const auto phase{
+                2 * std::numbers::pi_v<Scalar> * static_cast<Scalar>(node / extents_[0]) /
+                static_cast<Scalar>(extents_[1])
+            };
+            velocityX[node] = Scalar{0.05} + Scalar{0.01} * std::sin(phase);
+        }
+        initializeEquilibrium(
+            lattice,
+            std::span<const Scalar>{densities},
+            {std::span<const Scalar>{velocityX}, std::span<const Scalar>{velocityY}}
+        );
+    }
+
+    auto advance()
+    {
+        return [this](std::size_t timeStep) {
+            streamAA(lattice, timeStep, [](std::array<Scalar, D2Q9_SIZE>& values) {
+                relaxBGK<D2Q9_DESCRIPTOR>(values, Scalar{1.2});
+            });
+        };
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    Lattice<2, 9, Scalar> lattice;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(ConvergenceMonitorTest, FloatingPointTypes);
+
+TYPED_TEST(ConvergenceMonitorTest, SamplesAreSpreadOverRowsAndColumns)
+{
+    // Given
+
+    const ConvergenceMonitor<D2Q9_DESCRIPTOR, TypeParam> monitor{
+        this->lattice.extents(), 1e-5F, 10, 16
+    };
+
+    // When
+
+    const std::vector<std::size_t>& samples{monitor.samples()};
+
+    // Then
+
+    ASSERT_EQ(samples.size(), 16);
+    EXPECT_TRUE(std::ranges::is_sorted(samples));
+    EXPECT_LT(samples.back(), this->lattice.nodeCount());
+    EXPECT_NE(samples[0] % 8, samples[1] % 8);
+    EXPECT_NE(samples[0] / 8, samples.back() / 8);
+}
+
+TYPED_TEST(ConvergenceMonitorTest, SamplesCoverEveryAxisOfPowerOfTwoLattices)
+{
+    // Given
+
+    const std::size_t extent{1024};
+    const ConvergenceMonitor<D2Q9_DESCRIPTOR, TypeParam> monitor{{extent, extent}, 1e-5F, 10, 4096};
+
+    // When
+
+    std::set<std::size_t> columns;
+    std::set<std::size_t> rows;
+    for (const std::size_t node : monitor.samples())
+    {
+        columns.insert(node % extent);
+        rows.insert(node / extent);
+    }
+
+    // Then
+
+    EXPECT_EQ(monitor.samples().size(), 4096);
+    EXPECT_EQ(columns.size(), 64);
+    EXPECT_EQ(rows.size(), 64);
+    EXPECT_LT(*columns.begin(), extent / 64);
+    EXPECT_GE(*columns.rbegin(), extent - extent / 64);
+}
+
+TYPED_TEST(ConvergenceMonitorTest, ResidualIsOnlyUpdatedWhenACheckIsDue)
+{
+    // Given
+
+    ConvergenceMonitor<D2Q9_DESCRIPTOR, TypeParam> monitor{this->lattice.extents(), 1e-5F, 4};
+    const auto advance{this->advance()};
+
+    // When
+
+    monitor.update(this->lattice, 0);
+    const TypeParam first{monitor.residual()};
+    for (std::size_t step = 0; step < 4; ++step)
+    {
+        advance(step);
+        monitor.update(this->lattice, step + 1);
+        if (step < 3)
+        {
+            EXPECT_EQ(monitor.residual(), first);
+        }
+    }
+
+    // Then
+
+    EXPECT_EQ(first, std::numeric_limits<TypeParam>::infinity());
+    EXPECT_GT(monitor.residual(), TypeParam{0.0});
+    EXPECT_LT(monitor.residual(), TypeParam{1e-2});
+    EXPECT_FALSE(monitor.converged());
+}
+
+TYPED_TEST(ConvergenceMonitorTest, UnchangedFlowConverges)
+{
+    // Given
+
+    ConvergenceMonitor<D2Q9_DESCRIPTOR, TypeParam> monitor{this->lattice.extents(), 1e-5F, 2};
+
+    // When
+
+    const bool initial{monitor.update(this->lattice, 0)};
+    const bool unchanged{monitor.update(this->lattice, 2)};
+
+    // Then
+
+    EXPECT_FALSE(initial);
+    EXPECT_TRUE(unchanged);
+    EXPECT_EQ(monitor.residual(), TypeParam{0.0});
+}
+
+TYPED_TEST(ConvergenceMonitorTest, RunStopsOnceTheShearWaveHasDecayed)
+{
+    // Given
+
+    const TypeParam threshold{1e-5F};
+    const std::size_t maxSteps{4000};
+    ConvergenceMonitor<D2Q9_DESCRIPTOR, TypeParam> monitor{this->lattice.extents(), threshold, 10};
+
+    // When
+
+    const std::size_t steps{advanceUntilConverged(
+        this->lattice, monitor, maxSteps, PopulationLayout::AAPattern, this->advance()
+    )};
+
+    // Then
+
+    EXPECT_LT(steps, maxSteps);
+    EXPECT_EQ(steps % 10, 0);
+    EXPECT_TRUE(monitor.converged());
+    EXPECT_LT(monitor.residual(), threshold);
+}
+
+TYPED_TEST(ConvergenceMonitorTest, ThrowsOnInvalidArguments)
+{
+    // Given
+
+    ConvergenceMonitor<D2Q9_DESCRIPTOR, TypeParam> monitor{this->lattice.extents(), 1e-5F, 2};
+    const Lattice<2, 9, TypeParam> otherLattice{{4, 4}};
+
+    // When / Then
+
+    EXPECT_THROW(
+        (ConvergenceMonitor<D2Q9_DESCRIPTOR, TypeParam>{this->lattice.extents(), 1e-5F, 0}),
+        std::invalid_argument
+    );
+    EXPECT_THROW(
+        (ConvergenceMonitor<D2Q9_DESCRIPTOR, TypeParam>{this->lattice.extents(), 1e-5F, 2, 0}),
+        std::invalid_argument
+    );
+    EXPECT_THROW(monitor.update(otherLattice, 0), std::invalid_argument);
+}
+
+TYPED_TEST(ConvergenceMonitorTest, AATimeLoopThrowsOnOddCheckInterval)
+{
+    // Given
+
+    ConvergenceMonitor<D2Q9_DESCRIPTOR, TypeParam> monitor{this->lattice.extents(), 1e-5F, 5};
+
+    // When / Then
+
+    EXPECT_THROW(
+        advanceUntilConverged(
+            this->lattice, monitor, 10, PopulationLayout::AAPattern, this->advance()
+        ),
+        std::invalid_argument
+    );
+    EXPECT_NO_THROW(advanceUntilConverged(
+        this->lattice, monitor, 10, PopulationLayout::Natural, [](std::size_t) {}
+    ));
+}
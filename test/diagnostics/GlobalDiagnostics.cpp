@@ -0,0 +1,192 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/diagnostics/GlobalDiagnostics.hpp"
+#include "../../src/lattice/equilibrium.hpp"
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class GlobalDiagnosticsTest : public ::testing::Test
+{
+private:
+    static constexpr std::array<std::size_t, 2> extents_{19, 11};
+
+protected:
+    GlobalDiagnosticsTest() : lattice{extents_}
+    {
+        std::vector<Scalar> densities(lattice.nodeCount());
+        std::vector<Scalar> velocityX(lattice.nodeCount());
+        std::vector<Scalar> velocityY(lattice.nodeCount());
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            densities[node] = Scalar{1.0} + static_cast<Scalar>(node % 13) / 100;
+            velocityX[node] = static_cast<Scalar>(static_cast<int>(node % 9) - 4) / 100;
+            velocityY[node] = static_cast<Scalar>(node % 5) / 100;
+        }
+        initializeEquilibrium(
+            lattice,
+            std::span<const Scalar>{densities},
+            {std::span<const Scalar>{velocityX}, std::span<const Scalar>{velocityY}}
+        );
+    }
+
+    auto collision() const
+    {
+        return [](std::array<Scalar, D2Q9_SIZE>& values) {
+            relaxBGK<D2Q9_DESCRIPTOR>(values, Scalar{1.3});
+        };
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    Lattice<2, 9, Scalar> lattice;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(GlobalDiagnosticsTest, FloatingPointTypes);
+
+TYPED_TEST(GlobalDiagnosticsTest, ReductionMatchesNodeMoments)
+{
+    // Given
+
+    DiagnosticsReducer<D2Q9_DESCRIPTOR, TypeParam> reducer{this->lattice.extents()};
+    long double mass{0.0};
+    std::array<long double, 2> momentum{};
+    long double kineticEnergy{0.0};
+    long double maxVelocity{0.0};
+    for (std::size_t node = 0; node < this->lattice.nodeCount(); ++node)
+    {
+        const D2Q9<TypeParam> distribution{this->lattice.node(node)};
+        const TypeParam density{computeDensity(distribution)};
+        const std::array<TypeParam, 2> nodeMomentum{computeMomentum(distribution)};
+        const long double velocitySquared{
+            (static_cast<long double>(nodeMomentum[0]) * nodeMomentum[0] +
+             static_cast<long double>(nodeMomentum[1]) * nodeMomentum[1]) /
+            (static_cast<long double>(density) * density)
+        };
+        mass += density;
+        momentum[0] += nodeMomentum[0];
+        momentum[1] += nodeMomentum[1];
+        kineticEnergy += density * velocitySquared / 2;
+        maxVelocity = std::max(maxVelocity, std::sqrt(velocitySquared));
+    }
+
+    // When
+
+    const auto diagnostics{reducer.reduce(this->lattice)};
+
+    // Then
+
+    const TypeParam tolerance{64 * std::numeric_limits<TypeParam>::epsilon()};
+    EXPECT_NEAR(diagnostics.mass, mass, tolerance * mass);
+    EXPECT_NEAR(diagnostics.momentum[0], momentum[0], tolerance * mass);
+    EXPECT_NEAR(diagnostics.momentum[1], momentum[1], tolerance * mass);
+    EXPECT_NEAR(diagnostics.kineticEnergy, kineticEnergy, tolerance * kineticEnergy);
+    EXPECT_NEAR(diagnostics.maxVelocity, maxVelocity, tolerance);
+    EXPECT_EQ(diagnostics.residual, std::numeric_limits<TypeParam>::infinity());
+}
+
+TYPED_TEST(GlobalDiagnosticsTest, ParallelReductionIsBitIdenticalForAnyThreadCount)
+{
+    // Given
+
+    const std::array<std::size_t, 2> tileExtents{6, 4};
+    TiledScheduler<2> sequentialScheduler{this->lattice.extents(), tileExtents, 1};
+    DiagnosticsReducer<D2Q9_DESCRIPTOR, TypeParam> sequentialReducer{sequentialScheduler};
+    const auto expected{sequentialReducer.reduce(this->lattice)};
+
+    for (const std::size_t threadCount : {1, 2, 3, 4})
+    {
+        TiledScheduler<2> scheduler{this->lattice.extents(), tileExtents, threadCount};
+        DiagnosticsReducer<D2Q9_DESCRIPTOR, TypeParam> reducer{scheduler};
+
+        // When
+
+        const auto diagnostics{reducer.reduce(this->lattice, scheduler)};
+
+        // Then
+
+        EXPECT_EQ(diagnostics.mass, expected.mass);
+        EXPECT_EQ(diagnostics.momentum, expected.momentum);
+        EXPECT_EQ(diagnostics.kineticEnergy, expected.kineticEnergy);
+        EXPECT_EQ(diagnostics.maxVelocity, expected.maxVelocity);
+    }
+}
+
+TYPED_TEST(GlobalDiagnosticsTest, FusedTimeStepReportsTheLatticeBeforeTheStep)
+{
+    // Given
+
+    const std::array<std::size_t, 2> tileExtents{8, 3};
+    TiledScheduler<2> scheduler{this->lattice.extents(), tileExtents, 3};
+    DiagnosticsReducer<D2Q9_DESCRIPTOR, TypeParam> fusedReducer{scheduler};
+    DiagnosticsReducer<D2Q9_DESCRIPTOR, TypeParam> reducer{scheduler};
+    Lattice<2, 9, TypeParam> expected{this->lattice};
+
+    for (std::size_t step = 0; step < 6; step += 2)
+    {
+        const auto separate{reducer.reduce(expected)};
+        streamAA(expected, step, this->collision());
+        streamAA(expected, step + 1, this->collision());
+
+        // When
+
+        const auto fused{
+            fusedReducer.streamAA(this->lattice, step, this->collision(), scheduler)
+        };
+        const auto odd{fusedReducer.streamAA(this->lattice, step + 1, this->collision())};
+
+        // Then
+
+        EXPECT_EQ(fused.mass, separate.mass);
+        EXPECT_EQ(fused.momentum, separate.momentum);
+        EXPECT_EQ(fused.kineticEnergy, separate.kineticEnergy);
+        EXPECT_EQ(fused.maxVelocity, separate.maxVelocity);
+        const TypeParam tolerance{16 * std::numeric_limits<TypeParam>::epsilon()};
+        EXPECT_NEAR(odd.mass, separate.mass, tolerance * separate.mass);
+        for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+        {
+            EXPECT_TRUE(std::ranges::equal(this->lattice.population(i), expected.population(i)));
+        }
+    }
+}
+
+TYPED_TEST(GlobalDiagnosticsTest, ResidualMeasuresTheRelativeChangeOfTheVelocityField)
+{
+    // Given
+
+    DiagnosticsReducer<D2Q9_DESCRIPTOR, TypeParam> reducer{this->lattice.extents()};
+    const auto first{reducer.reduce(this->lattice)};
+    const auto unchanged{reducer.reduce(this->lattice)};
+
+    // When
+
+    for (std::size_t step = 0; step < 2; ++step)
+    {
+        streamAA(this->lattice, step, this->collision());
+    }
+    const auto changed{reducer.reduce(this->lattice)};
+
+    // Then
+
+    EXPECT_EQ(first.residual, std::numeric_limits<TypeParam>::infinity());
+    EXPECT_EQ(unchanged.residual, TypeParam{0.0});
+    EXPECT_GT(changed.residual, TypeParam{0.0});
+    EXPECT_LT(changed.residual, TypeParam{1.0});
+}
+
+TYPED_TEST(GlobalDiagnosticsTest, ThrowsIfLatticeOrSchedulerDiffersFromReducer)
+{
+    // Given
+
+    TiledScheduler<2> scheduler{this->lattice.extents(), {4, 4}, 1};
+    TiledScheduler<2> otherScheduler{this->lattice.extents(), {5, 5}, 1};
+    DiagnosticsReducer<D2Q9_DESCRIPTOR, TypeParam> reducer{scheduler};
+    const Lattice<2, 9, TypeParam> otherLattice{{4, 4}};
+
+    // When / Then
+
+    EXPECT_THROW(reducer.reduce(otherLattice), std::invalid_argument);
+    EXPECT_THROW(reducer.reduce(this->lattice, otherScheduler), std::invalid_argument);
+}
@@ -0,0 +1,83 @@
+#include "../../src/diagnostics/VelocityResidual.hpp"
+#include "../../src/densityDistribution/d2q9.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class VelocityResidualTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(VelocityResidualTest, FloatingPointTypes);
+
+TYPED_TEST(VelocityResidualTest, NodeMomentsSumPopulationsAndMomentum)
+{
+    // Given
+
+    const auto velocities{latticeVelocities(D2Q9<TypeParam>{})};
+    std::array<TypeParam, D2Q9_SIZE> values{};
+    values.fill(TypeParam{0.1});
+    values[1] = TypeParam{0.3};
+
+    // When
+
+    const NodeMoments<2, TypeParam> moments{computeNodeMoments<D2Q9_DESCRIPTOR>(values)};
+
+    // Then
+
+    EXPECT_FLOAT_EQ(moments.density, TypeParam{1.1});
+    EXPECT_FLOAT_EQ(
+        moments.momentum[0], static_cast<TypeParam>(velocities[1][0]) * TypeParam{0.2}
+    );
+    EXPECT_FLOAT_EQ(
+        moments.momentum[1], static_cast<TypeParam>(velocities[1][1]) * TypeParam{0.2}
+    );
+}
+
+TYPED_TEST(VelocityResidualTest, ResidualIsRelativeChangeSincePreviousEvaluation)
+{
+    // Given
+
+    VelocityResidual<2, TypeParam> residual{2};
+
+    // When
+
+    const TypeParam initialChange{
+        residual.track(0, {TypeParam{3.0}, TypeParam{0.0}}) +
+        residual.track(1, {TypeParam{0.0}, TypeParam{4.0}})
+    };
+    const TypeParam initial{residual.finish(TypeParam{25.0}, initialChange)};
+    const TypeParam change{
+        residual.track(0, {TypeParam{3.0}, TypeParam{0.0}}) +
+        residual.track(1, {TypeParam{0.0}, TypeParam{5.0}})
+    };
+    const TypeParam relative{residual.finish(TypeParam{34.0}, change)};
+
+    // Then
+
+    EXPECT_EQ(initial, std::numeric_limits<TypeParam>::infinity());
+    EXPECT_TRUE(residual.hasPrevious());
+    EXPECT_FLOAT_EQ(change, TypeParam{1.0});
+    EXPECT_FLOAT_EQ(relative, TypeParam{1.0} / std::sqrt(TypeParam{34.0}));
+}
+
+TYPED_TEST(VelocityResidualTest, VanishingVelocityGivesAbsoluteChange)
+{
+    // Given
+
+    VelocityResidual<2, TypeParam> residual{1};
+    residual.finish(TypeParam{0.0}, residual.track(0, {TypeParam{0.5}, TypeParam{0.0}}));
+
+    // When
+
+    const TypeParam change{residual.track(0, {TypeParam{0.0}, TypeParam{0.0}})};
+    const TypeParam absolute{residual.finish(TypeParam{0.0}, change)};
+
+    // Then
+
+    EXPECT_FALSE(std::isinf(absolute));
+    EXPECT_FLOAT_EQ(absolute, TypeParam{0.5});
+}
@@ -0,0 +1,179 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/instrumentation/PhaseRecorder.hpp"
+#include "../../src/lattice/moments.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <latch>
+#include <thread>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class PhaseRecorderTest : public ::testing::Test
+{
+protected:
+    PhaseRecorderTest() { PhaseRecorder::clear(); }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    const std::array<std::size_t, 2> extents{12, 10};
+    const Scalar relaxationFrequency{1.2};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(PhaseRecorderTest, FloatingPointTypes);
+
+TYPED_TEST(PhaseRecorderTest, ScopeRecordsOneEvent)
+{
+    // Given
+
+    const std::size_t nodes{42};
+
+    // When
+
+    {
+        const ScopedPhase phase{Phase::Boundary, nodes};
+    }
+    const auto events{PhaseRecorder::events()};
+    const auto summary{PhaseRecorder::summary()};
+
+    // Then
+
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].phase, Phase::Boundary);
+    EXPECT_EQ(events[0].nodes, nodes);
+    EXPECT_EQ(summary[static_cast<std::size_t>(Phase::Boundary)].calls, 1);
+    EXPECT_EQ(summary[static_cast<std::size_t>(Phase::Boundary)].nodes, nodes);
+    EXPECT_EQ(summary[static_cast<std::size_t>(Phase::Collide)].calls, 0);
+}
+
+TYPED_TEST(PhaseRecorderTest, NestedScopeOfSamePhaseIsRecordedOnce)
+{
+    // Given
+
+    const std::size_t nodes{7};
+
+    // When
+
+    {
+        const ScopedPhase outer{Phase::Stream, nodes};
+        {
+            const ScopedPhase inner{Phase::Stream, nodes};
+            const ScopedPhase other{Phase::Moments, nodes};
+        }
+    }
+    const auto summary{PhaseRecorder::summary()};
+
+    // Then
+
+    EXPECT_EQ(PhaseRecorder::events().size(), 2);
+    EXPECT_EQ(summary[static_cast<std::size_t>(Phase::Stream)].calls, 1);
+    EXPECT_EQ(summary[static_cast<std::size_t>(Phase::Stream)].nodes, nodes);
+    EXPECT_EQ(summary[static_cast<std::size_t>(Phase::Moments)].calls, 1);
+}
+
+TYPED_TEST(PhaseRecorderTest, ThreadsRecordIntoSeparateBuffers)
+{
+    // Given
+
+    std::latch alive{2};
+    const auto record{[&] {
+        {
+            const ScopedPhase phase{Phase::Io, 1};
+        }
+        alive.arrive_and_wait();
+    }};
+
+    // When
+
+    std::thread first{record};
+    std::thread second{record};
+    first.join();
+    second.join();
+    const auto events{PhaseRecorder::events()};
+
+    // Then
+
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_NE(events[0].thread, events[1].thread);
+    EXPECT_LE(events[0].start, events[1].start);
+    EXPECT_EQ(PhaseRecorder::summary()[static_cast<std::size_t>(Phase::Io)].calls, 2);
+}
+
+TYPED_TEST(PhaseRecorderTest, ExitedThreadsHandTheirBuffersOn)
+{
+    // Given
+
+    const std::size_t threadCount{4};
+    const auto record{[] { const ScopedPhase phase{Phase::Io, 1}; }};
+
+    // When
+
+    for (std::size_t thread = 0; thread < threadCount; ++thread)
+    {
+        std::thread{record}.join();
+    }
+    const auto events{PhaseRecorder::events()};
+
+    // Then
+
+    ASSERT_EQ(events.size(), threadCount);
+    for (const PhaseEvent& event : events)
+    {
+        EXPECT_EQ(event.thread, events[0].thread);
+    }
+    EXPECT_EQ(PhaseRecorder::summary()[static_cast<std::size_t>(Phase::Io)].calls, threadCount);
+}
+
+TYPED_TEST(PhaseRecorderTest, FullBufferDropsEventsButKeepsCounting)
+{
+    // Given
+
+    const std::size_t extra{3};
+
+    // When
+
+    for (std::size_t call = 0; call < PHASE_BUFFER_CAPACITY + extra; ++call)
+    {
+        const ScopedPhase phase{Phase::Collide, 1};
+    }
+
+    // Then
+
+    EXPECT_EQ(PhaseRecorder::events().size(), PHASE_BUFFER_CAPACITY);
+    EXPECT_EQ(PhaseRecorder::dropped(), extra);
+    EXPECT_EQ(
+        PhaseRecorder::summary()[static_cast<std::size_t>(Phase::Collide)].calls,
+        PHASE_BUFFER_CAPACITY + extra
+    );
+}
+
+TYPED_TEST(PhaseRecorderTest, KernelsRecordTheirPhases)
+{
+    // Given
+
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> lattice{this->extents};
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        lattice.setNode(node, D2Q9<TypeParam>{});
+    }
+    std::vector<TypeParam> densities(lattice.nodeCount());
+    std::vector<TypeParam> momentumX(lattice.nodeCount());
+    std::vector<TypeParam> momentumY(lattice.nodeCount());
+    const std::array<std::span<TypeParam>, 2> momenta{momentumX, momentumY};
+
+    // When
+
+    collideBGK(lattice, this->relaxationFrequency);
+    streamAA(lattice, 0);
+    computeMoments(lattice, std::span<TypeParam>{densities}, momenta);
+    const auto summary{PhaseRecorder::summary()};
+
+    // Then
+
+    for (const Phase phase : {Phase::Collide, Phase::Stream, Phase::Moments})
+    {
+        EXPECT_EQ(summary[static_cast<std::size_t>(phase)].calls, 1);
+        EXPECT_EQ(summary[static_cast<std::size_t>(phase)].nodes, lattice.nodeCount());
+    }
+}
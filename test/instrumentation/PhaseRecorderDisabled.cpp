@@ -0,0 +1,79 @@
+#include "../../src/boundary/BoundaryEngine.hpp"
+#include "../../src/collision/bgk.hpp"
+#include "../../src/collision/cumulant.hpp"
+#include "../../src/collision/mrt.hpp"
+#include "../../src/instrumentation/PhaseRecorder.hpp"
+#include "../../src/io/AsyncFieldWriter.hpp"
+#include "../../src/io/Checkpoint.hpp"
+#include "../../src/lattice/equilibrium.hpp"
+#include "../../src/lattice/moments.hpp"
+#include "../../src/parallel/Subdomain.hpp"
+#include "../../src/refinement/RefinedGrid.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include "../../src/streaming/wavefront.hpp"
+#include <gtest/gtest.h>
+
+static_assert(!LATTICEFLOW_INSTRUMENTATION);
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class PhaseRecorderDisabledTest : public ::testing::Test
+{
+protected:
+    PhaseRecorderDisabledTest() { PhaseRecorder::clear(); }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    const std::array<std::size_t, 2> extents{12, 10};
+    const Scalar relaxationFrequency{1.2};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(PhaseRecorderDisabledTest, FloatingPointTypes);
+
+TYPED_TEST(PhaseRecorderDisabledTest, ScopeRecordsNothing)
+{
+    // When
+
+    {
+        const ScopedPhase phase{Phase::Boundary, 42};
+    }
+
+    // Then
+
+    EXPECT_TRUE(PhaseRecorder::events().empty());
+    EXPECT_EQ(PhaseRecorder::summary()[static_cast<std::size_t>(Phase::Boundary)].calls, 0);
+}
+
+TYPED_TEST(PhaseRecorderDisabledTest, KernelsRecordNothing)
+{
+    // Given
+
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> lattice{this->extents};
+    std::vector<TypeParam> densities(lattice.nodeCount(), TypeParam{1.0});
+    const std::vector<TypeParam> velocity(lattice.nodeCount(), TypeParam{0.0});
+    initializeEquilibrium(
+        lattice,
+        std::span<const TypeParam>{densities},
+        {std::span<const TypeParam>{velocity}, std::span<const TypeParam>{velocity}}
+    );
+    std::vector<TypeParam> momentumX(lattice.nodeCount());
+    std::vector<TypeParam> momentumY(lattice.nodeCount());
+    const std::array<std::span<TypeParam>, 2> momenta{momentumX, momentumY};
+
+    // When
+
+    collideBGK(lattice, this->relaxationFrequency);
+    streamAA(lattice, 0);
+    computeMoments(lattice, std::span<TypeParam>{densities}, momenta);
+    const auto summary{PhaseRecorder::summary()};
+
+    // Then
+
+    EXPECT_TRUE(PhaseRecorder::events().empty());
+    for (const Phase phase : {Phase::Collide, Phase::Stream, Phase::Moments})
+    {
+        EXPECT_EQ(summary[static_cast<std::size_t>(phase)].calls, 0);
+    }
+    EXPECT_NEAR(densities[0], TypeParam{1.0}, TypeParam{1e-5});
+}
@@ -0,0 +1,119 @@
+#include "../../src/instrumentation/PhaseReport.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class PhaseReportTest : public ::testing::Test
+{
+protected:
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    const std::array<PhaseEvent, 2> events{
+        PhaseEvent{1500, 2000, 64, 0, Phase::Collide},
+        PhaseEvent{4000, 500, 32, 1, Phase::Stream}
+    };
+    std::ostringstream stream;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(PhaseReportTest, FloatingPointTypes);
+
+TYPED_TEST(PhaseReportTest, ChromeTraceHoldsOneCompleteEventPerPhaseEvent)
+{
+    // When
+
+    writeChromeTrace(this->stream, this->events);
+    const std::string trace{this->stream.str()};
+
+    // Then
+
+    EXPECT_NE(trace.find("\"traceEvents\":["), std::string::npos);
+    EXPECT_NE(
+        trace.find("{\"name\":\"collide\",\"cat\":\"latticeflow\",\"ph\":\"X\",\"pid\":0,\"tid\":0,"
+                   "\"ts\":1.500,\"dur\":2.000,\"args\":{\"nodes\":64}}"),
+        std::string::npos
+    );
+    EXPECT_NE(
+        trace.find("{\"name\":\"stream\",\"cat\":\"latticeflow\",\"ph\":\"X\",\"pid\":0,\"tid\":1,"
+                   "\"ts\":4.000,\"dur\":0.500,\"args\":{\"nodes\":32}}"),
+        std::string::npos
+    );
+    EXPECT_EQ(trace.substr(trace.size() - 4), "\n]}\n");
+}
+
+TYPED_TEST(PhaseReportTest, ChromeTraceOfNoEventsIsEmptyArray)
+{
+    // When
+
+    writeChromeTrace(this->stream, {});
+
+    // Then
+
+    EXPECT_EQ(this->stream.str(), "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n]}\n");
+}
+
+TYPED_TEST(PhaseReportTest, SummaryListsPhasesWithCallsAndTheirThroughput)
+{
+    // Given
+
+    std::array<PhaseSummary, PHASE_COUNT> summaries{};
+    summaries[static_cast<std::size_t>(Phase::Collide)] = {1, 3'000'000, 6'000'000};
+    summaries[static_cast<std::size_t>(Phase::Io)] = {1, 1'000'000, 1'000};
+    const std::array<PhaseEvent, 2> events{
+        PhaseEvent{0, 3'000'000, 6'000'000, 0, Phase::Collide},
+        PhaseEvent{3'000'000, 1'000'000, 1'000, 1, Phase::Io}
+    };
+
+    // When
+
+    writePhaseSummary(this->stream, summaries, events);
+    const std::string table{this->stream.str()};
+
+    // Then
+
+    EXPECT_NE(table.find("MLUPS"), std::string::npos);
+    EXPECT_NE(table.find("collide"), std::string::npos);
+    EXPECT_NE(table.find("2000.000"), std::string::npos);
+    EXPECT_NE(table.find("75.000"), std::string::npos);
+    EXPECT_NE(table.find("io"), std::string::npos);
+    EXPECT_EQ(table.find("stream"), std::string::npos);
+    EXPECT_EQ(std::count(table.begin(), table.end(), '\n'), 3);
+}
+
+TYPED_TEST(PhaseReportTest, SummaryCountsConcurrentEventsOfAPhaseOnceInWallTime)
+{
+    // Given
+
+    std::array<PhaseSummary, PHASE_COUNT> summaries{};
+    summaries[static_cast<std::size_t>(Phase::Stream)] = {2, 4'000'000, 8'000'000};
+    const std::array<PhaseEvent, 2> events{
+        PhaseEvent{0, 2'000'000, 4'000'000, 0, Phase::Stream},
+        PhaseEvent{0, 2'000'000, 4'000'000, 1, Phase::Stream}
+    };
+
+    // When
+
+    writePhaseSummary(this->stream, summaries, events);
+    std::istringstream table{this->stream.str()};
+    std::string header;
+    std::getline(table, header);
+    std::string name;
+    std::uint64_t calls{0};
+    double cpu{0.0};
+    double wall{0.0};
+    double share{0.0};
+    std::uint64_t nodes{0};
+    double mlups{0.0};
+    table >> name >> calls >> cpu >> wall >> share >> nodes >> mlups;
+
+    // Then
+
+    EXPECT_EQ(name, "stream");
+    EXPECT_EQ(calls, 2);
+    EXPECT_DOUBLE_EQ(cpu, 4.0);
+    EXPECT_DOUBLE_EQ(wall, 2.0);
+    EXPECT_DOUBLE_EQ(share, 100.0);
+    EXPECT_EQ(nodes, 8'000'000);
+    EXPECT_DOUBLE_EQ(mlups, 4000.0);
+}
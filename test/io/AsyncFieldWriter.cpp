@@ -0,0 +1,262 @@
+#include "../../src/io/AsyncFieldWriter.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+
+namespace
+{
+
+/**
+ * The contents of a VTK image data file written by AsyncFieldWriter.
+ */
+template <std::floating_point Scalar>
+struct FieldFile
+{
+    std::string header;
+    std::vector<Scalar> densities;
+    std::vector<Scalar> velocities;
+};
+
+/**
+ * Reads one block of raw appended VTK data with a 64-bit byte count.
+ */
+template <std::floating_point Scalar>
+auto readBlock(const std::string& contents, std::size_t& offset) -> std::vector<Scalar>
+{
+    std::uint64_t byteCount{};
+    std::memcpy(&byteCount, &contents[offset], sizeof(byteCount));
+    offset += sizeof(byteCount);
+
+    std::vector<Scalar> values(byteCount / sizeof(Scalar));
+    std::memcpy(values.data(), &contents[offset], byteCount);
+    offset += byteCount;
+
+    return values;
+}
+
+/**
+ * Reads the XML header and both data arrays of a file written by AsyncFieldWriter.
+ */
+template <std::floating_point Scalar>
+auto readFieldFile(const std::filesystem::path& path) -> FieldFile<Scalar>
+{
+    std::ifstream file{path, std::ios::binary};
+    const std::string contents{std::istreambuf_iterator<char>{file}, {}};
+    const std::string marker{"<AppendedData encoding=\"raw\">\n_"};
+    std::size_t offset{contents.find(marker) + marker.size()};
+
+    FieldFile<Scalar> result;
+    result.header = contents.substr(0, offset);
+    result.densities = readBlock<Scalar>(contents, offset);
+    result.velocities = readBlock<Scalar>(contents, offset);
+
+    return result;
+}
+
+/**
+ * Returns an empty directory in the temporary directory that is unique to the running test.
+ */
+auto temporaryOutputDirectory() -> std::filesystem::path
+{
+    const auto* info{::testing::UnitTest::GetInstance()->current_test_info()};
+    std::string name{std::string{info->test_suite_name()} + "." + info->name()};
+    std::ranges::replace(name, '/', '_');
+    const auto directory{std::filesystem::temp_directory_path() / name};
+
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directory(directory);
+
+    return directory;
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class AsyncFieldWriterTest : public ::testing::Test
+{
+private:
+    static constexpr std::array<std::size_t, 2> extents_{4, 3};
+
+protected:
+    AsyncFieldWriterTest()
+        : lattice{extents_},
+          directory{temporaryOutputDirectory()},
+          writer{extents_, latticeVelocities(D2Q9<Scalar>{}), directory}
+    {
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            lattice.setNode(node, equilibrium(node));
+        }
+    }
+
+    ~AsyncFieldWriterTest() override
+    {
+        std::filesystem::remove_all(directory);
+    }
+
+    AsyncFieldWriterTest(const AsyncFieldWriterTest&) = delete;
+    AsyncFieldWriterTest(AsyncFieldWriterTest&&) = delete;
+    auto operator=(const AsyncFieldWriterTest&) -> AsyncFieldWriterTest& = delete;
+    auto operator=(AsyncFieldWriterTest&&) -> AsyncFieldWriterTest& = delete;
+
+    static auto density(std::size_t node) -> Scalar
+    {
+        return Scalar{1.0} + static_cast<Scalar>(node) / Scalar{64.0};
+    }
+
+    static auto velocity(std::size_t node) -> std::array<Scalar, 2>
+    {
+        return {static_cast<Scalar>(node) / Scalar{128.0}, Scalar{-0.03125}};
+    }
+
+    static auto equilibrium(std::size_t node) -> D2Q9<Scalar>
+    {
+        return computeEquilibrium<D2Q9_DESCRIPTOR>(density(node), velocity(node));
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    Lattice<2, 9, Scalar> lattice;
+    std::filesystem::path directory;
+    AsyncFieldWriter<2, 9, Scalar> writer;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(AsyncFieldWriterTest, FloatingPointTypes);
+
+TYPED_TEST(AsyncFieldWriterTest, WrittenFileHoldsDensityAndVelocity)
+{
+    // Given
+
+    const TypeParam tolerance{32 * std::numeric_limits<TypeParam>::epsilon()};
+
+    // When
+
+    this->writer.snapshot(this->lattice, 0);
+    this->writer.flush();
+    const auto file{readFieldFile<TypeParam>(this->writer.framePath(0))};
+
+    // Then
+
+    EXPECT_NE(file.header.find("WholeExtent=\"0 3 0 2 0 0\""), std::string::npos);
+    EXPECT_NE(
+        file.header.find(sizeof(TypeParam) == 4 ? "\"Float32\"" : "\"Float64\""), std::string::npos
+    );
+    ASSERT_EQ(file.densities.size(), this->lattice.nodeCount());
+    ASSERT_EQ(file.velocities.size(), 3 * this->lattice.nodeCount());
+    for (std::size_t node = 0; node < this->lattice.nodeCount(); ++node)
+    {
+        const auto expectedVelocity{TestFixture::velocity(node)};
+        EXPECT_NEAR(file.densities[node], TestFixture::density(node), tolerance);
+        EXPECT_NEAR(file.velocities[3 * node], expectedVelocity[0], tolerance);
+        EXPECT_NEAR(file.velocities[3 * node + 1], expectedVelocity[1], tolerance);
+        EXPECT_EQ(file.velocities[3 * node + 2], TypeParam{0.0});
+    }
+}
+
+TYPED_TEST(AsyncFieldWriterTest, LatticeMayChangeRightAfterSnapshot)
+{
+    // Given
+
+    const TypeParam tolerance{32 * std::numeric_limits<TypeParam>::epsilon()};
+
+    // When
+
+    this->writer.snapshot(this->lattice, 0);
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        std::ranges::fill(this->lattice.population(i), TypeParam{0.0});
+    }
+    this->writer.snapshot(this->lattice, 2);
+    this->writer.flush();
+    const auto first{readFieldFile<TypeParam>(this->writer.framePath(0))};
+
+    // Then
+
+    for (std::size_t node = 0; node < this->lattice.nodeCount(); ++node)
+    {
+        EXPECT_NEAR(first.densities[node], TestFixture::density(node), tolerance);
+    }
+}
+
+TYPED_TEST(AsyncFieldWriterTest, EverySnapshotIsWrittenAndTimed)
+{
+    // Given
+
+    const std::size_t frameCount{5};
+    const std::size_t outputInterval{100};
+
+    // When
+
+    for (std::size_t frame = 0; frame < frameCount; ++frame)
+    {
+        this->writer.snapshot(this->lattice, frame * outputInterval);
+    }
+    this->writer.flush();
+
+    // Then
+
+    EXPECT_EQ(this->writer.stalls().size(), frameCount);
+    for (std::size_t frame = 0; frame < frameCount; ++frame)
+    {
+        EXPECT_TRUE(std::filesystem::exists(this->writer.framePath(frame * outputInterval)));
+    }
+    EXPECT_EQ(this->writer.framePath(300).filename(), "fields_00000300.vti");
+}
+
+TYPED_TEST(AsyncFieldWriterTest, WriteErrorIsRethrownToSolver)
+{
+    // Given
+
+    AsyncFieldWriter<2, 9, TypeParam> writer{
+        this->lattice.extents(), latticeVelocities(D2Q9<TypeParam>{}), this->directory / "missing"
+    };
+
+    // When
+
+    writer.snapshot(this->lattice, 0);
+
+    // Then
+
+    EXPECT_THROW(writer.flush(), std::runtime_error);
+    EXPECT_NO_THROW(writer.flush());
+}
+
+TYPED_TEST(AsyncFieldWriterTest, SnapshotOfMomentCacheEqualsSnapshotOfLattice)
+{
+    // Given
+
+    MomentCache<2, 9, TypeParam> moments{this->lattice, latticeVelocities(D2Q9<TypeParam>{})};
+    static_cast<void>(moments.densities());
+
+    // When
+
+    this->writer.snapshot(this->lattice, 0);
+    this->writer.snapshot(moments, 2);
+    this->writer.flush();
+    const auto expected{readFieldFile<TypeParam>(this->writer.framePath(0))};
+    const auto actual{readFieldFile<TypeParam>(this->writer.framePath(2))};
+
+    // Then
+
+    EXPECT_EQ(moments.sweeps(), 1);
+    EXPECT_EQ(actual.densities, expected.densities);
+    EXPECT_EQ(actual.velocities, expected.velocities);
+}
+
+TYPED_TEST(AsyncFieldWriterTest, SnapshotThrowsIfExtentsDiffer)
+{
+    // Given
+
+    Lattice<2, 9, TypeParam> otherLattice{{8, 4}};
+    MomentCache<2, 9, TypeParam> moments{otherLattice, latticeVelocities(D2Q9<TypeParam>{})};
+
+    // When / Then
+
+    EXPECT_THROW(this->writer.snapshot(otherLattice, 0), std::invalid_argument);
+    EXPECT_THROW(this->writer.snapshot(moments, 0), std::invalid_argument);
+    EXPECT_TRUE(this->writer.stalls().empty());
+}
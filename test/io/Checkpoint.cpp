@@ -0,0 +1,290 @@
+#include "../../src/densityDistribution/d2q9.hpp"
+#include "../../src/densityDistribution/d3q19.hpp"
+#include "../../src/io/Checkpoint.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include "../LatticeFill.hpp"
+#include <cstdint>
+#include <fstream>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ * Returns a distinct value for every population of a lattice.
+ */
+template <std::floating_point Scalar>
+auto population(std::size_t i, std::size_t node) -> Scalar
+{
+    return static_cast<Scalar>(i) + Scalar{1.0} / static_cast<Scalar>(node + 3);
+}
+
+/**
+ * Returns a path in the temporary directory that is unique to the running test.
+ */
+auto temporaryCheckpointPath() -> std::filesystem::path
+{
+    const auto* info{::testing::UnitTest::GetInstance()->current_test_info()};
+    std::string name{std::string{info->test_suite_name()} + "." + info->name() + ".checkpoint"};
+    std::ranges::replace(name, '/', '_');
+
+    return std::filesystem::temp_directory_path() / name;
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class CheckpointTest : public ::testing::Test
+{
+private:
+    static constexpr std::array<std::size_t, 2> extents_{7, 5};
+
+protected:
+    CheckpointTest() : lattice{extents_}, path{temporaryCheckpointPath()}
+    {
+        fillLattice(lattice, population<Scalar>);
+    }
+
+    ~CheckpointTest() override
+    {
+        std::filesystem::remove(path);
+    }
+
+    CheckpointTest(const CheckpointTest&) = delete;
+    CheckpointTest(CheckpointTest&&) = delete;
+    auto operator=(const CheckpointTest&) -> CheckpointTest& = delete;
+    auto operator=(CheckpointTest&&) -> CheckpointTest& = delete;
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    Lattice<2, 9, Scalar> lattice;
+    std::filesystem::path path;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(CheckpointTest, FloatingPointTypes);
+
+TYPED_TEST(CheckpointTest, RestoreReproducesEveryPopulation)
+{
+    // Given
+
+    writeCheckpoint(this->lattice, this->path, 0);
+
+    // When
+
+    std::size_t completedSteps{1};
+    const auto restored{readCheckpoint<2, 9, TypeParam>(this->path, completedSteps)};
+
+    // Then
+
+    EXPECT_EQ(completedSteps, 0);
+    EXPECT_EQ(restored.extents(), this->lattice.extents());
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        EXPECT_TRUE(std::ranges::equal(restored.population(i), this->lattice.population(i)));
+    }
+}
+
+TYPED_TEST(CheckpointTest, HeaderDescribesLattice)
+{
+    // Given
+
+    writeCheckpoint(this->lattice, this->path, 0);
+
+    // When
+
+    const CheckpointHeader header{readCheckpointHeader(this->path)};
+
+    // Then
+
+    EXPECT_EQ(header.magic, CHECKPOINT_MAGIC);
+    EXPECT_EQ(header.version, CHECKPOINT_VERSION);
+    EXPECT_EQ(header.byteOrder, CHECKPOINT_BYTE_ORDER);
+    EXPECT_EQ(header.dimension, this->lattice.dimension());
+    EXPECT_EQ(header.size, this->lattice.size());
+    EXPECT_EQ(header.scalarSize, sizeof(TypeParam));
+    EXPECT_EQ(header.extents, (std::array<std::uint64_t, CHECKPOINT_MAX_DIMENSION>{7, 5, 1, 1}));
+    EXPECT_EQ(header.nodeCount, this->lattice.nodeCount());
+    EXPECT_EQ(header.dataOffset, CHECKPOINT_DATA_ALIGNMENT);
+    EXPECT_EQ(header.completedSteps, 0);
+}
+
+TYPED_TEST(CheckpointTest, MappedPopulationsAreAlignedViewsOfSavedValues)
+{
+    // Given
+
+    writeCheckpoint(this->lattice, this->path, 0);
+
+    // When
+
+    const MappedCheckpoint<2, 9, TypeParam> checkpoint{this->path};
+
+    // Then
+
+    EXPECT_EQ(checkpoint.extents(), this->lattice.extents());
+    EXPECT_EQ(checkpoint.nodeCount(), this->lattice.nodeCount());
+    EXPECT_TRUE(checkpoint.verify());
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        EXPECT_EQ(
+            reinterpret_cast<std::uintptr_t>(checkpoint.population(i).data()) % CACHE_LINE_SIZE, 0
+        );
+        EXPECT_TRUE(std::ranges::equal(checkpoint.population(i), this->lattice.population(i)));
+    }
+}
+
+TYPED_TEST(CheckpointTest, CorruptedPopulationFailsChecksum)
+{
+    // Given
+
+    writeCheckpoint(this->lattice, this->path, 0);
+    {
+        std::fstream file{this->path, std::ios::binary | std::ios::in | std::ios::out};
+        file.seekp(static_cast<std::streamoff>(CHECKPOINT_DATA_ALIGNMENT + 3 * sizeof(TypeParam)));
+        file.put('\x7F');
+    }
+
+    // When
+
+    const MappedCheckpoint<2, 9, TypeParam> checkpoint{this->path};
+
+    // Then
+
+    EXPECT_FALSE(checkpoint.verify());
+    EXPECT_THROW(checkpoint.restore(this->lattice), std::runtime_error);
+}
+
+TYPED_TEST(CheckpointTest, MismatchedModelOrScalarTypeIsRejected)
+{
+    // Given
+
+    using OtherScalar = std::conditional_t<std::is_same_v<TypeParam, float>, double, float>;
+    writeCheckpoint(this->lattice, this->path, 0);
+
+    // When
+
+    // Then
+
+    EXPECT_THROW((MappedCheckpoint<2, 5, TypeParam>{this->path}), std::runtime_error);
+    EXPECT_THROW((MappedCheckpoint<2, 9, OtherScalar>{this->path}), std::runtime_error);
+    EXPECT_THROW((MappedCheckpoint<3, 9, TypeParam>{this->path}), std::runtime_error);
+}
+
+TYPED_TEST(CheckpointTest, RestoreIntoLatticeOfOtherExtentsIsRejected)
+{
+    // Given
+
+    writeCheckpoint(this->lattice, this->path, 0);
+    const MappedCheckpoint<2, 9, TypeParam> checkpoint{this->path};
+    Lattice<2, 9, TypeParam> other{{5, 7}};
+
+    // When
+
+    // Then
+
+    EXPECT_THROW(checkpoint.restore(other), std::invalid_argument);
+}
+
+TYPED_TEST(CheckpointTest, TruncatedFileIsRejected)
+{
+    // Given
+
+    writeCheckpoint(this->lattice, this->path, 0);
+    std::filesystem::resize_file(
+        this->path, std::filesystem::file_size(this->path) - sizeof(TypeParam)
+    );
+
+    // When
+
+    // Then
+
+    EXPECT_THROW((MappedCheckpoint<2, 9, TypeParam>{this->path}), std::runtime_error);
+}
+
+TYPED_TEST(CheckpointTest, OtherFilesAreRejected)
+{
+    // Given
+
+    {
+        std::ofstream file{this->path, std::ios::binary};
+        file << std::string(CHECKPOINT_DATA_ALIGNMENT, 'x');
+    }
+
+    // When
+
+    // Then
+
+    EXPECT_THROW(readCheckpointHeader(this->path), std::runtime_error);
+    EXPECT_THROW(readCheckpointHeader(this->path.string() + ".missing"), std::runtime_error);
+}
+
+TYPED_TEST(CheckpointTest, WritingReplacesExistingCheckpoint)
+{
+    // Given
+
+    writeCheckpoint(this->lattice, this->path, 0);
+    this->lattice.population(4)[2] = TypeParam{42.0};
+
+    // When
+
+    writeCheckpoint(this->lattice, this->path, 0);
+    std::size_t completedSteps{0};
+    const auto restored{readCheckpoint<2, 9, TypeParam>(this->path, completedSteps)};
+
+    // Then
+
+    EXPECT_EQ(restored.population(4)[2], TypeParam{42.0});
+    EXPECT_FALSE(std::filesystem::exists(this->path.string() + ".tmp"));
+}
+
+TYPED_TEST(CheckpointTest, RestartAfterOddStepCountContinuesAAStreaming)
+{
+    // Given
+
+    constexpr std::size_t completedSteps{3};
+    for (std::size_t timeStep = 0; timeStep < completedSteps; ++timeStep)
+    {
+        streamAA(this->lattice, timeStep);
+    }
+    writeCheckpoint(this->lattice, this->path, completedSteps);
+
+    // When
+
+    std::size_t restoredSteps{0};
+    auto restored{readCheckpoint<2, 9, TypeParam>(this->path, restoredSteps)};
+    streamAA(restored, restoredSteps);
+    streamAA(this->lattice, completedSteps);
+
+    // Then
+
+    EXPECT_EQ(restoredSteps, completedSteps);
+    EXPECT_EQ((MappedCheckpoint<2, 9, TypeParam>{this->path}.completedSteps()), completedSteps);
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        EXPECT_TRUE(std::ranges::equal(restored.population(i), this->lattice.population(i)));
+    }
+}
+
+TEST(CheckpointD3Q19Test, RestoreReproducesEveryPopulation)
+{
+    // Given
+
+    const auto path{temporaryCheckpointPath()};
+    Lattice<D3Q19_DIMENSION, D3Q19_SIZE, double> lattice{{6, 5, 4}};
+    fillLattice(lattice, population<double>);
+
+    // When
+
+    writeCheckpoint(lattice, path, 0);
+    std::size_t completedSteps{0};
+    const auto restored{readCheckpoint<D3Q19_DIMENSION, D3Q19_SIZE, double>(path, completedSteps)};
+    std::filesystem::remove(path);
+
+    // Then
+
+    for (std::size_t i = 0; i < D3Q19_SIZE; ++i)
+    {
+        EXPECT_TRUE(std::ranges::equal(restored.population(i), lattice.population(i)));
+    }
+}
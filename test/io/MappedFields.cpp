@@ -0,0 +1,132 @@
+#include "../../src/io/MappedFields.hpp"
+#include "../../src/lattice/equilibrium.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+/**
+ * Returns a path in the temporary directory that is unique to the running test.
+ */
+auto temporaryFieldPath() -> std::filesystem::path
+{
+    const auto* info{::testing::UnitTest::GetInstance()->current_test_info()};
+    std::string name{std::string{info->test_suite_name()} + "." + info->name() + ".fields"};
+    std::ranges::replace(name, '/', '_');
+
+    return std::filesystem::temp_directory_path() / name;
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class MappedFieldsTest : public ::testing::Test
+{
+private:
+    static constexpr std::array<std::size_t, 2> extents_{7, 5};
+
+protected:
+    MappedFieldsTest()
+        : extents{extents_}, densities(extents_[0] * extents_[1]), velocityX(densities.size()),
+          velocityY(densities.size()), path{temporaryFieldPath()}
+    {
+        for (std::size_t node = 0; node < densities.size(); ++node)
+        {
+            densities[node] = Scalar{1.0} + static_cast<Scalar>(node) / 64;
+            velocityX[node] = static_cast<Scalar>(node % 5) / 50;
+            velocityY[node] = -static_cast<Scalar>(node % 3) / 50;
+        }
+    }
+
+    ~MappedFieldsTest() override
+    {
+        std::filesystem::remove(path);
+    }
+
+    MappedFieldsTest(const MappedFieldsTest&) = delete;
+    MappedFieldsTest(MappedFieldsTest&&) = delete;
+    auto operator=(const MappedFieldsTest&) -> MappedFieldsTest& = delete;
+    auto operator=(MappedFieldsTest&&) -> MappedFieldsTest& = delete;
+
+    auto flowVelocities() const -> std::array<std::span<const Scalar>, 2>
+    {
+        return {std::span<const Scalar>{velocityX}, std::span<const Scalar>{velocityY}};
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::array<std::size_t, 2> extents;
+    std::vector<Scalar> densities;
+    std::vector<Scalar> velocityX;
+    std::vector<Scalar> velocityY;
+    std::filesystem::path path;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(MappedFieldsTest, FloatingPointTypes);
+
+TYPED_TEST(MappedFieldsTest, MappedFieldsReproduceWrittenFields)
+{
+    // Given
+
+    writeFields<2>(this->path, std::span<const TypeParam>{this->densities}, this->flowVelocities());
+
+    // When
+
+    const MappedFields<2, TypeParam> fields{this->path, this->extents};
+
+    // Then
+
+    EXPECT_EQ(fields.nodeCount(), this->densities.size());
+    EXPECT_EQ(fields.extents(), this->extents);
+    EXPECT_TRUE(std::ranges::equal(fields.densities(), this->densities));
+    EXPECT_TRUE(std::ranges::equal(fields.velocities()[0], this->velocityX));
+    EXPECT_TRUE(std::ranges::equal(fields.velocities()[1], this->velocityY));
+}
+
+TYPED_TEST(MappedFieldsTest, InitializationFromMappedFieldsEqualsInitializationFromMemory)
+{
+    // Given
+
+    writeFields<2>(this->path, std::span<const TypeParam>{this->densities}, this->flowVelocities());
+    Lattice<2, 9, TypeParam> expected{this->extents};
+    initializeEquilibrium(
+        expected, std::span<const TypeParam>{this->densities}, this->flowVelocities()
+    );
+
+    // When
+
+    MappedFields<2, TypeParam> fields{this->path, this->extents};
+    const MappedFields<2, TypeParam> moved{std::move(fields)};
+    Lattice<2, 9, TypeParam> lattice{this->extents};
+    initializeEquilibrium(lattice, moved.densities(), moved.velocities());
+
+    // Then
+
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        EXPECT_TRUE(std::ranges::equal(lattice.population(i), expected.population(i)));
+    }
+}
+
+TYPED_TEST(MappedFieldsTest, ThrowsIfFileSizeDoesNotMatchExtents)
+{
+    // Given
+
+    writeFields<2>(this->path, std::span<const TypeParam>{this->densities}, this->flowVelocities());
+    using OtherScalar = std::conditional_t<std::is_same_v<TypeParam, float>, double, float>;
+
+    // When / Then
+
+    EXPECT_THROW(
+        (MappedFields<2, TypeParam>{this->path, {this->extents[0], this->extents[1] + 1}}),
+        std::runtime_error
+    );
+    EXPECT_THROW((MappedFields<2, OtherScalar>{this->path, this->extents}), std::runtime_error);
+    EXPECT_THROW(
+        (MappedFields<2, TypeParam>{this->path.string() + ".missing", this->extents}),
+        std::system_error
+    );
+}
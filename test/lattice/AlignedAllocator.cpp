@@ -0,0 +1,140 @@
+#include "../../src/lattice/AlignedAllocator.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class AlignedAllocatorTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(AlignedAllocatorTest, FloatingPointTypes);
+
+TYPED_TEST(AlignedAllocatorTest, AllocationStartsOnCacheLineBoundary)
+{
+    // Given
+
+    const std::size_t count{37};
+    AlignedAllocator<TypeParam> allocator;
+
+    // When
+
+    TypeParam* pointer{allocator.allocate(count)};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto address{reinterpret_cast<std::uintptr_t>(pointer)};
+    allocator.deallocate(pointer, count);
+
+    // Then
+
+    EXPECT_EQ(address % CACHE_LINE_SIZE, 0);
+}
+
+TYPED_TEST(AlignedAllocatorTest, AllocationHonoursCustomAlignment)
+{
+    // Given
+
+    const std::size_t count{3};
+    const std::size_t alignment{4096};
+    AlignedAllocator<TypeParam, alignment> allocator;
+
+    // When
+
+    TypeParam* pointer{allocator.allocate(count)};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto address{reinterpret_cast<std::uintptr_t>(pointer)};
+    allocator.deallocate(pointer, count);
+
+    // Then
+
+    EXPECT_EQ(address % alignment, 0);
+}
+
+TYPED_TEST(AlignedAllocatorTest, VectorDataStartsOnCacheLineBoundary)
+{
+    // Given
+
+    const std::size_t count{101};
+
+    // When
+
+    const std::vector<TypeParam, AlignedAllocator<TypeParam>> values(count);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto address{reinterpret_cast<std::uintptr_t>(values.data())};
+
+    // Then
+
+    EXPECT_EQ(address % CACHE_LINE_SIZE, 0);
+}
+
+TYPED_TEST(AlignedAllocatorTest, AllocatorsCompareEqual)
+{
+    // Given
+
+    const AlignedAllocator<TypeParam> allocator1;
+    const AlignedAllocator<int> allocator2;
+
+    // When / Then
+
+    EXPECT_TRUE(allocator1 == allocator2);
+}
+
+TYPED_TEST(AlignedAllocatorTest, ConstructWithValueCopiesValue)
+{
+    // Given
+
+    std::vector<TypeParam, AlignedAllocator<TypeParam>> values;
+
+    // When
+
+    values.assign(5, TypeParam{1.5});
+    values.resize(7);
+    values[5] = TypeParam{2.5};
+
+    // Then
+
+    EXPECT_EQ(values.size(), 7);
+    EXPECT_EQ(values[0], TypeParam{1.5});
+    EXPECT_EQ(values[4], TypeParam{1.5});
+    EXPECT_EQ(values[5], TypeParam{2.5});
+}
+
+TYPED_TEST(AlignedAllocatorTest, AllocatorsWithMemoryResourceShareItOnConversion)
+{
+    // Given
+
+    std::pmr::monotonic_buffer_resource resource;
+    const AlignedAllocator<TypeParam> allocator1{&resource};
+
+    // When
+
+    const AlignedAllocator<int> allocator2{allocator1};
+
+    // Then
+
+    EXPECT_EQ(allocator2.resource(), &resource);
+    EXPECT_TRUE(allocator1 == allocator2);
+    EXPECT_FALSE(allocator1 == AlignedAllocator<TypeParam>{});
+}
+
+TYPED_TEST(AlignedAllocatorTest, AllocationFromMemoryResourceStartsOnCacheLineBoundary)
+{
+    // Given
+
+    const std::size_t count{37};
+    std::pmr::monotonic_buffer_resource resource;
+    AlignedAllocator<TypeParam> allocator{&resource};
+
+    // When
+
+    static_cast<void>(resource.allocate(1, 1));
+    TypeParam* pointer{allocator.allocate(count)};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto address{reinterpret_cast<std::uintptr_t>(pointer)};
+    allocator.deallocate(pointer, count);
+
+    // Then
+
+    EXPECT_EQ(address % CACHE_LINE_SIZE, 0);
+}
@@ -0,0 +1,182 @@
+#include "../../src/densityDistribution/d2q9.hpp"
+#include "../../src/lattice/Arena.hpp"
+#include "../../src/lattice/Lattice.hpp"
+#include "../../src/lattice/MixedPrecisionLattice.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+constexpr std::size_t testChunkSize{HUGE_PAGE_SIZE};
+
+/**
+ * Returns whether a pointer lies in [first, first + size).
+ */
+auto contains(const void* first, std::size_t size, const void* pointer) -> bool
+{
+    const auto begin{reinterpret_cast<std::uintptr_t>(first)};
+    const auto address{reinterpret_cast<std::uintptr_t>(pointer)};
+
+    return address >= begin && address < begin + size;
+}
+
+} // namespace
+
+TEST(ArenaTest, AllocationsAreAlignedAndDisjoint)
+{
+    // Given
+
+    Arena arena{testChunkSize};
+
+    // When
+
+    void* first{arena.allocate(3, 1)};
+    void* second{arena.allocate(100, CACHE_LINE_SIZE)};
+    void* third{arena.allocate(8, 4096)};
+
+    // Then
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % CACHE_LINE_SIZE, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(third) % 4096, 0);
+    EXPECT_FALSE(contains(first, 3, second));
+    EXPECT_FALSE(contains(second, 100, third));
+    EXPECT_EQ(arena.bytesAllocated(), 111);
+    EXPECT_EQ(arena.chunkCount(), 1);
+    EXPECT_EQ(arena.bytesReserved(), testChunkSize);
+}
+
+TEST(ArenaTest, ResetReusesChunksWithoutReservingMore)
+{
+    // Given
+
+    Arena arena{testChunkSize};
+    void* first{arena.allocate(testChunkSize / 2, CACHE_LINE_SIZE)};
+    static_cast<void>(arena.allocate(testChunkSize / 2, CACHE_LINE_SIZE));
+    const std::size_t chunkCount{arena.chunkCount()};
+
+    // When
+
+    arena.reset();
+    void* reused{arena.allocate(testChunkSize / 2, CACHE_LINE_SIZE)};
+
+    // Then
+
+    EXPECT_EQ(reused, first);
+    EXPECT_EQ(arena.chunkCount(), chunkCount);
+    EXPECT_EQ(arena.bytesAllocated(), testChunkSize / 2);
+}
+
+TEST(ArenaTest, LargeAllocationGetsChunkOfItsOwn)
+{
+    // Given
+
+    Arena arena{testChunkSize};
+    static_cast<void>(arena.allocate(64, CACHE_LINE_SIZE));
+
+    // When
+
+    void* large{arena.allocate(3 * testChunkSize, CACHE_LINE_SIZE)};
+
+    // Then
+
+    EXPECT_NE(large, nullptr);
+    EXPECT_EQ(arena.chunkCount(), 2);
+    EXPECT_GE(arena.bytesReserved(), 4 * testChunkSize);
+}
+
+TEST(ArenaTest, ReleaseReturnsAllChunks)
+{
+    // Given
+
+    Arena arena{testChunkSize};
+    static_cast<void>(arena.allocate(64, CACHE_LINE_SIZE));
+
+    // When
+
+    arena.release();
+
+    // Then
+
+    EXPECT_EQ(arena.chunkCount(), 0);
+    EXPECT_EQ(arena.bytesReserved(), 0);
+    EXPECT_EQ(arena.bytesAllocated(), 0);
+}
+
+TEST(ArenaTest, ArenaEqualsOnlyItself)
+{
+    // Given
+
+    const Arena arena1;
+    const Arena arena2;
+
+    // When / Then
+
+    EXPECT_TRUE(arena1.is_equal(arena1));
+    EXPECT_FALSE(arena1.is_equal(arena2));
+}
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class ArenaLatticeTest : public ::testing::Test
+{
+protected:
+    static constexpr std::array<std::size_t, 2> extents{7, 5};
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    Arena arena{testChunkSize};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(ArenaLatticeTest, FloatingPointTypes);
+
+TYPED_TEST(ArenaLatticeTest, LatticeBlocksDrawPopulationsFromArena)
+{
+    // Given
+
+    const std::size_t blockCount{4};
+    std::vector<Lattice<2, 9, TypeParam>> blocks;
+
+    // When
+
+    for (std::size_t block = 0; block < blockCount; ++block)
+    {
+        blocks.emplace_back(TestFixture::extents, &this->arena);
+    }
+
+    // Then
+
+    EXPECT_EQ(this->arena.chunkCount(), 1);
+    EXPECT_GE(this->arena.bytesAllocated(), blockCount * 9 * 35 * sizeof(TypeParam));
+    for (const auto& block : blocks)
+    {
+        const auto address{reinterpret_cast<std::uintptr_t>(block.population(0).data())};
+        EXPECT_EQ(address % CACHE_LINE_SIZE, 0);
+        EXPECT_EQ(block.population(8)[34], TypeParam{0.0});
+    }
+}
+
+TYPED_TEST(ArenaLatticeTest, FirstTouchLatticeAndMixedPrecisionLatticeDrawFromArena)
+{
+    // Given
+
+    const auto weights{latticeWeights(D2Q9<TypeParam>{})};
+
+    // When
+
+    const Lattice<2, 9, TypeParam> lattice{
+        TestFixture::extents, [](const auto& zero) { zero(0, 35); }, &this->arena
+    };
+    const std::size_t latticeBytes{this->arena.bytesAllocated()};
+    const MixedPrecisionLattice<2, 9, TypeParam, ShiftedFloat16Storage> mixed{
+        TestFixture::extents, weights, &this->arena
+    };
+
+    // Then
+
+    EXPECT_GE(latticeBytes, 9 * 35 * sizeof(TypeParam));
+    EXPECT_GE(this->arena.bytesAllocated() - latticeBytes, 9 * 35 * sizeof(std::uint16_t));
+    EXPECT_EQ(lattice.population(3)[7], TypeParam{0.0});
+    EXPECT_EQ(mixed.load(3, 7), weights[3]);
+}
@@ -0,0 +1,219 @@
+#include "../../src/densityDistribution/d2q5.hpp"
+#include "../../src/densityDistribution/d2q9.hpp"
+#include "../../src/lattice/Lattice.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class LatticeTest : public ::testing::Test
+{
+private:
+    static constexpr std::size_t dimension_{2};
+    static constexpr std::size_t size_{9};
+    static constexpr std::array<std::size_t, dimension_> extents_{7, 5};
+    static constexpr std::initializer_list<Scalar> distribution_{1.0 / 3.0, 2.0 / 4.0,  3.0 / 5.0,
+                                                                 4.0 / 6.0, 5.0 / 7.0,  6.0 / 8.0,
+                                                                 7.0 / 9.0, 8.0 / 10.0, 9.0 / 11.0};
+
+protected:
+    LatticeTest() : lattice{extents_}, distribution{distribution_} {}
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    Lattice<dimension_, size_, Scalar> lattice;
+    DensityDistribution<dimension_, size_, Scalar> distribution;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(LatticeTest, FloatingPointTypes);
+
+TYPED_TEST(LatticeTest, DimensionAndSizeEqualTemplateParameters)
+{
+    // Given
+
+    const std::size_t expectedDimension{2};
+    const std::size_t expectedSize{9};
+
+    // When
+
+    // Then
+
+    EXPECT_EQ(this->lattice.dimension(), expectedDimension);
+    EXPECT_EQ(this->lattice.size(), expectedSize);
+}
+
+TYPED_TEST(LatticeTest, NodeCountEqualsProductOfExtents)
+{
+    // Given
+
+    const std::size_t expectedNodeCount{35};
+
+    // When
+
+    // Then
+
+    EXPECT_EQ(this->lattice.nodeCount(), expectedNodeCount);
+    EXPECT_EQ(this->lattice.population(0).size(), expectedNodeCount);
+}
+
+TYPED_TEST(LatticeTest, DefaultPopulationsEqualZero)
+{
+    // Given
+
+    const TypeParam expectedValue{0.0};
+
+    // When
+
+    // Then
+
+    for (std::size_t direction = 0; direction < this->lattice.size(); ++direction)
+    {
+        for (const TypeParam value : this->lattice.population(direction))
+        {
+            EXPECT_EQ(value, expectedValue);
+        }
+    }
+}
+
+TYPED_TEST(LatticeTest, PopulationArraysStartOnCacheLineBoundary)
+{
+    // Given
+
+    // When
+
+    // Then
+
+    for (std::size_t direction = 0; direction < this->lattice.size(); ++direction)
+    {
+        const TypeParam* data{this->lattice.population(direction).data()};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto address{reinterpret_cast<std::uintptr_t>(data)};
+        EXPECT_EQ(address % CACHE_LINE_SIZE, 0);
+    }
+}
+
+TYPED_TEST(LatticeTest, LinearIndexRunsFastestAlongFirstCoordinate)
+{
+    // Given
+
+    const std::array<std::size_t, 2> coordinates{3, 2};
+    const std::size_t expectedIndex{17};
+
+    // When
+
+    const std::size_t index{this->lattice.linearIndex(coordinates)};
+
+    // Then
+
+    EXPECT_EQ(index, expectedIndex);
+}
+
+TYPED_TEST(LatticeTest, NodeEqualsScatteredDistribution)
+{
+    // Given
+
+    const std::size_t index{17};
+
+    // When
+
+    this->lattice.setNode(index, this->distribution);
+    const DensityDistribution<2, 9, TypeParam> node{this->lattice.node(index)};
+
+    // Then
+
+    for (std::size_t direction = 0; direction < node.size(); ++direction)
+    {
+        EXPECT_EQ(node[direction], this->distribution[direction]);
+        EXPECT_EQ(this->lattice.population(direction)[index], this->distribution[direction]);
+        EXPECT_EQ(this->lattice.population(direction)[index - 1], TypeParam{0.0});
+    }
+}
+
+TYPED_TEST(LatticeTest, NodeMomentsEqualDistributionMoments)
+{
+    // Given
+
+    const std::size_t index{34};
+    this->lattice.setNode(index, this->distribution);
+
+    // When
+
+    const D2Q9<TypeParam> node{this->lattice.node(index)};
+
+    // Then
+
+    EXPECT_EQ(computeDensity(node), computeDensity(this->distribution));
+    EXPECT_EQ(computeMomentum(node), computeMomentum(this->distribution));
+    EXPECT_EQ(latticeWeights(node), latticeWeights(this->distribution));
+}
+
+TYPED_TEST(LatticeTest, D2Q5NodeMomentsEqualDistributionMoments)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{3, 3};
+    Lattice<2, 5, TypeParam> lattice{extents};
+    const D2Q5<TypeParam> distribution{1.0 / 3.0, 2.0 / 4.0, 4.0 / 6.0, 3.0 / 5.0, 5.0 / 7.0};
+    const std::size_t index{4};
+
+    // When
+
+    lattice.setNode(index, distribution);
+    const D2Q5<TypeParam> node{lattice.node(index)};
+
+    // Then
+
+    EXPECT_EQ(computeDensity(node), computeDensity(distribution));
+    EXPECT_EQ(computeMomentum(node), computeMomentum(distribution));
+}
+
+TYPED_TEST(LatticeTest, FirstTouchConstructorZeroesAllNodes)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{7, 5};
+    std::size_t touchedNodes{0};
+
+    // When
+
+    const Lattice<2, 9, TypeParam> lattice{extents, [&](const auto& zero) {
+                                               zero(0, 20);
+                                               zero(20, 35);
+                                               touchedNodes = 35;
+                                           }};
+
+    // Then
+
+    EXPECT_EQ(touchedNodes, lattice.nodeCount());
+    for (std::size_t direction = 0; direction < lattice.size(); ++direction)
+    {
+        for (const TypeParam value : lattice.population(direction))
+        {
+            EXPECT_EQ(value, TypeParam{0.0});
+        }
+    }
+}
+
+TYPED_TEST(LatticeTest, NonConstPopulationAccessAdvancesRevision)
+{
+    // Given
+
+    const std::uint64_t initial{this->lattice.revision()};
+    const auto& constLattice{this->lattice};
+
+    // When
+
+    static_cast<void>(constLattice.population(0));
+    const std::uint64_t afterRead{this->lattice.revision()};
+    static_cast<void>(this->lattice.population(0));
+    const std::uint64_t afterAccess{this->lattice.revision()};
+    this->lattice.setNode(0, this->distribution);
+    const std::uint64_t afterSetNode{this->lattice.revision()};
+
+    // Then
+
+    EXPECT_EQ(afterRead, initial);
+    EXPECT_NE(afterAccess, afterRead);
+    EXPECT_NE(afterSetNode, afterAccess);
+}
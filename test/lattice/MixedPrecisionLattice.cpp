@@ -0,0 +1,312 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/lattice/MixedPrecisionLattice.hpp"
+#include "../../src/lattice/moments.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <numbers>
+
+namespace
+{
+
+constexpr std::size_t shearWaveExtent{32};
+constexpr std::size_t shearWaveSteps{200};
+constexpr double shearWaveAmplitude{0.01};
+constexpr double shearWaveRelaxationFrequency{1.2};
+
+/**
+ * Stores a distinct non-equilibrium density distribution at every node of a lattice.
+ */
+template <typename LatticeType, std::floating_point Scalar>
+auto fillNodes(LatticeType& lattice, const std::array<Scalar, D2Q9_SIZE>& weights) -> void
+{
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        D2Q9<Scalar> distribution;
+        for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+        {
+            distribution[i] = weights[i] * (Scalar{1.0} + static_cast<Scalar>((node + 3 * i) % 11) /
+                                                              Scalar{100.0});
+        }
+        lattice.setNode(node, distribution);
+    }
+}
+
+/**
+ * Runs a decaying shear wave with fused AA streaming and BGK collision and returns the velocity
+ * along the first axis at every node.
+ */
+template <typename LatticeType, std::floating_point Scalar>
+auto runShearWave(LatticeType& lattice) -> std::vector<Scalar>
+{
+    constexpr D2Q9<Scalar> model;
+    const auto velocities{latticeVelocities(model)};
+    const auto opposites{latticeOpposites(model)};
+    const auto relaxationFrequency{static_cast<Scalar>(shearWaveRelaxationFrequency)};
+
+    for (std::size_t y = 0; y < shearWaveExtent; ++y)
+    {
+        const auto velocity{static_cast<Scalar>(
+            shearWaveAmplitude * std::sin(2.0 * std::numbers::pi * static_cast<double>(y) /
+                                          static_cast<double>(shearWaveExtent))
+        )};
+        for (std::size_t x = 0; x < shearWaveExtent; ++x)
+        {
+            lattice.setNode(
+                lattice.linearIndex({x, y}),
+                computeEquilibrium<D2Q9_DESCRIPTOR>(
+                    Scalar{1.0}, std::array<Scalar, D2Q9_DIMENSION>{velocity, Scalar{0.0}}
+                )
+            );
+        }
+    }
+
+    for (std::size_t timeStep = 0; timeStep < shearWaveSteps; ++timeStep)
+    {
+        streamAA(
+            lattice,
+            velocities,
+            opposites,
+            timeStep,
+            [&](std::array<Scalar, D2Q9_SIZE>& values) {
+                relaxBGK<D2Q9_DESCRIPTOR>(values, relaxationFrequency);
+            }
+        );
+    }
+
+    std::vector<Scalar> velocityX(lattice.nodeCount());
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const D2Q9<Scalar> distribution{lattice.node(node)};
+        velocityX[node] = computeMomentum(distribution)[0] / computeDensity(distribution);
+    }
+
+    return velocityX;
+}
+
+/**
+ * Returns the largest velocity deviation of a mixed-precision shear wave from the all-double one,
+ * relative to the amplitude of the wave.
+ */
+template <std::floating_point Scalar, StorageFormat Format>
+auto shearWaveError() -> double
+{
+    const std::array<std::size_t, 2> extents{shearWaveExtent, shearWaveExtent};
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, double> reference{extents};
+    MixedPrecisionLattice<D2Q9_DIMENSION, D2Q9_SIZE, Scalar, Format> lattice{
+        extents, latticeWeights(D2Q9<Scalar>{})
+    };
+
+    const auto expected{runShearWave<decltype(reference), double>(reference)};
+    const auto actual{runShearWave<decltype(lattice), Scalar>(lattice)};
+
+    double error{0.0};
+    for (std::size_t node = 0; node < expected.size(); ++node)
+    {
+        error = std::max(error, std::abs(static_cast<double>(actual[node]) - expected[node]));
+    }
+
+    return error / shearWaveAmplitude;
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class MixedPrecisionLatticeTest : public ::testing::Test
+{
+private:
+    static constexpr std::array<std::size_t, 2> extents_{7, 5};
+
+protected:
+    MixedPrecisionLatticeTest()
+        : weights{latticeWeights(D2Q9<Scalar>{})},
+          halfLattice{extents_, weights},
+          shiftedHalfLattice{extents_, weights},
+          shiftedSingleLattice{extents_, weights},
+          reference{extents_}
+    {
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::array<Scalar, D2Q9_SIZE> weights;
+    MixedPrecisionLattice<2, 9, Scalar, Float16Storage> halfLattice;
+    MixedPrecisionLattice<2, 9, Scalar, ShiftedFloat16Storage> shiftedHalfLattice;
+    MixedPrecisionLattice<2, 9, Scalar, ShiftedFloat32Storage> shiftedSingleLattice;
+    Lattice<2, 9, Scalar> reference;
+    const Scalar relaxationFrequency{1.3};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(MixedPrecisionLatticeTest, FloatingPointTypes);
+
+TYPED_TEST(MixedPrecisionLatticeTest, DefaultPopulationsEqualWeights)
+{
+    // Given
+
+    const TypeParam tolerance{static_cast<TypeParam>(0x1p-11)};
+
+    // When
+
+    // Then
+
+    EXPECT_EQ(this->shiftedHalfLattice.offsets(), this->weights);
+    EXPECT_EQ(this->halfLattice.offsets(), (std::array<TypeParam, D2Q9_SIZE>{}));
+    for (std::size_t node = 0; node < this->halfLattice.nodeCount(); ++node)
+    {
+        for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+        {
+            EXPECT_EQ(this->shiftedHalfLattice.load(i, node), this->weights[i]);
+            EXPECT_EQ(this->shiftedSingleLattice.load(i, node), this->weights[i]);
+            EXPECT_NEAR(
+                this->halfLattice.load(i, node), this->weights[i], tolerance * this->weights[i]
+            );
+        }
+    }
+}
+
+TYPED_TEST(MixedPrecisionLatticeTest, PopulationArraysStartOnCacheLineBoundary)
+{
+    // Given
+
+    // When
+
+    // Then
+
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        EXPECT_EQ(
+            reinterpret_cast<std::uintptr_t>(this->halfLattice.population(i).data()) %
+                CACHE_LINE_SIZE,
+            0
+        );
+        EXPECT_EQ(
+            reinterpret_cast<std::uintptr_t>(this->shiftedSingleLattice.population(i).data()) %
+                CACHE_LINE_SIZE,
+            0
+        );
+        EXPECT_EQ(this->halfLattice.population(i).size(), this->halfLattice.nodeCount());
+    }
+}
+
+TYPED_TEST(MixedPrecisionLatticeTest, NodesRoundTripWithinStoragePrecision)
+{
+    // Given
+
+    const TypeParam halfPrecision{static_cast<TypeParam>(0x1p-11)};
+    const TypeParam singlePrecision{static_cast<TypeParam>(0x1p-24)};
+
+    // When
+
+    fillNodes(this->reference, this->weights);
+    fillNodes(this->halfLattice, this->weights);
+    fillNodes(this->shiftedHalfLattice, this->weights);
+    fillNodes(this->shiftedSingleLattice, this->weights);
+
+    // Then
+
+    for (std::size_t node = 0; node < this->reference.nodeCount(); ++node)
+    {
+        const auto expected{this->reference.node(node)};
+        const auto half{this->halfLattice.node(node)};
+        const auto shiftedHalf{this->shiftedHalfLattice.node(node)};
+        const auto shiftedSingle{this->shiftedSingleLattice.node(node)};
+        for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+        {
+            const TypeParam deviation{std::abs(expected[i] - this->weights[i])};
+            EXPECT_NEAR(half[i], expected[i], halfPrecision * expected[i]);
+            EXPECT_NEAR(shiftedHalf[i], expected[i], halfPrecision * deviation);
+            EXPECT_NEAR(
+                shiftedSingle[i],
+                expected[i],
+                std::max(singlePrecision * deviation, std::numeric_limits<TypeParam>::epsilon())
+            );
+        }
+    }
+}
+
+TYPED_TEST(MixedPrecisionLatticeTest, D2Q9MomentsEqualMomentsOfWidenedNodes)
+{
+    // Given
+
+    fillNodes(this->shiftedHalfLattice, this->weights);
+    for (std::size_t node = 0; node < this->reference.nodeCount(); ++node)
+    {
+        this->reference.setNode(node, this->shiftedHalfLattice.node(node));
+    }
+    const std::size_t nodeCount{this->reference.nodeCount()};
+    std::vector<TypeParam> expectedDensities(nodeCount);
+    std::vector<TypeParam> expectedMomentumX(nodeCount);
+    std::vector<TypeParam> expectedMomentumY(nodeCount);
+    std::vector<TypeParam> densities(nodeCount);
+    std::vector<TypeParam> momentumX(nodeCount);
+    std::vector<TypeParam> momentumY(nodeCount);
+
+    // When
+
+    computeMoments(
+        this->reference,
+        std::span<TypeParam>{expectedDensities},
+        {std::span<TypeParam>{expectedMomentumX}, std::span<TypeParam>{expectedMomentumY}}
+    );
+    computeMoments(
+        this->shiftedHalfLattice,
+        std::span<TypeParam>{densities},
+        {std::span<TypeParam>{momentumX}, std::span<TypeParam>{momentumY}}
+    );
+
+    // Then
+
+    EXPECT_EQ(densities, expectedDensities);
+    EXPECT_EQ(momentumX, expectedMomentumX);
+    EXPECT_EQ(momentumY, expectedMomentumY);
+}
+
+TYPED_TEST(MixedPrecisionLatticeTest, D2Q9CollisionEqualsWidenedCollisionThenNarrowing)
+{
+    // Given
+
+    fillNodes(this->halfLattice, this->weights);
+    for (std::size_t node = 0; node < this->reference.nodeCount(); ++node)
+    {
+        this->reference.setNode(node, this->halfLattice.node(node));
+    }
+    MixedPrecisionLattice<2, 9, TypeParam, Float16Storage> expected{this->halfLattice};
+
+    // When
+
+    collideBGK(this->reference, this->relaxationFrequency);
+    collideBGK(this->halfLattice, this->relaxationFrequency);
+
+    // Then
+
+    for (std::size_t node = 0; node < this->reference.nodeCount(); ++node)
+    {
+        expected.setNode(node, this->reference.node(node));
+    }
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        EXPECT_TRUE(std::ranges::equal(this->halfLattice.population(i), expected.population(i)));
+    }
+}
+
+TEST(MixedPrecisionAccuracyTest, D2Q9ShiftedShearWaveStaysCloseToDoublePrecision)
+{
+    // Given
+
+    // When
+
+    const double shiftedSingleError{shearWaveError<double, ShiftedFloat32Storage>()};
+    const double shiftedHalfError{shearWaveError<float, ShiftedFloat16Storage>()};
+    const double halfError{shearWaveError<float, Float16Storage>()};
+    const double bfloatError{shearWaveError<float, BFloat16Storage>()};
+
+    // Then
+
+    EXPECT_LT(shiftedSingleError, 1e-6);
+    EXPECT_LT(shiftedHalfError, 1e-3);
+    EXPECT_LT(100 * shiftedHalfError, halfError);
+    EXPECT_LT(100 * shiftedHalfError, bfloatError);
+}
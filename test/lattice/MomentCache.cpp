@@ -0,0 +1,157 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/lattice/MomentCache.hpp"
+#include <gtest/gtest.h>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class MomentCacheTest : public ::testing::Test
+{
+private:
+    // An odd node count exercises both the vector loop and the scalar remainder.
+    static constexpr std::array<std::size_t, 2> extents_{13, 5};
+
+protected:
+    MomentCacheTest() : lattice{extents_}, cache{lattice, latticeVelocities(D2Q9<Scalar>{})}
+    {
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            const std::array<Scalar, 2> velocity{
+                static_cast<Scalar>(node % 7) / 100, -static_cast<Scalar>(node % 3) / 50
+            };
+            lattice.setNode(
+                node,
+                computeEquilibrium<D2Q9_DESCRIPTOR>(
+                    Scalar{1.0} + static_cast<Scalar>(node) / 200, velocity
+                )
+            );
+        }
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    Lattice<2, 9, Scalar> lattice;
+    MomentCache<2, 9, Scalar> cache;
+    const Scalar tolerance{16 * std::numeric_limits<Scalar>::epsilon()};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(MomentCacheTest, FloatingPointTypes);
+
+TYPED_TEST(MomentCacheTest, CachedMomentsEqualNodeMoments)
+{
+    // When
+
+    const auto densities{this->cache.densities()};
+    const auto momenta{this->cache.momenta()};
+
+    // Then
+
+    for (std::size_t node = 0; node < this->lattice.nodeCount(); ++node)
+    {
+        const D2Q9<TypeParam> distribution{this->lattice.node(node)};
+        const auto momentum{computeMomentum(distribution)};
+        EXPECT_NEAR(densities[node], computeDensity(distribution), this->tolerance);
+        EXPECT_NEAR(momenta[0][node], momentum[0], this->tolerance);
+        EXPECT_NEAR(momenta[1][node], momentum[1], this->tolerance);
+        EXPECT_EQ(this->cache.density(node), densities[node]);
+        EXPECT_EQ(this->cache.momentum(node)[1], momenta[1][node]);
+    }
+}
+
+TYPED_TEST(MomentCacheTest, RepeatedReadsShareOneSweep)
+{
+    // When
+
+    static_cast<void>(this->cache.densities());
+    static_cast<void>(this->cache.momenta());
+    static_cast<void>(this->cache.density(3));
+    static_cast<void>(this->cache.flowVelocities());
+
+    // Then
+
+    EXPECT_EQ(this->cache.sweeps(), 1);
+    EXPECT_TRUE(this->cache.isCurrent());
+}
+
+TYPED_TEST(MomentCacheTest, ModifiedLatticeIsRecomputed)
+{
+    // Given
+
+    const TypeParam density{this->cache.density(0)};
+
+    // When
+
+    this->lattice.population(0)[0] += TypeParam{0.5};
+
+    // Then
+
+    EXPECT_FALSE(this->cache.isCurrent());
+    EXPECT_NEAR(this->cache.density(0), density + TypeParam{0.5}, this->tolerance);
+    EXPECT_EQ(this->cache.sweeps(), 2);
+}
+
+TYPED_TEST(MomentCacheTest, ConstPopulationViewsKeepCacheCurrent)
+{
+    // Given
+
+    static_cast<void>(this->cache.densities());
+
+    // When
+
+    static_cast<void>(std::as_const(this->lattice).population(0));
+
+    // Then
+
+    EXPECT_TRUE(this->cache.isCurrent());
+    EXPECT_FALSE(this->cache.refresh());
+}
+
+TYPED_TEST(MomentCacheTest, CollisionMakesCacheStale)
+{
+    // Given
+
+    static_cast<void>(this->cache.densities());
+
+    // When
+
+    collideBGK(this->lattice, TypeParam{1.2});
+
+    // Then
+
+    EXPECT_FALSE(this->cache.isCurrent());
+}
+
+TYPED_TEST(MomentCacheTest, InvalidateForcesRecomputation)
+{
+    // Given
+
+    std::span<TypeParam> population{this->lattice.population(0)};
+    static_cast<void>(this->cache.densities());
+
+    // When
+
+    population[0] += TypeParam{0.5};
+    this->cache.invalidate();
+
+    // Then
+
+    EXPECT_TRUE(this->cache.refresh());
+    EXPECT_FALSE(this->cache.refresh());
+    EXPECT_EQ(this->cache.sweeps(), 2);
+}
+
+TYPED_TEST(MomentCacheTest, FlowVelocityIsMomentumOverDensity)
+{
+    // When
+
+    const auto flowVelocities{this->cache.flowVelocities()};
+
+    // Then
+
+    for (std::size_t node = 0; node < this->lattice.nodeCount(); ++node)
+    {
+        const TypeParam expected{static_cast<TypeParam>(node % 7) / 100};
+        EXPECT_NEAR(flowVelocities[0][node], expected, this->tolerance);
+        EXPECT_EQ(this->cache.flowVelocity(node)[1], flowVelocities[1][node]);
+    }
+}
@@ -0,0 +1,95 @@
+#include "../../src/lattice/RevisionCounter.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class RevisionCounterTest : public ::testing::Test
+{
+protected:
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    RevisionCounter counter;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(RevisionCounterTest, FloatingPointTypes);
+
+TYPED_TEST(RevisionCounterTest, AdvanceChangesValue)
+{
+    // Given
+
+    const std::uint64_t initial{this->counter.value()};
+
+    // When
+
+    this->counter.advance();
+
+    // Then
+
+    EXPECT_NE(this->counter.value(), initial);
+}
+
+TYPED_TEST(RevisionCounterTest, CopyStartsAtSameValue)
+{
+    // Given
+
+    this->counter.advance();
+
+    // When
+
+    const RevisionCounter copy{this->counter};
+
+    // Then
+
+    EXPECT_EQ(copy.value(), this->counter.value());
+}
+
+TYPED_TEST(RevisionCounterTest, AssignmentAdvancesInsteadOfCopying)
+{
+    // Given
+
+    RevisionCounter other;
+    for (std::size_t step = 0; step < 3; ++step)
+    {
+        other.advance();
+    }
+    const std::uint64_t initial{this->counter.value()};
+
+    // When
+
+    this->counter = other;
+
+    // Then
+
+    EXPECT_EQ(this->counter.value(), initial + 1);
+}
+
+TYPED_TEST(RevisionCounterTest, ConcurrentAdvancesAreAllCounted)
+{
+    // Given
+
+    constexpr std::size_t threadCount{4};
+    constexpr std::size_t advancesPerThread{10'000};
+    const std::uint64_t initial{this->counter.value()};
+
+    // When
+
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t thread = 0; thread < threadCount; ++thread)
+        {
+            threads.emplace_back([this] {
+                for (std::size_t step = 0; step < advancesPerThread; ++step)
+                {
+                    this->counter.advance();
+                }
+            });
+        }
+    }
+
+    // Then
+
+    EXPECT_EQ(this->counter.value(), initial + threadCount * advancesPerThread);
+}
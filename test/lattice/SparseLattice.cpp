@@ -0,0 +1,291 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/lattice/SparseLattice.hpp"
+#include "../../src/lattice/moments.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+namespace
+{
+
+constexpr std::size_t channelLength{12};
+constexpr std::size_t channelWidth{8};
+constexpr std::size_t channelSteps{41};
+
+/**
+ * Returns a fluid mask of a channel along the first axis with solid walls in the first and last
+ * rows and a solid obstacle in its middle.
+ */
+auto channelMask() -> std::vector<bool>
+{
+    std::vector<bool> fluid(channelLength * channelWidth, true);
+
+    for (std::size_t x = 0; x < channelLength; ++x)
+    {
+        fluid[x] = false;
+        fluid[(channelWidth - 1) * channelLength + x] = false;
+    }
+    fluid[3 * channelLength + 5] = false;
+    fluid[4 * channelLength + 5] = false;
+
+    return fluid;
+}
+
+/**
+ * Stores a distinct non-equilibrium density distribution at every node of a lattice.
+ */
+template <typename LatticeType, std::floating_point Scalar>
+auto fillNodes(LatticeType& lattice, const std::array<Scalar, D2Q9_SIZE>& weights) -> void
+{
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        D2Q9<Scalar> distribution;
+        for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+        {
+            distribution[i] = weights[i] * (Scalar{1.0} + static_cast<Scalar>((node + 3 * i) % 11) /
+                                                              Scalar{100.0});
+        }
+        lattice.setNode(node, distribution);
+    }
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class SparseLatticeTest : public ::testing::Test
+{
+private:
+    static constexpr std::array<std::size_t, 2> extents_{channelLength, channelWidth};
+
+protected:
+    SparseLatticeTest()
+        : fluid{channelMask()},
+          channel{extents_, latticeVelocities(model), latticeOpposites(model), fluid},
+          open{
+              extents_,
+              latticeVelocities(model),
+              latticeOpposites(model),
+              std::vector<bool>(channelLength * channelWidth, true)
+          },
+          reference{extents_}
+    {
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    static constexpr D2Q9<Scalar> model{};
+    std::vector<bool> fluid;
+    SparseLattice<2, 9, Scalar> channel;
+    SparseLattice<2, 9, Scalar> open;
+    Lattice<2, 9, Scalar> reference;
+    const Scalar relaxationFrequency{1.3};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(SparseLatticeTest, FloatingPointTypes);
+
+TYPED_TEST(SparseLatticeTest, StorageScalesWithFluidNodes)
+{
+    // Given
+
+    const auto fluidNodes{static_cast<std::size_t>(std::ranges::count(this->fluid, true))};
+
+    // When
+
+    // Then
+
+    EXPECT_EQ(this->channel.nodeCount(), fluidNodes);
+    EXPECT_EQ(this->channel.boxNodeCount(), channelLength * channelWidth);
+    EXPECT_LT(this->channel.slots().size(), this->open.slots().size());
+    for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+    {
+        EXPECT_EQ(this->channel.population(i).size(), fluidNodes);
+        EXPECT_EQ(this->channel.streamSlots(i).size(), fluidNodes);
+        EXPECT_EQ(
+            reinterpret_cast<std::uintptr_t>(this->channel.population(i).data()) % CACHE_LINE_SIZE,
+            0
+        );
+    }
+}
+
+TYPED_TEST(SparseLatticeTest, FluidIndicesRoundTripAndSolidNodesAreAbsent)
+{
+    // Given
+
+    // When
+
+    // Then
+
+    for (std::size_t node = 0; node < this->channel.nodeCount(); ++node)
+    {
+        const std::size_t boxIndex{this->channel.boxIndex(node)};
+        EXPECT_TRUE(this->fluid[boxIndex]);
+        EXPECT_EQ(
+            this->channel.fluidIndex({boxIndex % channelLength, boxIndex / channelLength}), node
+        );
+    }
+    EXPECT_EQ(this->channel.fluidIndex({0, 0}), this->channel.nodeCount());
+    EXPECT_EQ(this->channel.fluidIndex({5, 3}), this->channel.nodeCount());
+}
+
+TYPED_TEST(SparseLatticeTest, MismatchedMaskThrows)
+{
+    // Given
+
+    const std::vector<bool> fluid(channelLength, true);
+
+    // When
+
+    // Then
+
+    EXPECT_THROW(
+        (SparseLattice<2, 9, TypeParam>{
+            {channelLength, channelWidth},
+            latticeVelocities(this->model),
+            latticeOpposites(this->model),
+            fluid
+        }),
+        std::invalid_argument
+    );
+}
+
+TYPED_TEST(SparseLatticeTest, D2Q9AllFluidStreamingEqualsDenseStreaming)
+{
+    // Given
+
+    const auto weights{latticeWeights(this->model)};
+    const auto collision{[&](std::array<TypeParam, D2Q9_SIZE>& values) {
+        relaxBGK<D2Q9_DESCRIPTOR>(values, this->relaxationFrequency);
+    }};
+    fillNodes(this->reference, weights);
+    fillNodes(this->open, weights);
+
+    // When
+
+    for (std::size_t timeStep = 0; timeStep < channelSteps; ++timeStep)
+    {
+        streamAA(this->reference, timeStep, collision);
+        streamAA(this->open, timeStep, collision);
+    }
+
+    // Then
+
+    for (std::size_t node = 0; node < this->reference.nodeCount(); ++node)
+    {
+        const D2Q9<TypeParam> expected{gatherAA(this->reference, node, channelSteps)};
+        const D2Q9<TypeParam> distribution{gatherAA(this->open, node, channelSteps)};
+        for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+        {
+            EXPECT_EQ(distribution[i], expected[i]);
+        }
+    }
+}
+
+TYPED_TEST(SparseLatticeTest, D2Q9BounceBackConservesMass)
+{
+    // Given
+
+    const auto weights{latticeWeights(this->model)};
+    fillNodes(this->channel, weights);
+    TypeParam initialMass{0.0};
+    for (std::size_t node = 0; node < this->channel.nodeCount(); ++node)
+    {
+        initialMass += computeDensity(this->channel.node(node));
+    }
+
+    // When
+
+    for (std::size_t timeStep = 0; timeStep < channelSteps; ++timeStep)
+    {
+        streamAA(this->channel, timeStep, [&](std::array<TypeParam, D2Q9_SIZE>& values) {
+            relaxBGK<D2Q9_DESCRIPTOR>(values, this->relaxationFrequency);
+        });
+    }
+
+    // Then
+
+    TypeParam mass{0.0};
+    for (std::size_t node = 0; node < this->channel.nodeCount(); ++node)
+    {
+        mass += computeDensity(gatherAA(this->channel, node, channelSteps));
+    }
+    EXPECT_NEAR(mass, initialMass, 1e-4 * initialMass);
+}
+
+TYPED_TEST(SparseLatticeTest, D2Q9BounceBackReflectsPopulationsAtWalls)
+{
+    // Given
+
+    const std::size_t node{this->channel.fluidIndex({2, 1})};
+    D2Q9<TypeParam> distribution;
+    distribution[4] = TypeParam{1.0};
+    this->channel.setNode(node, distribution);
+
+    // When
+
+    const auto noCollision{[](std::array<TypeParam, D2Q9_SIZE>&) {}};
+    streamAA(this->channel, 0, noCollision);
+    const D2Q9<TypeParam> reflected{gatherAA(this->channel, node, 1)};
+    streamAA(this->channel, 1, noCollision);
+
+    // Then
+
+    EXPECT_EQ(reflected[2], TypeParam{1.0});
+    EXPECT_EQ(reflected[4], TypeParam{0.0});
+    EXPECT_EQ(this->channel.node(this->channel.fluidIndex({2, 2}))[2], TypeParam{1.0});
+    EXPECT_EQ(computeDensity(this->channel.node(node)), TypeParam{0.0});
+}
+
+TYPED_TEST(SparseLatticeTest, D2Q9MomentsEqualDenseMomentsAtFluidNodes)
+{
+    // Given
+
+    fillNodes(this->reference, latticeWeights(this->model));
+    for (std::size_t node = 0; node < this->channel.nodeCount(); ++node)
+    {
+        this->channel.setNode(node, this->reference.node(this->channel.boxIndex(node)));
+    }
+    const std::size_t boxNodeCount{this->reference.nodeCount()};
+    const std::size_t nodeCount{this->channel.nodeCount()};
+    std::vector<TypeParam> expectedDensities(boxNodeCount);
+    std::vector<TypeParam> expectedMomentumX(boxNodeCount);
+    std::vector<TypeParam> expectedMomentumY(boxNodeCount);
+    std::vector<TypeParam> densities(nodeCount);
+    std::vector<TypeParam> momentumX(nodeCount);
+    std::vector<TypeParam> momentumY(nodeCount);
+    std::vector<TypeParam> separateDensities(nodeCount);
+    std::vector<TypeParam> separateMomentumY(nodeCount);
+
+    // When
+
+    computeMoments(
+        this->reference,
+        std::span<TypeParam>{expectedDensities},
+        {std::span<TypeParam>{expectedMomentumX}, std::span<TypeParam>{expectedMomentumY}}
+    );
+    computeMoments(
+        this->channel,
+        std::span<TypeParam>{densities},
+        {std::span<TypeParam>{momentumX}, std::span<TypeParam>{momentumY}}
+    );
+    computeDensity(this->channel, std::span<TypeParam>{separateDensities});
+    computeMomentum(
+        this->channel,
+        {std::span<TypeParam>{momentumX}, std::span<TypeParam>{separateMomentumY}}
+    );
+
+    // Then
+
+    for (std::size_t node = 0; node < nodeCount; ++node)
+    {
+        const std::size_t boxIndex{this->channel.boxIndex(node)};
+        EXPECT_EQ(densities[node], expectedDensities[boxIndex]);
+        EXPECT_EQ(separateDensities[node], expectedDensities[boxIndex]);
+        EXPECT_EQ(momentumX[node], expectedMomentumX[boxIndex]);
+        EXPECT_EQ(momentumY[node], expectedMomentumY[boxIndex]);
+        EXPECT_EQ(separateMomentumY[node], expectedMomentumY[boxIndex]);
+    }
+}
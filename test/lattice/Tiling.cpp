@@ -0,0 +1,110 @@
+#include "../../src/lattice/Tiling.hpp"
+#include <gtest/gtest.h>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class TilingTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(TilingTest, FloatingPointTypes);
+
+TYPED_TEST(TilingTest, DefaultTileExtentsFitIntoCache)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{1024, 1024};
+    const std::size_t nodeBytes{9 * sizeof(TypeParam)};
+
+    // When
+
+    const auto tileExtents{defaultTileExtents<2, 9, TypeParam>(extents)};
+
+    // Then
+
+    EXPECT_EQ(tileExtents[0], extents[0]);
+    EXPECT_GE(tileExtents[1], 1);
+    EXPECT_LE(tileExtents[0] * tileExtents[1] * nodeBytes, TILE_CACHE_SIZE);
+}
+
+TYPED_TEST(TilingTest, DefaultTileExtentsSplitRowsLargerThanCache)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{1 << 20, 4};
+
+    // When
+
+    const auto tileExtents{defaultTileExtents<2, 9, TypeParam>(extents)};
+
+    // Then
+
+    EXPECT_LT(tileExtents[0], extents[0]);
+    EXPECT_EQ(tileExtents[1], 1);
+}
+
+TYPED_TEST(TilingTest, TilesCoverEveryNodeOnce)
+{
+    // Given
+
+    const std::array<std::size_t, 3> extents{7, 5, 3};
+    const std::array<std::size_t, 3> tileExtents{3, 2, 2};
+    std::vector<std::size_t> visits(7 * 5 * 3, 0);
+
+    // When
+
+    const auto tiles{tileLattice(extents, tileExtents)};
+    for (const LatticeTile<3>& tile : tiles)
+    {
+        forEachRow(tile, extents, [&](std::size_t firstNode, std::size_t lastNode) {
+            for (std::size_t node = firstNode; node < lastNode; ++node)
+            {
+                ++visits[node];
+            }
+        });
+    }
+
+    // Then
+
+    EXPECT_EQ(tiles.size(), 3 * 3 * 2);
+    for (const std::size_t count : visits)
+    {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TYPED_TEST(TilingTest, TilesAreTruncatedAtUpperBoundary)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{7, 5};
+    const std::array<std::size_t, 2> tileExtents{4, 4};
+
+    // When
+
+    const auto tiles{tileLattice(extents, tileExtents)};
+
+    // Then
+
+    ASSERT_EQ(tiles.size(), 4);
+    EXPECT_EQ(tiles[1].begin, (std::array<std::size_t, 2>{4, 0}));
+    EXPECT_EQ(tiles[1].end, (std::array<std::size_t, 2>{7, 4}));
+    EXPECT_EQ(tiles[3].begin, (std::array<std::size_t, 2>{4, 4}));
+    EXPECT_EQ(tiles[3].end, (std::array<std::size_t, 2>{7, 5}));
+}
+
+TYPED_TEST(TilingTest, TileNodeCountIsProductOfExtents)
+{
+    // Given
+
+    const LatticeTile<3> tile{{2, 0, 5}, {7, 3, 6}};
+
+    // When
+
+    const std::size_t count{tileNodeCount(tile)};
+
+    // Then
+
+    EXPECT_EQ(count, 15);
+}
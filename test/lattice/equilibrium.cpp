@@ -0,0 +1,218 @@
+#include "../../src/lattice/equilibrium.hpp"
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+/**
+ * A five-velocity model whose squared speed of sound is 1/2 instead of 1/3.
+ */
+constexpr LatticeDescriptor<2, 5> WIDE_D2Q5_DESCRIPTOR{makeLatticeDescriptor<2, 5>(
+    {{{0, 0}, {1, 0}, {-1, 0}, {0, 1}, {0, -1}}}, {0.0, 0.25, 0.25, 0.25, 0.25}, 0.5
+)};
+
+/**
+ * Fills density and velocity fields with smooth values of low Mach number.
+ */
+template <std::floating_point Scalar>
+auto fillFields(
+    std::vector<Scalar>& densities,
+    std::vector<Scalar>& velocityX,
+    std::vector<Scalar>& velocityY
+) -> void
+{
+    for (std::size_t node = 0; node < densities.size(); ++node)
+    {
+        densities[node] = Scalar{1.0} + static_cast<Scalar>(node % 17) / 100;
+        velocityX[node] = static_cast<Scalar>(static_cast<int>(node % 11) - 5) / 100;
+        velocityY[node] = static_cast<Scalar>(static_cast<int>(node % 7) - 3) / 100;
+    }
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class EquilibriumTest : public ::testing::Test
+{
+private:
+    // Rows longer than EQUILIBRIUM_BLOCK_SIZE exercise both full and partial blocks.
+    static constexpr std::array<std::size_t, 2> extents_{EQUILIBRIUM_BLOCK_SIZE + 37, 5};
+
+protected:
+    EquilibriumTest()
+        : lattice{extents_}, densities(lattice.nodeCount()), velocityX(lattice.nodeCount()),
+          velocityY(lattice.nodeCount())
+    {
+        fillFields(densities, velocityX, velocityY);
+    }
+
+    auto flowVelocities() const -> std::array<std::span<const Scalar>, 2>
+    {
+        return {std::span<const Scalar>{velocityX}, std::span<const Scalar>{velocityY}};
+    }
+
+    auto expectNodeEquilibrium() const -> void
+    {
+        const Scalar tolerance{8 * std::numeric_limits<Scalar>::epsilon()};
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            const std::array<Scalar, 2> velocity{velocityX[node], velocityY[node]};
+            const D2Q9<Scalar> expected{
+                computeEquilibrium<D2Q9_DESCRIPTOR>(densities[node], velocity)
+            };
+            const D2Q9<Scalar> actual{lattice.node(node)};
+            for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+            {
+                EXPECT_NEAR(actual[i], expected[i], tolerance) << "node " << node << ", i " << i;
+            }
+        }
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    Lattice<2, 9, Scalar> lattice;
+    std::vector<Scalar> densities;
+    std::vector<Scalar> velocityX;
+    std::vector<Scalar> velocityY;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(EquilibriumTest, FloatingPointTypes);
+
+TYPED_TEST(EquilibriumTest, D2Q9BulkInitializationEqualsNodeEquilibrium)
+{
+    // Given
+
+    // When
+
+    initializeEquilibrium(
+        this->lattice, std::span<const TypeParam>{this->densities}, this->flowVelocities()
+    );
+
+    // Then
+
+    this->expectNodeEquilibrium();
+}
+
+TYPED_TEST(EquilibriumTest, D2Q9ScheduledInitializationEqualsNodeEquilibrium)
+{
+    // Given
+
+    const std::array<std::size_t, 2> tileExtents{100, 2};
+
+    for (const std::size_t threadCount : {1, 3})
+    {
+        TiledScheduler<2> scheduler{this->lattice.extents(), tileExtents, threadCount};
+
+        // When
+
+        initializeEquilibrium(
+            this->lattice,
+            std::span<const TypeParam>{this->densities},
+            this->flowVelocities(),
+            scheduler
+        );
+
+        // Then
+
+        this->expectNodeEquilibrium();
+    }
+}
+
+TYPED_TEST(EquilibriumTest, FirstTouchLatticeHoldsNodeEquilibrium)
+{
+    // Given
+
+    TiledScheduler<2> scheduler{this->lattice.extents(), {100, 2}, 3};
+
+    // When
+
+    this->lattice = makeEquilibriumLattice<D2Q9_DESCRIPTOR>(
+        std::span<const TypeParam>{this->densities}, this->flowVelocities(), scheduler
+    );
+
+    // Then
+
+    EXPECT_EQ(this->lattice.extents(), scheduler.extents());
+    this->expectNodeEquilibrium();
+}
+
+TYPED_TEST(EquilibriumTest, D2Q5InitializationConservesDensityAndMomentum)
+{
+    // Given
+
+    Lattice<2, 5, TypeParam> lattice{this->lattice.extents()};
+
+    // When
+
+    initializeEquilibrium(
+        lattice, std::span<const TypeParam>{this->densities}, this->flowVelocities()
+    );
+
+    // Then
+
+    const TypeParam tolerance{8 * std::numeric_limits<TypeParam>::epsilon()};
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const D2Q5<TypeParam> distribution{lattice.node(node)};
+        TypeParam density{0.0};
+        for (const TypeParam population : distribution)
+        {
+            density += population;
+        }
+        EXPECT_NEAR(density, this->densities[node], tolerance);
+        EXPECT_NEAR(
+            distribution[1] - distribution[2],
+            this->densities[node] * this->velocityX[node],
+            tolerance
+        );
+    }
+}
+
+TYPED_TEST(EquilibriumTest, InitializationUsesSpeedOfSoundOfDescriptor)
+{
+    // Given
+
+    Lattice<2, 5, TypeParam> lattice{this->lattice.extents()};
+
+    // When
+
+    initializeEquilibrium<WIDE_D2Q5_DESCRIPTOR>(
+        lattice, std::span<const TypeParam>{this->densities}, this->flowVelocities()
+    );
+
+    // Then
+
+    const TypeParam tolerance{8 * std::numeric_limits<TypeParam>::epsilon()};
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const std::array<TypeParam, 2> velocity{this->velocityX[node], this->velocityY[node]};
+        const D2Q5<TypeParam> expected{
+            computeEquilibrium<WIDE_D2Q5_DESCRIPTOR>(this->densities[node], velocity)
+        };
+        const D2Q5<TypeParam> actual{lattice.node(node)};
+        for (std::size_t i = 0; i < D2Q5_SIZE; ++i)
+        {
+            EXPECT_NEAR(actual[i], expected[i], tolerance) << "node " << node << ", i " << i;
+        }
+    }
+}
+
+TYPED_TEST(EquilibriumTest, ThrowsIfFieldSizeDiffersFromNodeCount)
+{
+    // Given
+
+    const std::vector<TypeParam> shortDensities(this->lattice.nodeCount() - 1);
+
+    // When / Then
+
+    EXPECT_THROW(
+        initializeEquilibrium(
+            this->lattice, std::span<const TypeParam>{shortDensities}, this->flowVelocities()
+        ),
+        std::length_error
+    );
+}
@@ -0,0 +1,238 @@
+#include "../../src/lattice/moments.hpp"
+#include "../LatticeFill.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+template <std::floating_point Scalar>
+auto population(std::size_t i, std::size_t node) -> Scalar
+{
+    return static_cast<Scalar>((i + 3) * (node + 7) % 101) / 13;
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class LatticeMomentsTest : public ::testing::Test
+{
+private:
+    // An odd node count exercises both the vector loop and the scalar remainder.
+    static constexpr std::array<std::size_t, 2> extents_{37, 3};
+
+protected:
+    LatticeMomentsTest()
+        : d2q5Lattice{extents_}, d2q9Lattice{extents_}, densities(d2q9Lattice.nodeCount()),
+          momentumX(d2q9Lattice.nodeCount()), momentumY(d2q9Lattice.nodeCount())
+    {
+        fillLattice(d2q5Lattice, population<Scalar>);
+        fillLattice(d2q9Lattice, population<Scalar>);
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    Lattice<2, 5, Scalar> d2q5Lattice;
+    Lattice<2, 9, Scalar> d2q9Lattice;
+    std::vector<Scalar> densities;
+    std::vector<Scalar> momentumX;
+    std::vector<Scalar> momentumY;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(LatticeMomentsTest, FloatingPointTypes);
+
+TYPED_TEST(LatticeMomentsTest, D2Q5BatchedDensityEqualsNodeDensity)
+{
+    // Given
+
+    // When
+
+    computeDensity(this->d2q5Lattice, std::span<TypeParam>{this->densities});
+
+    // Then
+
+    for (std::size_t node = 0; node < this->d2q5Lattice.nodeCount(); ++node)
+    {
+        EXPECT_EQ(this->densities[node], computeDensity(this->d2q5Lattice.node(node)));
+    }
+}
+
+TYPED_TEST(LatticeMomentsTest, D2Q9BatchedDensityEqualsNodeDensity)
+{
+    // Given
+
+    // When
+
+    computeDensity(this->d2q9Lattice, std::span<TypeParam>{this->densities});
+
+    // Then
+
+    for (std::size_t node = 0; node < this->d2q9Lattice.nodeCount(); ++node)
+    {
+        EXPECT_EQ(this->densities[node], computeDensity(this->d2q9Lattice.node(node)));
+    }
+}
+
+TYPED_TEST(LatticeMomentsTest, D2Q5BatchedMomentumEqualsNodeMomentum)
+{
+    // Given
+
+    const std::array<std::span<TypeParam>, 2> momenta{this->momentumX, this->momentumY};
+
+    // When
+
+    computeMomentum(this->d2q5Lattice, momenta);
+
+    // Then
+
+    for (std::size_t node = 0; node < this->d2q5Lattice.nodeCount(); ++node)
+    {
+        const std::array<TypeParam, 2> expected{computeMomentum(this->d2q5Lattice.node(node))};
+        EXPECT_EQ(this->momentumX[node], expected[0]);
+        EXPECT_EQ(this->momentumY[node], expected[1]);
+    }
+}
+
+TYPED_TEST(LatticeMomentsTest, D2Q9BatchedMomentumEqualsNodeMomentum)
+{
+    // Given
+
+    const std::array<std::span<TypeParam>, 2> momenta{this->momentumX, this->momentumY};
+
+    // When
+
+    computeMomentum(this->d2q9Lattice, momenta);
+
+    // Then
+
+    for (std::size_t node = 0; node < this->d2q9Lattice.nodeCount(); ++node)
+    {
+        const std::array<TypeParam, 2> expected{computeMomentum(this->d2q9Lattice.node(node))};
+        EXPECT_EQ(this->momentumX[node], expected[0]);
+        EXPECT_EQ(this->momentumY[node], expected[1]);
+    }
+}
+
+TYPED_TEST(LatticeMomentsTest, D2Q9FusedMomentsEqualNodeMoments)
+{
+    // Given
+
+    const std::array<std::span<TypeParam>, 2> momenta{this->momentumX, this->momentumY};
+
+    // When
+
+    computeMoments(this->d2q9Lattice, std::span<TypeParam>{this->densities}, momenta);
+
+    // Then
+
+    for (std::size_t node = 0; node < this->d2q9Lattice.nodeCount(); ++node)
+    {
+        const D2Q9<TypeParam> distribution{this->d2q9Lattice.node(node)};
+        const std::array<TypeParam, 2> expected{computeMomentum(distribution)};
+        EXPECT_EQ(this->densities[node], computeDensity(distribution));
+        EXPECT_EQ(this->momentumX[node], expected[0]);
+        EXPECT_EQ(this->momentumY[node], expected[1]);
+    }
+}
+
+TYPED_TEST(LatticeMomentsTest, D2Q5FusedMomentsEqualNodeMoments)
+{
+    // Given
+
+    const std::array<std::span<TypeParam>, 2> momenta{this->momentumX, this->momentumY};
+
+    // When
+
+    computeMoments(this->d2q5Lattice, std::span<TypeParam>{this->densities}, momenta);
+
+    // Then
+
+    for (std::size_t node = 0; node < this->d2q5Lattice.nodeCount(); ++node)
+    {
+        const D2Q5<TypeParam> distribution{this->d2q5Lattice.node(node)};
+        const std::array<TypeParam, 2> expected{computeMomentum(distribution)};
+        EXPECT_EQ(this->densities[node], computeDensity(distribution));
+        EXPECT_EQ(this->momentumX[node], expected[0]);
+        EXPECT_EQ(this->momentumY[node], expected[1]);
+    }
+}
+
+TYPED_TEST(LatticeMomentsTest, D3Q19FusedMomentsEqualNodeMoments)
+{
+    // Given
+
+    Lattice<3, 19, TypeParam> lattice{{7, 3, 5}};
+    fillLattice(lattice, population<TypeParam>);
+    std::vector<TypeParam> densities(lattice.nodeCount());
+    std::vector<TypeParam> momentumX(lattice.nodeCount());
+    std::vector<TypeParam> momentumY(lattice.nodeCount());
+    std::vector<TypeParam> momentumZ(lattice.nodeCount());
+    const std::array<std::span<TypeParam>, 3> momenta{momentumX, momentumY, momentumZ};
+
+    // When
+
+    computeMoments(lattice, std::span<TypeParam>{densities}, momenta);
+
+    // Then
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const D3Q19<TypeParam> distribution{lattice.node(node)};
+        const std::array<TypeParam, 3> momentum{computeMomentum(distribution)};
+        EXPECT_EQ(densities[node], computeDensity(distribution));
+        EXPECT_EQ(momentumX[node], momentum[0]);
+        EXPECT_EQ(momentumY[node], momentum[1]);
+        EXPECT_EQ(momentumZ[node], momentum[2]);
+    }
+}
+
+TYPED_TEST(LatticeMomentsTest, D3Q27BatchedMomentsEqualNodeMoments)
+{
+    // Given
+
+    Lattice<3, 27, TypeParam> lattice{{7, 3, 5}};
+    fillLattice(lattice, population<TypeParam>);
+    std::vector<TypeParam> densities(lattice.nodeCount());
+    std::vector<TypeParam> momentumX(lattice.nodeCount());
+    std::vector<TypeParam> momentumY(lattice.nodeCount());
+    std::vector<TypeParam> momentumZ(lattice.nodeCount());
+    const std::array<std::span<TypeParam>, 3> momenta{momentumX, momentumY, momentumZ};
+
+    // When
+
+    computeDensity(lattice, std::span<TypeParam>{densities});
+    computeMomentum(lattice, momenta);
+
+    // Then
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const D3Q27<TypeParam> distribution{lattice.node(node)};
+        const std::array<TypeParam, 3> momentum{computeMomentum(distribution)};
+        EXPECT_EQ(densities[node], computeDensity(distribution));
+        EXPECT_EQ(momentumX[node], momentum[0]);
+        EXPECT_EQ(momentumY[node], momentum[1]);
+        EXPECT_EQ(momentumZ[node], momentum[2]);
+    }
+}
+
+TYPED_TEST(LatticeMomentsTest, ThrowsIfOutputSizeDiffersFromNodeCount)
+{
+    // Given
+
+    const std::span<TypeParam> shortDensities{std::span<TypeParam>{this->densities}.first(1)};
+    const std::array<std::span<TypeParam>, 2> shortMomenta{
+        std::span<TypeParam>{this->momentumX}.first(1), this->momentumY
+    };
+
+    // When / Then
+
+    EXPECT_THROW(computeDensity(this->d2q9Lattice, shortDensities), std::length_error);
+    EXPECT_THROW(computeMomentum(this->d2q9Lattice, shortMomenta), std::length_error);
+    EXPECT_THROW(
+        computeMoments(this->d2q9Lattice, std::span<TypeParam>{this->densities}, shortMomenta),
+        std::length_error
+    );
+}
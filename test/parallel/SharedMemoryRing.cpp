@@ -0,0 +1,86 @@
+#include "../../src/parallel/SharedMemoryRing.hpp"
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace
+{
+
+/**
+ * Returns a shared memory name that is unique to this process and test.
+ */
+auto ringName(const std::string& test) -> std::string
+{
+    return "/latticeflow-test-" + std::to_string(::getpid()) + "-" + test;
+}
+
+} // namespace
+
+TEST(SharedMemoryRingTest, MessagesArriveInOrderAcrossWrapAround)
+{
+    // Given
+
+    const std::string name{ringName("order")};
+    SharedMemoryRing producer{name, 100};
+    SharedMemoryRing consumer{name};
+    constexpr std::size_t messageCount{1000};
+
+    // When
+
+    std::vector<int> received(messageCount * 7);
+    std::thread receiver{[&] {
+        for (std::size_t message = 0; message < messageCount; ++message)
+        {
+            consumer.receive(std::as_writable_bytes(std::span{received}.subspan(message * 7, 7)));
+        }
+    }};
+    std::vector<int> sent(messageCount * 7);
+    std::iota(sent.begin(), sent.end(), 0);
+    for (std::size_t message = 0; message < messageCount; ++message)
+    {
+        producer.send(std::as_bytes(std::span{sent}.subspan(message * 7, 7)));
+    }
+    receiver.join();
+
+    // Then
+
+    EXPECT_EQ(consumer.capacity(), 100);
+    EXPECT_EQ(received, sent);
+}
+
+TEST(SharedMemoryRingTest, OversizedMessageThrows)
+{
+    // Given
+
+    SharedMemoryRing ring{ringName("oversized"), 16};
+    const std::array<std::byte, 17> message{};
+
+    // When
+
+    // Then
+
+    EXPECT_THROW(ring.send(message), std::invalid_argument);
+}
+
+TEST(SharedMemoryRingTest, CreatorRemovesName)
+{
+    // Given
+
+    const std::string name{ringName("remove")};
+
+    // When
+
+    {
+        const SharedMemoryRing ring{name, 64};
+        EXPECT_THROW((SharedMemoryRing{name, 64}), std::system_error);
+    }
+
+    // Then
+
+    EXPECT_THROW(SharedMemoryRing{name}, std::system_error);
+}
@@ -0,0 +1,334 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/lattice/Arena.hpp"
+#include "../../src/parallel/Subdomain.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+
+constexpr std::size_t stepCount{20};
+constexpr std::size_t ringMessages{4};
+
+/**
+ * Returns a distinct non-equilibrium density distribution for every node.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto initialNode(std::size_t node) -> DensityDistribution<2, Descriptor.velocities.size(), Scalar>
+{
+    DensityDistribution<2, Descriptor.velocities.size(), Scalar> distribution;
+    for (std::size_t i = 0; i < Descriptor.velocities.size(); ++i)
+    {
+        const auto offset{static_cast<Scalar>((7 * node + 3 * i) % 13) / Scalar{50.0}};
+        distribution[i] = static_cast<Scalar>(Descriptor.weights[i]) * (Scalar{1.0} + offset);
+    }
+    return distribution;
+}
+
+/**
+ * Runs one rank of a decomposed lattice and stores its owned populations into the natural layout
+ * of the whole lattice, one array per lattice vector.
+ */
+template <const auto& Descriptor, typename Scalar>
+auto runRank(
+    const std::string& prefix,
+    const std::array<std::size_t, 2>& extents,
+    std::size_t rank,
+    std::size_t rankCount,
+    std::span<Scalar> result
+) -> void
+{
+    constexpr std::size_t size{Descriptor.velocities.size()};
+    const Scalar relaxationFrequency{1.3};
+    const Lattice<2, size, Scalar> global{extents};
+    SharedMemoryTransport transport{prefix, rank, rankCount};
+    Subdomain<2, size, Scalar, SharedMemoryTransport> subdomain{
+        extents, Descriptor.velocities, Descriptor.opposites, rank, rankCount, transport
+    };
+
+    const std::size_t lastLayer{subdomain.firstLayer() + subdomain.layerCount()};
+    for (std::size_t y = subdomain.firstLayer(); y < lastLayer; ++y)
+    {
+        for (std::size_t x = 0; x < extents[0]; ++x)
+        {
+            subdomain.setNode({x, y}, initialNode<Descriptor, Scalar>(global.linearIndex({x, y})));
+        }
+    }
+
+    for (std::size_t timeStep = 0; timeStep < stepCount; ++timeStep)
+    {
+        subdomain.step(timeStep, [&](std::array<Scalar, size>& values) {
+            relaxBGK<Descriptor>(values, relaxationFrequency);
+        });
+    }
+    subdomain.synchronize();
+
+    for (std::size_t y = subdomain.firstLayer(); y < lastLayer; ++y)
+    {
+        for (std::size_t x = 0; x < extents[0]; ++x)
+        {
+            const auto distribution{subdomain.node({x, y})};
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                result[i * global.nodeCount() + global.linearIndex({x, y})] = distribution[i];
+            }
+        }
+    }
+}
+
+/**
+ * Runs the whole lattice in one piece and returns its populations, one array per lattice vector.
+ */
+template <const auto& Descriptor, typename Scalar>
+auto runReference(const std::array<std::size_t, 2>& extents) -> std::vector<Scalar>
+{
+    constexpr std::size_t size{Descriptor.velocities.size()};
+    const Scalar relaxationFrequency{1.3};
+    Lattice<2, size, Scalar> lattice{extents};
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        lattice.setNode(node, initialNode<Descriptor, Scalar>(node));
+    }
+    for (std::size_t timeStep = 0; timeStep < stepCount; ++timeStep)
+    {
+        streamAA(
+            lattice,
+            Descriptor.velocities,
+            Descriptor.opposites,
+            timeStep,
+            [&](std::array<Scalar, size>& values) {
+                relaxBGK<Descriptor>(values, relaxationFrequency);
+            }
+        );
+    }
+
+    std::vector<Scalar> result(size * lattice.nodeCount());
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        std::ranges::copy(lattice.population(i), result.begin() + i * lattice.nodeCount());
+    }
+    return result;
+}
+
+/**
+ * Returns a shared memory name prefix that is unique to this process and test.
+ */
+auto ringPrefix(const std::string& test) -> std::string
+{
+    return "/latticeflow-test-" + std::to_string(::getpid()) + "-" + test;
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class SubdomainTest : public ::testing::Test
+{
+protected:
+    /**
+     * Runs every rank on its own thread and returns the combined populations.
+     */
+    template <const auto& Descriptor>
+    auto runThreads(const std::string& test, std::size_t rankCount) -> std::vector<Scalar>
+    {
+        const std::string prefix{ringPrefix(test)};
+        const auto rings{SharedMemoryTransport::createRings(
+            prefix, rankCount, ringMessages * 3 * extents[0] * sizeof(Scalar)
+        )};
+        constexpr std::size_t size{Descriptor.velocities.size()};
+        std::vector<Scalar> result(size * extents[0] * extents[1]);
+
+        std::vector<std::thread> threads;
+        for (std::size_t rank = 0; rank < rankCount; ++rank)
+        {
+            threads.emplace_back([&, rank] {
+                runRank<Descriptor, Scalar>(prefix, extents, rank, rankCount, std::span{result});
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        return result;
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    const std::array<std::size_t, 2> extents{11, 13};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(SubdomainTest, FloatingPointTypes);
+
+TYPED_TEST(SubdomainTest, D2Q9SingleRankEqualsWholeLattice)
+{
+    // Given
+
+    const auto expected{runReference<D2Q9_DESCRIPTOR, TypeParam>(this->extents)};
+
+    // When
+
+    const auto actual{this->template runThreads<D2Q9_DESCRIPTOR>("single", 1)};
+
+    // Then
+
+    EXPECT_EQ(actual, expected);
+}
+
+TYPED_TEST(SubdomainTest, D2Q9ThreadRanksEqualWholeLattice)
+{
+    // Given
+
+    const auto expected{runReference<D2Q9_DESCRIPTOR, TypeParam>(this->extents)};
+
+    // When
+
+    const auto two{this->template runThreads<D2Q9_DESCRIPTOR>("two", 2)};
+    const auto four{this->template runThreads<D2Q9_DESCRIPTOR>("four", 4)};
+
+    // Then
+
+    EXPECT_EQ(two, expected);
+    EXPECT_EQ(four, expected);
+}
+
+TYPED_TEST(SubdomainTest, D2Q5ThreadRanksEqualWholeLattice)
+{
+    // Given
+
+    const auto expected{runReference<D2Q5_DESCRIPTOR, TypeParam>(this->extents)};
+
+    // When
+
+    const auto actual{this->template runThreads<D2Q5_DESCRIPTOR>("d2q5", 3)};
+
+    // Then
+
+    EXPECT_EQ(actual, expected);
+}
+
+TYPED_TEST(SubdomainTest, D2Q9ProcessRanksEqualWholeLattice)
+{
+    // Given
+
+    constexpr std::size_t rankCount{3};
+    const auto expected{runReference<D2Q9_DESCRIPTOR, TypeParam>(this->extents)};
+    const std::string prefix{ringPrefix("processes")};
+    const auto rings{SharedMemoryTransport::createRings(
+        prefix, rankCount, ringMessages * 3 * this->extents[0] * sizeof(TypeParam)
+    )};
+    const std::size_t resultBytes{expected.size() * sizeof(TypeParam)};
+    void* mapping{
+        ::mmap(nullptr, resultBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0)
+    };
+    ASSERT_NE(mapping, MAP_FAILED);
+    const std::span<TypeParam> result{static_cast<TypeParam*>(mapping), expected.size()};
+
+    // When
+
+    std::vector<pid_t> children;
+    for (std::size_t rank = 0; rank < rankCount; ++rank)
+    {
+        const pid_t child{::fork()};
+        if (child == 0)
+        {
+            runRank<D2Q9_DESCRIPTOR, TypeParam>(prefix, this->extents, rank, rankCount, result);
+            ::_exit(0);
+        }
+        children.push_back(child);
+    }
+    for (const pid_t child : children)
+    {
+        int status{0};
+        ::waitpid(child, &status, 0);
+        EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+
+    // Then
+
+    EXPECT_TRUE(std::ranges::equal(result, expected));
+    ::munmap(mapping, resultBytes);
+}
+
+TYPED_TEST(SubdomainTest, TooThinSlabsThrow)
+{
+    // Given
+
+    const std::string prefix{ringPrefix("thin")};
+    const auto rings{SharedMemoryTransport::createRings(prefix, 7, 64)};
+    SharedMemoryTransport transport{prefix, 0, 7};
+    constexpr D2Q9<TypeParam> model;
+
+    // When
+
+    // Then
+
+    EXPECT_THROW(
+        (Subdomain<2, 9, TypeParam, SharedMemoryTransport>{
+            this->extents, latticeVelocities(model), latticeOpposites(model), 6, 7, transport
+        }),
+        std::invalid_argument
+    );
+    EXPECT_THROW(
+        (Subdomain<2, 9, TypeParam, SharedMemoryTransport>{
+            this->extents, latticeVelocities(model), latticeOpposites(model), 7, 7, transport
+        }),
+        std::invalid_argument
+    );
+}
+
+TYPED_TEST(SubdomainTest, HaloExchangeIsRecordedAsCommunication)
+{
+    // Given
+
+    PhaseRecorder::clear();
+
+    // When
+
+    this->template runThreads<D2Q9_DESCRIPTOR>("phases", 2);
+    const auto summary{PhaseRecorder::summary()};
+
+    // Then
+
+    EXPECT_GT(summary[static_cast<std::size_t>(Phase::Communication)].calls, 0);
+    EXPECT_EQ(summary[static_cast<std::size_t>(Phase::Boundary)].calls, 0);
+}
+
+TYPED_TEST(SubdomainTest, PopulationsAndHaloBufferShareMemoryResource)
+{
+    // Given
+
+    const std::string prefix{ringPrefix("arena")};
+    const auto rings{SharedMemoryTransport::createRings(prefix, 2, 64)};
+    SharedMemoryTransport transport{prefix, 0, 2};
+    constexpr D2Q9<TypeParam> model;
+    Arena latticeArena;
+    Arena subdomainArena;
+
+    // When
+
+    const Subdomain<2, 9, TypeParam, SharedMemoryTransport> subdomain{
+        this->extents,
+        latticeVelocities(model),
+        latticeOpposites(model),
+        0,
+        2,
+        transport,
+        &subdomainArena
+    };
+    const Lattice<2, 9, TypeParam> lattice{subdomain.lattice().extents(), &latticeArena};
+
+    // Then
+
+    EXPECT_GE(
+        subdomainArena.bytesAllocated(), latticeArena.bytesAllocated() + subdomain.messageBytes()
+    );
+}
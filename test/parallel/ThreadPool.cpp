@@ -0,0 +1,268 @@
+#include "../../src/parallel/ThreadPool.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+class ThreadPoolTest : public ::testing::TestWithParam<std::size_t>
+{
+protected:
+    ThreadPoolTest() : pool{GetParam(), ThreadPinning::None} {}
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    ThreadPool pool;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+INSTANTIATE_TEST_SUITE_P(ThreadCounts, ThreadPoolTest, ::testing::Values(1, 2, 3, 8));
+
+TEST_P(ThreadPoolTest, ThreadCountEqualsRequestedCount)
+{
+    // Given
+
+    const std::size_t expectedThreadCount{GetParam()};
+
+    // When
+
+    // Then
+
+    EXPECT_EQ(this->pool.threadCount(), expectedThreadCount);
+}
+
+TEST_P(ThreadPoolTest, RunExecutesEveryTaskOnce)
+{
+    // Given
+
+    const std::size_t taskCount{1000};
+    std::vector<std::atomic<std::size_t>> executions(taskCount);
+
+    // When
+
+    for (std::size_t batch = 0; batch < 3; ++batch)
+    {
+        this->pool.run(taskCount, [&](std::size_t task) { ++executions[task]; });
+    }
+
+    // Then
+
+    for (const auto& count : executions)
+    {
+        EXPECT_EQ(count.load(), 3);
+    }
+}
+
+TEST_P(ThreadPoolTest, RunWithoutStealingExecutesTasksOnOwner)
+{
+    // Given
+
+    const std::size_t taskCount{37};
+    std::vector<std::thread::id> firstThreads(taskCount);
+    std::vector<std::thread::id> secondThreads(taskCount);
+
+    // When
+
+    const bool stealing{false};
+    this->pool.run(
+        taskCount,
+        [&](std::size_t task) { firstThreads[task] = std::this_thread::get_id(); },
+        stealing
+    );
+    this->pool.run(
+        taskCount,
+        [&](std::size_t task) { secondThreads[task] = std::this_thread::get_id(); },
+        stealing
+    );
+
+    // Then
+
+    for (std::size_t task = 0; task < taskCount; ++task)
+    {
+        EXPECT_EQ(firstThreads[task], secondThreads[task]);
+        const bool ownerIsCaller{this->pool.owner(task, taskCount) == 0};
+        EXPECT_EQ(firstThreads[task] == std::this_thread::get_id(), ownerIsCaller);
+    }
+}
+
+TEST_P(ThreadPoolTest, OwnersReceiveContiguousBlocks)
+{
+    // Given
+
+    const std::size_t taskCount{37};
+
+    // When
+
+    // Then
+
+    EXPECT_EQ(this->pool.owner(0, taskCount), 0);
+    EXPECT_EQ(this->pool.owner(taskCount - 1, taskCount), this->pool.threadCount() - 1);
+    for (std::size_t task = 1; task < taskCount; ++task)
+    {
+        const std::size_t step{
+            this->pool.owner(task, taskCount) - this->pool.owner(task - 1, taskCount)
+        };
+        EXPECT_LE(step, 1);
+    }
+}
+
+TEST_P(ThreadPoolTest, RunRethrowsTaskException)
+{
+    // Given
+
+    const std::size_t taskCount{16};
+    std::atomic<std::size_t> executions{0};
+
+    // When
+
+    const auto run{[&] {
+        this->pool.run(taskCount, [&](std::size_t task) {
+            ++executions;
+            if (task == 5)
+            {
+                throw std::runtime_error{"task failed"};
+            }
+        });
+    }};
+
+    // Then
+
+    EXPECT_THROW(run(), std::runtime_error);
+    EXPECT_EQ(executions.load(), taskCount);
+}
+
+#ifdef __linux__
+namespace
+{
+
+auto firstAllowedCpu(const cpu_set_t& allowed) -> int
+{
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+        if (CPU_ISSET(cpu, &allowed))
+        {
+            return cpu;
+        }
+    }
+    return -1;
+}
+
+auto workerCpus(ThreadPool& pool) -> std::set<int>
+{
+    std::mutex mutex;
+    std::set<int> cpus;
+
+    pool.run(
+        pool.threadCount(),
+        [&](std::size_t worker) {
+            cpu_set_t affinity;
+            if (worker == 0 ||
+                pthread_getaffinity_np(pthread_self(), sizeof(affinity), &affinity) != 0)
+            {
+                return;
+            }
+            const std::scoped_lock lock{mutex};
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            {
+                if (CPU_ISSET(cpu, &affinity))
+                {
+                    cpus.insert(cpu);
+                }
+            }
+        },
+        false
+    );
+
+    return cpus;
+}
+
+} // namespace
+
+TEST(ThreadPoolPinningTest, PinsCallerToFirstAllowedCpuAndRestoresItsAffinity)
+{
+    // Given
+
+    cpu_set_t original;
+    ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(original), &original), 0);
+    cpu_set_t pinned;
+    cpu_set_t restored;
+
+    // When
+
+    {
+        const ThreadPool pool{2, ThreadPinning::WorkersAndCaller};
+        if (!pool.pinned())
+        {
+            GTEST_SKIP() << "threads cannot be pinned in this environment";
+        }
+        ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(pinned), &pinned), 0);
+    }
+    ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(restored), &restored), 0);
+
+    // Then
+
+    EXPECT_EQ(CPU_COUNT(&pinned), 1);
+    EXPECT_TRUE(CPU_ISSET(firstAllowedCpu(original), &pinned));
+    EXPECT_TRUE(CPU_EQUAL(&restored, &original));
+}
+
+TEST(ThreadPoolPinningTest, PinningWorkersLeavesCallerAffinityAlone)
+{
+    // Given
+
+    cpu_set_t original;
+    ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(original), &original), 0);
+    cpu_set_t during;
+
+    // When
+
+    {
+        const ThreadPool pool{2, ThreadPinning::Workers};
+        ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(during), &during), 0);
+    }
+
+    // Then
+
+    EXPECT_TRUE(CPU_EQUAL(&during, &original));
+}
+TEST(ThreadPoolPinningTest, PoolsDestroyedOutOfOrderKeepDistinctCpus)
+{
+    // Given
+
+    constexpr std::size_t threadCount{3};
+    cpu_set_t allowed;
+    ASSERT_EQ(pthread_getaffinity_np(pthread_self(), sizeof(allowed), &allowed), 0);
+    if (CPU_COUNT(&allowed) < static_cast<int>(3 * threadCount))
+    {
+        GTEST_SKIP() << "too few CPUs to pin three pools apart";
+    }
+
+    auto first{std::make_unique<ThreadPool>(threadCount, ThreadPinning::Workers)};
+    ThreadPool second{threadCount, ThreadPinning::Workers};
+    if (!first->pinned() || !second.pinned())
+    {
+        GTEST_SKIP() << "threads cannot be pinned in this environment";
+    }
+
+    // When
+
+    first.reset();
+    ThreadPool third{threadCount, ThreadPinning::Workers};
+    const std::set<int> secondCpus{workerCpus(second)};
+    const std::set<int> thirdCpus{workerCpus(third)};
+
+    // Then
+
+    ASSERT_TRUE(third.pinned());
+    EXPECT_EQ(secondCpus.size(), threadCount - 1);
+    EXPECT_EQ(thirdCpus.size(), threadCount - 1);
+    for (const int cpu : thirdCpus)
+    {
+        EXPECT_FALSE(secondCpus.contains(cpu));
+    }
+}
+#endif
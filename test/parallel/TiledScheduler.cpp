@@ -0,0 +1,75 @@
+#include "../../src/lattice/Lattice.hpp"
+#include "../../src/parallel/TiledScheduler.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class TiledSchedulerTest : public ::testing::Test
+{
+private:
+    static constexpr std::array<std::size_t, 2> extents_{13, 11};
+    static constexpr std::array<std::size_t, 2> tileExtents_{13, 2};
+    static constexpr std::size_t threadCount_{3};
+
+protected:
+    TiledSchedulerTest() : scheduler{extents_, tileExtents_, threadCount_} {}
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    TiledScheduler<2> scheduler;
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(TiledSchedulerTest, FloatingPointTypes);
+
+TYPED_TEST(TiledSchedulerTest, ForEachTileVisitsEveryTileOnce)
+{
+    // Given
+
+    std::vector<std::atomic<std::size_t>> visits(13 * 11);
+
+    // When
+
+    const auto visitRow{[&](std::size_t firstNode, std::size_t lastNode) {
+        for (std::size_t node = firstNode; node < lastNode; ++node)
+        {
+            ++visits[node];
+        }
+    }};
+    this->scheduler.forEachTile([&](const LatticeTile<2>& tile) {
+        forEachRow(tile, this->scheduler.extents(), visitRow);
+    });
+
+    // Then
+
+    EXPECT_EQ(this->scheduler.tiles().size(), 6);
+    EXPECT_EQ(this->scheduler.threadCount(), 3);
+    for (const auto& count : visits)
+    {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TYPED_TEST(TiledSchedulerTest, FirstTouchLatticeStartsWithZeros)
+{
+    // Given
+
+    Lattice<2, 9, TypeParam> expected{this->scheduler.extents()};
+
+    // When
+
+    const Lattice<2, 9, TypeParam> lattice{
+        this->scheduler.extents(), [&](const auto& zero) { this->scheduler.firstTouch(zero); }
+    };
+
+    // Then
+
+    for (std::size_t i = 0; i < lattice.size(); ++i)
+    {
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            EXPECT_EQ(lattice.population(i)[node], expected.population(i)[node]);
+        }
+    }
+}
@@ -0,0 +1,207 @@
+#include "../../src/precision/StorageFormat.hpp"
+#include <bit>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+TEST(StorageFormatTest, Float16RoundTripPreservesEveryBitPattern)
+{
+    // Given
+
+    constexpr std::uint32_t patternCount{1U << 16U};
+
+    // When
+
+    // Then
+
+    for (std::uint32_t pattern = 0; pattern < patternCount; ++pattern)
+    {
+        const auto bits{static_cast<std::uint16_t>(pattern)};
+        const float value{decodeFloat16(bits)};
+        if (std::isnan(value))
+        {
+            EXPECT_TRUE(std::isnan(decodeFloat16(encodeFloat16(value))));
+        }
+        else
+        {
+            EXPECT_EQ(encodeFloat16(value), bits);
+        }
+    }
+}
+
+TEST(StorageFormatTest, Float16EncodesKnownValues)
+{
+    // Given
+
+    const float one{1.0F};
+    const float largest{65504.0F};
+    const float smallestSubnormal{0x1p-24F};
+    const float third{1.0F / 3.0F};
+
+    // When
+
+    // Then
+
+    EXPECT_EQ(encodeFloat16(one), 0x3C00U);
+    EXPECT_EQ(encodeFloat16(-one), 0xBC00U);
+    EXPECT_EQ(encodeFloat16(largest), 0x7BFFU);
+    EXPECT_EQ(encodeFloat16(smallestSubnormal), 0x0001U);
+    EXPECT_EQ(encodeFloat16(third), 0x3555U);
+    EXPECT_EQ(encodeFloat16(0.0F), 0x0000U);
+    EXPECT_EQ(encodeFloat16(-0.0F), 0x8000U);
+}
+
+TEST(StorageFormatTest, Float16RoundsTiesToEven)
+{
+    // Given
+
+    const float belowTie{std::nextafter(1.0F + 0x1p-11F, 0.0F)};
+    const float tieToEvenBelow{1.0F + 0x1p-11F};
+    const float tieToEvenAbove{1.0F + 3.0F * 0x1p-11F};
+    const float subnormalTie{0x1p-25F};
+
+    // When
+
+    // Then
+
+    EXPECT_EQ(encodeFloat16(belowTie), 0x3C00U);
+    EXPECT_EQ(encodeFloat16(tieToEvenBelow), 0x3C00U);
+    EXPECT_EQ(encodeFloat16(tieToEvenAbove), 0x3C02U);
+    EXPECT_EQ(encodeFloat16(subnormalTie), 0x0000U);
+    EXPECT_EQ(encodeFloat16(std::nextafter(subnormalTie, 1.0F)), 0x0001U);
+}
+
+TEST(StorageFormatTest, Float16OverflowsToInfinityAndKeepsNaN)
+{
+    // Given
+
+    const float justBelowOverflow{std::nextafter(65520.0F, 0.0F)};
+    const float overflow{65520.0F};
+    const float nan{std::numeric_limits<float>::quiet_NaN()};
+
+    // When
+
+    // Then
+
+    EXPECT_EQ(encodeFloat16(justBelowOverflow), 0x7BFFU);
+    EXPECT_EQ(encodeFloat16(overflow), 0x7C00U);
+    EXPECT_EQ(encodeFloat16(-std::numeric_limits<float>::infinity()), 0xFC00U);
+    EXPECT_TRUE(std::isnan(decodeFloat16(encodeFloat16(nan))));
+}
+
+TEST(StorageFormatTest, Float16ConstantEvaluationMatchesRunTimeConversion)
+{
+    // Given
+
+    constexpr float third{1.0F / 3.0F};
+    constexpr float subnormal{3.0F * 0x1p-24F};
+    constexpr float tie{1.0F + 3.0F * 0x1p-11F};
+
+    // When
+
+    constexpr std::uint16_t thirdBits{encodeFloat16(third)};
+    constexpr std::uint16_t subnormalBits{encodeFloat16(subnormal)};
+    constexpr std::uint16_t tieBits{encodeFloat16(tie)};
+    constexpr float decodedThird{decodeFloat16(thirdBits)};
+    constexpr float decodedSubnormal{decodeFloat16(subnormalBits)};
+
+    // Then
+
+    EXPECT_EQ(thirdBits, encodeFloat16(third));
+    EXPECT_EQ(subnormalBits, encodeFloat16(subnormal));
+    EXPECT_EQ(tieBits, encodeFloat16(tie));
+    EXPECT_EQ(decodedThird, decodeFloat16(thirdBits));
+    EXPECT_EQ(decodedSubnormal, subnormal);
+}
+
+TEST(StorageFormatTest, Float16RunConversionsMatchElementWiseConversions)
+{
+    // Given
+
+    constexpr std::size_t valueCount{37};
+    std::vector<float> values(valueCount);
+    for (std::size_t index = 0; index < valueCount; ++index)
+    {
+        values[index] = (static_cast<float>(index) - 18.0F) / 7.0F;
+    }
+    std::vector<std::uint16_t> bits(valueCount);
+    std::vector<float> decoded(valueCount);
+
+    // When
+
+    encodeFloat16(std::span<const float>{values}, std::span<std::uint16_t>{bits});
+    decodeFloat16(std::span<const std::uint16_t>{bits}, std::span<float>{decoded});
+
+    // Then
+
+    for (std::size_t index = 0; index < valueCount; ++index)
+    {
+        EXPECT_EQ(bits[index], encodeFloat16(values[index]));
+        EXPECT_EQ(decoded[index], decodeFloat16(bits[index]));
+    }
+}
+
+TEST(StorageFormatTest, BFloat16RoundTripPreservesEveryBitPattern)
+{
+    // Given
+
+    constexpr std::uint32_t patternCount{1U << 16U};
+
+    // When
+
+    // Then
+
+    for (std::uint32_t pattern = 0; pattern < patternCount; ++pattern)
+    {
+        const auto bits{static_cast<std::uint16_t>(pattern)};
+        const float value{decodeBFloat16(bits)};
+        if (std::isnan(value))
+        {
+            EXPECT_TRUE(std::isnan(decodeBFloat16(encodeBFloat16(value))));
+        }
+        else
+        {
+            EXPECT_EQ(encodeBFloat16(value), bits);
+        }
+    }
+}
+
+TEST(StorageFormatTest, BFloat16RoundsTiesToEven)
+{
+    // Given
+
+    const float tieToEvenBelow{std::bit_cast<float>(0x3F808000U)};
+    const float tieToEvenAbove{std::bit_cast<float>(0x3F818000U)};
+    const float aboveTie{std::bit_cast<float>(0x3F808001U)};
+
+    // When
+
+    // Then
+
+    EXPECT_EQ(encodeBFloat16(1.0F), 0x3F80U);
+    EXPECT_EQ(encodeBFloat16(tieToEvenBelow), 0x3F80U);
+    EXPECT_EQ(encodeBFloat16(tieToEvenAbove), 0x3F82U);
+    EXPECT_EQ(encodeBFloat16(aboveTie), 0x3F81U);
+}
+
+TEST(StorageFormatTest, FormatsSatisfyConceptAndDeclareShift)
+{
+    // Given
+
+    // When
+
+    // Then
+
+    EXPECT_TRUE(StorageFormat<Float16Storage>);
+    EXPECT_TRUE(StorageFormat<ShiftedFloat16Storage>);
+    EXPECT_TRUE(StorageFormat<BFloat16Storage>);
+    EXPECT_TRUE(StorageFormat<ShiftedFloat32Storage>);
+    EXPECT_FALSE(Float16Storage::SHIFTED);
+    EXPECT_TRUE(ShiftedFloat16Storage::SHIFTED);
+    EXPECT_FALSE(BFloat16Storage::SHIFTED);
+    EXPECT_TRUE(ShiftedFloat32Storage::SHIFTED);
+    EXPECT_EQ(sizeof(Float16Storage::Stored), 2);
+    EXPECT_EQ(sizeof(BFloat16Storage::Stored), 2);
+    EXPECT_EQ(sizeof(ShiftedFloat32Storage::Stored), 4);
+}
@@ -0,0 +1,281 @@
+#include "../../src/refinement/RefinedGrid.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <numbers>
+
+namespace
+{
+
+/**
+ * Returns the equilibrium of a shear wave whose velocity along the first axis varies sinusoidally
+ * along the second axis with the given wave length.
+ */
+template <std::floating_point Scalar>
+auto shearWave(const std::array<Scalar, 2>& position, Scalar amplitude, Scalar waveLength)
+    -> D2Q9<Scalar>
+{
+    const std::array<Scalar, 2> velocity{
+        amplitude *
+            std::sin(Scalar{2.0} * std::numbers::pi_v<Scalar> * position[1] / waveLength),
+        Scalar{0.0}
+    };
+
+    return computeEquilibrium<D2Q9_DESCRIPTOR>(Scalar{1.0}, velocity);
+}
+
+template <std::floating_point Scalar>
+auto flowVelocity(const DensityDistribution<2, D2Q9_SIZE, Scalar>& distribution)
+    -> std::array<Scalar, 2>
+{
+    const Scalar density{computeDensity<D2Q9_DESCRIPTOR>(distribution)};
+    const std::array<Scalar, 2> momentum{computeMomentum<D2Q9_DESCRIPTOR>(distribution)};
+
+    return {momentum[0] / density, momentum[1] / density};
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class RefinedGridTest : public ::testing::Test
+{
+protected:
+    using Grid = RefinedGrid<D2Q9_DESCRIPTOR, Scalar>;
+    using Key = typename Grid::Key;
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    const Scalar relaxationFrequency{1.0};
+    const Scalar tolerance{64 * std::numeric_limits<Scalar>::epsilon()};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(RefinedGridTest, FloatingPointTypes);
+
+TYPED_TEST(RefinedGridTest, RootBlocksCoverDomain)
+{
+    // When
+
+    const typename TestFixture::Grid grid{{2, 3}, this->relaxationFrequency};
+
+    // Then
+
+    EXPECT_EQ(grid.blockCount(), 6);
+    EXPECT_EQ(grid.nodeCount(), 6 * REFINED_BLOCK_EXTENT * REFINED_BLOCK_EXTENT);
+    EXPECT_EQ(grid.finestLevel(), 0);
+    EXPECT_TRUE(grid.isLeaf({0, {1, 2}}));
+}
+
+TYPED_TEST(RefinedGridTest, RefineAndCoarsenReplaceBlocks)
+{
+    // Given
+
+    typename TestFixture::Grid grid{{2, 2}, this->relaxationFrequency};
+
+    // When
+
+    grid.refine({0, {1, 0}});
+
+    // Then
+
+    EXPECT_EQ(grid.blockCount(), 7);
+    EXPECT_EQ(grid.finestLevel(), 1);
+    EXPECT_FALSE(grid.isLeaf({0, {1, 0}}));
+    EXPECT_TRUE(grid.isLeaf({1, {2, 0}}));
+    EXPECT_TRUE(grid.isLeaf({1, {3, 1}}));
+
+    // When
+
+    grid.coarsen({0, {1, 0}});
+
+    // Then
+
+    EXPECT_EQ(grid.blockCount(), 4);
+    EXPECT_EQ(grid.finestLevel(), 0);
+    EXPECT_TRUE(grid.isLeaf({0, {1, 0}}));
+}
+
+TYPED_TEST(RefinedGridTest, RelaxationFrequencyKeepsViscosityAcrossLevels)
+{
+    // Given
+
+    const typename TestFixture::Grid grid{{1, 1}, this->relaxationFrequency};
+
+    // Then
+
+    EXPECT_NEAR(grid.relaxationFrequency(0), TypeParam{1.0}, this->tolerance);
+    EXPECT_NEAR(grid.relaxationFrequency(1), TypeParam{2.0} / 3, this->tolerance);
+    EXPECT_NEAR(grid.relaxationFrequency(2), TypeParam{0.4}, this->tolerance);
+}
+
+TYPED_TEST(RefinedGridTest, UnrefinedGridEqualsUniformLattice)
+{
+    // Given
+
+    const std::size_t extent{2 * REFINED_BLOCK_EXTENT};
+    const TypeParam amplitude{0.05};
+    typename TestFixture::Grid grid{{2, 2}, TypeParam{1.3}};
+    grid.initialize([&](const std::array<TypeParam, 2>& position) {
+        return shearWave(position, amplitude, TypeParam{extent});
+    });
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> lattice{{extent, extent}};
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const std::array<TypeParam, 2> position{
+            static_cast<TypeParam>(node % extent) + TypeParam{0.5},
+            static_cast<TypeParam>(node / extent) + TypeParam{0.5}
+        };
+        lattice.setNode(node, shearWave(position, amplitude, TypeParam{extent}));
+    }
+    const std::size_t steps{6};
+
+    // When
+
+    for (std::size_t step = 0; step < steps; ++step)
+    {
+        grid.advance();
+        streamAA(lattice, step, [&](std::array<TypeParam, D2Q9_SIZE>& values) {
+            relaxBGK<D2Q9_DESCRIPTOR>(values, TypeParam{1.3});
+        });
+    }
+
+    // Then
+
+    for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+    {
+        const std::array<TypeParam, 2> position{
+            static_cast<TypeParam>(node % extent) + TypeParam{0.5},
+            static_cast<TypeParam>(node / extent) + TypeParam{0.5}
+        };
+        const D2Q9<TypeParam> expected{gatherAA(lattice, node, steps)};
+        const auto actual{grid.node(position)};
+        for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+        {
+            EXPECT_NEAR(actual[i], expected[i], this->tolerance);
+        }
+    }
+}
+
+TYPED_TEST(RefinedGridTest, UniformFlowAroundObstacleAtRestStaysAtRest)
+{
+    // Given
+
+    typename TestFixture::Grid grid{{3, 2}, this->relaxationFrequency};
+    grid.refine({0, {1, 0}});
+    grid.setSolid([](const std::array<TypeParam, 2>& position) {
+        const TypeParam x{position[0] - TypeParam{24.0}};
+        const TypeParam y{position[1] - TypeParam{8.0}};
+        return x * x + y * y < TypeParam{9.0};
+    });
+    grid.initialize(TypeParam{1.0}, {TypeParam{0.0}, TypeParam{0.0}});
+    const D2Q9<TypeParam> rest{
+        computeEquilibrium<D2Q9_DESCRIPTOR>(TypeParam{1.0}, std::array<TypeParam, 2>{})
+    };
+
+    // When
+
+    for (std::size_t step = 0; step < 5; ++step)
+    {
+        grid.advance();
+    }
+
+    // Then
+
+    for (const TypeParam x : {TypeParam{3.3}, TypeParam{18.2}, TypeParam{29.9}, TypeParam{40.1}})
+    {
+        for (const TypeParam y : {TypeParam{0.2}, TypeParam{15.4}, TypeParam{27.7}})
+        {
+            const auto distribution{grid.node({x, y})};
+            for (std::size_t i = 0; i < D2Q9_SIZE; ++i)
+            {
+                EXPECT_NEAR(distribution[i], rest[i], this->tolerance);
+            }
+        }
+    }
+}
+
+TYPED_TEST(RefinedGridTest, UniformFlowCrossesLevelInterfaces)
+{
+    // Given
+
+    typename TestFixture::Grid grid{{3, 3}, this->relaxationFrequency};
+    grid.refine({0, {1, 1}});
+    const std::array<TypeParam, 2> velocity{0.05, -0.02};
+    grid.initialize(TypeParam{1.0}, velocity);
+
+    // When
+
+    for (std::size_t step = 0; step < 8; ++step)
+    {
+        grid.advance();
+    }
+
+    // Then
+
+    for (const TypeParam x : {TypeParam{5.5}, TypeParam{16.1}, TypeParam{24.3}, TypeParam{31.9}})
+    {
+        const std::array<TypeParam, 2> actual{flowVelocity(grid.node({x, TypeParam{24.0}}))};
+        EXPECT_NEAR(actual[0], velocity[0], this->tolerance);
+        EXPECT_NEAR(actual[1], velocity[1], this->tolerance);
+    }
+}
+
+TYPED_TEST(RefinedGridTest, ShearWaveDecaysAtOneViscosityAcrossLevels)
+{
+    // Given
+
+    const TypeParam amplitude{0.01};
+    const auto waveLength{static_cast<TypeParam>(4 * REFINED_BLOCK_EXTENT)};
+    typename TestFixture::Grid grid{{1, 4}, this->relaxationFrequency};
+    grid.refine({0, {0, 1}});
+    grid.initialize([&](const std::array<TypeParam, 2>& position) {
+        return shearWave(position, amplitude, waveLength);
+    });
+    const std::size_t steps{100};
+
+    // When
+
+    for (std::size_t step = 0; step < steps; ++step)
+    {
+        grid.advance();
+    }
+
+    // Then
+
+    const TypeParam viscosity{(TypeParam{1.0} / this->relaxationFrequency - TypeParam{0.5}) / 3};
+    const TypeParam wavenumber{TypeParam{2.0} * std::numbers::pi_v<TypeParam> / waveLength};
+    const TypeParam decay{std::exp(-viscosity * wavenumber * wavenumber * steps)};
+    for (const TypeParam y : {TypeParam{4.5}, TypeParam{12.25}, TypeParam{20.75}, TypeParam{28.5}})
+    {
+        const TypeParam expected{amplitude * decay * std::sin(wavenumber * y)};
+        EXPECT_NEAR(flowVelocity(grid.node({TypeParam{7.0}, y}))[0], expected, 0.05 * amplitude);
+    }
+}
+
+TYPED_TEST(RefinedGridTest, InvalidChangesThrow)
+{
+    // Given
+
+    typename TestFixture::Grid grid{{2, 1}, this->relaxationFrequency};
+    grid.refine({0, {0, 0}});
+
+    // Then
+
+    EXPECT_THROW(grid.refine({0, {0, 0}}), std::invalid_argument);
+    EXPECT_THROW(grid.refine({1, {0, 0}}), std::invalid_argument);
+    EXPECT_THROW(grid.coarsen({0, {1, 0}}), std::invalid_argument);
+
+    // When
+
+    grid.refine({0, {1, 0}});
+    grid.refine({1, {1, 0}});
+
+    // Then
+
+    EXPECT_THROW(grid.coarsen({0, {0, 0}}), std::invalid_argument);
+    EXPECT_THROW(grid.coarsen({0, {1, 0}}), std::invalid_argument);
+    EXPECT_THROW(grid.node({TypeParam{-1.0}, TypeParam{0.0}}), std::out_of_range);
+    EXPECT_THROW((typename TestFixture::Grid{{0, 1}, TypeParam{1.0}}), std::invalid_argument);
+    EXPECT_THROW((typename TestFixture::Grid{{1, 1}, TypeParam{2.0}}), std::invalid_argument);
+}
@@ -0,0 +1,119 @@
+#include "../../src/simd/SimdPack.hpp"
+#include <array>
+#include <gtest/gtest.h>
+
+// long double has no vector specialization and exercises the scalar fallback.
+using FloatingPointTypes = ::testing::Types<float, double, long double>;
+
+template <typename Scalar>
+class SimdPackTest : public ::testing::Test
+{
+private:
+    static constexpr std::size_t width_{SimdPack<Scalar>::width};
+
+protected:
+    SimdPackTest()
+    {
+        for (std::size_t i = 0; i < width_; ++i)
+        {
+            lhs.at(i) = static_cast<Scalar>(i + 1) / 3;
+            rhs.at(i) = static_cast<Scalar>(2 * i + 5) / 7;
+        }
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    std::array<Scalar, width_> lhs{};
+    std::array<Scalar, width_> rhs{};
+    std::array<Scalar, width_> result{};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(SimdPackTest, FloatingPointTypes);
+
+TYPED_TEST(SimdPackTest, WidthFitsVectorRegister)
+{
+    // Given
+
+    const std::size_t maximumRegisterSize{64};
+
+    // When
+
+    const std::size_t registerSize{SimdPack<TypeParam>::width * sizeof(TypeParam)};
+
+    // Then
+
+    EXPECT_GE(SimdPack<TypeParam>::width, 1);
+    EXPECT_LE(registerSize, maximumRegisterSize);
+    EXPECT_FALSE(SIMD_INSTRUCTION_SET.empty());
+}
+
+TYPED_TEST(SimdPackTest, DefaultPackEqualsZero)
+{
+    // Given
+
+    const SimdPack<TypeParam> pack;
+
+    // When
+
+    pack.store(this->result.data());
+
+    // Then
+
+    for (const TypeParam value : this->result)
+    {
+        EXPECT_EQ(value, TypeParam{0.0});
+    }
+}
+
+TYPED_TEST(SimdPackTest, StoredPackEqualsLoadedValues)
+{
+    // Given
+
+    const SimdPack<TypeParam> pack{SimdPack<TypeParam>::load(this->lhs.data())};
+
+    // When
+
+    pack.store(this->result.data());
+
+    // Then
+
+    EXPECT_EQ(this->result, this->lhs);
+}
+
+TYPED_TEST(SimdPackTest, AddingPacksAddsElementWise)
+{
+    // Given
+
+    const SimdPack<TypeParam> lhs{SimdPack<TypeParam>::load(this->lhs.data())};
+    const SimdPack<TypeParam> rhs{SimdPack<TypeParam>::load(this->rhs.data())};
+
+    // When
+
+    (lhs + rhs).store(this->result.data());
+
+    // Then
+
+    for (std::size_t i = 0; i < this->result.size(); ++i)
+    {
+        EXPECT_EQ(this->result.at(i), this->lhs.at(i) + this->rhs.at(i));
+    }
+}
+
+TYPED_TEST(SimdPackTest, SubtractingPacksSubtractsElementWise)
+{
+    // Given
+
+    const SimdPack<TypeParam> lhs{SimdPack<TypeParam>::load(this->lhs.data())};
+    const SimdPack<TypeParam> rhs{SimdPack<TypeParam>::load(this->rhs.data())};
+
+    // When
+
+    (lhs - rhs).store(this->result.data());
+
+    // Then
+
+    for (std::size_t i = 0; i < this->result.size(); ++i)
+    {
+        EXPECT_EQ(this->result.at(i), this->lhs.at(i) - this->rhs.at(i));
+    }
+}
@@ -0,0 +1,309 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/densityDistribution/d3q19.hpp"
+#include "../../src/streaming/aaPattern.hpp"
+#include "../LatticeFill.hpp"
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ * Reference streaming step that propagates every population to its periodic neighbor through a
+ * second lattice.
+ */
+template <std::size_t Size, std::floating_point Scalar>
+auto streamTwoBuffer(
+    Lattice<2, Size, Scalar>& lattice,
+    const std::array<std::array<int, 2>, Size>& velocities
+) -> void
+{
+    const Lattice<2, Size, Scalar> previous{lattice};
+
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        const auto from{previous.population(i)};
+        const auto to{lattice.population(i)};
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            to[periodicNeighbor(lattice.extents(), node, velocities[i])] = from[node];
+        }
+    }
+}
+
+template <std::floating_point Scalar>
+auto population(std::size_t i, std::size_t node) -> Scalar
+{
+    return Scalar{1.0} + static_cast<Scalar>(i * 1000 + node) / 8192;
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class AAPatternTest : public ::testing::Test
+{
+private:
+    static constexpr std::array<std::size_t, 2> extents_{7, 5};
+
+protected:
+    AAPatternTest() : d2q5Lattice{extents_}, d2q9Lattice{extents_}
+    {
+        fillLattice(d2q5Lattice, population<Scalar>);
+        fillLattice(d2q9Lattice, population<Scalar>);
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    Lattice<2, 5, Scalar> d2q5Lattice;
+    Lattice<2, 9, Scalar> d2q9Lattice;
+    const Scalar relaxationFrequency{1.3};
+    const Scalar tolerance{10 * std::numeric_limits<Scalar>::epsilon()};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(AAPatternTest, FloatingPointTypes);
+
+TYPED_TEST(AAPatternTest, PeriodicNeighborWrapsAroundBoundaries)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{7, 5};
+    const std::array<int, 2> velocityBottomLeft{-1, -1};
+    const std::array<int, 2> velocityTopRight{1, 1};
+
+    // When
+
+    const std::size_t bottomLeftOfOrigin{periodicNeighbor(extents, 0, velocityBottomLeft)};
+    const std::size_t topRightOfLast{periodicNeighbor(extents, 34, velocityTopRight)};
+
+    // Then
+
+    EXPECT_EQ(bottomLeftOfOrigin, 34);
+    EXPECT_EQ(topRightOfLast, 0);
+}
+
+TYPED_TEST(AAPatternTest, D2Q9TwoStepsEqualTwoBufferStreaming)
+{
+    // Given
+
+    Lattice<2, 9, TypeParam> expected{this->d2q9Lattice};
+    const auto velocities{latticeVelocities(D2Q9<TypeParam>{})};
+
+    // When
+
+    streamAA(this->d2q9Lattice, 0);
+    streamAA(this->d2q9Lattice, 1);
+    streamTwoBuffer(expected, velocities);
+    streamTwoBuffer(expected, velocities);
+
+    // Then
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        for (std::size_t node = 0; node < expected.nodeCount(); ++node)
+        {
+            EXPECT_EQ(this->d2q9Lattice.population(i)[node], expected.population(i)[node]);
+        }
+    }
+}
+
+TYPED_TEST(AAPatternTest, D2Q5GatherAfterOddStepEqualsTwoBufferStreaming)
+{
+    // Given
+
+    Lattice<2, 5, TypeParam> expected{this->d2q5Lattice};
+    const auto velocities{latticeVelocities(D2Q5<TypeParam>{})};
+
+    // When
+
+    streamAA(this->d2q5Lattice, 0);
+    streamTwoBuffer(expected, velocities);
+
+    // Then
+
+    for (std::size_t node = 0; node < expected.nodeCount(); ++node)
+    {
+        const D2Q5<TypeParam> distribution{gatherAA(this->d2q5Lattice, node, 1)};
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(distribution[i], expected.population(i)[node]);
+        }
+    }
+}
+
+TYPED_TEST(AAPatternTest, D2Q9FusedCollisionEqualsCollideThenStream)
+{
+    // Given
+
+    Lattice<2, 9, TypeParam> expected{this->d2q9Lattice};
+    const D2Q9<TypeParam> model;
+    const auto velocities{latticeVelocities(model)};
+    const TypeParam relaxationFrequency{this->relaxationFrequency};
+    const std::size_t stepCount{5};
+
+    // When
+
+    for (std::size_t step = 0; step < stepCount; ++step)
+    {
+        streamAA(this->d2q9Lattice, step, [&](std::array<TypeParam, 9>& values) {
+            relaxBGK<D2Q9_DESCRIPTOR>(values, relaxationFrequency);
+        });
+        collideBGK(expected, relaxationFrequency);
+        streamTwoBuffer(expected, velocities);
+    }
+
+    // Then
+
+    for (std::size_t node = 0; node < expected.nodeCount(); ++node)
+    {
+        const D2Q9<TypeParam> distribution{gatherAA(this->d2q9Lattice, node, stepCount)};
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_NEAR(distribution[i], expected.population(i)[node], this->tolerance);
+        }
+    }
+}
+
+TYPED_TEST(AAPatternTest, D2Q5FusedCollisionConservesMass)
+{
+    // Given
+
+    const TypeParam relaxationFrequency{this->relaxationFrequency};
+    TypeParam expectedMass{0.0};
+    for (std::size_t node = 0; node < this->d2q5Lattice.nodeCount(); ++node)
+    {
+        expectedMass += computeDensity(this->d2q5Lattice.node(node));
+    }
+
+    // When
+
+    for (std::size_t step = 0; step < 4; ++step)
+    {
+        streamAA(this->d2q5Lattice, step, [&](std::array<TypeParam, 5>& values) {
+            relaxBGK<D2Q5_DESCRIPTOR>(values, relaxationFrequency);
+        });
+    }
+    TypeParam mass{0.0};
+    for (std::size_t node = 0; node < this->d2q5Lattice.nodeCount(); ++node)
+    {
+        mass += computeDensity(this->d2q5Lattice.node(node));
+    }
+
+    // Then
+
+    EXPECT_NEAR(mass, expectedMass, 100 * this->tolerance * expectedMass);
+}
+
+TYPED_TEST(AAPatternTest, D2Q9ParallelStepsAreBitIdenticalForAnyThreadCount)
+{
+    // Given
+
+    const TypeParam relaxationFrequency{this->relaxationFrequency};
+    const auto collision{[&](std::array<TypeParam, 9>& values) {
+        relaxBGK<D2Q9_DESCRIPTOR>(values, relaxationFrequency);
+    }};
+    const std::array<std::size_t, 2> tileExtents{3, 2};
+    const std::size_t stepCount{5};
+    Lattice<2, 9, TypeParam> expected{this->d2q9Lattice};
+    for (std::size_t step = 0; step < stepCount; ++step)
+    {
+        streamAA(expected, step, collision);
+    }
+
+    for (const std::size_t threadCount : {1, 2, 3, 4})
+    {
+        // When
+
+        TiledScheduler<2> scheduler{this->d2q9Lattice.extents(), tileExtents, threadCount};
+        Lattice<2, 9, TypeParam> lattice{this->d2q9Lattice};
+        for (std::size_t step = 0; step < stepCount; ++step)
+        {
+            streamAA(lattice, step, collision, scheduler);
+        }
+
+        // Then
+
+        for (std::size_t i = 0; i < lattice.size(); ++i)
+        {
+            for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+            {
+                EXPECT_EQ(lattice.population(i)[node], expected.population(i)[node]);
+            }
+        }
+    }
+}
+
+TYPED_TEST(AAPatternTest, D2Q5TiledStepsEqualWholeLatticeSteps)
+{
+    // Given
+
+    Lattice<2, 5, TypeParam> expected{this->d2q5Lattice};
+    const D2Q5<TypeParam> model;
+    const auto velocities{latticeVelocities(model)};
+    const auto opposites{latticeOpposites(model)};
+    const auto tiles{tileLattice(expected.extents(), {2, 3})};
+    const auto stream{[](std::array<TypeParam, 5>& values) { static_cast<void>(values); }};
+
+    // When
+
+    for (std::size_t step = 0; step < 3; ++step)
+    {
+        streamAA(expected, step);
+        for (auto tile = tiles.rbegin(); tile != tiles.rend(); ++tile)
+        {
+            streamAA(this->d2q5Lattice, velocities, opposites, step, stream, *tile);
+        }
+    }
+
+    // Then
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        for (std::size_t node = 0; node < expected.nodeCount(); ++node)
+        {
+            EXPECT_EQ(this->d2q5Lattice.population(i)[node], expected.population(i)[node]);
+        }
+    }
+}
+
+TYPED_TEST(AAPatternTest, D3Q19BlockCollisionEqualsNodeCollision)
+{
+    // Given
+
+    Lattice<3, D3Q19_SIZE, TypeParam> lattice{{STREAM_BLOCK_SIZE + 7, 3, 4}};
+    fillLattice(lattice, population<TypeParam>);
+    Lattice<3, D3Q19_SIZE, TypeParam> expected{lattice};
+    const TypeParam relaxationFrequency{this->relaxationFrequency};
+    const auto blockCollision{[&](auto& block, std::size_t count) {
+        relaxBGK<D3Q19_DESCRIPTOR>(block, count, relaxationFrequency);
+    }};
+    const auto nodeCollision{[&](std::array<TypeParam, D3Q19_SIZE>& values) {
+        relaxBGK<D3Q19_DESCRIPTOR>(values, relaxationFrequency);
+    }};
+
+    // When
+
+    for (std::size_t step = 0; step < 3; ++step)
+    {
+        streamAA(
+            lattice, D3Q19_DESCRIPTOR.velocities, D3Q19_DESCRIPTOR.opposites, step, blockCollision
+        );
+        streamAA(
+            expected, D3Q19_DESCRIPTOR.velocities, D3Q19_DESCRIPTOR.opposites, step, nodeCollision
+        );
+    }
+
+    // Then
+
+    for (std::size_t i = 0; i < D3Q19_SIZE; ++i)
+    {
+        for (std::size_t node = 0; node < lattice.nodeCount(); ++node)
+        {
+            EXPECT_NEAR(
+                lattice.population(i)[node],
+                expected.population(i)[node],
+                this->tolerance * expected.population(i)[node]
+            );
+        }
+    }
+}
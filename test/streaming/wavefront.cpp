@@ -0,0 +1,198 @@
+#include "../../src/collision/bgk.hpp"
+#include "../../src/densityDistribution/d3q19.hpp"
+#include "../../src/streaming/wavefront.hpp"
+#include "../LatticeFill.hpp"
+#include <gtest/gtest.h>
+
+namespace
+{
+
+template <std::floating_point Scalar>
+auto population(std::size_t i, std::size_t node) -> Scalar
+{
+    return Scalar{0.05} + static_cast<Scalar>((i * 37 + node * 11) % 23) / 200;
+}
+
+/**
+ * Returns a BGK collision for the lattice model of a descriptor, so that any change in the order of
+ * time steps at a node changes the result.
+ */
+template <const auto& Descriptor, std::floating_point Scalar>
+auto makeCollision(Scalar relaxationFrequency)
+{
+    return [relaxationFrequency](auto& values) {
+        relaxBGK<Descriptor>(values, relaxationFrequency);
+    };
+}
+
+template <std::size_t Dimension, std::size_t Size, std::floating_point Scalar>
+auto expectIdentical(
+    const Lattice<Dimension, Size, Scalar>& actual,
+    const Lattice<Dimension, Size, Scalar>& expected
+) -> void
+{
+    for (std::size_t i = 0; i < Size; ++i)
+    {
+        for (std::size_t node = 0; node < actual.nodeCount(); ++node)
+        {
+            EXPECT_EQ(actual.population(i)[node], expected.population(i)[node]);
+        }
+    }
+}
+
+} // namespace
+
+using FloatingPointTypes = ::testing::Types<float, double>;
+
+template <typename Scalar>
+class WavefrontTest : public ::testing::Test
+{
+protected:
+    // NOLINTBEGIN(cppcoreguidelines-non-private-member-variables-in-classes)
+    const Scalar relaxationFrequency{1.3};
+    // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
+};
+
+TYPED_TEST_SUITE(WavefrontTest, FloatingPointTypes);
+
+TYPED_TEST(WavefrontTest, D2Q9BlocksEqualPlainSteppingBitForBit)
+{
+    const auto collision{makeCollision<D2Q9_DESCRIPTOR>(this->relaxationFrequency)};
+
+    for (const std::size_t rows : {1, 2, 3, 8, 13})
+    {
+        for (const std::size_t depth : {1, 2, 3, 6})
+        {
+            for (const std::size_t bandExtent : {1, 3, 16})
+            {
+                // Given
+
+                Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> actual{{5, rows}};
+                fillLattice(actual, population<TypeParam>);
+                Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> expected{actual};
+                const std::size_t firstStep{3};
+
+                // When
+
+                for (std::size_t step = 0; step < depth; ++step)
+                {
+                    streamAA(expected, firstStep + step, collision);
+                }
+                streamWavefrontAA(actual, firstStep, depth, bandExtent, collision);
+
+                // Then
+
+                expectIdentical(actual, expected);
+            }
+        }
+    }
+}
+
+TYPED_TEST(WavefrontTest, D2Q5RepeatedBlocksEqualPlainSteppingBitForBit)
+{
+    // Given
+
+    const auto collision{makeCollision<D2Q5_DESCRIPTOR>(this->relaxationFrequency)};
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, TypeParam> actual{{6, 11}};
+    fillLattice(actual, population<TypeParam>);
+    Lattice<D2Q5_DIMENSION, D2Q5_SIZE, TypeParam> expected{actual};
+    const std::size_t blocks{3};
+    const std::size_t depth{4};
+
+    // When
+
+    for (std::size_t step = 0; step < blocks * depth; ++step)
+    {
+        streamAA(expected, step, collision);
+    }
+    for (std::size_t block = 0; block < blocks; ++block)
+    {
+        streamWavefrontAA(actual, block * depth, depth, 2, collision);
+    }
+
+    // Then
+
+    expectIdentical(actual, expected);
+}
+
+TYPED_TEST(WavefrontTest, D3Q19BlocksAdvanceAlongLastAxis)
+{
+    // Given
+
+    const D3Q19<TypeParam> model;
+    const auto collision{makeCollision<D3Q19_DESCRIPTOR>(this->relaxationFrequency)};
+    Lattice<D3Q19_DIMENSION, D3Q19_SIZE, TypeParam> actual{{4, 3, 7}};
+    fillLattice(actual, population<TypeParam>);
+    Lattice<D3Q19_DIMENSION, D3Q19_SIZE, TypeParam> expected{actual};
+    const std::size_t depth{5};
+
+    // When
+
+    for (std::size_t step = 0; step < depth; ++step)
+    {
+        streamAA(expected, latticeVelocities(model), latticeOpposites(model), step, collision);
+    }
+    streamWavefrontAA(
+        actual, latticeVelocities(model), latticeOpposites(model), 0, depth, 2, collision
+    );
+
+    // Then
+
+    expectIdentical(actual, expected);
+}
+
+TYPED_TEST(WavefrontTest, ZeroDepthLeavesLatticeUnchanged)
+{
+    // Given
+
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> actual{{5, 4}};
+    fillLattice(actual, population<TypeParam>);
+    const Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> expected{actual};
+
+    // When
+
+    streamWavefrontAA(actual, 0, 0, 2, makeCollision<D2Q9_DESCRIPTOR>(this->relaxationFrequency));
+
+    // Then
+
+    expectIdentical(actual, expected);
+}
+
+TYPED_TEST(WavefrontTest, ZeroBandExtentThrows)
+{
+    // Given
+
+    Lattice<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam> lattice{{5, 4}};
+
+    // Then
+
+    EXPECT_THROW(
+        streamWavefrontAA(
+            lattice, 0, 2, 0, makeCollision<D2Q9_DESCRIPTOR>(this->relaxationFrequency)
+        ),
+        std::invalid_argument
+    );
+}
+
+TYPED_TEST(WavefrontTest, DefaultExtentFitsCacheBudget)
+{
+    // Given
+
+    const std::array<std::size_t, 2> extents{256, 1024};
+    const std::size_t depth{4};
+
+    // When
+
+    const std::size_t bandExtent{
+        defaultWavefrontExtent<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam>(extents, depth)
+    };
+
+    // Then
+
+    const std::size_t layerBytes{extents[0] * D2Q9_SIZE * sizeof(TypeParam)};
+    EXPECT_GE(bandExtent, 1);
+    EXPECT_LE((bandExtent + depth + 2) * layerBytes, TILE_CACHE_SIZE);
+    EXPECT_EQ(
+        (defaultWavefrontExtent<D2Q9_DIMENSION, D2Q9_SIZE, TypeParam>({1 << 20, 4}, depth)), 1
+    );
+}